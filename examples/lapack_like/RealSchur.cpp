@@ -21,10 +21,13 @@ main( int argc, char* argv[] )
         const Int matType = Input("--matType","0: uniform, 1: Haar",0);
         const Int n = Input("--size","height of matrix",100);
         const bool fullTriangle = Input("--fullTriangle","full Schur?",true);
-#ifdef EL_HAVE_SCALAPACK
+        const bool useSDC = Input("--useSDC","use Spectral D&C?",false);
         // QR algorithm options
-        const bool aed = Input("--aed","use Agg. Early Deflat.?",false);
-#else
+        const bool scalapack =
+          Input("--scalapack","use ScaLAPACK's QR algorithm?",false);
+        const bool aed = Input("--aed","ScaLAPACK's dist. AED?",false);
+        const Int minMultiBulgeSize =
+          Input("--minMultiBulgeSize","max size of LAPACK blocks",256);
         // Spectral Divide and Conquer options
         const Int cutoff = Input("--cutoff","cutoff for QR alg.",256);
         const Int maxInnerIts = Input("--maxInnerIts","maximum RURV its",2);
@@ -34,7 +37,6 @@ main( int argc, char* argv[] )
         const Real spreadFactor = Input("--spreadFactor","median pert.",1e-6);
         const bool random = Input("--random","random RRQR?",true);
         const bool progress = Input("--progress","output progress?",false);
-#endif
         const bool display = Input("--display","display matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -50,11 +52,10 @@ main( int argc, char* argv[] )
         DistMatrix<Real> T( A ), Q;
         DistMatrix<Complex<Real>,VR,STAR> w;
         SchurCtrl<Real> ctrl;
-#ifdef EL_HAVE_SCALAPACK
+        ctrl.qrCtrl.scalapack = scalapack;
         ctrl.qrCtrl.distAED = aed;
-        // TODO: distribution block size
-#else
-        ctrl.useSDC = true;
+        ctrl.qrCtrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.useSDC = useSDC;
         ctrl.sdcCtrl.cutoff = cutoff;
         ctrl.sdcCtrl.maxInnerIts = maxInnerIts;
         ctrl.sdcCtrl.maxOuterIts = maxOuterIts;
@@ -64,7 +65,6 @@ main( int argc, char* argv[] )
         ctrl.sdcCtrl.progress = progress;
         ctrl.sdcCtrl.signCtrl.tol = signTol;
         ctrl.sdcCtrl.signCtrl.progress = progress;
-#endif
         Schur( T, w, Q, fullTriangle, ctrl );
         MakeTrapezoidal( UPPER, T, -1 );
         if( display )
@@ -23,11 +23,16 @@ main( int argc, char* argv[] )
         const Int matType = Input("--matType","0: uniform, 1: Haar",0);
         const Int n = Input("--size","height of matrix",100);
         const bool fullTriangle = Input("--fullTriangle","full Schur?",true);
-#ifdef EL_HAVE_SCALAPACK
-        // QR algorithm options (none so far)
-        // TODO: whether or not to use AED
-        // TODO: distribution block size
-#else
+        const bool useSDC = Input("--useSDC","use Spectral D&C?",false);
+        // QR algorithm options
+        const bool scalapack =
+          Input("--scalapack","use ScaLAPACK's QR algorithm?",false);
+        const Int minMultiBulgeSize =
+          Input("--minMultiBulgeSize","max size of LAPACK blocks",256);
+        const Int numShifts =
+          Input("--numShifts","shifts per sweep (0=auto)",0);
+        const Int deflationSize =
+          Input("--deflationSize","AED window size (0=auto)",0);
         // Spectral Divide and Conquer options
         const Int cutoff = Input("--cutoff","cutoff for QR alg.",256);
         const Int maxInnerIts = Input("--maxInnerIts","maximum RURV its",2);
@@ -37,7 +42,6 @@ main( int argc, char* argv[] )
         const Real spreadFactor = Input("--spreadFactor","median pert.",1e-6);
         const bool random = Input("--random","random RRQR?",true);
         const bool progress = Input("--progress","output progress?",false);
-#endif
         const bool display = Input("--display","display matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -54,12 +58,11 @@ main( int argc, char* argv[] )
         DistMatrix<C> T( A ), Q(g);
         DistMatrix<C,VR,STAR> w(g);
         SchurCtrl<Real> ctrl;
-#ifdef EL_HAVE_SCALAPACK
-        //ctrl.qrCtrl.blockHeight = nbDist;
-        //ctrl.qrCtrl.blockWidth = nbDist;
-        ctrl.qrCtrl.distAED = false;
-#else
-        ctrl.useSDC = true;
+        ctrl.qrCtrl.scalapack = scalapack;
+        ctrl.qrCtrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.qrCtrl.numShifts = numShifts;
+        ctrl.qrCtrl.deflationSize = deflationSize;
+        ctrl.useSDC = useSDC;
         ctrl.sdcCtrl.cutoff = cutoff;
         ctrl.sdcCtrl.maxInnerIts = maxInnerIts;
         ctrl.sdcCtrl.maxOuterIts = maxOuterIts;
@@ -69,7 +72,6 @@ main( int argc, char* argv[] )
         ctrl.sdcCtrl.progress = progress;
         ctrl.sdcCtrl.signCtrl.tol = signTol;
         ctrl.sdcCtrl.signCtrl.progress = progress;
-#endif
         Schur( T, w, Q, fullTriangle, ctrl );
         MakeTrapezoidal( UPPER, T );
 
@@ -897,6 +897,8 @@ CReflect( const HermitianTridiagCtrl<F>& ctrl )
     ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.order = CReflect(ctrl.order);
     ctrlC.symvCtrl = CReflect(ctrl.symvCtrl);
+    ctrlC.twoStage = ctrl.twoStage;
+    ctrlC.bandwidth = ctrl.bandwidth;
     return ctrlC;
 }
 
@@ -908,6 +910,8 @@ CReflect( const ElHermitianTridiagCtrl& ctrlC )
     ctrl.approach = CReflect(ctrlC.approach);
     ctrl.order = CReflect(ctrlC.order);
     ctrl.symvCtrl = CReflect<F>(ctrlC.symvCtrl);
+    ctrl.twoStage = ctrlC.twoStage;
+    ctrl.bandwidth = ctrlC.bandwidth;
     return ctrl;
 }
 
@@ -968,6 +972,33 @@ inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
     return ctrl;
 }
 
+/* HermitianDCCtrl */
+inline ElHermitianDCCtrl_s CReflect( const HermitianDCCtrl<float>& ctrl )
+{
+    ElHermitianDCCtrl_s ctrlC;
+    ctrlC.cutoff = ctrl.cutoff;
+    return ctrlC;
+}
+inline ElHermitianDCCtrl_d CReflect( const HermitianDCCtrl<double>& ctrl )
+{
+    ElHermitianDCCtrl_d ctrlC;
+    ctrlC.cutoff = ctrl.cutoff;
+    return ctrlC;
+}
+
+inline HermitianDCCtrl<float> CReflect( const ElHermitianDCCtrl_s& ctrlC )
+{
+    HermitianDCCtrl<float> ctrl;
+    ctrl.cutoff = ctrlC.cutoff;
+    return ctrl;
+}
+inline HermitianDCCtrl<double> CReflect( const ElHermitianDCCtrl_d& ctrlC )
+{
+    HermitianDCCtrl<double> ctrl;
+    ctrl.cutoff = ctrlC.cutoff;
+    return ctrl;
+}
+
 /* HermitianEigSubset */
 inline ElHermitianEigSubset_s CReflect
 ( const HermitianEigSubset<float>& subset )
@@ -1025,7 +1056,9 @@ inline ElHermitianEigCtrl_s CReflect( const HermitianEigCtrl<float>& ctrl )
     ElHermitianEigCtrl_s ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.dcCtrl = CReflect( ctrl.dcCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useDC = ctrl.useDC;
     return ctrlC;
 }
 
@@ -1034,7 +1067,9 @@ inline ElHermitianEigCtrl_d CReflect( const HermitianEigCtrl<double>& ctrl )
     ElHermitianEigCtrl_d ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.dcCtrl = CReflect( ctrl.dcCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useDC = ctrl.useDC;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_c 
@@ -1043,7 +1078,9 @@ CReflect( const HermitianEigCtrl<Complex<float>>& ctrl )
     ElHermitianEigCtrl_c ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.dcCtrl = CReflect( ctrl.dcCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useDC = ctrl.useDC;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_z
@@ -1052,7 +1089,9 @@ CReflect( const HermitianEigCtrl<Complex<double>>& ctrl )
     ElHermitianEigCtrl_z ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
+    ctrlC.dcCtrl = CReflect( ctrl.dcCtrl );
     ctrlC.useSDC = ctrl.useSDC;
+    ctrlC.useDC = ctrl.useDC;
     return ctrlC;
 }
 
@@ -1061,7 +1100,9 @@ inline HermitianEigCtrl<float> CReflect( const ElHermitianEigCtrl_s& ctrlC )
     HermitianEigCtrl<float> ctrl;
     ctrl.tridiagCtrl = CReflect<float>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.dcCtrl = CReflect( ctrlC.dcCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useDC = ctrlC.useDC;
     return ctrl;
 }
 inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
@@ -1069,7 +1110,9 @@ inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
     HermitianEigCtrl<double> ctrl;
     ctrl.tridiagCtrl = CReflect<double>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.dcCtrl = CReflect( ctrlC.dcCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useDC = ctrlC.useDC;
     return ctrl;
 }
 inline HermitianEigCtrl<Complex<float>> 
@@ -1078,7 +1121,9 @@ CReflect( const ElHermitianEigCtrl_c& ctrlC )
     HermitianEigCtrl<Complex<float>> ctrl;
     ctrl.tridiagCtrl = CReflect<Complex<float>>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.dcCtrl = CReflect( ctrlC.dcCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useDC = ctrlC.useDC;
     return ctrl;
 }
 inline HermitianEigCtrl<Complex<double>> 
@@ -1087,7 +1132,9 @@ CReflect( const ElHermitianEigCtrl_z& ctrlC )
     HermitianEigCtrl<Complex<double>> ctrl;
     ctrl.tridiagCtrl = CReflect<Complex<double>>( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
+    ctrl.dcCtrl = CReflect( ctrlC.dcCtrl );
     ctrl.useSDC = ctrlC.useSDC;
+    ctrl.useDC = ctrlC.useDC;
     return ctrl;
 }
 
@@ -1168,6 +1215,10 @@ inline ElHessQRCtrl CReflect( const HessQRCtrl& ctrl )
     ctrlC.distAED = ctrl.distAED;
     ctrlC.blockHeight = ctrl.blockHeight;
     ctrlC.blockWidth = ctrl.blockWidth;
+    ctrlC.scalapack = ctrl.scalapack;
+    ctrlC.minMultiBulgeSize = ctrl.minMultiBulgeSize;
+    ctrlC.numShifts = ctrl.numShifts;
+    ctrlC.deflationSize = ctrl.deflationSize;
     return ctrlC;
 }
 
@@ -1177,6 +1228,10 @@ inline HessQRCtrl CReflect( const ElHessQRCtrl& ctrlC )
     ctrl.distAED = ctrlC.distAED;
     ctrl.blockHeight = ctrlC.blockHeight;
     ctrl.blockWidth = ctrlC.blockWidth;
+    ctrl.scalapack = ctrlC.scalapack;
+    ctrl.minMultiBulgeSize = ctrlC.minMultiBulgeSize;
+    ctrl.numShifts = ctrlC.numShifts;
+    ctrl.deflationSize = ctrlC.deflationSize;
     return ctrl;
 }
 
@@ -1398,52 +1453,56 @@ inline ElRegSolveAlg CReflect( RegSolveAlg alg )
 inline ElRegSolveCtrl_s CReflect( const RegSolveCtrl<float>& ctrl )
 {
     ElRegSolveCtrl_s ctrlC;
-    ctrlC.alg          = CReflect(ctrl.alg);
-    ctrlC.relTol       = ctrl.relTol;
-    ctrlC.relTolRefine = ctrl.relTolRefine;
-    ctrlC.maxRefineIts = ctrl.maxRefineIts;
-    ctrlC.restart      = ctrl.restart;
-    ctrlC.progress     = ctrl.progress;
-    ctrlC.time         = ctrl.time;
+    ctrlC.alg            = CReflect(ctrl.alg);
+    ctrlC.mixedPrecision = ctrl.mixedPrecision;
+    ctrlC.relTol         = ctrl.relTol;
+    ctrlC.relTolRefine   = ctrl.relTolRefine;
+    ctrlC.maxRefineIts   = ctrl.maxRefineIts;
+    ctrlC.restart        = ctrl.restart;
+    ctrlC.progress       = ctrl.progress;
+    ctrlC.time           = ctrl.time;
     return ctrlC;
 }
 
 inline ElRegSolveCtrl_d CReflect( const RegSolveCtrl<double>& ctrl )
 {
     ElRegSolveCtrl_d ctrlC;
-    ctrlC.alg          = CReflect(ctrl.alg);
-    ctrlC.relTol       = ctrl.relTol;
-    ctrlC.relTolRefine = ctrl.relTolRefine;
-    ctrlC.maxRefineIts = ctrl.maxRefineIts;
-    ctrlC.restart      = ctrl.restart;
-    ctrlC.progress     = ctrl.progress;
-    ctrlC.time         = ctrl.time;
+    ctrlC.alg            = CReflect(ctrl.alg);
+    ctrlC.mixedPrecision = ctrl.mixedPrecision;
+    ctrlC.relTol         = ctrl.relTol;
+    ctrlC.relTolRefine   = ctrl.relTolRefine;
+    ctrlC.maxRefineIts   = ctrl.maxRefineIts;
+    ctrlC.restart        = ctrl.restart;
+    ctrlC.progress       = ctrl.progress;
+    ctrlC.time           = ctrl.time;
     return ctrlC;
 }
 
 inline RegSolveCtrl<float> CReflect( const ElRegSolveCtrl_s& ctrlC )
 {
     RegSolveCtrl<float> ctrl;
-    ctrl.alg          = CReflect(ctrlC.alg);
-    ctrl.relTol       = ctrlC.relTol;
-    ctrl.relTolRefine = ctrlC.relTolRefine;
-    ctrl.maxRefineIts = ctrlC.maxRefineIts;
-    ctrl.restart      = ctrlC.restart;
-    ctrl.progress     = ctrlC.progress;
-    ctrl.time         = ctrlC.time;
+    ctrl.alg            = CReflect(ctrlC.alg);
+    ctrl.mixedPrecision = ctrlC.mixedPrecision;
+    ctrl.relTol         = ctrlC.relTol;
+    ctrl.relTolRefine   = ctrlC.relTolRefine;
+    ctrl.maxRefineIts   = ctrlC.maxRefineIts;
+    ctrl.restart        = ctrlC.restart;
+    ctrl.progress       = ctrlC.progress;
+    ctrl.time           = ctrlC.time;
     return ctrl;
 }
 
 inline RegSolveCtrl<double> CReflect( const ElRegSolveCtrl_d& ctrlC )
 {
     RegSolveCtrl<double> ctrl;
-    ctrl.alg          = CReflect(ctrlC.alg);
-    ctrl.relTol       = ctrlC.relTol;
-    ctrl.relTolRefine = ctrlC.relTolRefine;
-    ctrl.maxRefineIts = ctrlC.maxRefineIts;
-    ctrl.restart      = ctrlC.restart;
-    ctrl.progress     = ctrlC.progress;
-    ctrl.time         = ctrlC.time;
+    ctrl.alg            = CReflect(ctrlC.alg);
+    ctrl.mixedPrecision = ctrlC.mixedPrecision;
+    ctrl.relTol         = ctrlC.relTol;
+    ctrl.relTolRefine   = ctrlC.relTolRefine;
+    ctrl.maxRefineIts   = ctrlC.maxRefineIts;
+    ctrl.restart        = ctrlC.restart;
+    ctrl.progress       = ctrlC.progress;
+    ctrl.time           = ctrlC.time;
     return ctrl;
 }
 
@@ -1688,6 +1747,51 @@ inline KKTSystem CReflect( ElKKTSystem system )
 
 /* Mehrotra's Predictor-Corrector IPM
    ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+inline ElGondzioCtrl_s CReflect( const GondzioCtrl<float>& ctrl )
+{
+    ElGondzioCtrl_s ctrlC;
+    ctrlC.maxCorrectors  = ctrl.maxCorrectors;
+    ctrlC.adaptive       = ctrl.adaptive;
+    ctrlC.stepIncrease   = ctrl.stepIncrease;
+    ctrlC.minImprovement = ctrl.minImprovement;
+    ctrlC.betaMin        = ctrl.betaMin;
+    ctrlC.betaMax        = ctrl.betaMax;
+    return ctrlC;
+}
+inline ElGondzioCtrl_d CReflect( const GondzioCtrl<double>& ctrl )
+{
+    ElGondzioCtrl_d ctrlC;
+    ctrlC.maxCorrectors  = ctrl.maxCorrectors;
+    ctrlC.adaptive       = ctrl.adaptive;
+    ctrlC.stepIncrease   = ctrl.stepIncrease;
+    ctrlC.minImprovement = ctrl.minImprovement;
+    ctrlC.betaMin        = ctrl.betaMin;
+    ctrlC.betaMax        = ctrl.betaMax;
+    return ctrlC;
+}
+inline GondzioCtrl<float> CReflect( const ElGondzioCtrl_s& ctrlC )
+{
+    GondzioCtrl<float> ctrl;
+    ctrl.maxCorrectors  = ctrlC.maxCorrectors;
+    ctrl.adaptive       = ctrlC.adaptive;
+    ctrl.stepIncrease   = ctrlC.stepIncrease;
+    ctrl.minImprovement = ctrlC.minImprovement;
+    ctrl.betaMin        = ctrlC.betaMin;
+    ctrl.betaMax        = ctrlC.betaMax;
+    return ctrl;
+}
+inline GondzioCtrl<double> CReflect( const ElGondzioCtrl_d& ctrlC )
+{
+    GondzioCtrl<double> ctrl;
+    ctrl.maxCorrectors  = ctrlC.maxCorrectors;
+    ctrl.adaptive       = ctrlC.adaptive;
+    ctrl.stepIncrease   = ctrlC.stepIncrease;
+    ctrl.minImprovement = ctrlC.minImprovement;
+    ctrl.betaMin        = ctrlC.betaMin;
+    ctrl.betaMax        = ctrlC.betaMax;
+    return ctrl;
+}
+
 inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
 {
     ElMehrotraCtrl_s ctrlC;
@@ -1699,6 +1803,7 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.gondzioCtrl   = CReflect(ctrl.gondzioCtrl);
     ctrlC.forceSameStep = ctrl.forceSameStep;
     ctrlC.solveCtrl     = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg    = ctrl.resolveReg;
@@ -1725,6 +1830,7 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.gondzioCtrl   = CReflect(ctrl.gondzioCtrl);
     ctrlC.forceSameStep = ctrl.forceSameStep;
     ctrlC.solveCtrl     = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg    = ctrl.resolveReg;
@@ -1751,6 +1857,7 @@ inline MehrotraCtrl<float> CReflect( ElMehrotraCtrl_s ctrlC )
     ctrl.maxStepRatio  = ctrlC.maxStepRatio;
     ctrl.system        = CReflect(ctrlC.system);
     ctrl.mehrotra      = ctrlC.mehrotra;
+    ctrl.gondzioCtrl   = CReflect(ctrlC.gondzioCtrl);
     ctrl.forceSameStep = ctrlC.forceSameStep;
     ctrl.solveCtrl     = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg    = ctrlC.resolveReg;
@@ -1777,6 +1884,7 @@ inline MehrotraCtrl<double> CReflect( ElMehrotraCtrl_d ctrlC )
     ctrl.maxStepRatio  = ctrlC.maxStepRatio;
     ctrl.system        = CReflect(ctrlC.system);
     ctrl.mehrotra      = ctrlC.mehrotra;
+    ctrl.gondzioCtrl   = CReflect(ctrlC.gondzioCtrl);
     ctrl.forceSameStep = ctrlC.forceSameStep;
     ctrl.solveCtrl     = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg    = ctrlC.resolveReg;
@@ -24,7 +24,9 @@ typedef enum {
   EL_GEMM_SUMMA_B,
   EL_GEMM_SUMMA_C,
   EL_GEMM_SUMMA_DOT,
-  EL_GEMM_CANNON
+  EL_GEMM_CANNON,
+  EL_GEMM_25D,
+  EL_GEMM_AUTO
 } ElGemmAlgorithm;
 
 EL_EXPORT ElError ElGemm_i
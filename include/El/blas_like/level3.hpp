@@ -21,11 +21,40 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_25D,
+  GEMM_AUTO
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of layers the process grid is split into by GEMM_25D; a value
+// of zero selects the largest divisor c of the number of processes, p, such
+// that c^3 <= p
+Int GemmReplicationFactor();
+void SetGemmReplicationFactor( Int replicationFactor );
+
+// GEMM_AUTO chooses among the SUMMA variants and Cannon's algorithm, as well
+// as the algorithmic blocksize, by minimizing a latency/bandwidth/flop cost
+// model. The model is calibrated by a short micro-benchmark the first time a
+// grid of a given shape is used and, if a tuning file was set, is read from
+// (or appended to) that file. GemmCalibration is collective over the grid.
+struct GemmCostModel
+{
+    double latency;          // seconds per message
+    double inverseBandwidth; // seconds per byte
+    double flopTime;         // seconds per flop of a wide local Gemm
+    double panelFlopTime;    // extra seconds per flop times the panel width
+};
+
+void SetGemmTuningFile( const string& filename );
+const GemmCostModel& GemmCalibration( const Grid& g );
+
+template<typename T>
+GemmAlgorithm TunedGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& g, Int& blocksize );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -78,6 +78,7 @@
 #include "El/core/environment/decl.hpp"
 
 #include "El/core/Timer.hpp"
+#include "El/core/Profile.hpp"
 #include "El/core/indexing/decl.hpp"
 #include "El/core/imports/blas.hpp"
 #include "El/core/imports/lapack.hpp"
@@ -23,6 +23,14 @@ struct DistSparseMultMeta
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
+    // The processes (other than this one) which this process sends to and
+    // receives from during a normal multiply
+    vector<int> sendRanks, recvRanks;
+
+    // The local entries of local row i whose columns are owned by this
+    // process lie within [diagBegs[i],diagEnds[i])
+    vector<Int> diagBegs, diagEnds;
+
     DistSparseMultMeta() : ready(false), numRecvInds(0) { }
 
     void Clear()
@@ -35,6 +43,10 @@ struct DistSparseMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( sendRanks );
+        SwapClear( recvRanks );
+        SwapClear( diagBegs );
+        SwapClear( diagEnds );
     }
 
     const DistSparseMultMeta& operator=( const DistSparseMultMeta& meta )
@@ -47,10 +59,37 @@ struct DistSparseMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        sendRanks = meta.sendRanks;
+        recvRanks = meta.recvRanks;
+        diagBegs = meta.diagBegs;
+        diagEnds = meta.diagEnds;
         return *this;
     }
 };
 
+// The workspace retained between multiplications with a DistSparseMatrix so
+// that repeated products with a fixed sparsity pattern (e.g., within Krylov
+// methods) do not reallocate their communication buffers
+template<typename T>
+struct DistSparseMultPlan
+{
+    Memory<T> sendVals, recvVals;
+    vector<mpi::Request> requests;
+
+    DistSparseMultPlan() { }
+    // The workspace is never copied
+    DistSparseMultPlan( const DistSparseMultPlan<T>& ) { }
+    const DistSparseMultPlan<T>& operator=( const DistSparseMultPlan<T>& )
+    { return *this; }
+
+    void Clear()
+    {
+        sendVals.Empty();
+        recvVals.Empty();
+        SwapClear( requests );
+    }
+};
+
 // Use a simple 1d distribution where each process owns a fixed number of rows,
 //     if last process,  height - (commSize-1)*floor(height/commSize)
 //     otherwise,        floor(height/commSize)
@@ -194,6 +233,7 @@ public:
     double Imbalance() const EL_NO_RELEASE_EXCEPT;
 
     mutable DistSparseMultMeta multMeta;
+    mutable DistSparseMultPlan<T> multPlan;
     DistSparseMultMeta InitializeMultMeta() const;
 
     void MappedSources
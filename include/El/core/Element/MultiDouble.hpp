@@ -0,0 +1,1286 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_ELEMENT_MULTIDOUBLE_HPP
+#define EL_ELEMENT_MULTIDOUBLE_HPP
+
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Double-double and quad-double arithmetic, i.e., the representation of a
+// real number as the unevaluated sum of two (resp. four) nonoverlapping IEEE
+// doubles, which yields roughly 32 (resp. 64) decimal digits of precision.
+// The algorithms follow
+//
+//   Yozo Hida, Xiaoye S. Li, and David H. Bailey,
+//   "Algorithms for quad-double precision floating point arithmetic",
+//   15th IEEE Symposium on Computer Arithmetic, pp. 155--162, 2001,
+//
+// and are built entirely from the error-free transformations of Knuth and
+// Dekker, so that, unlike Quad (i.e., __float128), each operation maps onto a
+// short, branch-free sequence of hardware double-precision instructions.
+//
+// NOTE: The error-free transformations assume strict IEEE double-precision
+//       arithmetic and are silently broken by, e.g., -ffast-math or x87
+//       extended-precision registers.
+
+namespace El {
+
+struct DoubleDouble;
+struct QuadDouble;
+
+namespace multi_double {
+
+// Error-free transformations
+// ==========================
+
+// s + err = a + b, assuming that |a| >= |b|
+inline double QuickTwoSum( double a, double b, double& err )
+{
+    const double s = a + b;
+    err = b - (s-a);
+    return s;
+}
+
+// s + err = a + b
+inline double TwoSum( double a, double b, double& err )
+{
+    const double s = a + b;
+    const double bb = s - a;
+    err = (a-(s-bb)) + (b-bb);
+    return s;
+}
+
+// s + err = a - b
+inline double TwoDiff( double a, double b, double& err )
+{
+    const double s = a - b;
+    const double bb = s - a;
+    err = (a-(s-bb)) - (b+bb);
+    return s;
+}
+
+#ifndef FP_FAST_FMA
+// hi + lo = a, where both hi and lo have at most 26 significant bits
+inline void Split( double a, double& hi, double& lo )
+{
+    const double splitter = 134217729.;             // 2^27+1
+    const double splitThresh = 6.69692879491417e+299; // 2^996
+    if( a > splitThresh || a < -splitThresh )
+    {
+        a *= 3.7252902984619140625e-09;  // 2^-28
+        const double temp = splitter*a;
+        hi = temp - (temp-a);
+        lo = a - hi;
+        hi *= 268435456.; // 2^28
+        lo *= 268435456.;
+    }
+    else
+    {
+        const double temp = splitter*a;
+        hi = temp - (temp-a);
+        lo = a - hi;
+    }
+}
+#endif
+
+// p + err = a b
+inline double TwoProd( double a, double b, double& err )
+{
+    const double p = a*b;
+#ifdef FP_FAST_FMA
+    err = std::fma( a, b, -p );
+#else
+    double aHi, aLo, bHi, bLo;
+    Split( a, aHi, aLo );
+    Split( b, bHi, bLo );
+    err = ((aHi*bHi-p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+    return p;
+}
+
+// (a,b,c) <- an exact rearrangement of a+b+c with the largest term first
+inline void ThreeSum( double& a, double& b, double& c )
+{
+    double t1, t2, t3;
+    t1 = TwoSum( a, b, t2 );
+    a = TwoSum( c, t1, t3 );
+    b = TwoSum( t2, t3, c );
+}
+
+// (a,b) <- a rearrangement of a+b+c which only keeps two terms
+inline void ThreeSum2( double& a, double& b, double c )
+{
+    double t1, t2, t3;
+    t1 = TwoSum( a, b, t2 );
+    a = TwoSum( c, t1, t3 );
+    b = t2 + t3;
+}
+
+// Renormalize a (possibly overlapping) expansion into four nonoverlapping
+// components
+inline void Renormalize( double& c0, double& c1, double& c2, double& c3 )
+{
+    if( std::isinf(c0) )
+        return;
+
+    double s0, s1, s2=0, s3=0;
+    s0 = QuickTwoSum( c2, c3, c3 );
+    s0 = QuickTwoSum( c1, s0, c2 );
+    c0 = QuickTwoSum( c0, s0, c1 );
+
+    s0 = c0;
+    s1 = c1;
+    if( s1 != 0. )
+    {
+        s1 = QuickTwoSum( s1, c2, s2 );
+        if( s2 != 0. )
+            s2 = QuickTwoSum( s2, c3, s3 );
+        else
+            s1 = QuickTwoSum( s1, c3, s2 );
+    }
+    else
+    {
+        s0 = QuickTwoSum( s0, c2, s1 );
+        if( s1 != 0. )
+            s1 = QuickTwoSum( s1, c3, s2 );
+        else
+            s0 = QuickTwoSum( s0, c3, s1 );
+    }
+    c0 = s0; c1 = s1; c2 = s2; c3 = s3;
+}
+
+inline void Renormalize
+( double& c0, double& c1, double& c2, double& c3, double& c4 )
+{
+    if( std::isinf(c0) )
+        return;
+
+    double s0, s1, s2=0, s3=0;
+    s0 = QuickTwoSum( c3, c4, c4 );
+    s0 = QuickTwoSum( c2, s0, c3 );
+    s0 = QuickTwoSum( c1, s0, c2 );
+    c0 = QuickTwoSum( c0, s0, c1 );
+
+    s0 = c0;
+    s1 = c1;
+    if( s1 != 0. )
+    {
+        s1 = QuickTwoSum( s1, c2, s2 );
+        if( s2 != 0. )
+        {
+            s2 = QuickTwoSum( s2, c3, s3 );
+            if( s3 != 0. )
+                s3 += c4;
+            else
+                s2 = QuickTwoSum( s2, c4, s3 );
+        }
+        else
+        {
+            s1 = QuickTwoSum( s1, c3, s2 );
+            if( s2 != 0. )
+                s2 = QuickTwoSum( s2, c4, s3 );
+            else
+                s1 = QuickTwoSum( s1, c4, s2 );
+        }
+    }
+    else
+    {
+        s0 = QuickTwoSum( s0, c2, s1 );
+        if( s1 != 0. )
+        {
+            s1 = QuickTwoSum( s1, c3, s2 );
+            if( s2 != 0. )
+                s2 = QuickTwoSum( s2, c4, s3 );
+            else
+                s1 = QuickTwoSum( s1, c4, s2 );
+        }
+        else
+        {
+            s0 = QuickTwoSum( s0, c3, s1 );
+            if( s1 != 0. )
+                s1 = QuickTwoSum( s1, c4, s2 );
+            else
+                s0 = QuickTwoSum( s0, c4, s1 );
+        }
+    }
+    c0 = s0; c1 = s1; c2 = s2; c3 = s3;
+}
+
+} // namespace multi_double
+
+// Double-double
+// =============
+struct DoubleDouble
+{
+    // The value is x[0]+x[1], with |x[1]| <= ulp(x[0])/2
+    double x[2];
+
+    DoubleDouble() = default;
+    constexpr DoubleDouble( double alpha ) : x{alpha,0.} { }
+    constexpr DoubleDouble( double hi, double lo ) : x{hi,lo} { }
+    // Integers with more than 53 bits are split over both components
+    template<typename T,
+             typename=typename std::enable_if<std::is_integral<T>::value>::type>
+    DoubleDouble( T alpha )
+    {
+        x[0] = double(alpha);
+        x[1] = ( std::abs(x[0]) < 9.2233720368547758e18 ?
+                 double(alpha-T(x[0])) : 0. );
+    }
+
+    explicit operator double() const { return x[0]; }
+    explicit operator float() const { return float(x[0]); }
+    // Truncate towards zero
+    template<typename T,
+             typename=typename std::enable_if<std::is_integral<T>::value>::type>
+    explicit operator T() const;
+
+    DoubleDouble& operator+=( const DoubleDouble& alpha );
+    DoubleDouble& operator+=( double alpha );
+    DoubleDouble& operator-=( const DoubleDouble& alpha );
+    DoubleDouble& operator-=( double alpha );
+    DoubleDouble& operator*=( const DoubleDouble& alpha );
+    DoubleDouble& operator*=( double alpha );
+    DoubleDouble& operator/=( const DoubleDouble& alpha );
+    DoubleDouble& operator/=( double alpha );
+};
+
+inline DoubleDouble operator+( const DoubleDouble& a )
+{ return a; }
+inline DoubleDouble operator-( const DoubleDouble& a )
+{ return DoubleDouble(-a.x[0],-a.x[1]); }
+
+inline DoubleDouble operator+( const DoubleDouble& a, const DoubleDouble& b )
+{
+    using namespace multi_double;
+    double s2, t2;
+    double s1 = TwoSum( a.x[0], b.x[0], s2 );
+    const double t1 = TwoSum( a.x[1], b.x[1], t2 );
+    s2 += t1;
+    s1 = QuickTwoSum( s1, s2, s2 );
+    s2 += t2;
+    s1 = QuickTwoSum( s1, s2, s2 );
+    return DoubleDouble(s1,s2);
+}
+inline DoubleDouble operator+( const DoubleDouble& a, double b )
+{
+    using namespace multi_double;
+    double s2;
+    double s1 = TwoSum( a.x[0], b, s2 );
+    s2 += a.x[1];
+    s1 = QuickTwoSum( s1, s2, s2 );
+    return DoubleDouble(s1,s2);
+}
+inline DoubleDouble operator+( double a, const DoubleDouble& b )
+{ return b + a; }
+
+inline DoubleDouble operator-( const DoubleDouble& a, const DoubleDouble& b )
+{ return a + (-b); }
+inline DoubleDouble operator-( const DoubleDouble& a, double b )
+{ return a + (-b); }
+inline DoubleDouble operator-( double a, const DoubleDouble& b )
+{ return (-b) + a; }
+
+inline DoubleDouble operator*( const DoubleDouble& a, const DoubleDouble& b )
+{
+    using namespace multi_double;
+    double p2;
+    double p1 = TwoProd( a.x[0], b.x[0], p2 );
+    p2 += a.x[0]*b.x[1] + a.x[1]*b.x[0];
+    p1 = QuickTwoSum( p1, p2, p2 );
+    return DoubleDouble(p1,p2);
+}
+inline DoubleDouble operator*( const DoubleDouble& a, double b )
+{
+    using namespace multi_double;
+    double p2;
+    double p1 = TwoProd( a.x[0], b, p2 );
+    p2 += a.x[1]*b;
+    p1 = QuickTwoSum( p1, p2, p2 );
+    return DoubleDouble(p1,p2);
+}
+inline DoubleDouble operator*( double a, const DoubleDouble& b )
+{ return b*a; }
+
+inline DoubleDouble operator/( const DoubleDouble& a, double b )
+{
+    using namespace multi_double;
+    const double q1 = a.x[0] / b;
+
+    // Compute a - q1 b
+    double p2, e;
+    const double p1 = TwoProd( q1, b, p2 );
+    const double s = TwoDiff( a.x[0], p1, e );
+    e += a.x[1];
+    e -= p2;
+
+    double q2 = (s+e) / b;
+    const double q = QuickTwoSum( q1, q2, q2 );
+    return DoubleDouble(q,q2);
+}
+inline DoubleDouble operator/( const DoubleDouble& a, const DoubleDouble& b )
+{
+    using namespace multi_double;
+    double q1 = a.x[0] / b.x[0];
+    DoubleDouble r = a - b*q1;
+    double q2 = r.x[0] / b.x[0];
+    r -= b*q2;
+    const double q3 = r.x[0] / b.x[0];
+    q1 = QuickTwoSum( q1, q2, q2 );
+    return DoubleDouble(q1,q2) + q3;
+}
+inline DoubleDouble operator/( double a, const DoubleDouble& b )
+{ return DoubleDouble(a) / b; }
+
+inline DoubleDouble& DoubleDouble::operator+=( const DoubleDouble& alpha )
+{ *this = *this + alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator+=( double alpha )
+{ *this = *this + alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator-=( const DoubleDouble& alpha )
+{ *this = *this - alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator-=( double alpha )
+{ *this = *this - alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator*=( const DoubleDouble& alpha )
+{ *this = *this * alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator*=( double alpha )
+{ *this = *this * alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator/=( const DoubleDouble& alpha )
+{ *this = *this / alpha; return *this; }
+inline DoubleDouble& DoubleDouble::operator/=( double alpha )
+{ *this = *this / alpha; return *this; }
+
+inline bool operator==( const DoubleDouble& a, const DoubleDouble& b )
+{ return a.x[0] == b.x[0] && a.x[1] == b.x[1]; }
+inline bool operator==( const DoubleDouble& a, double b )
+{ return a.x[0] == b && a.x[1] == 0.; }
+inline bool operator==( double a, const DoubleDouble& b )
+{ return b == a; }
+inline bool operator!=( const DoubleDouble& a, const DoubleDouble& b )
+{ return !(a == b); }
+inline bool operator!=( const DoubleDouble& a, double b )
+{ return !(a == b); }
+inline bool operator!=( double a, const DoubleDouble& b )
+{ return !(a == b); }
+
+inline bool operator<( const DoubleDouble& a, const DoubleDouble& b )
+{ return a.x[0] < b.x[0] || (a.x[0] == b.x[0] && a.x[1] < b.x[1]); }
+inline bool operator<( const DoubleDouble& a, double b )
+{ return a.x[0] < b || (a.x[0] == b && a.x[1] < 0.); }
+inline bool operator<( double a, const DoubleDouble& b )
+{ return a < b.x[0] || (a == b.x[0] && 0. < b.x[1]); }
+inline bool operator>( const DoubleDouble& a, const DoubleDouble& b )
+{ return b < a; }
+inline bool operator>( const DoubleDouble& a, double b )
+{ return b < a; }
+inline bool operator>( double a, const DoubleDouble& b )
+{ return b < a; }
+inline bool operator<=( const DoubleDouble& a, const DoubleDouble& b )
+{ return !(b < a); }
+inline bool operator<=( const DoubleDouble& a, double b )
+{ return !(b < a); }
+inline bool operator<=( double a, const DoubleDouble& b )
+{ return !(b < a); }
+inline bool operator>=( const DoubleDouble& a, const DoubleDouble& b )
+{ return !(a < b); }
+inline bool operator>=( const DoubleDouble& a, double b )
+{ return !(a < b); }
+inline bool operator>=( double a, const DoubleDouble& b )
+{ return !(a < b); }
+
+// Quad-double
+// ===========
+struct QuadDouble
+{
+    // The value is x[0]+x[1]+x[2]+x[3], with nonoverlapping components of
+    // decreasing magnitude
+    double x[4];
+
+    QuadDouble() = default;
+    constexpr QuadDouble( double alpha ) : x{alpha,0.,0.,0.} { }
+    constexpr QuadDouble( double x0, double x1, double x2, double x3 )
+    : x{x0,x1,x2,x3} { }
+    constexpr QuadDouble( const DoubleDouble& alpha )
+    : x{alpha.x[0],alpha.x[1],0.,0.} { }
+    template<typename T,
+             typename=typename std::enable_if<std::is_integral<T>::value>::type>
+    QuadDouble( T alpha )
+    {
+        const DoubleDouble alphaDD( alpha );
+        x[0] = alphaDD.x[0];
+        x[1] = alphaDD.x[1];
+        x[2] = x[3] = 0.;
+    }
+
+    explicit operator double() const { return x[0]; }
+    explicit operator float() const { return float(x[0]); }
+    explicit operator DoubleDouble() const
+    {
+        double lo;
+        const double hi = multi_double::QuickTwoSum( x[0], x[1]+x[2], lo );
+        return DoubleDouble(hi,lo);
+    }
+    // Truncate towards zero
+    template<typename T,
+             typename=typename std::enable_if<std::is_integral<T>::value>::type>
+    explicit operator T() const;
+
+    QuadDouble& operator+=( const QuadDouble& alpha );
+    QuadDouble& operator+=( double alpha );
+    QuadDouble& operator-=( const QuadDouble& alpha );
+    QuadDouble& operator-=( double alpha );
+    QuadDouble& operator*=( const QuadDouble& alpha );
+    QuadDouble& operator*=( double alpha );
+    QuadDouble& operator/=( const QuadDouble& alpha );
+    QuadDouble& operator/=( double alpha );
+};
+
+inline QuadDouble operator+( const QuadDouble& a )
+{ return a; }
+inline QuadDouble operator-( const QuadDouble& a )
+{ return QuadDouble(-a.x[0],-a.x[1],-a.x[2],-a.x[3]); }
+
+// This is the "sloppy" addition of Hida et al., which, like their library,
+// we prefer over the (branchy) IEEE-style addition for the sake of speed
+inline QuadDouble operator+( const QuadDouble& a, const QuadDouble& b )
+{
+    using namespace multi_double;
+    double t0, t1, t2, t3;
+    double s0 = TwoSum( a.x[0], b.x[0], t0 );
+    double s1 = TwoSum( a.x[1], b.x[1], t1 );
+    double s2 = TwoSum( a.x[2], b.x[2], t2 );
+    double s3 = TwoSum( a.x[3], b.x[3], t3 );
+
+    s1 = TwoSum( s1, t0, t0 );
+    ThreeSum( s2, t0, t1 );
+    ThreeSum2( s3, t0, t2 );
+    t0 = t0 + t1 + t3;
+
+    Renormalize( s0, s1, s2, s3, t0 );
+    return QuadDouble(s0,s1,s2,s3);
+}
+inline QuadDouble operator+( const QuadDouble& a, double b )
+{
+    using namespace multi_double;
+    double e;
+    double c0 = TwoSum( a.x[0], b, e );
+    double c1 = TwoSum( a.x[1], e, e );
+    double c2 = TwoSum( a.x[2], e, e );
+    double c3 = TwoSum( a.x[3], e, e );
+    Renormalize( c0, c1, c2, c3, e );
+    return QuadDouble(c0,c1,c2,c3);
+}
+inline QuadDouble operator+( double a, const QuadDouble& b )
+{ return b + a; }
+
+inline QuadDouble operator-( const QuadDouble& a, const QuadDouble& b )
+{ return a + (-b); }
+inline QuadDouble operator-( const QuadDouble& a, double b )
+{ return a + (-b); }
+inline QuadDouble operator-( double a, const QuadDouble& b )
+{ return (-b) + a; }
+
+// The "sloppy" multiplication of Hida et al., which neglects the O(eps^4)
+// terms
+inline QuadDouble operator*( const QuadDouble& a, const QuadDouble& b )
+{
+    using namespace multi_double;
+    double q0, q1, q2, q3, q4, q5;
+    double p0 = TwoProd( a.x[0], b.x[0], q0 );
+    double p1 = TwoProd( a.x[0], b.x[1], q1 );
+    double p2 = TwoProd( a.x[1], b.x[0], q2 );
+    double p3 = TwoProd( a.x[0], b.x[2], q3 );
+    double p4 = TwoProd( a.x[1], b.x[1], q4 );
+    double p5 = TwoProd( a.x[2], b.x[0], q5 );
+
+    // Start the accumulation
+    ThreeSum( p1, p2, q0 );
+
+    // Six-three sum of (p2,q1,q2) and (p3,p4,p5)
+    ThreeSum( p2, q1, q2 );
+    ThreeSum( p3, p4, p5 );
+    double t0, t1;
+    double s0 = TwoSum( p2, p3, t0 );
+    double s1 = TwoSum( q1, p4, t1 );
+    double s2 = q2 + p5;
+    s1 = TwoSum( s1, t0, t0 );
+    s2 += t0 + t1;
+
+    // The O(eps^3) terms
+    s1 += a.x[0]*b.x[3] + a.x[1]*b.x[2] + a.x[2]*b.x[1] + a.x[3]*b.x[0] +
+          q0 + q3 + q4 + q5;
+
+    Renormalize( p0, p1, s0, s1, s2 );
+    return QuadDouble(p0,p1,s0,s1);
+}
+inline QuadDouble operator*( const QuadDouble& a, double b )
+{
+    using namespace multi_double;
+    double q0, q1, q2;
+    const double p0 = TwoProd( a.x[0], b, q0 );
+    const double p1 = TwoProd( a.x[1], b, q1 );
+    double p2 = TwoProd( a.x[2], b, q2 );
+    const double p3 = a.x[3]*b;
+
+    double s0 = p0;
+    double s2;
+    double s1 = TwoSum( q0, p1, s2 );
+    ThreeSum( s2, q1, p2 );
+    ThreeSum2( q1, q2, p3 );
+    double s3 = q1;
+    double s4 = q2 + p2;
+
+    Renormalize( s0, s1, s2, s3, s4 );
+    return QuadDouble(s0,s1,s2,s3);
+}
+inline QuadDouble operator*( double a, const QuadDouble& b )
+{ return b*a; }
+
+// Long division, keeping an extra quotient term for accuracy
+inline QuadDouble operator/( const QuadDouble& a, const QuadDouble& b )
+{
+    double q0 = a.x[0] / b.x[0];
+    QuadDouble r = a - b*q0;
+    double q1 = r.x[0] / b.x[0];
+    r -= b*q1;
+    double q2 = r.x[0] / b.x[0];
+    r -= b*q2;
+    double q3 = r.x[0] / b.x[0];
+    r -= b*q3;
+    double q4 = r.x[0] / b.x[0];
+    multi_double::Renormalize( q0, q1, q2, q3, q4 );
+    return QuadDouble(q0,q1,q2,q3);
+}
+inline QuadDouble operator/( const QuadDouble& a, double b )
+{
+    double q0 = a.x[0] / b;
+    QuadDouble r = a - QuadDouble(q0)*b;
+    double q1 = r.x[0] / b;
+    r -= QuadDouble(q1)*b;
+    double q2 = r.x[0] / b;
+    r -= QuadDouble(q2)*b;
+    double q3 = r.x[0] / b;
+    r -= QuadDouble(q3)*b;
+    double q4 = r.x[0] / b;
+    multi_double::Renormalize( q0, q1, q2, q3, q4 );
+    return QuadDouble(q0,q1,q2,q3);
+}
+inline QuadDouble operator/( double a, const QuadDouble& b )
+{ return QuadDouble(a) / b; }
+
+inline QuadDouble& QuadDouble::operator+=( const QuadDouble& alpha )
+{ *this = *this + alpha; return *this; }
+inline QuadDouble& QuadDouble::operator+=( double alpha )
+{ *this = *this + alpha; return *this; }
+inline QuadDouble& QuadDouble::operator-=( const QuadDouble& alpha )
+{ *this = *this - alpha; return *this; }
+inline QuadDouble& QuadDouble::operator-=( double alpha )
+{ *this = *this - alpha; return *this; }
+inline QuadDouble& QuadDouble::operator*=( const QuadDouble& alpha )
+{ *this = *this * alpha; return *this; }
+inline QuadDouble& QuadDouble::operator*=( double alpha )
+{ *this = *this * alpha; return *this; }
+inline QuadDouble& QuadDouble::operator/=( const QuadDouble& alpha )
+{ *this = *this / alpha; return *this; }
+inline QuadDouble& QuadDouble::operator/=( double alpha )
+{ *this = *this / alpha; return *this; }
+
+inline bool operator==( const QuadDouble& a, const QuadDouble& b )
+{
+    return a.x[0] == b.x[0] && a.x[1] == b.x[1] &&
+           a.x[2] == b.x[2] && a.x[3] == b.x[3];
+}
+inline bool operator==( const QuadDouble& a, double b )
+{ return a.x[0] == b && a.x[1] == 0. && a.x[2] == 0. && a.x[3] == 0.; }
+inline bool operator==( double a, const QuadDouble& b )
+{ return b == a; }
+inline bool operator!=( const QuadDouble& a, const QuadDouble& b )
+{ return !(a == b); }
+inline bool operator!=( const QuadDouble& a, double b )
+{ return !(a == b); }
+inline bool operator!=( double a, const QuadDouble& b )
+{ return !(a == b); }
+
+inline bool operator<( const QuadDouble& a, const QuadDouble& b )
+{
+    for( int i=0; i<3; ++i )
+        if( a.x[i] != b.x[i] )
+            return a.x[i] < b.x[i];
+    return a.x[3] < b.x[3];
+}
+inline bool operator<( const QuadDouble& a, double b )
+{ return a.x[0] < b || (a.x[0] == b && a.x[1] < 0.); }
+inline bool operator<( double a, const QuadDouble& b )
+{ return a < b.x[0] || (a == b.x[0] && 0. < b.x[1]); }
+inline bool operator>( const QuadDouble& a, const QuadDouble& b )
+{ return b < a; }
+inline bool operator>( const QuadDouble& a, double b )
+{ return b < a; }
+inline bool operator>( double a, const QuadDouble& b )
+{ return b < a; }
+inline bool operator<=( const QuadDouble& a, const QuadDouble& b )
+{ return !(b < a); }
+inline bool operator<=( const QuadDouble& a, double b )
+{ return !(b < a); }
+inline bool operator<=( double a, const QuadDouble& b )
+{ return !(b < a); }
+inline bool operator>=( const QuadDouble& a, const QuadDouble& b )
+{ return !(a < b); }
+inline bool operator>=( const QuadDouble& a, double b )
+{ return !(a < b); }
+inline bool operator>=( double a, const QuadDouble& b )
+{ return !(a < b); }
+
+namespace multi_double {
+
+// Type-specific kernels
+// =====================
+
+// The relative precision of the format
+template<typename T> double Epsilon();
+template<> inline double Epsilon<DoubleDouble>()
+{ return 4.93038065763132378382e-32; } // 2^-104
+template<> inline double Epsilon<QuadDouble>()
+{ return 1.2154326714572542e-63; } // 2^-209
+
+// The number of Newton steps needed to extend a double-precision
+// approximation to the full precision
+template<typename T> int NumNewtonSteps();
+template<> inline int NumNewtonSteps<DoubleDouble>() { return 1; }
+template<> inline int NumNewtonSteps<QuadDouble>() { return 3; }
+
+template<typename T> T Pi();
+template<> inline DoubleDouble Pi<DoubleDouble>()
+{ return DoubleDouble(3.141592653589793116e+00,1.224646799147353207e-16); }
+template<> inline QuadDouble Pi<QuadDouble>()
+{
+    return QuadDouble
+    (3.141592653589793116e+00,1.224646799147353207e-16,
+     -2.994769809718339666e-33,1.112454220863365282e-49);
+}
+
+template<typename T> T Log2();
+template<> inline DoubleDouble Log2<DoubleDouble>()
+{ return DoubleDouble(6.931471805599452862e-01,2.319046813846299558e-17); }
+template<> inline QuadDouble Log2<QuadDouble>()
+{
+    return QuadDouble
+    (6.931471805599452862e-01,2.319046813846299558e-17,
+     5.707708438416212066e-34,-3.582432210601811423e-50);
+}
+
+inline DoubleDouble Ldexp( const DoubleDouble& a, int exp )
+{ return DoubleDouble(std::ldexp(a.x[0],exp),std::ldexp(a.x[1],exp)); }
+inline QuadDouble Ldexp( const QuadDouble& a, int exp )
+{
+    return QuadDouble
+    (std::ldexp(a.x[0],exp),std::ldexp(a.x[1],exp),
+     std::ldexp(a.x[2],exp),std::ldexp(a.x[3],exp));
+}
+
+inline DoubleDouble Abs( const DoubleDouble& a )
+{ return a.x[0] < 0. ? -a : a; }
+inline QuadDouble Abs( const QuadDouble& a )
+{ return a.x[0] < 0. ? -a : a; }
+
+inline DoubleDouble Floor( const DoubleDouble& a )
+{
+    double hi = std::floor(a.x[0]);
+    double lo = 0.;
+    if( hi == a.x[0] )
+    {
+        // The high component is an integer, so round the low component
+        lo = std::floor(a.x[1]);
+        hi = QuickTwoSum( hi, lo, lo );
+    }
+    return DoubleDouble(hi,lo);
+}
+inline QuadDouble Floor( const QuadDouble& a )
+{
+    double x0 = std::floor(a.x[0]);
+    double x1=0., x2=0., x3=0.;
+    if( x0 == a.x[0] )
+    {
+        x1 = std::floor(a.x[1]);
+        if( x1 == a.x[1] )
+        {
+            x2 = std::floor(a.x[2]);
+            if( x2 == a.x[2] )
+                x3 = std::floor(a.x[3]);
+        }
+        Renormalize( x0, x1, x2, x3 );
+    }
+    return QuadDouble(x0,x1,x2,x3);
+}
+
+template<typename T>
+inline T Ceil( const T& a )
+{ return -multi_double::Floor(-a); }
+
+// Round to the nearest integer, with ties away from zero (as in std::round)
+template<typename T>
+inline T Round( const T& a )
+{
+    return a.x[0] < 0. ? -multi_double::Floor(0.5-a)
+                       :  multi_double::Floor(a+0.5);
+}
+
+template<typename T>
+inline bool IsNaN( const T& a )
+{ return std::isnan(a.x[0]); }
+
+template<typename T>
+inline T NaN()
+{ return T(std::numeric_limits<double>::quiet_NaN()); }
+template<typename T>
+inline T Infinity()
+{ return T(std::numeric_limits<double>::infinity()); }
+
+// Truncate towards zero
+template<typename T>
+inline T Truncate( const T& a )
+{ return a.x[0] < 0. ? multi_double::Ceil(a) : multi_double::Floor(a); }
+
+inline DoubleDouble Sqrt( const DoubleDouble& a )
+{
+    // Karp and Markstein's trick: one Newton step on the inverse square root
+    // from a double-precision approximation suffices
+    if( a.x[0] == 0. )
+        return DoubleDouble(0.);
+    if( a.x[0] < 0. )
+        return NaN<DoubleDouble>();
+    const double x = 1. / std::sqrt(a.x[0]);
+    const double ax = a.x[0]*x;
+    double err;
+    const double axSquared = TwoProd( ax, ax, err );
+    const DoubleDouble residual = a - DoubleDouble(axSquared,err);
+    double lo;
+    const double hi = TwoSum( ax, residual.x[0]*(x*0.5), lo );
+    return DoubleDouble(hi,lo);
+}
+inline QuadDouble Sqrt( const QuadDouble& a )
+{
+    // Newton's iteration for the inverse square root, x <- x + x(1-a x^2)/2,
+    // followed by a multiplication with a
+    if( a.x[0] == 0. )
+        return QuadDouble(0.);
+    if( a.x[0] < 0. )
+        return NaN<QuadDouble>();
+    QuadDouble r = 1. / std::sqrt(a.x[0]);
+    const QuadDouble h = Ldexp( a, -1 );
+    for( int step=0; step<3; ++step )
+        r += (0.5 - h*(r*r))*r;
+    return r*a;
+}
+
+// Elementary functions
+// ====================
+// These are shared by both formats and are templated over them
+
+template<typename T>
+inline T Exp( const T& a )
+{
+    // exp(a) = 2^m exp(r)^(2^k), where a = m log(2) + 2^k r, and exp(r) is
+    // evaluated using a Taylor series
+    const int k = 10;
+    if( IsNaN(a) )
+        return a;
+    if( a.x[0] > 709.78 )
+        return Infinity<T>();
+    if( a.x[0] < -745.13 )
+        return T(0.);
+    if( a == 0. )
+        return T(1.);
+
+    const T log2 = Log2<T>();
+    const double m = std::floor( a.x[0]/log2.x[0] + 0.5 );
+    const T r = Ldexp( a - log2*m, -k );
+
+    // Form s = exp(r) - 1
+    const double tol = Epsilon<T>()*std::abs(r.x[0]);
+    T s = r, term = r;
+    for( int i=2; ; ++i )
+    {
+        term = term*r / double(i);
+        s += term;
+        if( std::abs(term.x[0]) <= tol )
+            break;
+    }
+
+    // exp(2r) - 1 = (exp(r)-1) (exp(r)+1)
+    for( int i=0; i<k; ++i )
+        s = s*(s+2.);
+    s += 1.;
+
+    return Ldexp( s, int(m) );
+}
+
+template<typename T>
+inline T Log( const T& a )
+{
+    // Newton's iteration on f(x) = exp(x) - a, i.e., x <- x + a exp(-x) - 1
+    if( IsNaN(a) )
+        return a;
+    if( a.x[0] < 0. )
+        return NaN<T>();
+    if( a.x[0] == 0. )
+        return -Infinity<T>();
+    if( a == 1. )
+        return T(0.);
+
+    T x = std::log(a.x[0]);
+    for( int step=0; step<NumNewtonSteps<T>(); ++step )
+        x += a*multi_double::Exp(-x) - 1.;
+    return x;
+}
+
+template<typename T>
+inline T Pow( const T& a, const T& b )
+{
+    if( a.x[0] == 0. )
+    {
+        if( b.x[0] == 0. )
+            return T(1.);
+        return b.x[0] > 0. ? T(0.) : Infinity<T>();
+    }
+    if( a.x[0] < 0. )
+    {
+        // Only integer powers of negative numbers are real
+        if( multi_double::Floor(b) != b )
+            return NaN<T>();
+        const T result = multi_double::Exp( b*multi_double::Log(-a) );
+        const bool odd = ( multi_double::Floor(Ldexp(b,-1)) != Ldexp(b,-1) );
+        return odd ? -result : result;
+    }
+    return multi_double::Exp( b*multi_double::Log(a) );
+}
+
+template<typename T>
+inline void SinCos( const T& a, T& sinA, T& cosA )
+{
+    if( IsNaN(a) )
+    {
+        sinA = cosA = a;
+        return;
+    }
+    if( a == 0. )
+    {
+        sinA = 0.;
+        cosA = 1.;
+        return;
+    }
+
+    // Reduce to t = a - 2 pi z - (pi/2) j, where |t| <= pi/4
+    const T pi = Pi<T>();
+    const T twoPi = Ldexp( pi, 1 );
+    const T halfPi = Ldexp( pi, -1 );
+    const T z = multi_double::Round( a / twoPi );
+    const T r = a - twoPi*z;
+    const double q = std::floor( r.x[0]/halfPi.x[0] + 0.5 );
+    const T t = r - halfPi*q;
+    const int j = int(q);
+
+    // Evaluate the Taylor series of sin(t) and recover cos(t) from it
+    T sinT = t, term = t;
+    const T tSquared = t*t;
+    const double tol = Epsilon<T>()*std::abs(t.x[0]);
+    for( int i=3; ; i+=2 )
+    {
+        term = -term*tSquared / double((i-1)*i);
+        sinT += term;
+        if( std::abs(term.x[0]) <= tol )
+            break;
+    }
+    const T cosT = multi_double::Sqrt( 1. - sinT*sinT );
+
+    switch( j )
+    {
+    case 0:  sinA =  sinT; cosA =  cosT; break;
+    case 1:  sinA =  cosT; cosA = -sinT; break;
+    case -1: sinA = -cosT; cosA =  sinT; break;
+    default: sinA = -sinT; cosA = -cosT; break;
+    }
+}
+
+template<typename T>
+inline T Sin( const T& a )
+{ T sinA, cosA; SinCos( a, sinA, cosA ); return sinA; }
+template<typename T>
+inline T Cos( const T& a )
+{ T sinA, cosA; SinCos( a, sinA, cosA ); return cosA; }
+template<typename T>
+inline T Tan( const T& a )
+{ T sinA, cosA; SinCos( a, sinA, cosA ); return sinA/cosA; }
+
+template<typename T>
+inline T Atan2( const T& y, const T& x )
+{
+    // Newton's iteration on either sin(z) = y/r or cos(z) = x/r, where
+    // r = sqrt(x^2+y^2), depending upon which is better conditioned
+    if( IsNaN(x) || IsNaN(y) )
+        return NaN<T>();
+    if( x.x[0] == 0. )
+    {
+        if( y.x[0] == 0. )
+            return T(0.);
+        return y.x[0] > 0. ? Ldexp(Pi<T>(),-1) : -Ldexp(Pi<T>(),-1);
+    }
+    if( y.x[0] == 0. )
+        return x.x[0] > 0. ? T(0.) : Pi<T>();
+
+    const T r = multi_double::Sqrt( x*x + y*y );
+    const T xUnit = x / r;
+    const T yUnit = y / r;
+    T z = std::atan2( y.x[0], x.x[0] );
+    T sinZ, cosZ;
+    for( int step=0; step<NumNewtonSteps<T>(); ++step )
+    {
+        SinCos( z, sinZ, cosZ );
+        if( std::abs(xUnit.x[0]) > std::abs(yUnit.x[0]) )
+            z += (yUnit - sinZ) / cosZ;
+        else
+            z -= (xUnit - cosZ) / sinZ;
+    }
+    return z;
+}
+
+template<typename T>
+inline T Atan( const T& a )
+{ return multi_double::Atan2( a, T(1.) ); }
+
+template<typename T>
+inline T Asin( const T& a )
+{
+    const T aAbs = multi_double::Abs(a);
+    if( aAbs > 1. )
+        return NaN<T>();
+    return multi_double::Atan2( a, multi_double::Sqrt(1.-a*a) );
+}
+
+template<typename T>
+inline T Acos( const T& a )
+{
+    const T aAbs = multi_double::Abs(a);
+    if( aAbs > 1. )
+        return NaN<T>();
+    return multi_double::Atan2( multi_double::Sqrt(1.-a*a), a );
+}
+
+template<typename T>
+inline T Sinh( const T& a )
+{
+    if( std::abs(a.x[0]) > 0.05 )
+    {
+        const T expA = multi_double::Exp(a);
+        return Ldexp( expA - 1./expA, -1 );
+    }
+
+    // Avoid cancellation with a Taylor series
+    T s = a, term = a;
+    const T aSquared = a*a;
+    const double tol = Epsilon<T>()*std::abs(a.x[0]);
+    for( int i=3; ; i+=2 )
+    {
+        term = term*aSquared / double((i-1)*i);
+        s += term;
+        if( std::abs(term.x[0]) <= tol )
+            break;
+    }
+    return s;
+}
+
+template<typename T>
+inline T Cosh( const T& a )
+{
+    const T expA = multi_double::Exp(a);
+    return Ldexp( expA + 1./expA, -1 );
+}
+
+template<typename T>
+inline T Tanh( const T& a )
+{
+    if( std::abs(a.x[0]) > 80. )
+        return T(a.x[0] > 0. ? 1. : -1.);
+    if( std::abs(a.x[0]) > 0.05 )
+    {
+        const T expA = multi_double::Exp(a);
+        const T expAInv = 1./expA;
+        return (expA-expAInv) / (expA+expAInv);
+    }
+    const T s = multi_double::Sinh(a);
+    return s / multi_double::Sqrt(1.+s*s);
+}
+
+template<typename T>
+inline T Asinh( const T& a )
+{
+    const T aAbs = multi_double::Abs(a);
+    const T result = multi_double::Log( aAbs + multi_double::Sqrt(a*a+1.) );
+    return a.x[0] < 0. ? -result : result;
+}
+
+template<typename T>
+inline T Acosh( const T& a )
+{
+    if( a < 1. )
+        return NaN<T>();
+    return multi_double::Log( a + multi_double::Sqrt(a*a-1.) );
+}
+
+template<typename T>
+inline T Atanh( const T& a )
+{
+    const T aAbs = multi_double::Abs(a);
+    if( aAbs > 1. )
+        return NaN<T>();
+    if( aAbs == 1. )
+        return a.x[0] > 0. ? Infinity<T>() : -Infinity<T>();
+    return Ldexp( multi_double::Log((1.+a)/(1.-a)), -1 );
+}
+
+// Decimal conversion
+// ==================
+
+// 10^e, computed by repeated squaring
+template<typename T>
+inline T PowerOfTen( int e )
+{
+    T result(1.), base(10.);
+    for( int n=std::abs(e); n>0; n/=2 )
+    {
+        if( n % 2 )
+            result *= base;
+        base *= base;
+    }
+    return e < 0 ? 1./result : result;
+}
+
+// Form the scientific notation of a with numDigits digits after the decimal
+// point, e.g., "-1.234e-05"
+template<typename T>
+inline std::string ToString( const T& a, int numDigits )
+{
+    if( IsNaN(a) )
+        return "nan";
+    if( std::isinf(a.x[0]) )
+        return a.x[0] > 0. ? "inf" : "-inf";
+
+    std::string str;
+    if( a.x[0] < 0. )
+        str += '-';
+    T r = multi_double::Abs(a);
+
+    int e = 0;
+    if( r.x[0] != 0. )
+    {
+        e = int(std::floor(std::log10(r.x[0])));
+        // Avoid overflowing the power of ten for the largest exponents
+        if( e > 300 )
+            r = (r / 1e10) / PowerOfTen<T>(e-10);
+        else if( e < -300 )
+            r = (r * 1e10) / PowerOfTen<T>(e+10);
+        else
+            r /= PowerOfTen<T>(e);
+        // Fix the (rare) off-by-one estimates of the exponent
+        if( r >= 10. )
+        {
+            r /= 10.;
+            ++e;
+        }
+        else if( r < 1. )
+        {
+            r *= 10.;
+            --e;
+        }
+    }
+
+    // Extract one extra digit for the sake of rounding
+    std::vector<int> digits(numDigits+2);
+    for( int i=0; i<numDigits+2; ++i )
+    {
+        const int digit = int(std::floor(r.x[0]));
+        digits[i] = digit;
+        r = (r - double(digit))*10.;
+    }
+    // The extracted digits may be slightly outside of [0,9], so carry
+    if( digits[numDigits+1] >= 5 )
+        ++digits[numDigits];
+    for( int i=numDigits; i>0; --i )
+    {
+        while( digits[i] < 0 )
+        {
+            digits[i] += 10;
+            --digits[i-1];
+        }
+        while( digits[i] > 9 )
+        {
+            digits[i] -= 10;
+            ++digits[i-1];
+        }
+    }
+    if( digits[0] > 9 )
+    {
+        // Shift the digits to make room for the carry
+        for( int i=numDigits; i>0; --i )
+            digits[i] = digits[i-1];
+        digits[1] = digits[0] - 10;
+        digits[0] = 1;
+        ++e;
+    }
+
+    str += char('0'+digits[0]);
+    if( numDigits > 0 )
+        str += '.';
+    for( int i=1; i<=numDigits; ++i )
+        str += char('0'+digits[i]);
+    str += ( e < 0 ? "e-" : "e+" );
+    const int eAbs = std::abs(e);
+    if( eAbs < 10 )
+        str += '0';
+    str += std::to_string(eAbs);
+    return str;
+}
+
+} // namespace multi_double
+
+template<typename T,typename>
+inline DoubleDouble::operator T() const
+{
+    const DoubleDouble alpha = multi_double::Truncate( *this );
+    return T(alpha.x[0]) + T(alpha.x[1]);
+}
+
+template<typename T,typename>
+inline QuadDouble::operator T() const
+{
+    const QuadDouble alpha = multi_double::Truncate( *this );
+    return T(alpha.x[0]) + T(alpha.x[1]) + T(alpha.x[2]) + T(alpha.x[3]);
+}
+
+} // namespace El
+
+namespace std {
+
+template<>
+class numeric_limits<El::DoubleDouble>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr float_denorm_style has_denorm = denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 104;
+    static constexpr int digits10 = 31;
+    static constexpr int max_digits10 = 33;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = DBL_MIN_EXP+53;
+    static constexpr int min_exponent10 = DBL_MIN_10_EXP+16;
+    static constexpr int max_exponent = DBL_MAX_EXP;
+    static constexpr int max_exponent10 = DBL_MAX_10_EXP;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    // The smallest normalized number whose low component is also normalized
+    static constexpr El::DoubleDouble min()
+    { return El::DoubleDouble(DBL_MIN*9007199254740992.); } // 2^53
+    static constexpr El::DoubleDouble max()
+    { return El::DoubleDouble(DBL_MAX,DBL_MAX*5.5511151231257827e-17); }
+    static constexpr El::DoubleDouble lowest()
+    { return El::DoubleDouble(-DBL_MAX,-DBL_MAX*5.5511151231257827e-17); }
+    static constexpr El::DoubleDouble epsilon()
+    { return El::DoubleDouble(4.93038065763132378382e-32); }
+    static constexpr El::DoubleDouble round_error()
+    { return El::DoubleDouble(0.5); }
+    static constexpr El::DoubleDouble infinity()
+    { return El::DoubleDouble(numeric_limits<double>::infinity()); }
+    static constexpr El::DoubleDouble quiet_NaN()
+    { return El::DoubleDouble(numeric_limits<double>::quiet_NaN()); }
+    static constexpr El::DoubleDouble signaling_NaN()
+    { return El::DoubleDouble(numeric_limits<double>::signaling_NaN()); }
+    static constexpr El::DoubleDouble denorm_min()
+    { return min(); }
+};
+
+template<>
+class numeric_limits<El::QuadDouble>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr float_denorm_style has_denorm = denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 209;
+    static constexpr int digits10 = 62;
+    static constexpr int max_digits10 = 65;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = DBL_MIN_EXP+159;
+    static constexpr int min_exponent10 = DBL_MIN_10_EXP+48;
+    static constexpr int max_exponent = DBL_MAX_EXP;
+    static constexpr int max_exponent10 = DBL_MAX_10_EXP;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    // The smallest normalized number whose components are all normalized
+    static constexpr El::QuadDouble min()
+    { return El::QuadDouble(DBL_MIN*7.3075081866545146e+47); } // 2^159
+    static constexpr El::QuadDouble max()
+    {
+        return El::QuadDouble
+        (DBL_MAX,
+         DBL_MAX*5.5511151231257827e-17,
+         DBL_MAX*3.0814879110195774e-33,
+         DBL_MAX*1.7105694144590052e-49);
+    }
+    static constexpr El::QuadDouble lowest()
+    {
+        return El::QuadDouble
+        (-DBL_MAX,
+         -DBL_MAX*5.5511151231257827e-17,
+         -DBL_MAX*3.0814879110195774e-33,
+         -DBL_MAX*1.7105694144590052e-49);
+    }
+    static constexpr El::QuadDouble epsilon()
+    { return El::QuadDouble(1.2154326714572542e-63); }
+    static constexpr El::QuadDouble round_error()
+    { return El::QuadDouble(0.5); }
+    static constexpr El::QuadDouble infinity()
+    { return El::QuadDouble(numeric_limits<double>::infinity()); }
+    static constexpr El::QuadDouble quiet_NaN()
+    { return El::QuadDouble(numeric_limits<double>::quiet_NaN()); }
+    static constexpr El::QuadDouble signaling_NaN()
+    { return El::QuadDouble(numeric_limits<double>::signaling_NaN()); }
+    static constexpr El::QuadDouble denorm_min()
+    { return min(); }
+};
+
+} // namespace std
+
+#endif // ifndef EL_ELEMENT_MULTIDOUBLE_HPP
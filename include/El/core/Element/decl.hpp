@@ -17,6 +17,8 @@
 #include <quadmath.h>
 #endif
 
+#include "El/core/Element/MultiDouble.hpp"
+
 namespace El {
 
 using std::enable_if;
@@ -68,6 +70,8 @@ template<> struct IsScalar<Complex<double>> { static const bool value=true; };
 template<> struct IsScalar<Quad> { static const bool value=true; };
 template<> struct IsScalar<Complex<Quad>> { static const bool value=true; };
 #endif
+template<> struct IsScalar<DoubleDouble> { static const bool value=true; };
+template<> struct IsScalar<QuadDouble> { static const bool value=true; };
 
 template<typename T> struct IsBlasScalar
 { static const bool value=false; };
@@ -87,12 +91,28 @@ template<> struct PromoteHelper<float> { typedef double type; };
 #ifdef EL_HAVE_QUAD
 template<> struct PromoteHelper<double> { typedef Quad type; };
 #endif
+template<> struct PromoteHelper<DoubleDouble> { typedef QuadDouble type; };
 
 template<typename Real> struct PromoteHelper<Complex<Real>>
 { typedef Complex<typename PromoteHelper<Real>::type> type; };
 
 template<typename F> using Promote = typename PromoteHelper<F>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename F> struct DemoteHelper { typedef F type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename F> using Demote = typename DemoteHelper<F>::type;
+
 // Returning the underlying, or "base", real field
 // -----------------------------------------------
 // Note: The following is for internal usage only; please use Base
@@ -149,6 +169,8 @@ template<> struct IsData<Complex<double>> { static const bool value=true; };
 template<> struct IsData<Quad> { static const bool value=true; };
 template<> struct IsData<Complex<Quad>> { static const bool value=true; };
 #endif
+template<> struct IsData<DoubleDouble> { static const bool value=true; };
+template<> struct IsData<QuadDouble> { static const bool value=true; };
 
 // Basic element manipulation and I/O
 // ==================================
@@ -158,6 +180,8 @@ template<> struct IsData<Complex<Quad>> { static const bool value=true; };
 #ifdef EL_HAVE_QUAD
 std::ostream& operator<<( std::ostream& os, Quad alpha );
 #endif
+std::ostream& operator<<( std::ostream& os, const DoubleDouble& alpha );
+std::ostream& operator<<( std::ostream& os, const QuadDouble& alpha );
 template<typename Real>
 std::ostream& operator<<( std::ostream& os, Complex<Real> alpha );
 
@@ -241,6 +265,8 @@ Base<T> Abs( const T& alpha ) EL_NO_EXCEPT;
 template<> Quad Abs( const Quad& alpha ) EL_NO_EXCEPT;
 template<> Quad Abs( const Complex<Quad>& alpha ) EL_NO_EXCEPT;
 #endif
+template<> DoubleDouble Abs( const DoubleDouble& alpha ) EL_NO_EXCEPT;
+template<> QuadDouble Abs( const QuadDouble& alpha ) EL_NO_EXCEPT;
 
 // Carefully avoid unnecessary overflow in an absolute value computation
 // ---------------------------------------------------------------------
@@ -273,6 +299,8 @@ F Exp( const F& alpha ) EL_NO_EXCEPT;
 template<> Quad Exp( const Quad& alpha ) EL_NO_EXCEPT;
 template<> Complex<Quad> Exp( const Complex<Quad>& alpha ) EL_NO_EXCEPT;
 #endif
+template<> DoubleDouble Exp( const DoubleDouble& alpha ) EL_NO_EXCEPT;
+template<> QuadDouble Exp( const QuadDouble& alpha ) EL_NO_EXCEPT;
 
 template<typename F,typename T,
          typename=EnableIf<IsScalar<F>>,
@@ -289,6 +317,10 @@ template<> Complex<Quad> Pow
 template<> Complex<Quad> Pow
 ( const Complex<Quad>& alpha, const Quad& beta ) EL_NO_EXCEPT;
 #endif
+template<> DoubleDouble Pow
+( const DoubleDouble& alpha, const DoubleDouble& beta ) EL_NO_EXCEPT;
+template<> QuadDouble Pow
+( const QuadDouble& alpha, const QuadDouble& beta ) EL_NO_EXCEPT;
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Log( const F& alpha );
@@ -296,6 +328,8 @@ F Log( const F& alpha );
 template<> Quad Log( const Quad& alpha );
 template<> Complex<Quad> Log( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Log( const DoubleDouble& alpha );
+template<> QuadDouble Log( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Sqrt( const F& alpha );
@@ -303,6 +337,8 @@ F Sqrt( const F& alpha );
 template<> Quad Sqrt( const Quad& alpha );
 template<> Complex<Quad> Sqrt( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Sqrt( const DoubleDouble& alpha );
+template<> QuadDouble Sqrt( const QuadDouble& alpha );
 
 // Trigonometric functions
 // =======================
@@ -312,6 +348,8 @@ F Cos( const F& alpha );
 template<> Quad Cos( const Quad& alpha );
 template<> Complex<Quad> Cos( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Cos( const DoubleDouble& alpha );
+template<> QuadDouble Cos( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Sin( const F& alpha );
@@ -319,6 +357,8 @@ F Sin( const F& alpha );
 template<> Quad Sin( const Quad& alpha );
 template<> Complex<Quad> Sin( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Sin( const DoubleDouble& alpha );
+template<> QuadDouble Sin( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Tan( const F& alpha );
@@ -326,6 +366,8 @@ F Tan( const F& alpha );
 template<> Quad Tan( const Quad& alpha );
 template<> Complex<Quad> Tan( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Tan( const DoubleDouble& alpha );
+template<> QuadDouble Tan( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Acos( const F& alpha );
@@ -333,6 +375,8 @@ F Acos( const F& alpha );
 template<> Quad Acos( const Quad& alpha );
 template<> Complex<Quad> Acos( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Acos( const DoubleDouble& alpha );
+template<> QuadDouble Acos( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Asin( const F& alpha );
@@ -340,6 +384,8 @@ F Asin( const F& alpha );
 template<> Quad Asin( const Quad& alpha );
 template<> Complex<Quad> Asin( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Asin( const DoubleDouble& alpha );
+template<> QuadDouble Asin( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Atan( const F& alpha );
@@ -347,9 +393,13 @@ F Atan( const F& alpha );
 template<> Quad Atan( const Quad& alpha );
 template<> Complex<Quad> Atan( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Atan( const DoubleDouble& alpha );
+template<> QuadDouble Atan( const QuadDouble& alpha );
 
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 Real Atan2( const Real& y, const Real& x );
+template<> DoubleDouble Atan2( const DoubleDouble& y, const DoubleDouble& x );
+template<> QuadDouble Atan2( const QuadDouble& y, const QuadDouble& x );
 
 // Hyperbolic functions
 // ====================
@@ -359,6 +409,8 @@ F Cosh( const F& alpha );
 template<> Quad Cosh( const Quad& alpha );
 template<> Complex<Quad> Cosh( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Cosh( const DoubleDouble& alpha );
+template<> QuadDouble Cosh( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Sinh( const F& alpha );
@@ -366,6 +418,8 @@ F Sinh( const F& alpha );
 template<> Quad Sinh( const Quad& alpha );
 template<> Complex<Quad> Sinh( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Sinh( const DoubleDouble& alpha );
+template<> QuadDouble Sinh( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Tanh( const F& alpha );
@@ -373,6 +427,8 @@ F Tanh( const F& alpha );
 template<> Quad Tanh( const Quad& alpha );
 template<> Complex<Quad> Tanh( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Tanh( const DoubleDouble& alpha );
+template<> QuadDouble Tanh( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Acosh( const F& alpha );
@@ -380,6 +436,8 @@ F Acosh( const F& alpha );
 template<> Quad Acosh( const Quad& alpha );
 template<> Complex<Quad> Acosh( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Acosh( const DoubleDouble& alpha );
+template<> QuadDouble Acosh( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Asinh( const F& alpha );
@@ -387,6 +445,8 @@ F Asinh( const F& alpha );
 template<> Quad Asinh( const Quad& alpha );
 template<> Complex<Quad> Asinh( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Asinh( const DoubleDouble& alpha );
+template<> QuadDouble Asinh( const QuadDouble& alpha );
 
 template<typename F,typename=EnableIf<IsScalar<F>>>
 F Atanh( const F& alpha );
@@ -394,6 +454,8 @@ F Atanh( const F& alpha );
 template<> Quad Atanh( const Quad& alpha );
 template<> Complex<Quad> Atanh( const Complex<Quad>& alpha );
 #endif
+template<> DoubleDouble Atanh( const DoubleDouble& alpha );
+template<> QuadDouble Atanh( const QuadDouble& alpha );
 
 // Rounding
 // ========
@@ -411,6 +473,8 @@ Int Round( const Int& alpha );
 #ifdef EL_HAVE_QUAD
 Quad Round( const Quad& alpha );
 #endif
+DoubleDouble Round( const DoubleDouble& alpha );
+QuadDouble Round( const QuadDouble& alpha );
 
 // Ceiling
 // -------
@@ -425,6 +489,8 @@ Int Ceil( const Int& alpha );
 #ifdef EL_HAVE_QUAD
 Quad Ceil( const Quad& alpha );
 #endif
+DoubleDouble Ceil( const DoubleDouble& alpha );
+QuadDouble Ceil( const QuadDouble& alpha );
 
 // Floor
 // -----
@@ -439,6 +505,15 @@ Int Floor( const Int& alpha );
 #ifdef EL_HAVE_QUAD
 Quad Floor( const Quad& alpha );
 #endif
+DoubleDouble Floor( const DoubleDouble& alpha );
+QuadDouble Floor( const QuadDouble& alpha );
+
+// Testing for NaN
+// ---------------
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+bool IsNaN( const Real& alpha );
+bool IsNaN( const DoubleDouble& alpha );
+bool IsNaN( const QuadDouble& alpha );
 
 // Two-norm formation
 // ==================
@@ -30,6 +30,18 @@ inline ostream& operator<<( ostream& os, Quad alpha )
 #endif
 #endif
 
+inline ostream& operator<<( ostream& os, const DoubleDouble& alpha )
+{
+    os << multi_double::ToString( alpha, os.precision() );
+    return os;
+}
+
+inline ostream& operator<<( ostream& os, const QuadDouble& alpha )
+{
+    os << multi_double::ToString( alpha, os.precision() );
+    return os;
+}
+
 template<typename Real>
 inline ostream& operator<<( ostream& os, Complex<Real> alpha )
 {
@@ -156,6 +168,14 @@ inline Quad Abs( const Complex<Quad>& alphaPre ) EL_NO_EXCEPT
 }
 #endif
 
+template<>
+inline DoubleDouble Abs( const DoubleDouble& alpha ) EL_NO_EXCEPT
+{ return multi_double::Abs(alpha); }
+
+template<>
+inline QuadDouble Abs( const QuadDouble& alpha ) EL_NO_EXCEPT
+{ return multi_double::Abs(alpha); }
+
 template<typename Real,typename>
 inline Real SafeAbs( const Real& alpha ) EL_NO_EXCEPT { return Abs(alpha); }
 
@@ -215,6 +235,14 @@ inline Complex<Quad> Exp( const Complex<Quad>& alphaPre ) EL_NO_EXCEPT
 }
 #endif
 
+template<>
+inline DoubleDouble Exp( const DoubleDouble& alpha ) EL_NO_EXCEPT
+{ return multi_double::Exp(alpha); }
+
+template<>
+inline QuadDouble Exp( const QuadDouble& alpha ) EL_NO_EXCEPT
+{ return multi_double::Exp(alpha); }
+
 template<typename F,typename T,typename,typename>
 inline F Pow( const F& alpha, const T& beta ) EL_NO_EXCEPT
 { return std::pow(alpha,beta); }
@@ -262,6 +290,16 @@ inline Complex<Quad> Pow
 }
 #endif
 
+template<>
+inline DoubleDouble Pow
+( const DoubleDouble& alpha, const DoubleDouble& beta ) EL_NO_EXCEPT
+{ return multi_double::Pow(alpha,beta); }
+
+template<>
+inline QuadDouble Pow
+( const QuadDouble& alpha, const QuadDouble& beta ) EL_NO_EXCEPT
+{ return multi_double::Pow(alpha,beta); }
+
 // Inverse exponentiation
 // ----------------------
 template<typename F,typename>
@@ -284,6 +322,14 @@ inline Complex<Quad> Log( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Log( const DoubleDouble& alpha )
+{ return multi_double::Log(alpha); }
+
+template<>
+inline QuadDouble Log( const QuadDouble& alpha )
+{ return multi_double::Log(alpha); }
+
 template<typename F,typename>
 inline F      Sqrt( const F&   alpha ) { return std::sqrt(alpha); }
 inline double Sqrt( const Int& alpha ) { return std::sqrt(alpha); }
@@ -304,6 +350,14 @@ inline Complex<Quad> Sqrt( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Sqrt( const DoubleDouble& alpha )
+{ return multi_double::Sqrt(alpha); }
+
+template<>
+inline QuadDouble Sqrt( const QuadDouble& alpha )
+{ return multi_double::Sqrt(alpha); }
+
 // Trigonometric
 // =============
 template<typename F,typename>
@@ -326,6 +380,14 @@ inline Complex<Quad> Cos( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Cos( const DoubleDouble& alpha )
+{ return multi_double::Cos(alpha); }
+
+template<>
+inline QuadDouble Cos( const QuadDouble& alpha )
+{ return multi_double::Cos(alpha); }
+
 template<typename F,typename>
 inline F      Sin( const F&   alpha ) { return std::sin(alpha); }
 inline double Sin( const Int& alpha ) { return std::sin(alpha); }
@@ -346,6 +408,14 @@ inline Complex<Quad> Sin( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Sin( const DoubleDouble& alpha )
+{ return multi_double::Sin(alpha); }
+
+template<>
+inline QuadDouble Sin( const QuadDouble& alpha )
+{ return multi_double::Sin(alpha); }
+
 template<typename F,typename>
 inline F      Tan( const F&   alpha ) { return std::tan(alpha); }
 inline double Tan( const Int& alpha ) { return std::tan(alpha); }
@@ -366,6 +436,14 @@ inline Complex<Quad> Tan( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Tan( const DoubleDouble& alpha )
+{ return multi_double::Tan(alpha); }
+
+template<>
+inline QuadDouble Tan( const QuadDouble& alpha )
+{ return multi_double::Tan(alpha); }
+
 // Inverse trigonometric
 // ---------------------
 template<typename F,typename>
@@ -388,6 +466,14 @@ inline Complex<Quad> Acos( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Acos( const DoubleDouble& alpha )
+{ return multi_double::Acos(alpha); }
+
+template<>
+inline QuadDouble Acos( const QuadDouble& alpha )
+{ return multi_double::Acos(alpha); }
+
 template<typename F,typename>
 inline F      Asin( const F&   alpha ) { return std::asin(alpha); }
 inline double Asin( const Int& alpha ) { return std::asin(alpha); }
@@ -408,6 +494,14 @@ inline Complex<Quad> Asin( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Asin( const DoubleDouble& alpha )
+{ return multi_double::Asin(alpha); }
+
+template<>
+inline QuadDouble Asin( const QuadDouble& alpha )
+{ return multi_double::Asin(alpha); }
+
 template<typename F,typename>
 inline F      Atan( const F&   alpha ) { return std::atan(alpha); }
 inline double Atan( const Int& alpha ) { return std::atan(alpha); }
@@ -428,6 +522,14 @@ inline Complex<Quad> Atan( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Atan( const DoubleDouble& alpha )
+{ return multi_double::Atan(alpha); }
+
+template<>
+inline QuadDouble Atan( const QuadDouble& alpha )
+{ return multi_double::Atan(alpha); }
+
 template<typename Real,typename>
 inline Real Atan2( const Real& y, const Real& x ) { return std::atan2( y, x ); }
 inline double Atan2( const Int& y, const Int& x ) { return std::atan2( y, x ); }
@@ -436,6 +538,14 @@ inline double Atan2( const Int& y, const Int& x ) { return std::atan2( y, x ); }
 // TODO: Atan2
 #endif
 
+template<>
+inline DoubleDouble Atan2( const DoubleDouble& y, const DoubleDouble& x )
+{ return multi_double::Atan2( y, x ); }
+
+template<>
+inline QuadDouble Atan2( const QuadDouble& y, const QuadDouble& x )
+{ return multi_double::Atan2( y, x ); }
+
 // Hyperbolic
 // ==========
 template<typename F,typename>
@@ -458,6 +568,14 @@ inline Complex<Quad> Cosh( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Cosh( const DoubleDouble& alpha )
+{ return multi_double::Cosh(alpha); }
+
+template<>
+inline QuadDouble Cosh( const QuadDouble& alpha )
+{ return multi_double::Cosh(alpha); }
+
 template<typename F,typename>
 inline F      Sinh( const F&   alpha ) { return std::sinh(alpha); }
 inline double Sinh( const Int& alpha ) { return std::sinh(alpha); }
@@ -478,6 +596,14 @@ inline Complex<Quad> Sinh( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Sinh( const DoubleDouble& alpha )
+{ return multi_double::Sinh(alpha); }
+
+template<>
+inline QuadDouble Sinh( const QuadDouble& alpha )
+{ return multi_double::Sinh(alpha); }
+
 template<typename F,typename>
 inline F      Tanh( const F&   alpha ) { return std::tanh(alpha); }
 inline double Tanh( const Int& alpha ) { return std::tanh(alpha); }
@@ -498,6 +624,14 @@ inline Complex<Quad> Tanh( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Tanh( const DoubleDouble& alpha )
+{ return multi_double::Tanh(alpha); }
+
+template<>
+inline QuadDouble Tanh( const QuadDouble& alpha )
+{ return multi_double::Tanh(alpha); }
+
 // Inverse hyperbolic
 // ------------------
 template<typename F,typename>
@@ -520,6 +654,14 @@ inline Complex<Quad> Acosh( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Acosh( const DoubleDouble& alpha )
+{ return multi_double::Acosh(alpha); }
+
+template<>
+inline QuadDouble Acosh( const QuadDouble& alpha )
+{ return multi_double::Acosh(alpha); }
+
 template<typename F,typename>
 inline F      Asinh( const F&   alpha ) { return std::asinh(alpha); }
 inline double Asinh( const Int& alpha ) { return std::asinh(alpha); }
@@ -540,6 +682,14 @@ inline Complex<Quad> Asinh( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Asinh( const DoubleDouble& alpha )
+{ return multi_double::Asinh(alpha); }
+
+template<>
+inline QuadDouble Asinh( const QuadDouble& alpha )
+{ return multi_double::Asinh(alpha); }
+
 template<typename F,typename>
 inline F      Atanh( const F&   alpha ) { return std::atanh(alpha); }
 inline double Atanh( const Int& alpha ) { return std::atanh(alpha); }
@@ -560,6 +710,14 @@ inline Complex<Quad> Atanh( const Complex<Quad>& alphaPre )
 }
 #endif
 
+template<>
+inline DoubleDouble Atanh( const DoubleDouble& alpha )
+{ return multi_double::Atanh(alpha); }
+
+template<>
+inline QuadDouble Atanh( const QuadDouble& alpha )
+{ return multi_double::Atanh(alpha); }
+
 // Rounding
 // ========
 
@@ -577,6 +735,10 @@ inline Int Round( const Int& alpha ) { return alpha; }
 #ifdef EL_HAVE_QUAD
 inline Quad Round( const Quad& alpha ) { return rintq(alpha); }
 #endif
+inline DoubleDouble Round( const DoubleDouble& alpha )
+{ return multi_double::Round(alpha); }
+inline QuadDouble Round( const QuadDouble& alpha )
+{ return multi_double::Round(alpha); }
 
 // Ceiling
 // -------
@@ -592,6 +754,10 @@ inline Int Ceil( const Int& alpha ) { return alpha; }
 #ifdef EL_HAVE_QUAD
 inline Quad Ceil( const Quad& alpha ) { return ceilq(alpha); }
 #endif
+inline DoubleDouble Ceil( const DoubleDouble& alpha )
+{ return multi_double::Ceil(alpha); }
+inline QuadDouble Ceil( const QuadDouble& alpha )
+{ return multi_double::Ceil(alpha); }
 
 // Floor
 // -----
@@ -607,6 +773,20 @@ inline Int Floor( const Int& alpha ) { return alpha; }
 #ifdef EL_HAVE_QUAD
 inline Quad Floor( const Quad& alpha ) { return floorq(alpha); }
 #endif
+inline DoubleDouble Floor( const DoubleDouble& alpha )
+{ return multi_double::Floor(alpha); }
+inline QuadDouble Floor( const QuadDouble& alpha )
+{ return multi_double::Floor(alpha); }
+
+// Testing for NaN
+// ---------------
+template<typename Real,typename>
+inline bool IsNaN( const Real& alpha ) { return std::isnan(alpha); }
+
+inline bool IsNaN( const DoubleDouble& alpha )
+{ return multi_double::IsNaN(alpha); }
+inline bool IsNaN( const QuadDouble& alpha )
+{ return multi_double::IsNaN(alpha); }
 
 // Two-norm formation
 // ==================
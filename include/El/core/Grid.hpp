@@ -87,6 +87,13 @@ public:
 
     static int FindFactor( int p ) EL_NO_EXCEPT;
 
+    // Partitions of the owning processes into c contiguous, equally-sized
+    // layers (for 2.5D and 3D algorithms), along with the communicator
+    // connecting the processes in the same position of each layer. Forming
+    // them is collective, so they are formed on first use and then cached.
+    const Grid& LayerGrid( int c, int layer ) const;
+    mpi::Comm LayerDepthComm( int c ) const;
+
 private:
     bool haveViewers_;
     int height_, size_, gcd_;
@@ -112,7 +119,16 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    struct Layers
+    {
+        int numLayers;
+        vector<unique_ptr<Grid>> grids;
+        mpi::Comm depthComm;
+    };
+    mutable vector<unique_ptr<Layers>> layers_;
+
     void SetUpGrid();
+    const Layers& GetLayers( int c ) const;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -12,11 +12,40 @@
 
 namespace El {
 
+// Every Memory<G> buffer is aligned to MemoryAlignment() bytes and, unless the
+// pool has been disabled, is recycled through a process-wide cache of
+// previously-freed blocks grouped into size classes (four per power of two).
+// Cached blocks are returned to the system by ClearMemoryPool(), by Finalize(),
+// or when an allocation would otherwise fail.
+struct MemoryPoolStats
+{
+    size_t bytesLive=0;     // bytes currently handed out to Memory objects
+    size_t bytesCached=0;   // bytes held in the pool awaiting reuse
+    size_t highWaterMark=0; // maximum value of bytesLive
+    size_t numRequests=0;   // number of allocation requests
+    size_t numHits=0;       // number of requests served from the pool
+
+    double HitRate() const EL_NO_EXCEPT
+    { return ( numRequests==0 ? 0. : double(numHits)/double(numRequests) ); }
+};
+
+void EnableMemoryPool( bool enable=true );
+void DisableMemoryPool();
+bool MemoryPoolEnabled();
+
+// The alignment must be a power of two which is at least sizeof(void*)
+void SetMemoryAlignment( size_t alignment );
+size_t MemoryAlignment();
+
+MemoryPoolStats GetMemoryPoolStats();
+void ResetMemoryPoolStats();
+void PrintMemoryPoolStats( std::ostream& os=std::cout );
+void ClearMemoryPool();
+
 template<typename G>
 class Memory
 {
     size_t size_;
-    G* rawBuffer_;
     G* buffer_;
 public:
     Memory();
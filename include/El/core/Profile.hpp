@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// Release-mode profiling of nested regions
+// ========================================
+// When profiling is enabled, every region records its number of calls, its
+// wall-clock time, the flops performed by the local kernels it executes, and
+// the bytes moved (and time spent) by the mpi:: routines it calls. Regions
+// nest, e.g., Gemm -> gemm::SUMMA_NNC -> copy::AllGather -> mpi::AllGather.
+//
+// ProfileReport is collective over mpi::COMM_WORLD: it aggregates the
+// per-process trees into a text summary (min/avg/max time over the
+// processes, along with the fraction of time spent communicating) written to
+// basename+".txt" and a Chrome-trace file (viewable via chrome://tracing)
+// written to basename+".json". Finalize() calls ProfileReport if any
+// profiling data was recorded.
+//
+// Only the master thread records regions.
+
+void EnableProfiling( bool enable=true );
+void DisableProfiling();
+bool ProfilingEnabled();
+
+void SetProfileBasename( const string& basename );
+const string& ProfileBasename();
+
+// Bound the number of trace events kept by each process (the summary is
+// unaffected by this limit)
+void SetProfileTraceLimit( Int maxEvents );
+Int ProfileTraceLimit();
+
+// Returns true if a region was pushed; communication regions nested within
+// other communication regions are not recorded so that bytes are not counted
+// twice
+bool PushProfileRegion( const char* name, bool comm=false );
+void PopProfileRegion();
+
+// Credit the innermost region with work performed locally or bytes moved
+void AddProfileFlops( double flops );
+void AddProfileBytes( double numBytes );
+
+void ProfileReport();
+void ClearProfile();
+
+class ProfileRegion
+{
+public:
+    ProfileRegion( const char* name )
+    : active_(PushProfileRegion(name))
+    { }
+
+    // Communication regions also record the number of bytes sent and
+    // received by this process
+    ProfileRegion( const char* name, double numBytes )
+    : active_(PushProfileRegion(name,true))
+    { if( active_ ) AddProfileBytes( numBytes ); }
+
+    ~ProfileRegion()
+    { if( active_ ) PopProfileRegion(); }
+
+    bool Active() const { return active_; }
+
+private:
+    bool active_;
+
+    ProfileRegion( const ProfileRegion& );
+    const ProfileRegion& operator=( const ProfileRegion& );
+};
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
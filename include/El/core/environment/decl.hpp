@@ -98,6 +98,11 @@ Int DefaultBlockWidth();
 void SetDefaultBlockHeight( Int blockHeight );
 void SetDefaultBlockWidth( Int blockWidth );
 
+// The maximum number of queued remote updates which each process sends per
+// round of DistMatrix/DistSparseMatrix::ProcessQueues
+Int AssemblyBatchSize();
+void SetAssemblyBatchSize( Int batchSize );
+
 std::mt19937& Generator();
 
 template<typename T,typename=EnableIf<IsScalar<T>>>
@@ -251,6 +256,17 @@ public:
     : std::runtime_error( msg ) { }
 };
 
+// An exception which signifies that an iterative refinement of a solution
+// failed to converge (e.g., because the matrix was too ill-conditioned for
+// the precision of the factorization used as a preconditioner)
+class RefinementFailureException : public std::runtime_error
+{
+public:
+    RefinementFailureException
+    ( const char* msg="Iterative refinement did not converge" )
+    : std::runtime_error( msg ) { }
+};
+
 // An exception which signifies that a matrix was unexpectedly non-HPSD
 class NonHPSDMatrixException  : public std::runtime_error
 {
@@ -606,7 +606,10 @@ void Syrk
   dcomplex alpha, const dcomplex* A, BlasInt lda,
   dcomplex beta,        dcomplex* C, BlasInt ldc );
 
-// TODO: Templated Trmm
+template<typename T>
+void Trmm
+( char side,  char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  T alpha, const T* A, BlasInt lda, T* B, BlasInt ldb );
 
 void Trmm
 ( char side,  char uplo, char trans, char unit, BlasInt m, BlasInt n,
@@ -621,7 +624,10 @@ void Trmm
 ( char side,  char uplo, char trans, char unit, BlasInt m, BlasInt n,
   dcomplex alpha, const dcomplex* A, BlasInt lda, dcomplex* B, BlasInt ldb );
 
-// TODO: Templated Trsm
+template<typename T>
+void Trsm
+( char side,  char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  T alpha, const T* A, BlasInt lda, T* B, BlasInt ldb );
 
 void Trsm
 ( char side,  char uplo, char trans, char unit, BlasInt m, BlasInt n,
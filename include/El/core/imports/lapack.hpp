@@ -21,11 +21,15 @@ namespace lapack {
 template<typename R=double> R MachineEpsilon();
 template<> float MachineEpsilon<float>();
 template<> double MachineEpsilon<double>();
+template<> DoubleDouble MachineEpsilon<DoubleDouble>();
+template<> QuadDouble MachineEpsilon<QuadDouble>();
 
 // Minimum number which can be inverted without overflow
 template<typename R=double> R MachineSafeMin();
 template<> float MachineSafeMin<float>();
 template<> double MachineSafeMin<double>();
+template<> DoubleDouble MachineSafeMin<DoubleDouble>();
+template<> QuadDouble MachineSafeMin<QuadDouble>();
 
 // Base of the machine, where the number is represented as 
 //   (mantissa) x (base)^(exponent)
@@ -114,6 +118,10 @@ float    Givens( float    phi, float    gamma, float * c, float   * s );
 double   Givens( double   phi, double   gamma, double* c, double  * s );
 scomplex Givens( scomplex phi, scomplex gamma, float * c, scomplex* s );
 dcomplex Givens( dcomplex phi, dcomplex gamma, double* c, dcomplex* s );
+DoubleDouble Givens
+( DoubleDouble phi, DoubleDouble gamma, DoubleDouble* c, DoubleDouble* s );
+QuadDouble Givens
+( QuadDouble phi, QuadDouble gamma, QuadDouble* c, QuadDouble* s );
 
 // Compute the eigen-values/pairs of a symmetric tridiagonal matrix
 // ================================================================
@@ -370,6 +378,27 @@ void HessenbergSchur
 ( BlasInt n, dcomplex* H, BlasInt ldH, dcomplex* w, dcomplex* Q, BlasInt ldQ, 
   bool fullTriangle=false, bool multiplyQ=false );
 
+// Reorder a Schur decomposition
+// =============================
+// Move the diagonal block of the (quasi-)triangular matrix T which begins at
+// (zero-based) index 'ifst' so that it begins at index 'ilst' and accumulate
+// the unitary transformation into Q. For real matrices, both indices are
+// overwritten with the beginnings of the corresponding 2x2 blocks, and false
+// is returned if a swap was rejected for being ill-conditioned.
+
+bool SchurExchange
+( BlasInt n, float* T, BlasInt ldT, float* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst );
+bool SchurExchange
+( BlasInt n, double* T, BlasInt ldT, double* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst );
+bool SchurExchange
+( BlasInt n, scomplex* T, BlasInt ldT, scomplex* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst );
+bool SchurExchange
+( BlasInt n, dcomplex* T, BlasInt ldT, dcomplex* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst );
+
 // Compute the eigenvalues/pairs of an upper Hessenberg matrix
 // ===========================================================
 
@@ -440,6 +469,12 @@ inline Real Epsilon() { return lapack::MachineEpsilon<Real>(); }
 template<>
 inline Quad Epsilon<Quad>() { return Quad(9.63)/Quad(1e35); }
 #endif
+template<>
+inline DoubleDouble Epsilon<DoubleDouble>()
+{ return multi_double::Epsilon<DoubleDouble>(); }
+template<>
+inline QuadDouble Epsilon<QuadDouble>()
+{ return multi_double::Epsilon<QuadDouble>(); }
 
 } // namespace El
 
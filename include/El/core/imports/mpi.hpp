@@ -21,6 +21,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -80,6 +81,8 @@ inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 typedef MPI_Aint Aint;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
+typedef MPI_Offset Offset;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
@@ -107,6 +110,10 @@ const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
 const Request REQUEST_NULL = MPI_REQUEST_NULL;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
+const int MODE_CREATE = MPI_MODE_CREATE;
 const Op MAX = MPI_MAX;
 const Op MIN = MPI_MIN;
 const Op MAXLOC = MPI_MAXLOC;
@@ -129,12 +136,18 @@ template<typename Real> inline Op MinOp() EL_NO_EXCEPT { return MIN; }
 template<> Op MaxOp<Quad>() EL_NO_EXCEPT;
 template<> Op MinOp<Quad>() EL_NO_EXCEPT;
 #endif
+template<> Op MaxOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op MinOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op MaxOp<QuadDouble>() EL_NO_EXCEPT;
+template<> Op MinOp<QuadDouble>() EL_NO_EXCEPT;
 
 template<typename T> inline Op SumOp() EL_NO_EXCEPT { return SUM; }
 #ifdef EL_HAVE_QUAD
 template<> Op SumOp<Quad>() EL_NO_EXCEPT;
 template<> Op SumOp<Complex<Quad>>() EL_NO_EXCEPT;
 #endif
+template<> Op SumOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op SumOp<QuadDouble>() EL_NO_EXCEPT;
 
 template<typename Real> Op MaxLocOp() EL_NO_EXCEPT;
 template<> Op MaxLocOp<Int>() EL_NO_EXCEPT;
@@ -143,6 +156,8 @@ template<> Op MaxLocOp<double>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Op MaxLocOp<Quad>() EL_NO_EXCEPT;
 #endif
+template<> Op MaxLocOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op MaxLocOp<QuadDouble>() EL_NO_EXCEPT;
 
 template<typename Real> Op MaxLocPairOp() EL_NO_EXCEPT;
 template<> Op MaxLocPairOp<Int>() EL_NO_EXCEPT;
@@ -151,6 +166,8 @@ template<> Op MaxLocPairOp<double>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Op MaxLocPairOp<Quad>() EL_NO_EXCEPT;
 #endif
+template<> Op MaxLocPairOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op MaxLocPairOp<QuadDouble>() EL_NO_EXCEPT;
 
 template<typename Real> Op MinLocOp() EL_NO_EXCEPT;
 template<> Op MinLocOp<Int>() EL_NO_EXCEPT;
@@ -159,6 +176,8 @@ template<> Op MinLocOp<double>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Op MinLocOp<Quad>() EL_NO_EXCEPT;
 #endif
+template<> Op MinLocOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op MinLocOp<QuadDouble>() EL_NO_EXCEPT;
 
 template<typename Real> Op MinLocPairOp() EL_NO_EXCEPT;
 template<> Op MinLocPairOp<Int>() EL_NO_EXCEPT;
@@ -167,6 +186,8 @@ template<> Op MinLocPairOp<double>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Op MinLocPairOp<Quad>() EL_NO_EXCEPT;
 #endif
+template<> Op MinLocPairOp<DoubleDouble>() EL_NO_EXCEPT;
+template<> Op MinLocPairOp<QuadDouble>() EL_NO_EXCEPT;
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
@@ -257,6 +278,45 @@ bool IProbe
 template<typename T>
 int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT;
 
+// Derived datatypes
+// -----------------
+void Contiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void Vector
+( int count, int blocklength, int stride, Datatype oldType,
+  Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void Indexed
+( int count, const int* blocklengths, const int* displs, Datatype oldType,
+  Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void HIndexed
+( int count, const int* blocklengths, const Aint* byteDispls, 
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void Commit( Datatype& type ) EL_NO_RELEASE_EXCEPT;
+
+// Parallel file I/O
+// -----------------
+// NOTE: FileOpen returns false rather than throwing so that the caller can
+//       report a missing file with its own error message
+bool FileOpen
+( Comm comm, const std::string& filename, int amode, File& file )
+EL_NO_RELEASE_EXCEPT;
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT;
+Offset FileSize( File file ) EL_NO_RELEASE_EXCEPT;
+void FileSetSize( File file, Offset size ) EL_NO_RELEASE_EXCEPT;
+void FileSetView
+( File file, Offset disp, Datatype etype, Datatype fileType ) 
+EL_NO_RELEASE_EXCEPT;
+void FileReadAt
+( File file, Offset offset, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT;
+void FileWriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT;
+void FileReadAll
+( File file, void* buf, int count, Datatype type ) EL_NO_RELEASE_EXCEPT;
+void FileWriteAll
+( File file, const void* buf, int count, Datatype type ) EL_NO_RELEASE_EXCEPT;
+
 // NOTE: This is instantiated for the standard datatypes
 template<typename T>
 void SetUserReduceFunc
@@ -495,6 +555,17 @@ void IGather
 ( const Complex<Real>* sbuf, int sc,
         Complex<Real>* rbuf, int rc, int root, Comm comm, Request& request );
 
+// Non-blocking AllGather
+// ----------------------
+template<typename Real>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request& request );
+template<typename Real>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm, Request& request );
+
 // Gather with variable recv sizes
 // -------------------------------
 template<typename Real>
@@ -948,12 +1019,16 @@ template<> Datatype TypeMap<Complex<double>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<Complex<Quad>>() EL_NO_EXCEPT;
 #endif
+template<> Datatype TypeMap<DoubleDouble>() EL_NO_EXCEPT;
+template<> Datatype TypeMap<QuadDouble>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<ValueInt<Int>>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<ValueInt<float>>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<ValueInt<double>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<ValueInt<Quad>>() EL_NO_EXCEPT;
 #endif
+template<> Datatype TypeMap<ValueInt<DoubleDouble>>() EL_NO_EXCEPT;
+template<> Datatype TypeMap<ValueInt<QuadDouble>>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<ValueInt<Complex<float>>>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<ValueInt<Complex<double>>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
@@ -966,6 +1041,8 @@ template<> Datatype TypeMap<Entry<double>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<Entry<Quad>>() EL_NO_EXCEPT;
 #endif
+template<> Datatype TypeMap<Entry<DoubleDouble>>() EL_NO_EXCEPT;
+template<> Datatype TypeMap<Entry<QuadDouble>>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<Entry<Complex<float>>>() EL_NO_EXCEPT;
 template<> Datatype TypeMap<Entry<Complex<double>>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
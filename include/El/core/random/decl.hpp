@@ -44,6 +44,10 @@ Quad SampleUniform( Quad a, Quad b );
 template<>
 Complex<Quad> SampleUniform( Complex<Quad> a, Complex<Quad> b );
 #endif
+template<>
+DoubleDouble SampleUniform( DoubleDouble a, DoubleDouble b );
+template<>
+QuadDouble SampleUniform( QuadDouble a, QuadDouble b );
 
 template<>
 Int SampleUniform<Int>( Int a, Int b );
@@ -61,6 +65,10 @@ Quad SampleNormal( Quad mean, Quad stddev );
 template<>
 Complex<Quad> SampleNormal( Complex<Quad> mean, Quad stddev );
 #endif
+template<>
+DoubleDouble SampleNormal( DoubleDouble mean, DoubleDouble stddev );
+template<>
+QuadDouble SampleNormal( QuadDouble mean, QuadDouble stddev );
 
 // Generate a sample from a uniform PDF over the (closed) unit ball about the 
 // origin of the ring implied by the type T using the most natural metric.
@@ -200,6 +200,27 @@ inline Complex<Quad> SampleUniform( Complex<Quad> a, Complex<Quad> b )
 }
 #endif
 
+// A single double-precision sample only provides 53 random bits, so the
+// remaining bits of the multi-double mantissa are filled with further samples
+template<>
+inline DoubleDouble SampleUniform( DoubleDouble a, DoubleDouble b )
+{
+    const double scale = std::ldexp(1.,-53);
+    DoubleDouble unit = SampleUniform<double>(0,1);
+    unit += SampleUniform<double>(0,1)*scale;
+    return a + unit*(b-a);
+}
+
+template<>
+inline QuadDouble SampleUniform( QuadDouble a, QuadDouble b )
+{
+    QuadDouble unit = 0;
+    double scale = 1;
+    for( Int j=0; j<4; ++j, scale=std::ldexp(scale,-53) )
+        unit += SampleUniform<double>(0,1)*scale;
+    return a + unit*(b-a);
+}
+
 template<>
 inline Int SampleUniform<Int>( Int a, Int b )
 {
@@ -326,6 +347,33 @@ inline Complex<Quad> SampleNormal( Complex<Quad> mean, Quad stddev )
 }
 #endif
 
+// Run Marsiglia's polar method directly in the extended precision
+template<>
+inline DoubleDouble SampleNormal( DoubleDouble mean, DoubleDouble stddev )
+{
+    while( true )
+    {
+        const DoubleDouble U = SampleUniform<DoubleDouble>(-1,1);
+        const DoubleDouble V = SampleUniform<DoubleDouble>(-1,1);
+        const DoubleDouble S = U*U+V*V;
+        if( S > DoubleDouble(0) && S < DoubleDouble(1) )
+            return mean + stddev*U*Sqrt(-2*Log(S)/S);
+    }
+}
+
+template<>
+inline QuadDouble SampleNormal( QuadDouble mean, QuadDouble stddev )
+{
+    while( true )
+    {
+        const QuadDouble U = SampleUniform<QuadDouble>(-1,1);
+        const QuadDouble V = SampleUniform<QuadDouble>(-1,1);
+        const QuadDouble S = U*U+V*V;
+        if( S > QuadDouble(0) && S < QuadDouble(1) )
+            return mean + stddev*U*Sqrt(-2*Log(S)/S);
+    }
+}
+
 template<>
 inline float
 SampleBall<float>( float center, float radius )
@@ -370,6 +418,16 @@ SampleBall<Complex<Quad>>( Complex<Quad> center, Quad radius )
 }
 #endif
 
+template<>
+inline DoubleDouble
+SampleBall<DoubleDouble>( DoubleDouble center, DoubleDouble radius )
+{ return SampleUniform<DoubleDouble>(center-radius,center+radius); }
+
+template<>
+inline QuadDouble
+SampleBall<QuadDouble>( QuadDouble center, QuadDouble radius )
+{ return SampleUniform<QuadDouble>(center-radius,center+radius); }
+
 // I'm not certain if there is any good way to define this
 template<>
 inline Int
@@ -153,6 +153,15 @@ template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, 
   const string filename, FileFormat format=AUTO, bool sequential=false );
+// Sparse matrices support the MATRIX_MARKET (coordinate) and BINARY
+// (compressed sparse row) formats; every process of a distributed sparse
+// matrix reads its own portion of the file
+template<typename T>
+void Read
+( SparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
+template<typename T>
+void Read
+( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
 
 // Spy
 // ===
@@ -172,6 +181,14 @@ template<typename T>
 void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  FileFormat format=BINARY );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  FileFormat format=BINARY );
 
 } // namespace El
 
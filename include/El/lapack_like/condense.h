@@ -115,6 +115,8 @@ typedef struct {
   ElHermitianTridiagApproach approach;
   ElGridOrderType order;
   ElSymvCtrl symvCtrl;
+  bool twoStage;
+  ElInt bandwidth;
 } ElHermitianTridiagCtrl;
 EL_EXPORT ElError 
 ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl );
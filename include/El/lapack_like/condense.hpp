@@ -106,6 +106,13 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<F> symvCtrl;
+
+    // If 'twoStage' is true, HermitianEig reduces to tridiagonal form by
+    // first reducing to a band matrix with the given bandwidth (zero selects
+    // the algorithmic blocksize) and then chasing bulges (see
+    // herm_tridiag::TwoStage)
+    bool twoStage=false;
+    Int bandwidth=0;
 };
 
 template<typename F>
@@ -134,6 +141,45 @@ void ApplyQ
   const ElementalMatrix<F>& A, const ElementalMatrix<F>& t, 
         ElementalMatrix<F>& B );
 
+// Two-stage reduction, A = Q1 Q2 T Q2^H Q1^H
+// ------------------------------------------
+// A is first reduced to a Hermitian band matrix using Level 3 operations,
+// and the band matrix is then reduced to the real symmetric tridiagonal
+// matrix T by bulge chasing. On exit, the Householder reflectors defining Q1
+// are packed below the bandwidth'th subdiagonal of A (in the lower triangle,
+// regardless of 'uplo'), with their scalings in t, and d and e hold the
+// diagonal and subdiagonal of T. If requested, the bulge-chasing reflectors
+// defining Q2 are returned in the columns of V2 (each of length at most the
+// bandwidth and with a unit first entry), with their scalings in t2, so that
+// Q2 can be applied blockwise by ApplyTwoStageQ rather than formed.
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<F>& t,
+  ElementalMatrix<Base<F>>& d,
+  ElementalMatrix<Base<F>>& e,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<F>& t,
+  ElementalMatrix<Base<F>>& d,
+  ElementalMatrix<Base<F>>& e,
+  ElementalMatrix<F>& V2,
+  ElementalMatrix<F>& t2,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
+
+// B := Q1 Q2 B
+template<typename F>
+void ApplyTwoStageQ
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& t,
+  const ElementalMatrix<F>& V2,
+  const ElementalMatrix<F>& t2,
+        ElementalMatrix<F>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -426,6 +426,7 @@ typedef enum
 typedef struct
 {
   ElRegSolveAlg alg;
+  bool mixedPrecision;
   float relTol;
   float relTolRefine;
   ElInt maxIts;
@@ -439,6 +440,7 @@ EL_EXPORT ElError ElRegSolveCtrlDefault_s( ElRegSolveCtrl_s* ctrl );
 typedef struct
 {
   ElRegSolveAlg alg;
+  bool mixedPrecision;
   double relTol;
   double relTolRefine;
   ElInt maxIts;
@@ -17,12 +17,24 @@ namespace El {
 
 // Cholesky
 // ========
+
+// If 'lookAhead' is true, the distributed factorization updates the next
+// panel before the rest of the trailing matrix and overlaps its
+// redistribution with the remainder of the update
+struct CholeskyCtrl {
+    bool scalapack=false;
+    bool lookAhead=false;
+};
+
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack=false );
 template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl );
+template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
 
 template<typename F>
@@ -291,10 +303,15 @@ enum RegSolveAlg
   REG_SOLVE_LGMRES
 };
 
+// If 'mixedPrecision' is true, the sparse drivers which accept this control
+// structure (e.g., LeastSquares, GLM, and LSE) factor the regularized matrix
+// in Demote<F> and solve with reg_ldl::MixedSolveAfter, so that the
+// refinement and the outer Krylov method run in the working precision
 template<typename Real>
 struct RegSolveCtrl
 {
     RegSolveAlg alg=REG_SOLVE_FGMRES;
+    bool mixedPrecision=false;
     Real relTol;
     Real relTolRefine;
     Int maxIts=4;
@@ -453,6 +470,46 @@ Int SolveAfter
         ldl::DistMultiVecNodeMeta& meta,
   const RegSolveCtrl<Base<F>>& ctrl );
 
+// Variants which precondition with a factorization in the demoted precision
+template<typename F>
+Int MixedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+
 } // namespace reg_ldl
 
 // LU
@@ -483,10 +540,20 @@ void LU( DistMatrix<F,STAR,STAR>& A );
 
 // LU with partial pivoting
 // ------------------------
+
+// If 'lookAhead' is true, the distributed factorization updates the next
+// panel before the rest of the trailing matrix and overlaps its
+// redistribution with the remainder of the update
+struct LUCtrl {
+    bool lookAhead=false;
+};
+
 template<typename F>
 void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
 void LU( ElementalMatrix<F>& A, DistPermutation& P );
+template<typename F>
+void LU( ElementalMatrix<F>& A, DistPermutation& P, const LUCtrl& ctrl );
 
 // LU with full pivoting
 // ---------------------
@@ -823,8 +890,12 @@ struct TreeData
     vector<Matrix<F>> tList;
     vector<Matrix<Base<F>>> dList;
 
-    TreeData( Int numStages=0 )
-    : QRList(numStages), tList(numStages), dList(numStages)
+    // Each node of the reduction tree absorbs up to arity-1 children, so that
+    // two yields a binary tree and the number of processes yields a flat tree
+    Int arity;
+
+    TreeData( Int numStages=0, Int arity_=2 )
+    : QRList(numStages), tList(numStages), dList(numStages), arity(arity_)
     { }
 
     TreeData( TreeData<F>&& treeData )
@@ -833,7 +904,8 @@ struct TreeData
       d0(move(treeData.d0)),
       QRList(move(treeData.QRList)),
       tList(move(treeData.tList)),
-      dList(move(treeData.dList))
+      dList(move(treeData.dList)),
+      arity(treeData.arity)
     { }
 
     TreeData<F>& operator=( TreeData<F>&& treeData )
@@ -844,17 +916,19 @@ struct TreeData
         QRList = move(treeData.QRList);
         tList = move(treeData.tList);
         dList = move(treeData.dList);
+        arity = treeData.arity;
         return *this;
     }
 };
 
 // Return an implicit tall-skinny QR factorization
 template<typename F>
-TreeData<F> TS( const ElementalMatrix<F>& A );
+TreeData<F> TS( const ElementalMatrix<F>& A, Int arity=2 );
 
 // Return an explicit tall-skinny QR factorization
 template<typename F>
-void ExplicitTS( ElementalMatrix<F>& A, ElementalMatrix<F>& R );
+void ExplicitTS
+( ElementalMatrix<F>& A, ElementalMatrix<F>& R, Int arity=2 );
 
 namespace ts {
 
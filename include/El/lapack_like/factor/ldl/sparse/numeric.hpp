@@ -226,6 +226,41 @@ struct DistMatrixNode
 template<typename F>
 struct DistFront;
 
+// A cached plan for streaming the nonzero values of a sparse matrix directly
+// into the storage of a frontal tree that was pulled from a matrix with the
+// same sparsity pattern (e.g., the KKT systems of an interior point method)
+struct FrontPullMeta
+{
+    // The sparsity pattern of the matrix that the plan was formed from
+    vector<Int> patternOffsets;
+    vector<Int> patternTargets;
+
+    // The offsets of the (lower-triangular) entries of A which are scattered
+    vector<Int> sourceOffs;
+
+    // The post-order index of the front that each entry lands in, the offset
+    // into its dense storage (or, for the top-left of a sparse leaf, into the
+    // values of 'workSparse'), and the offset of the mirrored entry within
+    // 'workSparse' (-1 for entries of the dense storage)
+    vector<Int> targetFronts;
+    vector<Int> targetOffs;
+    vector<Int> mirrorOffs;
+
+    // The leading dimensions of the dense storage when the plan was formed
+    vector<Int> frontLDims;
+
+    void Empty()
+    {
+        SwapClear( patternOffsets );
+        SwapClear( patternTargets );
+        SwapClear( sourceOffs );
+        SwapClear( targetFronts );
+        SwapClear( targetOffs );
+        SwapClear( mirrorOffs );
+        SwapClear( frontLDims );
+    }
+};
+
 template<typename F>
 struct Front
 {
@@ -262,6 +297,15 @@ struct Front
       const vector<Int>& reordering, 
       const NodeInfo& rootInfo,
       bool conjugate=true );
+    // Form 'meta' on the first call; afterwards, as long as the sparsity
+    // pattern of A is unchanged, only stream the values of A into the
+    // existing (and possibly factored) fronts
+    void Pull
+    ( const SparseMatrix<F>& A,
+      const vector<Int>& reordering, 
+      const NodeInfo& rootInfo,
+            FrontPullMeta& meta,
+      bool conjugate=true );
     void PullUpdate
     ( const SparseMatrix<F>& A,
       const vector<Int>& reordering, 
@@ -302,6 +346,42 @@ struct FactorCommMeta
 };
 void ComputeFactRecvInds( const DistNodeInfo& info );
 
+// The distributed analogue of FrontPullMeta, which also caches the exchange
+// of the entries of A between processes
+struct DistFrontPullMeta
+{
+    // The local sparsity pattern of the matrix that the plan was formed from
+    vector<Int> patternOffsets;
+    vector<Int> patternTargets;
+
+    // The local offsets of the entries of A sent to each process
+    vector<Int> sendSourceOffs;
+    vector<int> sendSizes, sendOffs;
+    vector<int> recvSizes, recvOffs;
+
+    // The destinations of the received entries, as in FrontPullMeta, where
+    // the distributed fronts are indexed after the local subtree
+    vector<Int> targetFronts;
+    vector<Int> targetOffs;
+    vector<Int> mirrorOffs;
+    vector<Int> frontLDims;
+
+    void Empty()
+    {
+        SwapClear( patternOffsets );
+        SwapClear( patternTargets );
+        SwapClear( sendSourceOffs );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( targetFronts );
+        SwapClear( targetOffs );
+        SwapClear( mirrorOffs );
+        SwapClear( frontLDims );
+    }
+};
+
 template<typename F>
 struct DistFront
 {
@@ -355,6 +435,16 @@ struct DistFront
             vector<Int>& mappedTargets,
             vector<Int>& colOffs,
       bool conjugate=false );
+    // Form 'meta' on the first call; afterwards, as long as the sparsity
+    // pattern of A is unchanged, only exchange the values of A and stream
+    // them into the existing (and possibly factored) fronts
+    void Pull
+    ( const DistSparseMatrix<F>& A,
+      const DistMap& reordering,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& info,
+            DistFrontPullMeta& meta,
+      bool conjugate=false );
 
     void PullUpdate
     ( const DistSparseMatrix<F>& A,
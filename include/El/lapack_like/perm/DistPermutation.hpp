@@ -64,6 +64,14 @@ struct PermutationMeta
             Int permAlign,
             mpi::Comm permComm );
 
+    // For each k, move row preimage[k] into row image[k], where the two lists
+    // are permutations of the same set of rows (all other rows are fixed)
+    PermutationMeta
+    ( const vector<Int>& image,
+      const vector<Int>& preimage,
+            Int permAlign,
+            mpi::Comm permComm );
+
     void Update
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
@@ -177,6 +185,14 @@ private:
     typedef std::pair<Int,mpi::Comm> keyType_;
     mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
     mutable bool staleMeta_=false;
+
+    // A swap sequence is applied by composing it into a permutation of the
+    // rows it touches, whose metadata is cached (for a single offset) in
+    // rowMeta_ and colMeta_
+    mutable Int metaOffset_=0;
+    const PermutationMeta& SwapMeta
+    ( std::map<keyType_,PermutationMeta>& metaMap,
+      Int align, mpi::Comm comm, Int offset ) const;
 };
 
 } // namespace El
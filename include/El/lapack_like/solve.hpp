@@ -15,12 +15,46 @@
 
 namespace El {
 
+// Control structure for the dense linear solvers
+// ==============================================
+// If 'mixedPrecision' is true, the factorization is computed in Demote<F>
+// (e.g., float for double-precision problems and double for Quad problems)
+// and the solution is refined in the working precision with GMRES-IR until
+// its normwise backward error is at most 'relTol' (see GMRESIR.hpp). If the
+// refinement fails, e.g., because the matrix is too ill-conditioned for the
+// lower precision, the system is refactored in the working precision unless
+// 'fallback' is false, in which case the RefinementFailureException is
+// propagated to the caller. Any other exception is always propagated.
+template<typename Real>
+struct LinearSolveCtrl
+{
+    bool mixedPrecision=false;
+    bool fallback=true;
+    Real relTol;
+    Real innerRelTol;
+    Int restart=20;
+    Int maxIts=60;
+    Int maxRefineIts=10;
+    bool progress=false;
+
+    LinearSolveCtrl()
+    {
+        const Real eps = Epsilon<Real>();
+        relTol = Pow(eps,Real(0.9));
+        innerRelTol = Pow(eps,Real(0.25));
+    }
+};
+
 // Linear
 // ======
 template<typename F>
-void LinearSolve( const Matrix<F>& A, Matrix<F>& B );
+void LinearSolve
+( const Matrix<F>& A, Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
-void LinearSolve( const ElementalMatrix<F>& A, ElementalMatrix<F>& B );
+void LinearSolve
+( const ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
 void LinearSolve
 ( const DistMatrix<F,MC,MR,BLOCK>& A, DistMatrix<F,MC,MR,BLOCK>& B );
@@ -130,11 +164,13 @@ void Overwrite
 template<typename F>
 void HPDSolve
 ( UpperOrLower uplo, Orientation orientation, 
-  const Matrix<F>& A, Matrix<F>& B );
+  const Matrix<F>& A, Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
 void HPDSolve
 ( UpperOrLower uplo, Orientation orientation,
-  const ElementalMatrix<F>& A, ElementalMatrix<F>& B );
+  const ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 
 template<typename F>
 void HPDSolve
@@ -174,6 +210,7 @@ void MultiShiftHessSolve
 } // namespace El
 
 #include "./solve/FGMRES.hpp"
+#include "./solve/GMRESIR.hpp"
 #include "./solve/LGMRES.hpp"
 #include "./solve/Refined.hpp"
 
@@ -152,7 +152,7 @@ inline Int Single
                 Axpy( -H.Get(i,j), vi, w );
             }
             const Real delta = Nrm2( w );
-            if( std::isnan(delta) )
+            if( IsNaN(delta) )
                 RuntimeError("Arnoldi step produced a NaN");
             if( delta == Real(0) )
                 restart = j+1;
@@ -183,17 +183,17 @@ inline Int Single
             // -----------------------------------------------------------
             const F eta_j_j = H.Get(j,j);
             const F eta_jp1_j = delta;
-            if( std::isnan(RealPart(eta_j_j))   ||
-                std::isnan(ImagPart(eta_j_j))   ||
-                std::isnan(RealPart(eta_jp1_j)) ||
-                std::isnan(ImagPart(eta_jp1_j)) )
+            if( IsNaN(RealPart(eta_j_j))   ||
+                IsNaN(ImagPart(eta_j_j))   ||
+                IsNaN(RealPart(eta_jp1_j)) ||
+                IsNaN(ImagPart(eta_jp1_j)) )
                 RuntimeError("Either H(j,j) or H(j+1,j) was NaN");
             Real c;
             F s;
             F rho = lapack::Givens( eta_j_j, eta_jp1_j, &c, &s );
-            if( std::isnan(c) ||
-                std::isnan(RealPart(s)) || std::isnan(ImagPart(s)) ||
-                std::isnan(RealPart(rho)) || std::isnan(ImagPart(rho)) )
+            if( IsNaN(c) ||
+                IsNaN(RealPart(s)) || IsNaN(ImagPart(s)) ||
+                IsNaN(RealPart(rho)) || IsNaN(ImagPart(rho)) )
                 RuntimeError("Givens rotation produced a NaN");
             H.Set( j, j, rho );
             cs.Set( j, 0, c );
@@ -244,7 +244,7 @@ inline Int Single
             // Residual checks
             // ---------------
             const Real residNorm = Nrm2( w );
-            if( std::isnan(residNorm) )
+            if( IsNaN(residNorm) )
                 RuntimeError("Residual norm was NaN");
             const Real relResidNorm = residNorm/origResidNorm;
             if( relResidNorm < relTol )
@@ -445,7 +445,7 @@ inline Int Single
                 Axpy( -H.Get(i,j), q, w );
             }
             const Real delta = Nrm2( w );
-            if( std::isnan(delta) )
+            if( IsNaN(delta) )
                 RuntimeError("Arnoldi step produced a NaN");
             if( delta == Real(0) )
                 restart = j+1;
@@ -476,17 +476,17 @@ inline Int Single
             // -----------------------------------------------------------
             const F eta_j_j = H.Get(j,j);
             const F eta_jp1_j = delta;
-            if( std::isnan(RealPart(eta_j_j))   ||
-                std::isnan(ImagPart(eta_j_j))   ||
-                std::isnan(RealPart(eta_jp1_j)) ||
-                std::isnan(ImagPart(eta_jp1_j)) )
+            if( IsNaN(RealPart(eta_j_j))   ||
+                IsNaN(ImagPart(eta_j_j))   ||
+                IsNaN(RealPart(eta_jp1_j)) ||
+                IsNaN(ImagPart(eta_jp1_j)) )
                 RuntimeError("Either H(j,j) or H(j+1,j) was NaN");
             Real c;
             F s;
             F rho = lapack::Givens( eta_j_j, eta_jp1_j, &c, &s );
-            if( std::isnan(c) ||
-                std::isnan(RealPart(s)) || std::isnan(ImagPart(s)) ||
-                std::isnan(RealPart(rho)) || std::isnan(ImagPart(rho)) )
+            if( IsNaN(c) ||
+                IsNaN(RealPart(s)) || IsNaN(ImagPart(s)) ||
+                IsNaN(RealPart(rho)) || IsNaN(ImagPart(rho)) )
                 RuntimeError("Givens rotation produced a NaN");
             H.Set( j, j, rho );
             cs.Set( j, 0, c );
@@ -538,7 +538,7 @@ inline Int Single
             // Residual checks
             // ---------------
             const Real residNorm = Nrm2( w );
-            if( std::isnan(residNorm) )
+            if( IsNaN(residNorm) )
                 RuntimeError("Residual norm was NaN");
             const Real relResidNorm = residNorm/origResidNorm;
             if( relResidNorm < relTol )
@@ -602,6 +602,309 @@ inline Int FGMRES
     return mostIts;
 }
 
+namespace fgmres {
+
+// The following variant keeps the vectors and the Krylov bases in a [VC,STAR]
+// distribution (aligned with b) so that the basis columns, the Arnoldi
+// updates, and the solution updates are all local operations, and the only
+// communication outside of applyA and precond is in the inner products
+// TODO: Add support for an initial guess
+template<typename F,class ApplyAType,class PrecondType>
+inline Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMatrix<F,VC,STAR>& b,
+        Base<F> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    DEBUG_ONLY(
+      CSE cse("fgmres::Single");
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    // Avoid half of the matrix-vector products by keeping the results of
+    // A z_j and A x_0
+    const bool saveProducts = true;
+    const bool time = false;
+
+    typedef Base<F> Real;
+    const Int n = b.Height();
+    const Grid& g = b.Grid();
+    const int commRank = g.Rank();
+    Timer iterTimer;
+
+    // x := 0
+    // ======
+    DistMatrix<F,VC,STAR> x(g);
+    x.AlignWith( b );
+    Zeros( x, n, 1 );
+
+    DistMatrix<F,VC,STAR> Ax0(g);
+    Ax0.AlignWith( b );
+    if( saveProducts )
+    {
+        // A x_0 := 0
+        // ==========
+        Zeros( Ax0, n, 1 );
+    }
+
+    // w := b (= b - A x_0)
+    // ====================
+    DistMatrix<F,VC,STAR> w(g);
+    w.AlignWith( b );
+    w = b;
+    const Real origResidNorm = Nrm2( w );
+    if( progress && commRank == 0 )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // TODO: Constrain the maximum number of iterations
+    Int iter=0;
+    bool converged = false;
+    Matrix<Real> cs;
+    Matrix<F> sn, H, t;
+    DistMatrix<F,VC,STAR> x0(g), q(g), V(g), Z(g), AZ(g);
+    x0.AlignWith( b );
+    q.AlignWith( b );
+    V.AlignWith( b );
+    Z.AlignWith( b );
+    AZ.AlignWith( b );
+    while( !converged )
+    {
+        if( progress && commRank == 0 )
+            Output("Starting FGMRES iteration ",iter);
+        const Int indent = PushIndent();
+
+        // x0 := x
+        // =======
+        x0 = x;
+        if( saveProducts && iter != 0 )
+            Ax0 = q;
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H,  restart, restart );
+        Zeros( V, n, restart );
+        Zeros( Z, n, restart );
+        if( saveProducts )
+            Zeros( AZ, n, restart );
+
+        // NOTE: w = b - A x already
+
+        // beta := || w ||_2
+        // =================
+        const Real beta = Nrm2( w );
+
+        // v0 := w / beta
+        // ==============
+        auto v0 = V( ALL, IR(0) );
+        v0 = w;
+        v0 *= 1/beta;
+
+        // t := beta e_0
+        // =============
+        Zeros( t, restart+1, 1 );
+        t.Set( 0, 0, beta );
+
+        // Run one round of GMRES(restart)
+        // ===============================
+        for( Int j=0; j<restart; ++j )
+        {
+            if( progress && commRank == 0 )
+                Output("Starting inner FGMRES iteration ",j);
+            if( time && commRank == 0 )
+                iterTimer.Start();
+            const Int innerIndent = PushIndent();
+
+            // z_j := inv(M) v_j
+            // =================
+            auto vj = V( ALL, IR(j) );
+            auto zj = Z( ALL, IR(j) );
+            zj = vj;
+            precond( zj );
+
+            // w := A z_j
+            // ----------
+            applyA( F(1), zj, F(0), w );
+            if( saveProducts )
+            {
+                auto Azj = AZ( ALL, IR(j) );
+                Azj = w;
+            }
+
+            // Run the j'th step of Arnoldi
+            // ----------------------------
+            for( Int i=0; i<=j; ++i )
+            {
+                // H(i,j) := v_i' w
+                // ^^^^^^^^^^^^^^^^
+                auto vi = V( ALL, IR(i) );
+                H.Set( i, j, Dot(vi,w) );
+
+                // w := w - H(i,j) v_i
+                // ^^^^^^^^^^^^^^^^^^^
+                Axpy( -H.Get(i,j), vi, w );
+            }
+            const Real delta = Nrm2( w );
+            if( IsNaN(delta) )
+                RuntimeError("Arnoldi step produced a NaN");
+            if( delta == Real(0) )
+                restart = j+1;
+            if( j+1 != restart )
+            {
+                // v_{j+1} := w / delta
+                // ^^^^^^^^^^^^^^^^^^^^
+                auto v_jp1 = V( ALL, IR(j+1) );
+                v_jp1 = w;
+                v_jp1 *= 1/delta;
+            }
+
+            // Apply existing rotations to the new column of H
+            // -----------------------------------------------
+            for( Int i=0; i<j; ++i )
+            {
+                const Real c = cs.Get(i,0);
+                const F s = sn.Get(i,0);
+                const F sConj = Conj(s);
+                const F eta_i_j = H.Get(i,j);
+                const F eta_ip1_j = H.Get(i+1,j);
+                H.Set( i,   j,  c    *eta_i_j + s*eta_ip1_j );
+                H.Set( i+1, j, -sConj*eta_i_j + c*eta_ip1_j );
+            }
+
+            // Generate and apply a new rotation to both H and the rotated
+            // beta*e_0 vector, t, then solve the minimum residual problem
+            // -----------------------------------------------------------
+            const F eta_j_j = H.Get(j,j);
+            const F eta_jp1_j = delta;
+            if( IsNaN(RealPart(eta_j_j))   ||
+                IsNaN(ImagPart(eta_j_j))   ||
+                IsNaN(RealPart(eta_jp1_j)) ||
+                IsNaN(ImagPart(eta_jp1_j)) )
+                RuntimeError("Either H(j,j) or H(j+1,j) was NaN");
+            Real c;
+            F s;
+            F rho = lapack::Givens( eta_j_j, eta_jp1_j, &c, &s );
+            if( IsNaN(c) ||
+                IsNaN(RealPart(s)) || IsNaN(ImagPart(s)) ||
+                IsNaN(RealPart(rho)) || IsNaN(ImagPart(rho)) )
+                RuntimeError("Givens rotation produced a NaN");
+            H.Set( j, j, rho );
+            cs.Set( j, 0, c );
+            sn.Set( j, 0, s );
+            // Apply the rotation to the rotated beta*e_0 vector
+            // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+            const F sConj = Conj(s);
+            const F tau_j = t.Get(j,0);
+            const F tau_jp1 = t.Get(j+1,0);
+            t.Set( j,   0,  c    *tau_j + s*tau_jp1 );
+            t.Set( j+1, 0, -sConj*tau_j + c*tau_jp1 );
+            // Minimize the residual
+            // ^^^^^^^^^^^^^^^^^^^^^
+            auto tT = t( IR(0,j+1), ALL );
+            auto HTL = H( IR(0,j+1), IR(0,j+1) );
+            auto y = tT;
+            Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+            // x := x0 + Zj y
+            // ^^^^^^^^^^^^^^
+            // NOTE: y is redundantly computed, so this update is local
+            x = x0;
+            auto Zj = Z( ALL, IR(0,j+1) );
+            auto yj = y( IR(0,j+1), ALL );
+            Gemv( NORMAL, F(1), Zj.LockedMatrix(), yj, F(1), x.Matrix() );
+
+            // w := b - A x
+            // ------------
+            w = b;
+            if( saveProducts )
+            {
+                // q := Ax = Ax0 + A Z_j y_j
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^
+                q = Ax0;
+                auto AZj = AZ( ALL, IR(0,j+1) );
+                Gemv( NORMAL, F(1), AZj.LockedMatrix(), yj, F(1), q.Matrix() );
+
+                // w := b - A x
+                // ^^^^^^^^^^^^
+                w -= q;
+            }
+            else
+            {
+                applyA( F(-1), x, F(1), w );
+            }
+
+            if( time && commRank == 0 )
+                Output("iter took ",iterTimer.Stop()," secs");
+
+            // Residual checks
+            // ---------------
+            const Real residNorm = Nrm2( w );
+            if( IsNaN(residNorm) )
+                RuntimeError("Residual norm was NaN");
+            const Real relResidNorm = residNorm/origResidNorm;
+            if( relResidNorm < relTol )
+            {
+                if( progress && commRank == 0 )
+                    Output("converged with relative tolerance: ",relResidNorm);
+                converged = true;
+                ++iter;
+                break;
+            }
+            else
+            {
+                if( progress && commRank == 0 )
+                    Output
+                    ("finished iteration ",iter," with relResidNorm=",
+                     relResidNorm);
+            }
+            ++iter;
+            if( iter == maxIts )
+                RuntimeError("FGMRES did not converge");
+            SetIndent( innerIndent );
+        }
+        SetIndent( indent );
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace fgmres
+
+// TODO: Add support for an initial guess
+template<typename F,class ApplyAType,class PrecondType>
+inline Int FGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMatrix<F,VC,STAR>& B,
+        Base<F> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    DEBUG_ONLY(CSE cse("FGMRES"))
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMatrix<F,VC,STAR> u(B.Grid());
+    u.AlignWith( B );
+    Zeros( u, height, 1 );
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        u = b;
+        const Int its =
+          fgmres::Single
+          ( applyA, precond, u, relTol, restart, maxIts, progress );
+        b = u;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
 } // namespace El
 
 #endif // ifndef EL_SOLVE_FGMRES_HPP
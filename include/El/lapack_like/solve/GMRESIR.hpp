@@ -0,0 +1,321 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SOLVE_GMRESIR_HPP
+#define EL_SOLVE_GMRESIR_HPP
+
+// GMRES-based iterative refinement (GMRES-IR), as described in
+//   Erin Carson and Nicholas J. Higham,
+//   "Accelerating the solution of linear systems by iterative refinement in
+//    three precisions", SIAM J. Sci. Comput., Vol. 40, No. 2, 2018.
+//
+// Each correction equation, A dx = r, is solved to the modest relative
+// tolerance 'innerRelTol' with FGMRES preconditioned by a (typically
+// low-precision) factorization of A, while the residuals and the updates to
+// the solution are formed in the working precision. Refinement stops once the
+// normwise backward error,
+//
+//   || b - A x ||_oo / ( || A ||_oo || x ||_oo + || b ||_oo ),
+//
+// is at most 'relTol'. If the residual stagnates first, or more than
+// 'maxRefineIts' corrections would be required, a RefinementFailureException
+// is thrown so that the caller can fall back to a full-precision
+// factorization.
+
+namespace El {
+
+namespace gmres_ir {
+
+template<typename F,class ApplyAType,class PrecondType>
+inline Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<F>& b,
+        Base<F> normA,
+        Base<F> relTol,
+        Base<F> innerRelTol,
+        Int restart,
+        Int maxIts,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_ONLY(
+      CSE cse("gmres_ir::Single");
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<F> Real;
+    const Int n = b.Height();
+    const Real bNorm = MaxNorm( b );
+    if( bNorm == Real(0) )
+        return 0;
+
+    Matrix<F> x, r, dx;
+    Zeros( x, n, 1 );
+    r = b;
+    Real residNorm = bNorm;
+    for( Int refineIt=0; refineIt<maxRefineIts; ++refineIt )
+    {
+        // Solve A dx = r with preconditioned FGMRES
+        // =========================================
+        dx = r;
+        fgmres::Single
+        ( applyA, precond, dx, innerRelTol, restart, maxIts, progress );
+        x += dx;
+
+        // r := b - A x
+        // ============
+        r = b;
+        applyA( F(-1), x, F(1), r );
+        const Real newResidNorm = MaxNorm( r );
+        const Real backwardError = newResidNorm / (normA*MaxNorm(x)+bNorm);
+        if( progress )
+            Output("GMRES-IR iteration ",refineIt,": ",backwardError);
+        if( backwardError <= relTol )
+        {
+            b = x;
+            return refineIt+1;
+        }
+        if( newResidNorm >= residNorm/2 )
+            break;
+        residNorm = newResidNorm;
+    }
+    throw RefinementFailureException("GMRES-IR did not converge");
+    return -1;
+}
+
+} // namespace gmres_ir
+
+template<typename F,class ApplyAType,class PrecondType>
+inline Int GMRESIR
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<F>& B,
+        Base<F> normA,
+        Base<F> relTol,
+        Base<F> innerRelTol,
+        Int restart,
+        Int maxIts,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_ONLY(CSE cse("GMRESIR"))
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        const Int its =
+          gmres_ir::Single
+          ( applyA, precond, b, normA, relTol, innerRelTol,
+            restart, maxIts, maxRefineIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+namespace gmres_ir {
+
+template<typename F,class ApplyAType,class PrecondType>
+inline Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& b,
+        Base<F> normA,
+        Base<F> relTol,
+        Base<F> innerRelTol,
+        Int restart,
+        Int maxIts,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_ONLY(
+      CSE cse("gmres_ir::Single");
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<F> Real;
+    const Int n = b.Height();
+    mpi::Comm comm = b.Comm();
+    const int commRank = mpi::Rank(comm);
+    const Real bNorm = MaxNorm( b );
+    if( bNorm == Real(0) )
+        return 0;
+
+    DistMultiVec<F> x(comm), r(comm), dx(comm);
+    Zeros( x, n, 1 );
+    r = b;
+    Real residNorm = bNorm;
+    for( Int refineIt=0; refineIt<maxRefineIts; ++refineIt )
+    {
+        // Solve A dx = r with preconditioned FGMRES
+        // =========================================
+        dx = r;
+        fgmres::Single
+        ( applyA, precond, dx, innerRelTol, restart, maxIts, progress );
+        x += dx;
+
+        // r := b - A x
+        // ============
+        r = b;
+        applyA( F(-1), x, F(1), r );
+        const Real newResidNorm = MaxNorm( r );
+        const Real backwardError = newResidNorm / (normA*MaxNorm(x)+bNorm);
+        if( progress && commRank == 0 )
+            Output("GMRES-IR iteration ",refineIt,": ",backwardError);
+        if( backwardError <= relTol )
+        {
+            b = x;
+            return refineIt+1;
+        }
+        if( newResidNorm >= residNorm/2 )
+            break;
+        residNorm = newResidNorm;
+    }
+    throw RefinementFailureException("GMRES-IR did not converge");
+    return -1;
+}
+
+} // namespace gmres_ir
+
+template<typename F,class ApplyAType,class PrecondType>
+inline Int GMRESIR
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& B,
+        Base<F> normA,
+        Base<F> relTol,
+        Base<F> innerRelTol,
+        Int restart,
+        Int maxIts,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_ONLY(CSE cse("GMRESIR"))
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<F> u(B.Comm());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its =
+          gmres_ir::Single
+          ( applyA, precond, u, normA, relTol, innerRelTol,
+            restart, maxIts, maxRefineIts, progress );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+// The following variant refines every right-hand side at once: the residuals
+// of the whole block are formed with a single application of A, and only the
+// columns which have not yet converged are corrected with FGMRES. B is left
+// in its [VC,STAR] distribution throughout so that applyA and precond may
+// keep their operands staged between calls.
+template<typename F,class ApplyAType,class PrecondType>
+inline Int GMRESIR
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMatrix<F,VC,STAR>& B,
+        Base<F> normA,
+        Base<F> relTol,
+        Base<F> innerRelTol,
+        Int restart,
+        Int maxIts,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_ONLY(CSE cse("GMRESIR"))
+    typedef Base<F> Real;
+    const Int n = B.Height();
+    const Int width = B.Width();
+    const Grid& g = B.Grid();
+    const int commRank = g.Rank();
+
+    DistMatrix<Real,STAR,STAR> bNorms(g), residNorms(g), xNorms(g);
+    ColumnMaxNorms( B, bNorms );
+
+    // Right-hand sides which are zero already hold their solutions
+    vector<Int> active;
+    for( Int j=0; j<width; ++j )
+        if( bNorms.GetLocal(j,0) != Real(0) )
+            active.push_back( j );
+    if( active.empty() )
+        return 0;
+
+    DistMatrix<F,VC,STAR> X(g), R(g), dx(g);
+    X.AlignWith( B );
+    R.AlignWith( B );
+    dx.AlignWith( B );
+    Zeros( X, n, width );
+    R = B;
+    Matrix<Real> lastResidNorms( bNorms.LockedMatrix() );
+    vector<Int> stillActive;
+    for( Int refineIt=0; refineIt<maxRefineIts; ++refineIt )
+    {
+        // Solve A dx = r with preconditioned FGMRES for each active column
+        // ================================================================
+        for( const Int j : active )
+        {
+            dx = R( ALL, IR(j) );
+            fgmres::Single
+            ( applyA, precond, dx, innerRelTol, restart, maxIts, progress );
+            auto x = X( ALL, IR(j) );
+            x += dx;
+        }
+
+        // R := B - A X
+        // ============
+        R = B;
+        applyA( F(-1), X, F(1), R );
+        ColumnMaxNorms( R, residNorms );
+        ColumnMaxNorms( X, xNorms );
+
+        Real maxBackwardError = 0;
+        bool stagnated = false;
+        stillActive.resize( 0 );
+        for( const Int j : active )
+        {
+            const Real residNorm = residNorms.GetLocal(j,0);
+            const Real backwardError =
+              residNorm /
+              (normA*xNorms.GetLocal(j,0)+bNorms.GetLocal(j,0));
+            maxBackwardError = Max(maxBackwardError,backwardError);
+            if( backwardError <= relTol )
+                continue;
+            if( residNorm >= lastResidNorms.Get(j,0)/2 )
+                stagnated = true;
+            lastResidNorms.Set( j, 0, residNorm );
+            stillActive.push_back( j );
+        }
+        if( progress && commRank == 0 )
+            Output("GMRES-IR iteration ",refineIt,": ",maxBackwardError);
+        if( stillActive.empty() )
+        {
+            B = X;
+            return refineIt+1;
+        }
+        if( stagnated )
+            break;
+        active.swap( stillActive );
+    }
+    throw RefinementFailureException("GMRES-IR did not converge");
+    return -1;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_GMRESIR_HPP
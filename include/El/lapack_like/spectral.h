@@ -174,32 +174,51 @@ typedef struct {
 } ElHermitianSDCCtrl_d;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl );
 
+/* HermitianDCCtrl */
+typedef struct {
+  ElInt cutoff;
+} ElHermitianDCCtrl_s;
+EL_EXPORT ElError ElHermitianDCCtrlDefault_s( ElHermitianDCCtrl_s* ctrl );
+
+typedef struct {
+  ElInt cutoff;
+} ElHermitianDCCtrl_d;
+EL_EXPORT ElError ElHermitianDCCtrlDefault_d( ElHermitianDCCtrl_d* ctrl );
+
 /* HermitianEigCtrl */
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
+  ElHermitianDCCtrl_s dcCtrl;
   bool useSDC;
+  bool useDC;
 } ElHermitianEigCtrl_s;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
+  ElHermitianDCCtrl_d dcCtrl;
   bool useSDC;
+  bool useDC;
 } ElHermitianEigCtrl_d;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
+  ElHermitianDCCtrl_s dcCtrl;
   bool useSDC;
+  bool useDC;
 } ElHermitianEigCtrl_c;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
+  ElHermitianDCCtrl_d dcCtrl;
   bool useSDC;
+  bool useDC;
 } ElHermitianEigCtrl_z;
 EL_EXPORT ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl );
 
@@ -719,6 +738,8 @@ EL_EXPORT ElError ElHermitianPolarDecompDist_z
 typedef struct {
   bool distAED;
   ElInt blockHeight, blockWidth;
+  bool scalapack;
+  ElInt minMultiBulgeSize, numShifts, deflationSize;
 } ElHessQRCtrl;
 EL_EXPORT ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl );
 
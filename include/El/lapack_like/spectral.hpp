@@ -34,12 +34,23 @@ struct HermitianSDCCtrl
     bool progress=false;
 };
 
+// Control structure for the distributed divide-and-conquer tridiagonal
+// eigensolver, which, unlike PMRRR, runs in the working precision
+template<typename Real>
+struct HermitianDCCtrl
+{
+    // Subproblems of at most this size are solved directly
+    Int cutoff=64;
+};
+
 template<typename F>
 struct HermitianEigCtrl
 {
     HermitianTridiagCtrl<F> tridiagCtrl;
     HermitianSDCCtrl<Base<F>> sdcCtrl;
+    HermitianDCCtrl<Base<F>> dcCtrl;
     bool useSDC=false;
+    bool useDC=false;
     bool timeStages=false;
 };
 
@@ -210,6 +221,25 @@ void HermitianTridiagEigPostEstimate
         ElementalMatrix<Real>& w,       ElementalMatrix<Real>& Z, 
   SortType sort, Real vl, Real vu );
 
+// Cuppen's divide and conquer
+// ---------------------------
+// All eigenpairs are computed (in the working precision) and the requested
+// subset is then extracted. When only eigenvalues are requested, there is
+// nothing to merge, and the processes instead divide the requested indices
+// amongst themselves and compute their eigenvalues by bisection.
+template<typename F>
+void HermitianTridiagEigDC
+( const ElementalMatrix<Base<F>>& d, const ElementalMatrix<F>& dSub,
+        ElementalMatrix<Base<F>>& w, SortType sort=ASCENDING,
+  const HermitianEigSubset<Base<F>>& subset=HermitianEigSubset<Base<F>>() );
+template<typename F>
+void HermitianTridiagEigDC
+( const ElementalMatrix<Base<F>>& d, const ElementalMatrix<F>& dSub,
+        ElementalMatrix<Base<F>>& w,       ElementalMatrix<F>& Z,
+  SortType sort=ASCENDING,
+  const HermitianEigSubset<Base<F>>& subset=HermitianEigSubset<Base<F>>(),
+  const HermitianDCCtrl<Base<F>>& ctrl=HermitianDCCtrl<Base<F>>() );
+
 namespace herm_eig {
 
 template<typename F>
@@ -276,10 +306,24 @@ struct SDCCtrl
     SignCtrl<Real> signCtrl;
 };
 
+// By default, distributed matrices are handled by a native multishift QR
+// algorithm with aggressive early deflation which works directly on the
+// [MC,MR] distribution. Active blocks of size at most 'minMultiBulgeSize' are
+// handed to LAPACK, and a 'numShifts' or 'deflationSize' of zero is chosen
+// based upon the size of the active block.
+//
+// If 'scalapack' is true, ScaLAPACK's implementation is instead run on a
+// block-cyclic copy with the given block dimensions, and 'distAED' determines
+// whether its aggressive early deflation is distributed.
 struct HessQRCtrl 
 {
     bool distAED=false;
     Int blockHeight=DefaultBlockHeight(), blockWidth=DefaultBlockWidth();
+
+    bool scalapack=false;
+    Int minMultiBulgeSize=256;
+    Int numShifts=0;
+    Int deflationSize=0;
 };
 
 template<typename Real>
@@ -25,6 +25,70 @@ Int LLL
 template<typename F>
 Base<F> LLLDelta( const Matrix<F>& QR );
 
+// LLL with deep insertions (Schnorr and Euchner). A positive depth restricts
+// insertions (other than standard LLL swaps) to the first 'depth' positions.
+template<typename F>
+Int DeepLLL
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Int depth=0,
+  Base<F> innerTol=0,
+  bool progress=false,
+  bool time=false );
+
+// A recursive (segmented) variant of LLL which independently reduces the
+// two halves of the basis (concurrently, when built with OpenMP) and then
+// merges them using a Householder QR factorization and a blocked
+// size-reduction. Bases with at most 'cutoff' columns are directly reduced.
+template<typename F>
+Int RecursiveLLL
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Base<F> innerTol=0,
+  Int cutoff=32,
+  bool progress=false,
+  bool time=false );
+
+// Block Korkine-Zolotarev (BKZ) reduction
+// =======================================
+// In the spirit of the "BKZ 2.0" variant of Chen and Nguyen, the enumeration
+// of each block may be (linearly) pruned and have its radius bounded by a
+// multiple of the Gaussian heuristic, and the number of tours over the basis
+// may be capped ("early abort").
+template<typename Real>
+struct BKZCtrl
+{
+    Int blocksize=20;
+    Real delta=Real(0.99);
+    Real innerTol=0;
+
+    // Use linear pruning (Gama, Nguyen, and Regev) during enumeration?
+    // Along with the following radius bound, this typically only pays off
+    // for large blocksizes (say, 30 or more).
+    bool prune=false;
+
+    // If positive, the enumeration radius of each block is limited to this
+    // multiple of the Gaussian heuristic of the projected block lattice
+    // (1.1 is the choice of Chen and Nguyen)
+    Real ghFactor=0;
+
+    // Stop after this many tours even if the basis is not yet BKZ-reduced
+    Int maxTours=std::numeric_limits<Int>::max();
+
+    bool progress=false;
+    bool time=false;
+};
+
+// Returns the number of tours over the basis. On exit, the upper triangle of
+// QR contains the R factor of B.
+template<typename Real>
+Int BKZ
+( Matrix<Real>& B,
+  Matrix<Real>& QR,
+  const BKZCtrl<Real>& ctrl=BKZCtrl<Real>() );
+
 template<typename F>
 void LatticeGramSchmidt( const Matrix<F>& B, Matrix<F>& G, Matrix<F>& M );
 
@@ -26,6 +26,17 @@
 #endif
 #endif
 
+#if defined(EL_ENABLE_DOUBLEDOUBLE)
+#ifndef PROTO_DOUBLEDOUBLE
+# define PROTO_DOUBLEDOUBLE PROTO_REAL(DoubleDouble)
+#endif
+#endif
+#if defined(EL_ENABLE_QUADDOUBLE)
+#ifndef PROTO_QUADDOUBLE
+# define PROTO_QUADDOUBLE PROTO_REAL(QuadDouble)
+#endif
+#endif
+
 #ifndef PROTO_COMPLEX
 # define PROTO_COMPLEX(T) PROTO(T)
 #endif
@@ -56,6 +67,12 @@ PROTO_DOUBLE
 #if defined(EL_ENABLE_QUAD) && defined(EL_HAVE_QUAD)
 PROTO_QUAD
 #endif
+#if defined(EL_ENABLE_DOUBLEDOUBLE)
+PROTO_DOUBLEDOUBLE
+#endif
+#if defined(EL_ENABLE_QUADDOUBLE)
+PROTO_QUADDOUBLE
+#endif
 #endif
 
 #if !defined(EL_NO_COMPLEX_PROTO)
@@ -22,7 +22,28 @@ typedef enum {
 
 /* Mehrotra Predictor-Corrector IPM
    ================================ */
-/* See the C++ structure for documentation of the members */
+/* See the C++ structures for documentation of the members */
+typedef struct {
+  ElInt maxCorrectors;
+  bool adaptive;
+  float stepIncrease;
+  float minImprovement;
+  float betaMin;
+  float betaMax;
+} ElGondzioCtrl_s;
+
+typedef struct {
+  ElInt maxCorrectors;
+  bool adaptive;
+  double stepIncrease;
+  double minImprovement;
+  double betaMin;
+  double betaMax;
+} ElGondzioCtrl_d;
+
+EL_EXPORT ElError ElGondzioCtrlDefault_s( ElGondzioCtrl_s* ctrl );
+EL_EXPORT ElError ElGondzioCtrlDefault_d( ElGondzioCtrl_d* ctrl );
+
 typedef struct {
   bool primalInit, dualInit;
   float minTol;
@@ -31,6 +52,7 @@ typedef struct {
   float maxStepRatio;
   ElKKTSystem system;
   bool mehrotra;
+  ElGondzioCtrl_s gondzioCtrl;
   bool forceSameStep;
   ElRegSolveCtrl_s solveCtrl;
   bool resolveReg;
@@ -54,6 +76,7 @@ typedef struct {
   double maxStepRatio;
   ElKKTSystem system;
   bool mehrotra;
+  ElGondzioCtrl_d gondzioCtrl;
   bool forceSameStep;
   ElRegSolveCtrl_d solveCtrl;
   bool resolveReg;
@@ -33,6 +33,68 @@ inline Real MehrotraCentrality
 ( Real mu, Real muAff, Real alphaAffPri, Real alphaAffDual )
 { return Min(Pow(muAff/mu,Real(3)),Real(1)); }
 
+// Gondzio's multiple centrality correctors
+// ----------------------------------------
+// After the (Mehrotra) predictor-corrector direction has been computed, each
+// corrector aims for a longer step of length min(alpha+stepIncrease,1) by
+// pulling the complementarity products of the corresponding trial point which
+// fall outside of [betaMin sigma mu, betaMax sigma mu] back towards the
+// central path. Each corrector only requires another solve with the existing
+// factorization and is only accepted if it lengthens the step by at least
+// minImprovement*stepIncrease. See
+//
+//   Jacek Gondzio,
+//   "Multiple centrality corrections in a primal-dual method for linear
+//    programming", Computational Optimization and Applications, Vol. 6,
+//   pp. 137--156, 1996.
+//
+template<typename Real>
+struct GondzioCtrl
+{
+    // The maximum number of correctors per iteration (zero disables them)
+    Int maxCorrectors=0;
+
+    // If true, the number of correctors attempted in each iteration grows
+    // with the ratio of the cost of forming and factoring the KKT system to
+    // the cost of a solve (up to 'maxCorrectors'). Otherwise, 'maxCorrectors'
+    // correctors are attempted in each iteration.
+    bool adaptive=true;
+
+    Real stepIncrease=Real(0.1);
+    Real minImprovement=Real(0.1);
+    Real betaMin=Real(0.1);
+    Real betaMax=Real(10);
+};
+
+// Gondzio's heuristic for the number of correctors which a factorization
+// which costs 'factorTime' can afford when a solve costs 'solveTime'.
+// The ratio is agreed upon over 'comm' so that every process attempts the
+// same number of (collective) corrector solves.
+template<typename Real>
+inline Int NumGondzioCorrectors
+( const GondzioCtrl<Real>& ctrl,
+  double factorTime,
+  double solveTime,
+  mpi::Comm comm=mpi::COMM_SELF )
+{
+    if( ctrl.maxCorrectors <= 0 )
+        return 0;
+    if( !ctrl.adaptive )
+        return ctrl.maxCorrectors;
+    double ratio =
+      ( solveTime > 0 ? factorTime/solveTime
+                      : std::numeric_limits<double>::max() );
+    ratio = mpi::AllReduce( ratio, mpi::MAX, comm );
+    Int numCorrectors = 1;
+    if( ratio > 10 )
+        ++numCorrectors;
+    if( ratio > 30 )
+        ++numCorrectors;
+    if( ratio > 50 )
+        ++numCorrectors;
+    return Min(numCorrectors,ctrl.maxCorrectors);
+}
+
 template<typename Real>
 struct MehrotraCtrl 
 {
@@ -44,8 +106,9 @@ struct MehrotraCtrl
     // 'affine' cone constraints, i.e., (h - G x) in K, the primal variables are
     // 'x' and 's', while the dual variables are again 'y' and 'z'.
     //
-    // NOTE: User initialization has not yet been tested, so there might be a 
-    //       trivial bug.
+    // NOTE: Sequences of related direct conic-form LPs and QPs can instead
+    //       be warm-started from the previous solution via a MehrotraSession
+    //       (see below).
     bool primalInit=false, dualInit=false;
 
     // Throw an exception if this tolerance could not be achieved.
@@ -74,9 +137,12 @@ struct MehrotraCtrl
     KKTSystem system=FULL_KKT;
 
     // Use Mehrotra's second-order corrector?
-    // TODO: Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // Follow the predictor-corrector direction with Gondzio's multiple
+    // centrality correctors?
+    GondzioCtrl<Real> gondzioCtrl;
+
     // Force the primal and dual step lengths to be the same size?
     bool forceSameStep=true;
 
@@ -136,7 +202,259 @@ struct MehrotraCtrl
 #endif
 
     // TODO: Add a user-definable (muAff,mu) -> sigma function to replace
-    //       the default, (muAff/mu)^3 
+    //       the default, (muAff/mu)^3
+};
+
+// Sessions for sequences of related direct conic-form LPs and QPs
+// ===============================================================
+// Solving a sequence of problems through the same session object reuses
+//
+//  1) the outer equilibration of A, which should be recomputed (via
+//     ResetEquilibration) if the entries of A change substantially,
+//  2) the nested-dissection ordering, frontal tree and scatter plan of the
+//     sparse KKT system, which are rebuilt whenever its sparsity pattern
+//     differs from that of the previous solve, and
+//  3) the previous solution as a starting point, after recentering its
+//     complementary pairs with pos_orth::Recenter. A starting point given
+//     via MehrotraCtrl::primalInit/dualInit takes precedence.
+//
+// The typical use is a rolling-horizon model where only b, c (and Q) change
+// between solves.
+
+template<typename Real>
+struct MehrotraWarmStartCtrl
+{
+    // Start from the solution of the previous solve of the session?
+    bool enabled=true;
+
+    // The recentering parameters passed to pos_orth::Recenter
+    Real muMin=Real(1e-2);
+    Real beta=Real(0.1);
+};
+
+// For Matrix and SparseMatrix problems
+template<typename Real>
+struct MehrotraSession
+{
+    MehrotraWarmStartCtrl<Real> warmStartCtrl;
+
+    // The outer equilibration of A
+    bool equilibrated=false;
+    Matrix<Real> dRow, dCol;
+
+    // The analysis of the sparse KKT system, along with the KKT formulation
+    // and the sparsity patterns of A and Q that it was formed from
+    bool analyzed=false;
+    KKTSystem system=FULL_KKT;
+    vector<Int> AOffsets, ATargets, QOffsets, QTargets;
+    vector<Int> map, invMap;
+    unique_ptr<ldl::NodeInfo> info;
+    unique_ptr<ldl::Separator> rootSep;
+    unique_ptr<ldl::Front<Real>> front;
+    ldl::FrontPullMeta frontMeta;
+
+    // The solution of the previous solve
+    bool solved=false;
+    Matrix<Real> x, y, z;
+
+    MehrotraSession() { ResetAnalysis(); }
+
+    void ResetEquilibration() { equilibrated = false; }
+
+    void ResetAnalysis()
+    {
+        analyzed = false;
+        info.reset( new ldl::NodeInfo );
+        rootSep.reset( new ldl::Separator );
+        front.reset( new ldl::Front<Real> );
+        frontMeta.Empty();
+    }
+
+    // Whether the analysis can be reused for the given problem
+    bool Analyzed
+    ( const SparseMatrix<Real>& A, KKTSystem kktSystem ) const
+    {
+        return analyzed && kktSystem == system && QOffsets.empty() &&
+               SamePattern( A, AOffsets, ATargets );
+    }
+    bool Analyzed
+    ( const SparseMatrix<Real>& Q, const SparseMatrix<Real>& A,
+      KKTSystem kktSystem ) const
+    {
+        return analyzed && kktSystem == system &&
+               SamePattern( Q, QOffsets, QTargets ) &&
+               SamePattern( A, AOffsets, ATargets );
+    }
+
+    // Mark the analysis as valid for the given problem
+    void RecordAnalysis( const SparseMatrix<Real>& A, KKTSystem kktSystem )
+    {
+        analyzed = true;
+        system = kktSystem;
+        SwapClear( QOffsets );
+        SwapClear( QTargets );
+        StorePattern( A, AOffsets, ATargets );
+    }
+    void RecordAnalysis
+    ( const SparseMatrix<Real>& Q, const SparseMatrix<Real>& A,
+      KKTSystem kktSystem )
+    {
+        RecordAnalysis( A, kktSystem );
+        StorePattern( Q, QOffsets, QTargets );
+    }
+
+private:
+    static bool SamePattern
+    ( const SparseMatrix<Real>& A,
+      const vector<Int>& offsets, const vector<Int>& targets )
+    {
+        const Int height = A.Height();
+        const Int numEntries = A.NumEntries();
+        const Int* offsetBuf = A.LockedOffsetBuffer();
+        const Int* targetBuf = A.LockedTargetBuffer();
+        return Int(offsets.size()) == height+1 &&
+               Int(targets.size()) == numEntries &&
+               std::equal( offsetBuf, offsetBuf+height+1, offsets.begin() ) &&
+               std::equal( targetBuf, targetBuf+numEntries, targets.begin() );
+    }
+
+    static void StorePattern
+    ( const SparseMatrix<Real>& A, vector<Int>& offsets, vector<Int>& targets )
+    {
+        const Int* offsetBuf = A.LockedOffsetBuffer();
+        const Int* targetBuf = A.LockedTargetBuffer();
+        offsets.assign( offsetBuf, offsetBuf+A.Height()+1 );
+        targets.assign( targetBuf, targetBuf+A.NumEntries() );
+    }
+};
+
+// For ElementalMatrix problems
+template<typename Real>
+struct DistMehrotraSession
+{
+    MehrotraWarmStartCtrl<Real> warmStartCtrl;
+
+    // The outer equilibration of A
+    bool equilibrated=false;
+    DistMatrix<Real,MC,STAR> dRow;
+    DistMatrix<Real,MR,STAR> dCol;
+
+    // The solution of the previous solve
+    bool solved=false;
+    DistMatrix<Real> x, y, z;
+
+    DistMehrotraSession( const Grid& grid=DefaultGrid() )
+    : dRow(grid), dCol(grid), x(grid), y(grid), z(grid)
+    { }
+
+    void ResetEquilibration() { equilibrated = false; }
+};
+
+// For DistSparseMatrix problems
+template<typename Real>
+struct DistSparseMehrotraSession
+{
+    MehrotraWarmStartCtrl<Real> warmStartCtrl;
+
+    // The outer equilibration of A
+    bool equilibrated=false;
+    DistMultiVec<Real> dRow, dCol;
+
+    // The analysis of the sparse KKT system, along with the KKT formulation
+    // and the local sparsity patterns of A and Q that it was formed from
+    bool analyzed=false;
+    KKTSystem system=FULL_KKT;
+    vector<Int> AOffsets, ATargets, QOffsets, QTargets;
+    DistMap map, invMap;
+    unique_ptr<ldl::DistNodeInfo> info;
+    unique_ptr<ldl::DistSeparator> rootSep;
+    unique_ptr<ldl::DistFront<Real>> front;
+    ldl::DistFrontPullMeta frontMeta;
+
+    // The solution of the previous solve
+    bool solved=false;
+    DistMultiVec<Real> x, y, z;
+
+    DistSparseMehrotraSession( mpi::Comm comm=mpi::COMM_WORLD )
+    : dRow(comm), dCol(comm), map(comm), invMap(comm),
+      x(comm), y(comm), z(comm)
+    { ResetAnalysis(); }
+
+    void ResetEquilibration() { equilibrated = false; }
+
+    void ResetAnalysis()
+    {
+        analyzed = false;
+        info.reset( new ldl::DistNodeInfo );
+        rootSep.reset( new ldl::DistSeparator );
+        front.reset( new ldl::DistFront<Real> );
+        frontMeta.Empty();
+    }
+
+    // Whether the analysis can be reused for the given problem (on every
+    // process)
+    bool Analyzed
+    ( const DistSparseMatrix<Real>& A, KKTSystem kktSystem ) const
+    {
+        const bool same =
+          analyzed && kktSystem == system && QOffsets.empty() &&
+          SamePattern( A, AOffsets, ATargets );
+        return mpi::AllReduce( int(same), mpi::MIN, A.Comm() ) != 0;
+    }
+    bool Analyzed
+    ( const DistSparseMatrix<Real>& Q, const DistSparseMatrix<Real>& A,
+      KKTSystem kktSystem ) const
+    {
+        const bool same =
+          analyzed && kktSystem == system &&
+          SamePattern( Q, QOffsets, QTargets ) &&
+          SamePattern( A, AOffsets, ATargets );
+        return mpi::AllReduce( int(same), mpi::MIN, A.Comm() ) != 0;
+    }
+
+    // Mark the analysis as valid for the given problem
+    void RecordAnalysis
+    ( const DistSparseMatrix<Real>& A, KKTSystem kktSystem )
+    {
+        analyzed = true;
+        system = kktSystem;
+        SwapClear( QOffsets );
+        SwapClear( QTargets );
+        StorePattern( A, AOffsets, ATargets );
+    }
+    void RecordAnalysis
+    ( const DistSparseMatrix<Real>& Q, const DistSparseMatrix<Real>& A,
+      KKTSystem kktSystem )
+    {
+        RecordAnalysis( A, kktSystem );
+        StorePattern( Q, QOffsets, QTargets );
+    }
+
+private:
+    static bool SamePattern
+    ( const DistSparseMatrix<Real>& A,
+      const vector<Int>& offsets, const vector<Int>& targets )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int numLocalEntries = A.NumLocalEntries();
+        const Int* offsetBuf = A.LockedOffsetBuffer();
+        const Int* targetBuf = A.LockedTargetBuffer();
+        return
+          Int(offsets.size()) == localHeight+1 &&
+          Int(targets.size()) == numLocalEntries &&
+          std::equal( offsetBuf, offsetBuf+localHeight+1, offsets.begin() ) &&
+          std::equal( targetBuf, targetBuf+numLocalEntries, targets.begin() );
+    }
+
+    static void StorePattern
+    ( const DistSparseMatrix<Real>& A,
+      vector<Int>& offsets, vector<Int>& targets )
+    {
+        const Int* offsetBuf = A.LockedOffsetBuffer();
+        const Int* targetBuf = A.LockedTargetBuffer();
+        offsets.assign( offsetBuf, offsetBuf+A.LocalHeight()+1 );
+        targets.assign( targetBuf, targetBuf+A.NumLocalEntries() );
+    }
 };
 
 // Alternating Direction Method of Multipliers
@@ -229,6 +547,16 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(false) );
 template<typename Real>
 void LP
+( const Matrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(false) );
+template<typename Real>
+void LP
 ( const ElementalMatrix<Real>& A, 
   const ElementalMatrix<Real>& b,
   const ElementalMatrix<Real>& c,
@@ -238,12 +566,41 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(false) );
 template<typename Real>
 void LP
+( const ElementalMatrix<Real>& A, 
+  const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+        DistMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(false) );
+template<typename Real>
+void LP
+( const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+template<typename Real>
+void LP
 ( const SparseMatrix<Real>& A, 
   const Matrix<Real>& b,
   const Matrix<Real>& c,
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+template<typename Real>
+void LP
+( const DistSparseMatrix<Real>& A, 
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 template<typename Real>
 void LP
@@ -253,6 +610,7 @@ void LP
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 
 // Affine conic form
@@ -408,6 +766,27 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 template<typename Real>
 void QP
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
+( const ElementalMatrix<Real>& Q,
+  const ElementalMatrix<Real>& A, 
+  const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
 ( const ElementalMatrix<Real>& Q,
   const ElementalMatrix<Real>& A, 
   const ElementalMatrix<Real>& b,
@@ -415,6 +794,7 @@ void QP
         ElementalMatrix<Real>& x,
         ElementalMatrix<Real>& y,
         ElementalMatrix<Real>& z,
+        DistMehrotraSession<Real>& session,
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 template<typename Real>
 void QP
@@ -428,6 +808,27 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 template<typename Real>
 void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A, 
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A, 
   const DistMultiVec<Real>& b,
@@ -435,6 +836,7 @@ void QP
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 
 // Affine conic form
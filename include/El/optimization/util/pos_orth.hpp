@@ -28,6 +28,38 @@ Real ComplementRatio
 ( const DistMultiVec<Real>& s,
   const DistMultiVec<Real>& z );
 
+// Gondzio's centrality correction
+// ===============================
+// Overwrite r with v - t, where v = (s + alphaPri ds) o (z + alphaDual dz)
+// are the complementarity products of a trial point and t is the projection
+// of v onto [betaMin*sigmaMu,betaMax*sigmaMu]. Entries of r which are larger
+// than betaMax*sigmaMu are truncated so that the few products which are much
+// too large do not dominate the correction.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const ElementalMatrix<Real>& s,
+  const ElementalMatrix<Real>& ds,
+  const ElementalMatrix<Real>& z,
+  const ElementalMatrix<Real>& dz,
+        ElementalMatrix<Real>& r,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax );
+
 // Maximum step
 // ============
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -100,6 +132,30 @@ void PushPairInto
   const DistMultiVec<Real>& w,
   Real wMaxNormLimit );
 
+// Recenter a (nearly) complementary pair
+// ======================================
+// With mu := max(s^T z / k, muMin), each pair whose product lies below
+// beta*mu is modified so that its product is exactly beta*mu, which is
+// useful for warm-starting an IPM from the solution of a related problem.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Recenter
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real muMin,
+  Real beta );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Recenter
+( ElementalMatrix<Real>& s,
+  ElementalMatrix<Real>& z,
+  Real muMin,
+  Real beta );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void Recenter
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real muMin,
+  Real beta );
+
 } // namespace pos_orth
 } // namespace El
 
@@ -191,6 +191,45 @@ void EmbeddingMaps
         DistMultiVec<Int>& sparseToOrigFirstInds,
   Int cutoffSparse );
 
+// Gondzio's centrality correction
+// ===============================
+// The analogue of pos_orth::GondzioCorrection in which the complementarity
+// product of each cone is measured by the inner product of the corresponding
+// members of the trial point, (s + alphaPri ds) and (z + alphaDual dz). The
+// correction is a multiple of the identity of each cone.
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const ElementalMatrix<Real>& s,
+  const ElementalMatrix<Real>& ds,
+  const ElementalMatrix<Real>& z,
+  const ElementalMatrix<Real>& dz,
+        ElementalMatrix<Real>& r,
+  const ElementalMatrix<Int>& orders,
+  const ElementalMatrix<Int>& firstInds,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax,
+  Int cutoff=1000 );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void GondzioCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax,
+  Int cutoff=1000 );
+
 // Identity
 // ========
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -473,13 +473,15 @@ lib.ElRegSolveCtrlDefault_s.argtypes = \
 lib.ElRegSolveCtrlDefault_d.argtypes = \
   [c_void_p]
 class RegSolveCtrl_s(ctypes.Structure):
-  _fields_ = [("alg",c_uint),("relTol",sType),("relTolRefine",sType),
+  _fields_ = [("alg",c_uint),("mixedPrecision",bType),
+              ("relTol",sType),("relTolRefine",sType),
               ("maxIts",iType),("maxRefineIts",iType),("restart",iType),
               ("progress",bType),("time",bType)]
   def __init__(self):
     lib.ElRegSolveCtrlDefault_s(pointer(self))
 class RegSolveCtrl_d(ctypes.Structure):
-  _fields_ = [("alg",c_uint),("relTol",dType),("relTolRefine",dType),
+  _fields_ = [("alg",c_uint),("mixedPrecision",bType),
+              ("relTol",dType),("relTolRefine",dType),
               ("maxIts",iType),("maxRefineIts",iType),("restart",iType),
               ("progress",bType),("time",bType)]
   def __init__(self):
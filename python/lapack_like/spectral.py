@@ -709,7 +709,10 @@ class SignCtrl_d(ctypes.Structure):
 lib.ElHessQRCtrlDefault.argtypes = [c_void_p]
 class HessQRCtrl(ctypes.Structure):
   _fields_ = [("distAED",bType),
-              ("blockHeight",iType),("blockWidth",iType)]
+              ("blockHeight",iType),("blockWidth",iType),
+              ("scalapack",bType),
+              ("minMultiBulgeSize",iType),("numShifts",iType),
+              ("deflationSize",iType)]
   def __init__(self):
     lib.ElHessQRCtrlDefault(pointer(self))
 
@@ -13,6 +13,26 @@ from El.lapack_like.factor import *
 
 # Mehrotra Predictor-Corrector IPMs
 # =================================
+lib.ElGondzioCtrlDefault_s.argtypes = \
+lib.ElGondzioCtrlDefault_d.argtypes = \
+  [c_void_p]
+class GondzioCtrl_s(ctypes.Structure):
+  _fields_ = [("maxCorrectors",iType),
+              ("adaptive",bType),
+              ("stepIncrease",sType),
+              ("minImprovement",sType),
+              ("betaMin",sType),("betaMax",sType)]
+  def __init__(self):
+    lib.ElGondzioCtrlDefault_s(pointer(self))
+class GondzioCtrl_d(ctypes.Structure):
+  _fields_ = [("maxCorrectors",iType),
+              ("adaptive",bType),
+              ("stepIncrease",dType),
+              ("minImprovement",dType),
+              ("betaMin",dType),("betaMax",dType)]
+  def __init__(self):
+    lib.ElGondzioCtrlDefault_d(pointer(self))
+
 lib.ElMehrotraCtrlDefault_s.argtypes = \
 lib.ElMehrotraCtrlDefault_d.argtypes = \
   [c_void_p,bType]
@@ -23,6 +43,7 @@ class MehrotraCtrl_s(ctypes.Structure):
               ("maxStepRatio",sType),
               ("system",c_uint),
               ("mehrotra",bType),
+              ("gondzioCtrl",GondzioCtrl_s),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_s),
               ("resolveReg",bType),
@@ -45,6 +66,7 @@ class MehrotraCtrl_d(ctypes.Structure):
               ("maxStepRatio",dType),
               ("system",c_uint),
               ("mehrotra",bType),
+              ("gondzioCtrl",GondzioCtrl_d),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_d),
               ("resolveReg",bType),
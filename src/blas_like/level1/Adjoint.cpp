@@ -69,6 +69,8 @@ void Adjoint( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
   ( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -37,6 +37,8 @@ void AdjointAxpyContract
                    BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
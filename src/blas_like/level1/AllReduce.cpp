@@ -88,6 +88,8 @@ void AllReduce( AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op )
   ( AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
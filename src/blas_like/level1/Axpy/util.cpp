@@ -48,6 +48,8 @@ void UpdateWithLocalData
   ( T alpha, const ElementalMatrix<T>& A, DistMatrix<T,STAR,STAR>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace util
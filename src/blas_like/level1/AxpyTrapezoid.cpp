@@ -187,6 +187,8 @@ void AxpyTrapezoid
   PROTO_TYPES(T,T)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
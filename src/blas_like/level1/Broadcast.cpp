@@ -95,6 +95,8 @@ void Broadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank )
   template void Broadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -333,6 +333,8 @@ void ColumnMinAbsNonzero
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -443,6 +443,8 @@ void ColumnTwoNorms
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
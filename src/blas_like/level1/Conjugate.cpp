@@ -59,6 +59,8 @@ void Conjugate( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
   template void Conjugate( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -68,6 +68,8 @@ void ConjugateSubmatrix
   ( AbstractDistMatrix<T>& A, const vector<Int>& I, const vector<Int>& J );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
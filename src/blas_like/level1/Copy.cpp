@@ -709,7 +709,27 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
 
 #endif
 
+#define PROTO_DOUBLEDOUBLE \
+  SAME(DoubleDouble) \
+  CONVERT(Int,DoubleDouble) \
+  CONVERT(float,DoubleDouble) \
+  CONVERT(double,DoubleDouble) \
+  CONVERT(DoubleDouble,float) \
+  CONVERT(DoubleDouble,double)
+
+#define PROTO_QUADDOUBLE \
+  SAME(QuadDouble) \
+  CONVERT(Int,QuadDouble) \
+  CONVERT(float,QuadDouble) \
+  CONVERT(double,QuadDouble) \
+  CONVERT(DoubleDouble,QuadDouble) \
+  CONVERT(QuadDouble,float) \
+  CONVERT(QuadDouble,double) \
+  CONVERT(QuadDouble,DoubleDouble)
+
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
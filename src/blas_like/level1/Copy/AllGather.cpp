@@ -18,6 +18,7 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>()>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::AllGather"))
+    ProfileRegion region( "copy::AllGather" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -39,10 +40,9 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            vector<T> buf;
-            FastResize( buf, (distStride+1)*portionSize );
-            T* sendBuf = &buf[0];
-            T* recvBuf = &buf[portionSize];
+            Memory<T> buf( (distStride+1)*portionSize );
+            T* sendBuf = buf.Buffer();
+            T* recvBuf = buf.Buffer()+portionSize;
 
             // Pack
             util::InterleaveMatrix
@@ -68,24 +68,23 @@ void AllGather
         // Pack from the root
         const Int BLocalHeight = B.LocalHeight();
         const Int BLocalWidth = B.LocalWidth();
-        vector<T> buf;
-        FastResize( buf, BLocalHeight*BLocalWidth );
+        Memory<T> buf( BLocalHeight*BLocalWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
             ( BLocalHeight, BLocalWidth,
               B.LockedBuffer(), 1, B.LDim(),
-              buf.data(),       1, BLocalHeight ); 
+              buf.Buffer(),     1, BLocalHeight ); 
 
         // Broadcast from the root
         mpi::Broadcast
-        ( buf.data(), BLocalHeight*BLocalWidth, A.Root(), A.CrossComm() );
+        ( buf.Buffer(), BLocalHeight*BLocalWidth, A.Root(), A.CrossComm() );
 
         // Unpack if not the root
         if( A.CrossRank() != A.Root() )
             util::InterleaveMatrix
             ( BLocalHeight, BLocalWidth,
-              buf.data(), 1, BLocalHeight,
-              B.Buffer(), 1, B.LDim() );
+              buf.Buffer(), 1, BLocalHeight,
+              B.Buffer(),   1, B.LDim() );
     }
 }
 
@@ -95,6 +94,7 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>(),BLOCK>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::AllGather"))
+    ProfileRegion region( "copy::AllGather" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -125,6 +125,8 @@ void AllGather
   PROTO_DIST(T,VR,  STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
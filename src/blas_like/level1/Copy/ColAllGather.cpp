@@ -22,6 +22,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
           B.RowDist() != A.RowDist() )
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::ColAllGather" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -48,25 +49,24 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             else if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> bcastBuf;
-                FastResize( bcastBuf, localWidthB );
+                Memory<T> bcastBuf( localWidthB );
 
                 if( A.ColRank() == A.ColAlign() )
                 {
                     B.Matrix() = A.LockedMatrix();
                     StridedMemCopy
-                    ( bcastBuf.data(),  1,
+                    ( bcastBuf.Buffer(), 1,
                       B.LockedBuffer(), B.LDim(), localWidthB );
                 }
 
                 // Broadcast within the column comm
                 mpi::Broadcast
-                ( bcastBuf.data(), localWidthB, A.ColAlign(), A.ColComm() );
+                ( bcastBuf.Buffer(), localWidthB, A.ColAlign(), A.ColComm() );
 
                 // Unpack
                 StridedMemCopy
-                ( B.Buffer(),      B.LDim(), 
-                  bcastBuf.data(), 1,        localWidthB );
+                ( B.Buffer(),        B.LDim(), 
+                  bcastBuf.Buffer(), 1,          localWidthB );
             }
             else
             {
@@ -75,10 +75,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -109,15 +108,15 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> buffer;
+                Memory<T> buffer;
                 T* bcastBuf;
 
                 if( A.ColRank() == A.ColAlign() )
                 {
                     const Int localWidth = A.LocalWidth();
-                    FastResize( buffer, localWidth+localWidthB );
-                    T* sendBuf = &buffer[0];
-                    bcastBuf   = &buffer[localWidth];
+                    buffer.Require( localWidth+localWidthB );
+                    T* sendBuf = buffer.Buffer();
+                    bcastBuf   = buffer.Buffer()+localWidth;
 
                     // Pack
                     StridedMemCopy
@@ -130,8 +129,8 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 }
                 else
                 {
-                    FastResize( buffer, localWidthB );
-                    bcastBuf = buffer.data();
+                    buffer.Require( localWidthB );
+                    bcastBuf = buffer.Buffer();
                 }
 
                 // Communicate
@@ -150,10 +149,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int portionSize =
                     mpi::Pad( maxLocalHeight*maxLocalWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* firstBuf  = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* firstBuf  = buffer.Buffer();
+                T* secondBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -184,24 +182,23 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
-        FastResize( buf, localHeight*localWidth );
+        Memory<T> buf( localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
               B.LockedBuffer(), 1, B.LDim(),
-              buf.data(),       1, localHeight );
+              buf.Buffer(),     1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
-        ( buf.data(), localHeight*localWidth, A.Root(), A.CrossComm() );
+        ( buf.Buffer(), localHeight*localWidth, A.Root(), A.CrossComm() );
 
         // Unpack if not the root
         if( A.CrossRank() != A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
-              buf.data(), 1, localHeight,
-              B.Buffer(), 1, B.LDim() );
+              buf.Buffer(), 1, localHeight,
+              B.Buffer(),   1, B.LDim() );
     }
 }
 
@@ -210,6 +207,7 @@ void ColAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::ColAllGather"))
+    ProfileRegion region( "copy::ColAllGather" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -222,6 +220,8 @@ void ColAllGather
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -18,6 +18,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   >& B )
 {
     DEBUG_ONLY(CSE cse("copy::ColAllToAllDemote"))
+    ProfileRegion region( "copy::ColAllToAllDemote" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -51,10 +52,9 @@ void ColAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
             // Pack            
             util::PartialColStridedPack
@@ -87,10 +87,9 @@ void ColAllToAllDemote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
         // Pack
         util::PartialColStridedPack
@@ -127,6 +126,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   ,BLOCK>& B )
 {
     DEBUG_ONLY(CSE cse("copy::ColAllToAllDemote"))
+    ProfileRegion region( "copy::ColAllToAllDemote" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -157,6 +157,8 @@ void ColAllToAllDemote
   PROTO_DIST(T,VR,  STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -18,6 +18,7 @@ void ColAllToAllPromote
         DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>()>& B )
 {
     DEBUG_ONLY(CSE cse("copy::ColAllToAllPromote"))
+    ProfileRegion region( "copy::ColAllToAllPromote" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -45,10 +46,9 @@ void ColAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
             // Pack            
             util::RowStridedPack
@@ -81,10 +81,9 @@ void ColAllToAllPromote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
         // Pack
         util::RowStridedPack
@@ -121,6 +120,7 @@ void ColAllToAllPromote
         DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>(),BLOCK>& B )
 {
     DEBUG_ONLY(CSE cse("copy::ColAllToAllPromote"))
+    ProfileRegion region( "copy::ColAllToAllPromote" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -151,6 +151,8 @@ void ColAllToAllPromote
   PROTO_DIST(T,VR,  STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -22,6 +22,7 @@ void ColFilter( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
           A.RowDist() != B.RowDist() )
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::ColFilter" );
     AssertSameGrids( A, B );
 
     B.AlignRowsAndResize
@@ -55,10 +56,9 @@ void ColFilter( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         const Int localWidthA = A.LocalWidth();
         const Int sendSize = localHeight*localWidthA;
         const Int recvSize = localHeight*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+sendSize;
 
         // Pack
         util::InterleaveMatrix
@@ -84,6 +84,7 @@ void ColFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_ONLY(CSE cse("copy::ColFilter"))
+    ProfileRegion region( "copy::ColFilter" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -96,6 +97,8 @@ void ColFilter
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
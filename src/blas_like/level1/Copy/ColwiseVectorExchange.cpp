@@ -18,6 +18,7 @@ void ColwiseVectorExchange
         DistMatrix<T,ProductDist<V,U>(),STAR>& B )
 {
     DEBUG_ONLY(CSE cse("copy::ColwiseVectorExchange"))
+    ProfileRegion region( "copy::ColwiseVectorExchange" );
     AssertSameGrids( A, B );
     if( !B.Participating() )
         return;
@@ -42,6 +43,8 @@ void ColwiseVectorExchange
   PROTO_DIST(T,MR,MC)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
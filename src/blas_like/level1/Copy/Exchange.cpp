@@ -21,6 +21,7 @@ void Exchange
       CSE cse("copy::Exchange");
       AssertSameGrids( A, B );
     )
+    ProfileRegion region( "copy::Exchange" );
     const int myRank = mpi::Rank( comm );
     DEBUG_ONLY(
       if( myRank == sendRank && myRank != recvRank )
@@ -54,55 +55,51 @@ void Exchange
     else if( contigB )
     {
         // Pack A's data
-        vector<T> buf;
-        FastResize( buf, sendSize );
+        Memory<T> buf( sendSize );
         copy::util::InterleaveMatrix
         ( localHeightA, localWidthA,
           A.LockedBuffer(), 1, A.LDim(),
-          buf.data(),       1, localHeightA );
+          buf.Buffer(),     1, localHeightA );
 
         // Exchange with the partner
         mpi::SendRecv
-        ( buf.data(), sendSize, sendRank,
+        ( buf.Buffer(), sendSize, sendRank,
           B.Buffer(), recvSize, recvRank, comm );
     }
     else if( contigA )
     {
         // Exchange with the partner
-        vector<T> buf;
-        FastResize( buf, recvSize );
+        Memory<T> buf( recvSize );
         mpi::SendRecv
         ( A.LockedBuffer(), sendSize, sendRank,
-          buf.data(),       recvSize, recvRank, comm );
+          buf.Buffer(),     recvSize, recvRank, comm );
 
         // Unpack
         copy::util::InterleaveMatrix
         ( localHeightB, localWidthB,
-          buf.data(), 1, localHeightB,
-          B.Buffer(), 1, B.LDim() );
+          buf.Buffer(), 1, localHeightB,
+          B.Buffer(),   1, B.LDim() );
     }
     else
     {
         // Pack A's data
-        vector<T> sendBuf;
-        FastResize( sendBuf, sendSize );
+        Memory<T> sendBuf( sendSize );
         copy::util::InterleaveMatrix
         ( localHeightA, localWidthA,
           A.LockedBuffer(), 1, A.LDim(),
-          sendBuf.data(),   1, localHeightA );
+          sendBuf.Buffer(), 1, localHeightA );
 
         // Exchange with the partner
-        vector<T> recvBuf;
-        FastResize( recvBuf, recvSize );
+        Memory<T> recvBuf( recvSize );
         mpi::SendRecv
-        ( sendBuf.data(), sendSize, sendRank,
-          recvBuf.data(), recvSize, recvRank, comm );
+        ( sendBuf.Buffer(), sendSize, sendRank,
+          recvBuf.Buffer(), recvSize, recvRank, comm );
 
         // Unpack
         copy::util::InterleaveMatrix
         ( localHeightB, localWidthB,
-          recvBuf.data(), 1, localHeightB,
-          B.Buffer(),     1, B.LDim() );
+          recvBuf.Buffer(), 1, localHeightB,
+          B.Buffer(),       1, B.LDim() );
     }
 }
 
@@ -112,6 +109,8 @@ void Exchange
     int sendRank, int recvRank, mpi::Comm comm );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
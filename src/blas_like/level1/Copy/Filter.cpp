@@ -18,6 +18,7 @@ void Filter
         DistMatrix<T,        U,           V   >& B )
 {
     DEBUG_ONLY(CSE cse("copy::Filter"))
+    ProfileRegion region( "copy::Filter" );
     AssertSameGrids( A, B );
 
     B.Resize( A.Height(), A.Width() );
@@ -38,6 +39,7 @@ void Filter
         DistMatrix<T,        U,           V   ,BLOCK>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Filter"))
+    ProfileRegion region( "copy::Filter" );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
 }
@@ -67,6 +69,8 @@ void Filter
   PROTO_DIST(T,VR,  STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -17,6 +17,7 @@ void Gather
         DistMatrix<T,CIRC,CIRC>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Gather"))
+    ProfileRegion region( "copy::Gather" );
     AssertSameGrids( A, B );
     if( A.DistSize() == 1 && A.CrossSize() == 1 )
     {
@@ -51,17 +52,17 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
-    FastResize( sendBuf, totalSend );
-    FastResize( recvBuf, totalRecv );
+    Memory<T> sendBuf, recvBuf;
+    sendBuf.Require( totalSend );
+    recvBuf.Require( totalRecv );
     if( !irrelevant )
         copy::util::InterleaveMatrix
         ( A.LocalHeight(), A.LocalWidth(),
           A.LockedBuffer(), 1, A.LDim(),
-          sendBuf.data(),   1, A.LocalHeight() );
+          sendBuf.Buffer(), 1, A.LocalHeight() );
     mpi::Gather
-    ( sendBuf.data(), totalSend,
-      recvBuf.data(), recvCounts.data(), recvOffsets.data(), 
+    ( sendBuf.Buffer(), totalSend,
+      recvBuf.Buffer(), recvCounts.data(), recvOffsets.data(), 
       B.Root(), B.CrossComm() );
 
     // Unpack
@@ -80,7 +81,7 @@ void Gather
             const Int localWidth = Length( width, rowShift, rowStride );
             copy::util::InterleaveMatrix
             ( localHeight, localWidth,
-              &recvBuf[recvOffsets[q]],    1,         localHeight,
+              recvBuf.Buffer()+recvOffsets[q],    1,         localHeight,
               B.Buffer(colShift,rowShift), colStride, rowStride*B.LDim() );
         }
     }
@@ -92,6 +93,7 @@ void Gather
         DistMatrix<T,CIRC,CIRC,BLOCK>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Gather"))
+    ProfileRegion region( "copy::Gather" );
     AssertSameGrids( A, B );
     if( A.DistSize() == 1 && A.CrossSize() == 1 )
     {
@@ -126,17 +128,17 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
-    FastResize( sendBuf, totalSend );
-    FastResize( recvBuf, totalRecv );
+    Memory<T> sendBuf, recvBuf;
+    sendBuf.Require( totalSend );
+    recvBuf.Require( totalRecv );
     if( !irrelevant )
         copy::util::InterleaveMatrix
         ( A.LocalHeight(), A.LocalWidth(),
           A.LockedBuffer(), 1, A.LDim(),
-          sendBuf.data(),   1, A.LocalHeight() );
+          sendBuf.Buffer(), 1, A.LocalHeight() );
     mpi::Gather
-    ( sendBuf.data(), totalSend,
-      recvBuf.data(), recvCounts.data(), recvOffsets.data(), 
+    ( sendBuf.Buffer(), totalSend,
+      recvBuf.Buffer(), recvCounts.data(), recvOffsets.data(), 
       B.Root(), B.CrossComm() );
 
     // Unpack
@@ -159,7 +161,7 @@ void Gather
               BlockedLength( height, colShift, mb, colCut, colStride );
             const Int localWidth = 
               BlockedLength( width, rowShift, nb, rowCut, rowStride );
-            const T* data = &recvBuf[recvOffsets[q]];
+            const T* data = recvBuf.Buffer()+recvOffsets[q];
             for( Int jLoc=0; jLoc<localWidth; ++jLoc )
             {
                 const Int jBefore = rowShift*nb - rowCut;
@@ -193,6 +195,8 @@ void Gather
           DistMatrix<T,CIRC,CIRC,BLOCK>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -13,6 +13,40 @@
 namespace El {
 namespace copy {
 
+// Return the ranks within 'comm' of the processes which own (the first copy
+// of) each portion of the distribution of A
+template<typename T>
+inline vector<int> DistOwnerMap
+( const AbstractDistMatrix<T>& A, mpi::Comm comm, bool includeViewers )
+{
+    DEBUG_ONLY(CSE cse("copy::DistOwnerMap"))
+    const Grid& g = A.Grid();
+    const Dist colDist=A.ColDist(), rowDist=A.RowDist();
+    const int root = A.Root();
+    const int distSize = A.ColStride()*A.RowStride();
+
+    vector<int> distMap(distSize);
+    for( int q=0; q<distSize; ++q )
+        distMap[q] = g.CoordsToVC(colDist,rowDist,q,root);
+    if( includeViewers )
+    {
+        // The viewing communicators of the two grids need not be identical
+        vector<int> viewingRanks(distSize);
+        for( int q=0; q<distSize; ++q )
+            viewingRanks[q] = g.VCToViewing(distMap[q]);
+        mpi::Translate
+        ( g.ViewingComm(), distSize, viewingRanks.data(),
+          comm, distMap.data() );
+    }
+    return distMap;
+}
+
+// Since every process can compute the owner of any entry with respect to
+// both distributions, no indices are transmitted with the entries: each
+// process packs its local entries of A for each destination in column-major
+// order, and, since the local orderings of the element-wise and block
+// distributions are both consistent with the global ordering, each owner of
+// B can unpack the entries from each source in its own column-major order.
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 inline void Helper
 ( const AbstractDistMatrix<S>& A,
@@ -25,138 +59,126 @@ inline void Helper
     const Int height = A.Height();
     const Int width = A.Width();
     const Grid& g = B.Grid();
-    const Dist colDist=B.ColDist(), rowDist=B.RowDist();
-    const int root = B.Root();
     B.Resize( height, width );
-    const bool BPartic = B.Participating();
 
     const bool includeViewers = (A.Grid() != B.Grid());
+    mpi::Comm comm;
+    if( includeViewers )
+    {
+        comm = g.ViewingComm();
+    }
+    else
+    {
+        if( !g.InGrid() )
+            return;
+        comm = g.VCComm();
+    }
+    const int commSize = mpi::Size( comm );
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
+    // Pack the data
+    // =============
+    vector<int> sendCounts(commSize,0), sendOffs;
+    vector<S> sendBuf;
     if( A.RedundantRank() == 0 )
     {
-        const bool noRedundant = B.RedundantSize() == 1;
+        const auto distMap = DistOwnerMap( B, comm, includeViewers );
         const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
 
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
+        vector<int> ownerRows(localHeight), ownerCols(localWidth);
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
-        }
+            ownerRows[iLoc] = B.RowOwner(A.GlobalRow(iLoc));
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            ownerCols[jLoc] = colStride*B.ColOwner(A.GlobalCol(jLoc));
 
-        remoteEntries.reserve( localHeight*localWidth );
-        distOwners.reserve( localHeight*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ++sendCounts[distMap[ownerRows[iLoc]+ownerCols[jLoc]]];
+        Scan( sendCounts, sendOffs );
+
+        FastResize( sendBuf, localHeight*localWidth );
+        auto offs = sendOffs;
         const S* ABuf = A.LockedBuffer();
         const Int ALDim = A.LDim();
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc ) 
+            const S* ACol = &ABuf[jLoc*ALDim];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
             {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S alpha = ABuf[iLoc+jLoc*ALDim];
-                if( noRedundant && isLocalRow && isLocalCol )
-                {
-                    B.SetLocal( localRow, localCol, Caster<S,T>::Cast(alpha) );
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
-                    distOwners.push_back( ownerRow + colStride*ownerCol );
-                }
+                const int q = distMap[ownerRows[iLoc]+ownerCols[jLoc]];
+                sendBuf[offs[q]++] = ACol[iLoc];
             }
-        }    
-    }
-
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
-    {
-        comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
-
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-        {
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
-            distMap[q] = g.VCToViewing(vcOwner);
-        }
-
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
         }
     }
     else
+        sendOffs.resize( commSize, 0 );
+
+    // Compute the receive metadata
+    // ============================
+    // Only the first member of each redundant team of B receives data, but
+    // every member needs to know how to unpack the broadcasted result
+    const bool BPartic = B.Participating();
+    vector<int> recvCounts(commSize,0), recvOffs;
+    vector<int> sourceRows, sourceCols, distMap;
+    Int totalRecv = 0;
+    if( BPartic )
     {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
+        distMap = DistOwnerMap( A, comm, includeViewers );
+        const int colStride = A.ColStride();
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
 
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-            distMap[q] = g.CoordsToVC(colDist,rowDist,q,root);
+        sourceRows.resize( localHeight );
+        sourceCols.resize( localWidth );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            sourceRows[iLoc] = A.RowOwner(B.GlobalRow(iLoc));
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            sourceCols[jLoc] = colStride*A.ColOwner(B.GlobalCol(jLoc));
 
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
-        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ++recvCounts[distMap[sourceRows[iLoc]+sourceCols[jLoc]]];
+        totalRecv = Scan( recvCounts, recvOffs );
     }
-    SwapClear( distOwners );
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<S>> sendBuf;
-    FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
+    else
+        recvOffs.resize( commSize, 0 );
 
     // Exchange and unpack the data
     // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    if( B.Participating() )
+    vector<S> recvBuf;
+    FastResize( recvBuf, totalRecv );
+    if( BPartic && B.RedundantRank() != 0 )
+    {
+        vector<int> zeros(commSize,0);
+        mpi::AllToAll
+        ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+          recvBuf.data(), zeros.data(),      zeros.data(), comm );
+    }
+    else
     {
-        Int recvBufSize = recvBuf.size();
-        mpi::Broadcast( recvBufSize, 0, B.RedundantComm() );
-        FastResize( recvBuf, recvBufSize );
-        mpi::Broadcast( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
+        mpi::AllToAll
+        ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    }
+    SwapClear( sendBuf );
+    if( BPartic )
+    {
+        if( B.RedundantSize() > 1 )
+            mpi::Broadcast( recvBuf.data(), totalRecv, 0, B.RedundantComm() );
+
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
         T* BBuf = B.Buffer();
         const Int BLDim = B.LDim();
-        for( Int k=0; k<recvBufSize; ++k )
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
-            const auto& entry = recvBuf[k];
-            BBuf[entry.i+entry.j*BLDim] = Caster<S,T>::Cast(entry.value);
+            T* BCol = &BBuf[jLoc*BLDim];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int q = distMap[sourceRows[iLoc]+sourceCols[jLoc]];
+                BCol[iLoc] = Caster<S,T>::Cast(recvBuf[recvOffs[q]++]);
+            }
         }
     }
 }
@@ -167,6 +189,7 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::GeneralPurpose"))
+    ProfileRegion region( "copy::GeneralPurpose" );
 
     if( A.Grid().Size() == 1 && B.Grid().Size() == 1 )
     {
@@ -185,6 +208,7 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::GeneralPurpose"))
+    ProfileRegion region( "copy::GeneralPurpose" );
 
     const Int height = A.Height();
     const Int width = A.Width();
@@ -304,7 +328,27 @@ void GeneralPurpose
 
 #endif
 
+#define PROTO_DOUBLEDOUBLE \
+  SAME(DoubleDouble) \
+  CONVERT(Int,DoubleDouble) \
+  CONVERT(float,DoubleDouble) \
+  CONVERT(double,DoubleDouble) \
+  CONVERT(DoubleDouble,float) \
+  CONVERT(DoubleDouble,double)
+
+#define PROTO_QUADDOUBLE \
+  SAME(QuadDouble) \
+  CONVERT(Int,QuadDouble) \
+  CONVERT(float,QuadDouble) \
+  CONVERT(double,QuadDouble) \
+  CONVERT(DoubleDouble,QuadDouble) \
+  CONVERT(QuadDouble,float) \
+  CONVERT(QuadDouble,double) \
+  CONVERT(QuadDouble,DoubleDouble)
+
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
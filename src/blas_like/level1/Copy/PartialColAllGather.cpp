@@ -18,6 +18,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::PartialColAllGather"))
+    ProfileRegion region( "copy::PartialColAllGather" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -65,10 +66,9 @@ void PartialColAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (colStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer( (colStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+portionSize;
 
             // Pack
             util::InterleaveMatrix
@@ -97,10 +97,9 @@ void PartialColAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (colStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        Memory<T> buffer( (colStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+portionSize;
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
@@ -135,6 +134,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V,BLOCK>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::PartialColAllGather"))
+    ProfileRegion region( "copy::PartialColAllGather" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -165,6 +165,8 @@ void PartialColAllGather
   PROTO_DIST(T,VR,  STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
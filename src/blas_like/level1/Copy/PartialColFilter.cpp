@@ -22,6 +22,7 @@ void PartialColFilter
           A.RowDist() != B.RowDist() )
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::PartialColFilter" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -67,10 +68,9 @@ void PartialColFilter
         const Int localHeightSend = Length( height, sendColShift, colStride );
         const Int sendSize = localHeightSend*width;
         const Int recvSize = localHeight    *width;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+sendSize;
         // Pack
         util::InterleaveMatrix
         ( localHeightSend, width,
@@ -95,6 +95,7 @@ void PartialColFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_ONLY(CSE cse("copy::PartialColFilter"))
+    ProfileRegion region( "copy::PartialColFilter" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -107,6 +108,8 @@ void PartialColFilter
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
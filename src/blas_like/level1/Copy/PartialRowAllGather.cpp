@@ -23,6 +23,7 @@ void PartialRowAllGather
           B.RowDist() != Partial(A.RowDist()) ) 
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::PartialRowAllGather" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -53,10 +54,9 @@ void PartialRowAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (rowStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer( (rowStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+portionSize;
    
             // Pack
             util::InterleaveMatrix
@@ -85,10 +85,9 @@ void PartialRowAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialRowAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (rowStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        Memory<T> buffer( (rowStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+portionSize;
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
@@ -123,6 +122,7 @@ void PartialRowAllGather
         BlockMatrix<T>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::PartialRowAllGather"))
+    ProfileRegion region( "copy::PartialRowAllGather" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -135,6 +135,8 @@ void PartialRowAllGather
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -22,6 +22,7 @@ void PartialRowFilter
           A.RowDist() != Partial(B.RowDist()) )
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::PartialRowFilter" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -67,10 +68,9 @@ void PartialRowFilter
         const Int localWidthSend = Length( width, sendRowShift, rowStride );
         const Int sendSize = height*localWidthSend;
         const Int recvSize = height*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+sendSize;
         // Pack
         util::InterleaveMatrix
         ( height, localWidthSend,
@@ -95,6 +95,7 @@ void PartialRowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_ONLY(CSE cse("copy::PartialRowFilter"))
+    ProfileRegion region( "copy::PartialRowFilter" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -107,6 +108,8 @@ void PartialRowFilter
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
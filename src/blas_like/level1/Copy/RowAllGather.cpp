@@ -22,6 +22,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
           Collect(A.RowDist()) != B.RowDist() )
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::RowAllGather" );
     AssertSameGrids( A, B );
     const Int height = A.Height();
     const Int width = A.Width();
@@ -50,10 +51,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -103,10 +103,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -137,24 +136,23 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
-        FastResize( buf, localHeight*localWidth );
+        Memory<T> buf( localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
               B.LockedBuffer(), 1, B.LDim(),
-              buf.data(),       1, localHeight );
+              buf.Buffer(),     1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
-        ( buf.data(), localHeight*localWidth, A.Root(), A.CrossComm() );
+        ( buf.Buffer(), localHeight*localWidth, A.Root(), A.CrossComm() );
 
         // Unpack if not the root
         if( A.CrossRank() != A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
-              buf.data(), 1, localHeight,
-              B.Buffer(), 1, B.LDim() );
+              buf.Buffer(), 1, localHeight,
+              B.Buffer(),   1, B.LDim() );
     }
 }
 
@@ -163,6 +161,7 @@ void RowAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::RowAllGather"))
+    ProfileRegion region( "copy::RowAllGather" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -175,6 +174,8 @@ void RowAllGather
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
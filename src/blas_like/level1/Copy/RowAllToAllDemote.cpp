@@ -18,6 +18,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   >& B )
 {
     DEBUG_ONLY(CSE cse("copy::RowAllToAllDemote"))
+    ProfileRegion region( "copy::RowAllToAllDemote" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -46,10 +47,9 @@ void RowAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+rowStrideUnion*portionSize;
 
             // Pack            
             util::PartialRowStridedPack
@@ -82,10 +82,9 @@ void RowAllToAllDemote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+rowStrideUnion*portionSize;
 
         // Pack
         util::PartialRowStridedPack
@@ -122,6 +121,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   ,BLOCK>& B )
 {
     DEBUG_ONLY(CSE cse("copy::RowAllToAllDemote"))
+    ProfileRegion region( "copy::RowAllToAllDemote" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -152,6 +152,8 @@ void RowAllToAllDemote
   PROTO_DIST(T,VR,  STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -23,6 +23,7 @@ void RowFilter
           A.RowDist() != Collect(B.RowDist()) )
           LogicError("Incompatible distributions");
     )
+    ProfileRegion region( "copy::RowFilter" );
     AssertSameGrids( A, B );
 
     B.AlignColsAndResize
@@ -57,10 +58,9 @@ void RowFilter
         const Int sendSize = localHeightA*localWidth;
         const Int recvSize = localHeight *localWidth;
 
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+sendSize;
 
         // Pack
         util::InterleaveMatrix
@@ -86,6 +86,7 @@ void RowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_ONLY(CSE cse("copy::RowFilter"))
+    ProfileRegion region( "copy::RowFilter" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -98,6 +99,8 @@ void RowFilter
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -18,6 +18,7 @@ void RowwiseVectorExchange
         DistMatrix<T,STAR,ProductDist<V,U>()>& B )
 {
     DEBUG_ONLY(CSE cse("copy::RowwiseVectorExchange"))
+    ProfileRegion region( "copy::RowwiseVectorExchange" );
     AssertSameGrids( A, B );
     if( !B.Participating() )
         return;
@@ -42,6 +43,8 @@ void RowwiseVectorExchange
   PROTO_DIST(T,MR,MC)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -18,6 +18,7 @@ void Scatter
         ElementalMatrix<T>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Scatter"))
+    ProfileRegion region( "copy::Scatter" );
     AssertSameGrids( A, B );
 
     const Int m = A.Height();
@@ -50,13 +51,13 @@ void Scatter
         return;
     }
 
-    vector<T> buffer;
+    Memory<T> buffer;
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if( A.CrossRank() == root )
     {
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        recvBuf    = &buffer[sendSize];
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        recvBuf    = buffer.Buffer()+sendSize;
 
         // Pack the send buffer
         copy::util::StridedPack
@@ -72,8 +73,8 @@ void Scatter
     }
     else
     {
-        FastResize( buffer, recvSize );
-        recvBuf = &buffer[0];
+        buffer.Require( recvSize );
+        recvBuf = buffer.Buffer();
 
         // Perform the receiving portion of the scatter from the non-root
         mpi::Scatter
@@ -94,6 +95,7 @@ void Scatter
         BlockMatrix<T>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Scatter"))
+    ProfileRegion region( "copy::Scatter" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -106,6 +108,7 @@ void Scatter
         DistMatrix<T,STAR,STAR>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Scatter"))
+    ProfileRegion region( "copy::Scatter" );
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -115,24 +118,23 @@ void Scatter
     if( B.Participating() )
     {
         const Int pkgSize = mpi::Pad( height*width );
-        vector<T> buffer;
-        FastResize( buffer, pkgSize );
+        Memory<T> buffer( pkgSize );
 
         // Pack            
         if( A.Participating() )
             util::InterleaveMatrix
             ( height, width,
               A.LockedBuffer(), 1, A.LDim(),
-              buffer.data(),    1, height );
+              buffer.Buffer(),  1, height );
 
         // Broadcast from the process that packed
-        mpi::Broadcast( buffer.data(), pkgSize, A.Root(), A.CrossComm() );
+        mpi::Broadcast( buffer.Buffer(), pkgSize, A.Root(), A.CrossComm() );
 
         // Unpack
         util::InterleaveMatrix
         ( height, width,
-          buffer.data(), 1, height,
-          B.Buffer(),    1, B.LDim() );
+          buffer.Buffer(), 1, height,
+          B.Buffer(),      1, B.LDim() );
     }
 }
 
@@ -142,6 +144,7 @@ void Scatter
         DistMatrix<T,STAR,STAR,BLOCK>& B )
 {
     DEBUG_ONLY(CSE cse("copy::Scatter"))
+    ProfileRegion region( "copy::Scatter" );
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -162,6 +165,8 @@ void Scatter
           DistMatrix<T,STAR,STAR,BLOCK>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -18,6 +18,7 @@ void TranslateBetweenGrids
         DistMatrix<T,U,V>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::TranslateBetweenGrids"))
+    ProfileRegion region( "copy::TranslateBetweenGrids" );
     GeneralPurpose( A, B );
 }
 
@@ -107,13 +108,12 @@ void TranslateBetweenGrids
         requiredMemory += maxSendSize;
     if( inBGrid )
         requiredMemory += maxSendSize;
-    vector<T> auxBuf;
-    FastResize( auxBuf, requiredMemory );
+    Memory<T> auxBuf( requiredMemory );
     Int offset = 0;
-    T* sendBuf = &auxBuf[offset];
+    T* sendBuf = auxBuf.Buffer()+offset;
     if( inAGrid )
         offset += maxSendSize;
-    T* recvBuf = &auxBuf[offset];
+    T* recvBuf = auxBuf.Buffer()+offset;
 
     Int recvRow = 0; // avoid compiler warnings...
     if( inAGrid )
@@ -245,13 +245,12 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
-    FastResize( buffer, requiredMemory );
+    Memory<T> buffer( requiredMemory );
     Int offset = 0;
-    T* sendBuf = &buffer[offset];
+    T* sendBuf = buffer.Buffer()+offset;
     if( rankA == 0 ) 
         offset += height*width;
-    T* bcastBuffer = &buffer[offset];
+    T* bcastBuffer = buffer.Buffer()+offset;
 
     // Send from the root of A to the root of B's matrix's grid
     mpi::Request sendRequest;
@@ -315,6 +314,8 @@ void TranslateBetweenGrids
   PROTO_DIST(T,VR,STAR) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -16,6 +16,7 @@ template<typename T,Dist U,Dist V>
 void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::TransposeDist"))
+    ProfileRegion region( "copy::TransposeDist" );
     AssertSameGrids( A, B );
 
     const Grid& g = B.Grid();
@@ -44,10 +45,9 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         const Int recvRankB = 
             (recvRankA/colStrideA)+rowStrideA*(recvRankA%colStrideA);
 
-        vector<T> buffer;
-        FastResize( buffer, (colStrideA+rowStrideA)*portionSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[colStrideA*portionSize];
+        Memory<T> buffer( (colStrideA+rowStrideA)*portionSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+colStrideA*portionSize;
 
         if( A.RowRank() == A.RowAlign() )
         {
@@ -118,10 +118,9 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         const Int recvRankA = 
             (recvRankB/rowStrideA)+colStrideA*(recvRankB%rowStrideA);
 
-        vector<T> buffer;
-        FastResize( buffer, (colStrideA+rowStrideA)*portionSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[rowStrideA*portionSize];
+        Memory<T> buffer( (colStrideA+rowStrideA)*portionSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+rowStrideA*portionSize;
 
         if( A.ColRank() == A.ColAlign() )
         {
@@ -215,6 +214,8 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
   PROTO_DIST(T,MR,MC)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace copy
@@ -320,7 +320,12 @@ void DiagonalScale
   DIST_PROTO_REAL(T,VC  ,STAR); \
   DIST_PROTO_REAL(T,VR  ,STAR);
 
+#define PROTO_DOUBLEDOUBLE PROTO(DoubleDouble)
+#define PROTO_QUADDOUBLE PROTO(QuadDouble)
+
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -470,8 +470,13 @@ void DiagonalSolve
   DIST_PROTO_REAL(Real,VC  ,STAR); \
   DIST_PROTO_REAL(Real,VR  ,STAR);
 
+#define PROTO_DOUBLEDOUBLE PROTO(DoubleDouble)
+#define PROTO_QUADDOUBLE PROTO(QuadDouble)
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
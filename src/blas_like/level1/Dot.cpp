@@ -38,6 +38,8 @@ T Dot( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
   template T Dot( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -85,6 +85,8 @@ T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
   template T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -40,6 +40,8 @@ void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func )
   ( DistMultiVec<T>& A, function<T(void)> func );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
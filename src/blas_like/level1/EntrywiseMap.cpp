@@ -189,6 +189,8 @@ void EntrywiseMap
   PROTO_TYPES(T,Int) \
   PROTO_TYPES(T,float) \
   PROTO_TYPES(T,double) \
+  PROTO_TYPES(T,DoubleDouble) \
+  PROTO_TYPES(T,QuadDouble) \
   PROTO_TYPES(T,Complex<float>) \
   PROTO_TYPES(T,Complex<double>) \
   template void EntrywiseMap( Matrix<T>& A, function<T(T)> func ); \
@@ -207,6 +209,8 @@ void EntrywiseMap
 #endif
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
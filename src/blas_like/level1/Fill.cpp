@@ -80,6 +80,8 @@ void Fill( DistSparseMatrix<T>& A, T alpha )
   template void Fill( DistSparseMatrix<T>& A, T alpha );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -45,6 +45,8 @@ void FillDiagonal( AbstractDistMatrix<T>& A, T alpha, Int offset )
   ( AbstractDistMatrix<T>& A, T alpha, Int offset );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
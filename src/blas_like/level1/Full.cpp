@@ -28,6 +28,8 @@ Matrix<T> Full( const SparseMatrix<T>& A )
   template Matrix<T> Full( const SparseMatrix<T>& A );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -212,6 +212,8 @@ GetImagPartOfDiagonal( const DistMatrix<T,U,V>& A, Int offset )
   PROTO_DIST(T,VR,  STAR)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
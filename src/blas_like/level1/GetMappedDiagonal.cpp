@@ -192,6 +192,8 @@ void GetMappedDiagonal
   PROTO_TYPES(T,Int) \
   PROTO_TYPES(T,float) \
   PROTO_TYPES(T,double) \
+  PROTO_TYPES(T,DoubleDouble) \
+  PROTO_TYPES(T,QuadDouble) \
   PROTO_TYPES(T,Quad) \
   PROTO_TYPES(T,Complex<float>) \
   PROTO_TYPES(T,Complex<double>) \
@@ -203,12 +205,16 @@ void GetMappedDiagonal
   PROTO_TYPES(T,Int) \
   PROTO_TYPES(T,float) \
   PROTO_TYPES(T,double) \
+  PROTO_TYPES(T,DoubleDouble) \
+  PROTO_TYPES(T,QuadDouble) \
   PROTO_TYPES(T,Complex<float>) \
   PROTO_TYPES(T,Complex<double>)
 
 #endif
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -645,6 +645,8 @@ void GetSubmatrix
           DistMultiVec<T>& ASub );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -115,6 +115,8 @@ T HilbertSchmidt( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
   ( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
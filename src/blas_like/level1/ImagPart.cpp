@@ -49,6 +49,8 @@ void ImagPart
           BlockMatrix<Base<T>>& AImag );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -46,6 +46,8 @@ void IndexDependentFill
   ( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -125,6 +125,8 @@ void IndexDependentMap
   PROTO_TYPES(Base<T>,T) 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
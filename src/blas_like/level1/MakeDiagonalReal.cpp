@@ -49,6 +49,8 @@ void MakeDiagonalReal( AbstractDistMatrix<T>& A, Int offset )
   template void MakeDiagonalReal( AbstractDistMatrix<T>& A, Int offset );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -45,6 +45,8 @@ void MakeHermitian( UpperOrLower uplo, DistSparseMatrix<T>& A )
   template void MakeHermitian( UpperOrLower uplo, DistSparseMatrix<T>& A );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
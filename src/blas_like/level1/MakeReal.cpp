@@ -39,6 +39,8 @@ void MakeReal( AbstractDistMatrix<T>& A )
   template void MakeReal( AbstractDistMatrix<T>& A ); 
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
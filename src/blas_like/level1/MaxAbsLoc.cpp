@@ -501,6 +501,8 @@ Entry<Base<T>> SymmetricMaxAbsLoc
   ( UpperOrLower uplo, const DistSparseMatrix<T>& x );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
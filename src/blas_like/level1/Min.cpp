@@ -133,6 +133,8 @@ Real SymmetricMin( UpperOrLower uplo, const AbstractDistMatrix<Real>& A )
 
 #define EL_NO_COMPLEX_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -358,6 +358,8 @@ SymmetricMinAbsLoc( UpperOrLower uplo, const AbstractDistMatrix<F>& A )
   ( UpperOrLower uplo, const AbstractDistMatrix<F>& A );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
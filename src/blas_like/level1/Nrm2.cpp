@@ -55,6 +55,8 @@ Base<F> Nrm2( const DistMultiVec<F>& x )
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -410,6 +410,8 @@ QuasiDiagonalScale
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
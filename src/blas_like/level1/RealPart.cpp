@@ -49,6 +49,8 @@ void RealPart
           BlockMatrix<Base<T>>& AReal );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -42,6 +42,8 @@ void Round( DistMultiVec<T>& A )
   template void Round( AbstractDistMatrix<T>& A ); \
   template void Round( DistMultiVec<T>& A );
 
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
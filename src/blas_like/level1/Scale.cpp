@@ -173,6 +173,8 @@ void Scale( S alpha, DistMultiVec<T>& A )
              AbstractDistMatrix<Base<T>>& AImag );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -149,6 +149,8 @@ void SetImagPartOfDiagonal
   PROTO_DIST(T,VR,  STAR)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -56,6 +56,8 @@ void Shift( DistMultiVec<T>& A, S alpha )
   PROTO_SAME(T)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -479,6 +479,8 @@ void HermitianSwap
   ( UpperOrLower uplo, AbstractDistMatrix<T>& A, Int to, Int from );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -56,6 +56,8 @@ void Symmetric2x2Inv( UpperOrLower uplo, Matrix<F>& D, bool conjugate )
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
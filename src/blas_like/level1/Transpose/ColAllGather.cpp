@@ -59,6 +59,8 @@ void ColAllGather
           BlockMatrix<T>& B, bool conjugate );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace transpose
@@ -75,6 +75,8 @@ void ColFilter
           BlockMatrix<T>& B, bool conjugate );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace transpose
@@ -73,6 +73,8 @@ void PartialColFilter
           BlockMatrix<T>& B, bool conjugate );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace transpose
@@ -189,6 +189,8 @@ void UpdateImagPartOfDiagonal
   PROTO_DIST(T,VR,  STAR)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -79,6 +79,8 @@ void UpdateSubmatrix
     const AbstractDistMatrix<T>& ASub );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -63,6 +63,8 @@ void Zero( DistMultiVec<T>& X )
   template void Zero( DistMultiVec<T>& A );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -245,6 +245,8 @@ void Gemv
     T beta,        ElementalMatrix<T>& y );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
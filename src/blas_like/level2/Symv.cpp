@@ -334,6 +334,8 @@ void LocalRowAccumulate
     const SymvCtrl<T>& ctrl );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
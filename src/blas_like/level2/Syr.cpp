@@ -163,6 +163,8 @@ void Syr
     const ElementalMatrix<T>& x, ElementalMatrix<T>& A, bool conjugate );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -43,6 +43,8 @@ void Trmv
     const Matrix<T>& A, Matrix<T>& x );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
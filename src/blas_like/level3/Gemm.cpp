@@ -12,9 +12,25 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
 
 namespace El {
 
+namespace {
+Int gemmReplicationFactor = 0;
+}
+
+Int GemmReplicationFactor()
+{ return gemmReplicationFactor; }
+
+void SetGemmReplicationFactor( Int replicationFactor )
+{
+    DEBUG_ONLY(CSE cse("SetGemmReplicationFactor"))
+    if( replicationFactor < 0 )
+        LogicError("Replication factor must be non-negative");
+    gemmReplicationFactor = replicationFactor;
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -58,6 +74,8 @@ void Gemm
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
     if( k != 0 )
     {
+        ProfileRegion region( "blas::Gemm" );
+        AddProfileFlops( (IsComplex<T>::value ? 8. : 2.)*m*n*k );
         blas::Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(),
@@ -93,7 +111,28 @@ void Gemm
   GemmAlgorithm alg )
 {
     DEBUG_ONLY(CSE cse("Gemm"))
+    ProfileRegion region( "Gemm" );
     C *= beta;
+    if( alg == GEMM_AUTO )
+    {
+        const Int m = C.Height();
+        const Int n = C.Width();
+        const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+        Int bsize;
+        const GemmAlgorithm tunedAlg =
+          TunedGemmAlgorithm<T>( orientA, orientB, m, n, k, A.Grid(), bsize );
+        PushBlocksizeStack( bsize );
+        try { Gemm( orientA, orientB, alpha, A, B, T(1), C, tunedAlg ); }
+        catch( ... ) { PopBlocksizeStack(); throw; }
+        PopBlocksizeStack();
+        return;
+    }
+    if( alg == GEMM_25D )
+    {
+        gemm::SUMMA25D
+        ( orientA, orientB, alpha, A, B, C, GemmReplicationFactor() );
+        return;
+    }
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
@@ -287,6 +326,8 @@ void LocalGemm
                    ElementalMatrix<T>& C );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
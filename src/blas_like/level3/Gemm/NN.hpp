@@ -29,6 +29,7 @@ Cannon_NN
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::Cannon_NN" );
     const Grid& g = APre.Grid();
     if( g.Height() != g.Width() )
         LogicError("Process grid must be square for Cannon's");
@@ -117,6 +118,7 @@ SUMMA_NNA
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NNA" );
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -172,6 +174,7 @@ SUMMA_NNB
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NNB" );
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -224,6 +227,7 @@ SUMMA_NNC
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NNC" );
     const Int sumDim = APre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -276,6 +280,7 @@ SUMMA_NNDot
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NNDot" );
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
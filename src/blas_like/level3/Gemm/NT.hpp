@@ -32,6 +32,7 @@ SUMMA_NTA
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
             DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NTA" );
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -89,6 +90,7 @@ SUMMA_NTB
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NTB" );
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -148,6 +150,7 @@ SUMMA_NTC
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_NTC" );
     const Int sumDim = APre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The default replication factor: the largest divisor c of p with c^3 <= p,
+// which corresponds to a 3D algorithm when p is a perfect cube
+inline Int DefaultReplicationFactor( Int p )
+{
+    Int c = 1;
+    for( Int cand=2; cand*cand*cand<=p; ++cand )
+        if( p % cand == 0 )
+            c = cand;
+    return c;
+}
+
+// 2.5D (and 3D) matrix-matrix multiplication
+// ==========================================
+// The p processes of the grid are split into c layers, each of which is a
+// p/c process grid. Layer l forms the contribution of the l'th of c
+// contiguous slices of the summation dimension using a standard SUMMA, and
+// the layers' results are summed with a variable-length ReduceScatter over
+// the communicator of processes in the same position of each layer. Since
+// each SUMMA involves only p/c processes and 1/c of the summation dimension,
+// the volume of communication per process is reduced by roughly a factor of
+// sqrt(c) relative to SUMMA over the full grid, at the cost of c times as
+// much workspace for C.
+//
+// The slices of A and B are moved onto (and the summed slices of C off of)
+// the layer grids with the standard [MC,MR] translation between grids.
+template<typename T>
+inline void
+SUMMA25D
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const ElementalMatrix<T>& APre,
+  const ElementalMatrix<T>& BPre,
+        ElementalMatrix<T>& CPre,
+  Int c )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA25D");
+      AssertSameGrids( APre, BPre, CPre );
+    )
+    ProfileRegion region( "gemm::SUMMA25D" );
+    const Grid& g = APre.Grid();
+    const Int p = g.Size();
+    if( c == 0 )
+        c = DefaultReplicationFactor( p );
+    if( c < 1 || p % c != 0 )
+        LogicError
+        ("Replication factor ",c," does not divide the ",p," processes");
+    if( c == 1 || mpi::Size(g.ViewingComm()) != p )
+    {
+        // There is nothing to replicate, or processes which are not in the
+        // grid would need to take part in the layer translations
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), CPre, GEMM_DEFAULT );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int sumDim = ( orientA==NORMAL ? A.Width() : A.Height() );
+    DEBUG_ONLY(
+      const Int mA = ( orientA==NORMAL ? A.Height() : A.Width() );
+      const Int nB = ( orientB==NORMAL ? B.Width() : B.Height() );
+      const Int kB = ( orientB==NORMAL ? B.Height() : B.Width() );
+      if( mA != m || nB != n || kB != sumDim )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
+    )
+
+    // The layer grids and the depth communicator are cached by the grid
+    const Int pLayer = p / c;
+    const Int layer = g.OwningRank() / pLayer;
+    mpi::Comm depthComm = g.LayerDepthComm( c );
+
+    // Replicate the slices of A and B over the layers
+    // ===============================================
+    // NOTE: Every process takes part in the translation onto each layer
+    vector<DistMatrix<T,MC,MR>> ALayers, BLayers, CLayers;
+    ALayers.reserve( c );
+    BLayers.reserve( c );
+    CLayers.reserve( c );
+    for( Int l=0; l<c; ++l )
+    {
+        const Range<Int> sumInd( (l*sumDim)/c, ((l+1)*sumDim)/c );
+        const Grid& layerGrid = g.LayerGrid( c, l );
+        ALayers.emplace_back( layerGrid );
+        BLayers.emplace_back( layerGrid );
+        CLayers.emplace_back( layerGrid );
+        if( orientA == NORMAL )
+            ALayers[l] = A( ALL, sumInd );
+        else
+            ALayers[l] = A( sumInd, ALL );
+        if( orientB == NORMAL )
+            BLayers[l] = B( sumInd, ALL );
+        else
+            BLayers[l] = B( ALL, sumInd );
+        CLayers[l].Resize( m, n );
+    }
+
+    // Form this layer's contribution
+    // ==============================
+    auto& CLayer = CLayers[layer];
+    Gemm
+    ( orientA, orientB, alpha, ALayers[layer], BLayers[layer], CLayer,
+      GEMM_DEFAULT );
+    ALayers.clear();
+    BLayers.clear();
+
+    // Sum the contributions so that layer l owns column block l of C
+    // ==============================================================
+    // Column block l consists of the columns of the layer grid's process
+    // columns in [l*numColGroups/c,(l+1)*numColGroups/c) "column groups",
+    // so that it is contiguous in every process's local matrix
+    const Int rowStride = CLayer.RowStride();
+    const Int numColGroups = (n+rowStride-1)/rowStride;
+    const Int localHeight = CLayer.LocalHeight();
+    const Int localWidth = CLayer.LocalWidth();
+    auto groupBeg = [&]( Int l ) { return (l*numColGroups)/c; };
+    auto localColBeg = [&]( Int l ) { return Min(groupBeg(l),localWidth); };
+    auto colBeg = [&]( Int l ) { return Min(groupBeg(l)*rowStride,n); };
+    {
+        vector<int> recvCounts(c);
+        for( Int l=0; l<c; ++l )
+            recvCounts[l] = (localColBeg(l+1)-localColBeg(l))*localHeight;
+        Matrix<T> CLayerCopy;
+        Copy( CLayer.LockedMatrix(), CLayerCopy );
+        mpi::ReduceScatter
+        ( CLayerCopy.LockedBuffer(),
+          CLayer.Buffer()+localColBeg(layer)*localHeight, recvCounts.data(),
+          depthComm );
+    }
+
+    // Add each layer's column block of the product into C
+    // ===================================================
+    DistMatrix<T,MC,MR> CBlock(g);
+    for( Int l=0; l<c; ++l )
+    {
+        const Range<Int> colInd( colBeg(l), colBeg(l+1) );
+        auto C1 = C( ALL, colInd );
+        CBlock.AlignWith( C1 );
+        CBlock = CLayers[l]( ALL, colInd );
+        Axpy( T(1), CBlock, C1 );
+    }
+}
+
+} // namespace gemm
+} // namespace El
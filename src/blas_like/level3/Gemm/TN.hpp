@@ -32,6 +32,7 @@ SUMMA_TNA
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_TNA" );
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -90,6 +91,7 @@ SUMMA_TNB
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_TNB" );
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -145,6 +147,7 @@ SUMMA_TNC
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_TNC" );
     const Int sumDim = BPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
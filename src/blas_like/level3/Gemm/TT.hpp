@@ -33,6 +33,7 @@ SUMMA_TTA
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_TTA" );
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -93,6 +94,7 @@ SUMMA_TTB
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_TTB" );
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -156,6 +158,7 @@ SUMMA_TTC
            DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
            DimsString(CPre,"C"));
     )
+    ProfileRegion region( "gemm::SUMMA_TTC" );
     const Int sumDim = APre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -0,0 +1,318 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <fstream>
+#include <map>
+
+namespace El {
+
+namespace {
+
+string gemmTuningFile;
+std::map<std::pair<int,int>,GemmCostModel> gemmCostModels;
+
+// Seconds per flop of a local Gemm with a square output of size 'size'
+// and an inner dimension of 'rank'
+double LocalGemmFlopTime( Int size, Int rank )
+{
+    Matrix<double> A, B, C;
+    Ones( A, size, rank );
+    Ones( B, rank, size );
+    Zeros( C, size, size );
+    const double flops = 2.*size*size*rank;
+    double minTime = std::numeric_limits<double>::max();
+    // The first run only warms up the caches
+    for( Int rep=0; rep<4; ++rep )
+    {
+        const double startTime = mpi::Time();
+        blas::Gemm
+        ( 'N', 'N', size, size, rank,
+          1., A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+          0., C.Buffer(), C.LDim() );
+        const double runTime = mpi::Time() - startTime;
+        if( rep > 0 )
+            minTime = Min( minTime, runTime );
+    }
+    return minTime / flops;
+}
+
+// Seconds per tree-level of a broadcast of 'numEntries' doubles
+double BroadcastTime( Int numEntries, mpi::Comm comm )
+{
+    const double numLevels = std::ceil(std::log2(double(mpi::Size(comm))));
+    vector<double> buf( numEntries, 1. );
+    const Int numReps = ( numEntries > 1 ? 3 : 10 );
+    mpi::Barrier( comm );
+    const double startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        mpi::Broadcast( buf.data(), numEntries, 0, comm );
+    const double runTime = mpi::Time() - startTime;
+    return runTime / (numReps*numLevels);
+}
+
+GemmCostModel Calibrate( const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("Calibrate"))
+    GemmCostModel model;
+
+    // Fit the time per flop of a local rank-b update to
+    // flopTime + panelFlopTime/b
+    const Int size = 256, thinRank = 16;
+    const double thinTime = LocalGemmFlopTime( size, thinRank );
+    const double wideTime = LocalGemmFlopTime( size, size );
+    model.panelFlopTime =
+      Max( (thinTime-wideTime)/(1./thinRank-1./size), 0. );
+    model.flopTime = Max( wideTime-model.panelFlopTime/size, 0. );
+
+    // Fit the time per tree-level of a broadcast to
+    // latency + numBytes*inverseBandwidth
+    model.latency = model.inverseBandwidth = 0;
+    mpi::Comm comm = g.Comm();
+    if( mpi::Size(comm) > 1 )
+    {
+        const Int numEntries = Int(1) << 17;
+        const double smallTime = BroadcastTime( 1, comm );
+        const double largeTime = BroadcastTime( numEntries, comm );
+        model.latency = smallTime;
+        model.inverseBandwidth =
+          Max( largeTime-smallTime, 0. ) / (numEntries*sizeof(double));
+    }
+
+    // Every process must make the same choices
+    double params[4] = { model.latency, model.inverseBandwidth,
+                         model.flopTime, model.panelFlopTime };
+    mpi::AllReduce( params, 4, mpi::MAX, comm );
+    model.latency = params[0];
+    model.inverseBandwidth = params[1];
+    model.flopTime = params[2];
+    model.panelFlopTime = params[3];
+    return model;
+}
+
+// Search the tuning file for a model of a grid of the given shape
+bool ReadCostModel( int height, int width, GemmCostModel& model )
+{
+    std::ifstream file( gemmTuningFile.c_str() );
+    if( !file.is_open() )
+        return false;
+    int fileHeight, fileWidth;
+    GemmCostModel fileModel;
+    while( file >> fileHeight >> fileWidth
+                >> fileModel.latency >> fileModel.inverseBandwidth
+                >> fileModel.flopTime >> fileModel.panelFlopTime )
+    {
+        if( fileHeight == height && fileWidth == width )
+        {
+            model = fileModel;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WriteCostModel( int height, int width, const GemmCostModel& model )
+{
+    std::ofstream file( gemmTuningFile.c_str(), std::ios::app );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",gemmTuningFile);
+    file.precision( 17 );
+    file << height << " " << width << " "
+         << model.latency << " " << model.inverseBandwidth << " "
+         << model.flopTime << " " << model.panelFlopTime << "\n";
+}
+
+inline double TreeDepth( Int p )
+{ return ( p > 1 ? std::ceil(std::log2(double(p))) : 0. ); }
+
+inline Int NumPanels( Int dim, Int bsize )
+{ return (dim+bsize-1)/bsize; }
+
+} // anonymous namespace
+
+void SetGemmTuningFile( const string& filename )
+{ gemmTuningFile = filename; }
+
+const GemmCostModel& GemmCalibration( const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("GemmCalibration"))
+    // Processes outside of the grid take no part in its calibration
+    static const GemmCostModel emptyModel = { 0., 0., 0., 0. };
+    if( !g.InGrid() )
+        return emptyModel;
+
+    // A process may have cached a model for a different grid of the same
+    // shape which the other processes of this grid were not a part of, so
+    // whether or not to (collectively) calibrate must be decided collectively.
+    // Reducing the cached models also guarantees that every process makes the
+    // same choices.
+    mpi::Comm comm = g.Comm();
+    const std::pair<int,int> shape( g.Height(), g.Width() );
+    auto it = gemmCostModels.find( shape );
+    double cached[5] = { 1, 0, 0, 0, 0 };
+    if( it != gemmCostModels.end() )
+    {
+        cached[0] = 0;
+        cached[1] = it->second.latency;
+        cached[2] = it->second.inverseBandwidth;
+        cached[3] = it->second.flopTime;
+        cached[4] = it->second.panelFlopTime;
+    }
+    mpi::AllReduce( cached, 5, mpi::MAX, comm );
+    if( cached[0] == 0 )
+    {
+        GemmCostModel& model = it->second;
+        model.latency = cached[1];
+        model.inverseBandwidth = cached[2];
+        model.flopTime = cached[3];
+        model.panelFlopTime = cached[4];
+        return model;
+    }
+
+    GemmCostModel model;
+    bool haveModel = false;
+    if( gemmTuningFile != "" )
+    {
+        double params[5] = { 0, 0, 0, 0, 0 };
+        if( g.Rank() == 0 &&
+            ReadCostModel( shape.first, shape.second, model ) )
+        {
+            params[0] = 1;
+            params[1] = model.latency;
+            params[2] = model.inverseBandwidth;
+            params[3] = model.flopTime;
+            params[4] = model.panelFlopTime;
+        }
+        mpi::Broadcast( params, 5, 0, comm );
+        haveModel = ( params[0] != 0 );
+        model.latency = params[1];
+        model.inverseBandwidth = params[2];
+        model.flopTime = params[3];
+        model.panelFlopTime = params[4];
+    }
+    if( !haveModel )
+    {
+        model = Calibrate( g );
+        if( gemmTuningFile != "" && g.Rank() == 0 )
+            WriteCostModel( shape.first, shape.second, model );
+    }
+    return gemmCostModels[shape] = model;
+}
+
+template<typename T>
+GemmAlgorithm TunedGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& g, Int& bsize )
+{
+    DEBUG_ONLY(CSE cse("TunedGemmAlgorithm"))
+    bsize = Blocksize();
+    if( !g.InGrid() )
+        return GEMM_SUMMA_C;
+    const GemmCostModel& model = GemmCalibration( g );
+    const double alpha = model.latency;
+    const double beta = model.inverseBandwidth*sizeof(T);
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const double rTree = TreeDepth(r), cTree = TreeDepth(c),
+                 pTree = TreeDepth(p);
+    const double rFrac = double(r-1)/r, cFrac = double(c-1)/c;
+    const double mD = m, nD = n, kD = k;
+    const double flops = (IsComplex<T>::value ? 8. : 2.)*mD*nD*kD/p;
+    auto localTime = [&]( Int nb )
+    { return flops*(model.flopTime+model.panelFlopTime/nb); };
+
+    // Each SUMMA variant broadcasts or sums panels along both the process
+    // rows and columns and communicates a fixed volume of data
+    const double summaLatency = alpha*(rTree+cTree);
+    const bool normal = ( orientA == NORMAL && orientB == NORMAL );
+    auto cost = [&]( GemmAlgorithm alg, Int nb ) -> double
+    {
+        switch( alg )
+        {
+        case GEMM_SUMMA_A:
+            return NumPanels(n,nb)*summaLatency +
+              beta*(kD*nD/c*rFrac+mD*nD/r*cFrac) + localTime(nb);
+        case GEMM_SUMMA_B:
+            return NumPanels(m,nb)*summaLatency +
+              beta*(mD*kD/r*cFrac+mD*nD/c*rFrac) + localTime(nb);
+        case GEMM_SUMMA_C:
+            return NumPanels(k,nb)*summaLatency +
+              beta*(mD*kD/r*cFrac+kD*nD/c*rFrac) + localTime(nb);
+        case GEMM_SUMMA_DOT:
+        {
+            // Each outer panel is redistributed over the full grid, and each
+            // block of C is the sum of contributions from every process
+            const Int numOuter = NumPanels(Max(m,n),nb);
+            const Int numInner = NumPanels(Min(m,n),nb);
+            const double nbD = nb;
+            return numOuter*(alpha*pTree+beta*nbD*kD/p) +
+              numOuter*numInner*(2*alpha*pTree+beta*(nbD*kD/p+nbD*nbD)) +
+              localTime(nb);
+        }
+        case GEMM_CANNON:
+        {
+            // Every step shifts the local portions of A and B by one process
+            const double pSqrt = r;
+            return 2*(pSqrt+1)*alpha + (pSqrt+1)*beta*(mD*kD+kD*nD)/p +
+              flops*model.flopTime;
+        }
+        default:
+            return std::numeric_limits<double>::max();
+        }
+    };
+
+    vector<GemmAlgorithm> algs;
+    algs.push_back( GEMM_SUMMA_A );
+    algs.push_back( GEMM_SUMMA_B );
+    algs.push_back( GEMM_SUMMA_C );
+    if( normal )
+    {
+        algs.push_back( GEMM_SUMMA_DOT );
+        if( r == c && r > 1 && k % r == 0 )
+            algs.push_back( GEMM_CANNON );
+    }
+    const Int bsizes[] = { 32, 64, 96, 128, 192, 256, 384, 512 };
+
+    // Pick the algorithm with the lowest modeled cost and then the smallest
+    // blocksize whose cost is within five percent of it, since the model
+    // ignores the cache and workspace costs of wide panels
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestCost = std::numeric_limits<double>::max();
+    for( auto alg : algs )
+        for( auto nb : bsizes )
+        {
+            const double algCost = cost( alg, nb );
+            if( algCost < bestCost )
+            {
+                bestAlg = alg;
+                bestCost = algCost;
+            }
+        }
+    for( auto nb : bsizes )
+    {
+        if( cost( bestAlg, nb ) <= 1.05*bestCost )
+        {
+            bsize = nb;
+            break;
+        }
+    }
+    return bestAlg;
+}
+
+#define PROTO(T) \
+  template GemmAlgorithm TunedGemmAlgorithm<T> \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, const Grid& g, Int& bsize );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -40,6 +40,8 @@ void Hemm
     T beta,        ElementalMatrix<T>& C );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
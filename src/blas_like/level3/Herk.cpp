@@ -125,6 +125,8 @@ void Herk
 
 // blas::Herk not yet supported for Int
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -14,453 +14,367 @@ namespace El {
 
 namespace {
 
+// A generic CSR kernel
+// ====================
+// Every variant below is expressed in terms of a single engine which
+// accesses entry (j,k) of the multivector X as X[j*xRowStride+k*xColStride]
+// (and similarly for Y), so that column-major and interleaved storage share
+// the same code. The right-hand sides are processed in blocks of four so that
+// each pass over the sparse matrix is amortized over several columns.
+//
+// Row i is represented by the entries in [rowBegs[i],rowEnds[i]), which, for
+// a standard CSR matrix, are given by rowBegs=rowOffsets and
+// rowEnds=rowOffsets+1, and the column indices are shifted by colShift. This
+// allows a distributed multiply to separately handle the entries of each row
+// which involve locally-owned and remote portions of the multivector.
+//
+// When Elemental is built with EL_HYBRID, the rows are split between the
+// OpenMP threads into contiguous blocks containing roughly the same number of
+// nonzeros. The (conjugate-)transposed products accumulate into per-thread
+// buffers which are then summed so that no two threads ever update the same
+// entry of the output.
+
+const Int CSR_RHS_BLOCK = 4;
+
+#ifdef EL_HYBRID
+// Below this many multiply-adds, the fork/join overhead dominates
+const Int CSR_MIN_PARALLEL_WORK = 16384;
+
+// The first row owned by thread t when the nonzeros are evenly divided
+Int CSRRowSplit
+( Int m, const Int* rowBegs, const Int* rowEnds, Int numThreads, Int t )
+{
+    if( t <= 0 || m == 0 )
+        return 0;
+    if( t >= numThreads )
+        return m;
+    const double numNonzeros = rowEnds[m-1] - rowBegs[0];
+    const Int target = rowBegs[0] + Int((numNonzeros*t)/numThreads);
+    return std::lower_bound( rowBegs, rowBegs+m, target ) - rowBegs;
+}
+#endif
+
+// Y(iBeg:iEnd-1,:) := alpha A(iBeg:iEnd-1,:) X + beta Y(iBeg:iEnd-1,:)
 template<typename T>
-void MultiplyCSR
-( Orientation orientation, Int m, Int n,
+void CSRRowsNormal
+( Int iBeg, Int iEnd, Int numRHS,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
+  const Int* rowBegs,
+  const Int* rowEnds,
+  const Int* colIndices, Int colShift,
   const T*   values,
-  const T*   x,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   y )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
-    char matDescrA[6];
-    matDescrA[0] = 'G';
-    matDescrA[3] = 'C';
-    mkl::csrmv
-    ( orientation, m, n, alpha, matDescrA, 
-      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
-#else
-    if( orientation == NORMAL )
+    Int k=0;
+    for( ; k+CSR_RHS_BLOCK<=numRHS; k+=CSR_RHS_BLOCK )
     {
-        for( Int i=0; i<m; ++i )
+        const T* X0 = &X[k*xColStride];
+        const T* X1 = X0 + xColStride;
+        const T* X2 = X1 + xColStride;
+        const T* X3 = X2 + xColStride;
+        T* Y0 = &Y[k*yColStride];
+        T* Y1 = Y0 + yColStride;
+        T* Y2 = Y1 + yColStride;
+        T* Y3 = Y2 + yColStride;
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
+            T sum0=0, sum1=0, sum2=0, sum3=0;
+            const Int eStart = rowBegs[i];
+            const Int eStop = rowEnds[i];
             for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
             {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                const T value = values[e];
+                const Int jOff = (colIndices[e]-colShift)*xRowStride;
+                sum0 += value*X0[jOff];
+                sum1 += value*X1[jOff];
+                sum2 += value*X2[jOff];
+                sum3 += value*X3[jOff];
             }
+            const Int iOff = i*yRowStride;
+            Y0[iOff] = alpha*sum0 + beta*Y0[iOff];
+            Y1[iOff] = alpha*sum1 + beta*Y1[iOff];
+            Y2[iOff] = alpha*sum2 + beta*Y2[iOff];
+            Y3[iOff] = alpha*sum3 + beta*Y3[iOff];
         }
     }
-#endif
-}
-
-template<>
-void MultiplyCSR<Int>
-( Orientation orientation, Int m, Int n,
-  Int alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const Int*   values,
-  const Int*   x,
-  Int beta,
-        Int*   y )
-{
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-    if( orientation == NORMAL )
+    for( ; k<numRHS; ++k )
     {
-        for( Int i=0; i<m; ++i )
+        const T* x = &X[k*xColStride];
+        T* y = &Y[k*yColStride];
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            Int sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
+            T sum = 0;
+            const Int eStart = rowBegs[i];
+            const Int eStop = rowEnds[i];
             for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
-            }
+                sum += values[e]*x[(colIndices[e]-colShift)*xRowStride];
+            const Int iOff = i*yRowStride;
+            y[iOff] = alpha*sum + beta*y[iOff];
         }
     }
 }
 
-#ifdef EL_HAVE_QUAD
-template<>
-void MultiplyCSR<Quad>
-( Orientation orientation, Int m, Int n,
-  Quad alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const Quad*   values,
-  const Quad*   x,
-  Quad beta,
-        Quad*   y )
+// Z += alpha op(A(iBeg:iEnd-1,:)) X(iBeg:iEnd-1,:), where op(A) is either
+// A^T or A^H
+template<typename T>
+void CSRRowsAdjointUpdate
+( bool conjugate, Int iBeg, Int iEnd, Int numRHS,
+  T alpha,
+  const Int* rowBegs,
+  const Int* rowEnds,
+  const Int* colIndices, Int colShift,
+  const T*   values,
+  const T*   X, Int xRowStride, Int xColStride,
+        T*   Z, Int zRowStride, Int zColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-    if( orientation == NORMAL )
+    Int k=0;
+    for( ; k+CSR_RHS_BLOCK<=numRHS; k+=CSR_RHS_BLOCK )
     {
-        for( Int i=0; i<m; ++i )
+        const T* X0 = &X[k*xColStride];
+        const T* X1 = X0 + xColStride;
+        const T* X2 = X1 + xColStride;
+        const T* X3 = X2 + xColStride;
+        T* Z0 = &Z[k*zColStride];
+        T* Z1 = Z0 + zColStride;
+        T* Z2 = Z1 + zColStride;
+        T* Z3 = Z2 + zColStride;
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            Quad sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
+            const Int iOff = i*xRowStride;
+            const T x0 = alpha*X0[iOff];
+            const T x1 = alpha*X1[iOff];
+            const T x2 = alpha*X2[iOff];
+            const T x3 = alpha*X3[iOff];
+            const Int eStart = rowBegs[i];
+            const Int eStop = rowEnds[i];
             for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
+                const T value = ( conjugate ? Conj(values[e]) : values[e] );
+                const Int jOff = (colIndices[e]-colShift)*zRowStride;
+                Z0[jOff] += value*x0;
+                Z1[jOff] += value*x1;
+                Z2[jOff] += value*x2;
+                Z3[jOff] += value*x3;
             }
         }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
-            }
-        }
-    }
-}
-
-template<>
-void MultiplyCSR<Complex<Quad>>
-( Orientation orientation, Int m, Int n,
-  Complex<Quad> alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const Complex<Quad>*   values,
-  const Complex<Quad>*   x,
-  Complex<Quad> beta,
-        Complex<Quad>*   y )
-{
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            Complex<Quad> sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
     }
-    else
+    for( ; k<numRHS; ++k )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
+        const T* x = &X[k*xColStride];
+        T* z = &Z[k*zColStride];
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            for( Int i=0; i<m; ++i )
+            const T xi = alpha*x[i*xRowStride];
+            const Int eStart = rowBegs[i];
+            const Int eStop = rowEnds[i];
+            if( conjugate )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
+                    z[(colIndices[e]-colShift)*zRowStride] +=
+                      Conj(values[e])*xi;
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            else
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                    z[(colIndices[e]-colShift)*zRowStride] += values[e]*xi;
             }
         }
     }
 }
-#endif // ifdef EL_HAVE_QUAD
 
+// Y := alpha A X + beta Y, where A is m x n
 template<typename T>
-void MultiplyCSR
-( Orientation orientation, Int m, Int n, Int numRHS,
+void MultiplyCSRNormal
+( Int m, Int numRHS,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
+  const Int* rowBegs,
+  const Int* rowEnds,
+  const Int* colIndices, Int colShift,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-    if( numRHS == 1 )
+#ifdef EL_HYBRID
+    const Int numNonzeros = ( m==0 ? 0 : rowEnds[m-1]-rowBegs[0] );
+    if( omp_get_max_threads() > 1 &&
+        numNonzeros*numRHS >= CSR_MIN_PARALLEL_WORK )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
+        #pragma omp parallel
+        {
+            const Int numThreads = omp_get_num_threads();
+            const Int t = omp_get_thread_num();
+            CSRRowsNormal
+            ( CSRRowSplit(m,rowBegs,rowEnds,numThreads,t),
+              CSRRowSplit(m,rowBegs,rowEnds,numThreads,t+1), numRHS,
+              alpha, rowBegs, rowEnds, colIndices, colShift, values,
+              X, xRowStride, xColStride,
+              beta, Y, yRowStride, yColStride );
+        }
         return;
     }
+#endif
+    CSRRowsNormal
+    ( Int(0), m, numRHS,
+      alpha, rowBegs, rowEnds, colIndices, colShift, values,
+      X, xRowStride, xColStride,
+      beta, Y, yRowStride, yColStride );
+}
 
-    if( orientation == NORMAL )
+// Z := alpha op(A) X + Z, where A is m x n and op(A) is either A^T or A^H
+template<typename T>
+void MultiplyCSRAdjointUpdate
+( bool conjugate, Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowBegs,
+  const Int* rowEnds,
+  const Int* colIndices, Int colShift,
+  const T*   values,
+  const T*   X, Int xRowStride, Int xColStride,
+        T*   Z, Int zRowStride, Int zColStride )
+{
+#ifdef EL_HYBRID
+    // Each thread accumulates its contribution into a private n x numRHS
+    // buffer, which is only worthwhile if the buffers are not much larger
+    // than the matrix itself
+    const Int maxThreads = omp_get_max_threads();
+    const Int numNonzeros = ( m==0 ? 0 : rowEnds[m-1]-rowBegs[0] );
+    if( maxThreads > 1 && numNonzeros*numRHS >= CSR_MIN_PARALLEL_WORK &&
+        maxThreads*n <= 8*numNonzeros )
     {
-        for( Int i=0; i<m; ++i )
+        const Int bufferSize = n*numRHS;
+        Memory<T> buffers( maxThreads*bufferSize );
+        T* bufferBase = buffers.Buffer();
+        #pragma omp parallel
         {
+            const Int numThreads = omp_get_num_threads();
+            const Int t = omp_get_thread_num();
+            T* W = &bufferBase[t*bufferSize];
+            MemZero( W, bufferSize );
+            CSRRowsAdjointUpdate
+            ( conjugate,
+              CSRRowSplit(m,rowBegs,rowEnds,numThreads,t),
+              CSRRowSplit(m,rowBegs,rowEnds,numThreads,t+1), numRHS,
+              alpha, rowBegs, rowEnds, colIndices, colShift, values,
+              X, xRowStride, xColStride, W, Int(1), n );
+            #pragma omp barrier
+
+            // Sum the contributions, with each thread owning a set of rows
             for( Int k=0; k<numRHS; ++k )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                T* z = &Z[k*zColStride];
+                #pragma omp for nowait
+                for( Int j=0; j<n; ++j )
                 {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
+                    T sum = 0;
+                    for( Int s=0; s<numThreads; ++s )
+                        sum += bufferBase[j+k*n+s*bufferSize];
+                    z[j*zRowStride] += sum;
                 }
             }
         }
+        return;
     }
+#endif
+    CSRRowsAdjointUpdate
+    ( conjugate, Int(0), m, numRHS,
+      alpha, rowBegs, rowEnds, colIndices, colShift, values,
+      X, xRowStride, xColStride,
+      Z, zRowStride, zColStride );
 }
 
 template<typename T>
-void MultiplyCSRInterX
+void MultiplyCSRStrided
 ( Orientation orientation, Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSRInterX"))
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
+    DEBUG_ONLY(CSE cse("MultiplyCSRStrided"))
+    const Int numNonzeros = rowOffsets[m] - rowOffsets[0];
+    ProfileRegion region( "MultiplyCSR" );
+    AddProfileFlops( (IsComplex<T>::value ? 8. : 2.)*numNonzeros*numRHS );
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        MultiplyCSRNormal
+        ( m, numRHS,
+          alpha, rowOffsets, rowOffsets+1, colIndices, Int(0), values,
+          X, xRowStride, xColStride,
+          beta, Y, yRowStride, yColStride );
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
         for( Int k=0; k<numRHS; ++k )
             for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
+                Y[j*yRowStride+k*yColStride] *= beta;
+        MultiplyCSRAdjointUpdate
+        ( orientation==ADJOINT, m, n, numRHS,
+          alpha, rowOffsets, rowOffsets+1, colIndices, Int(0), values,
+          X, xRowStride, xColStride,
+          Y, yRowStride, yColStride );
     }
 }
 
-template<typename T>
-void MultiplyCSRInterY
-( Orientation orientation, Int m, Int n, Int numRHS,
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void MultiplyCSR
+( Orientation orientation, Int m, Int n,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   x,
   T beta,
-        T*   Y )
+        T*   y )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSRInterY"))
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
+    DEBUG_ONLY(CSE cse("MultiplyCSR"))
+    char matDescrA[6];
+    matDescrA[0] = 'G';
+    matDescrA[3] = 'C';
+    mkl::csrmv
+    ( orientation, m, n, alpha, matDescrA, 
+      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
+}
 
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-    }
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+#else
+template<typename T>
+#endif
+void MultiplyCSR
+( Orientation orientation, Int m, Int n,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   x,
+  T beta,
+        T*   y )
+{
+    DEBUG_ONLY(CSE cse("MultiplyCSR"))
+    MultiplyCSRStrided
+    ( orientation, m, n, Int(1),
+      alpha, rowOffsets, colIndices, values, x, Int(1), Int(0),
+      beta, y, Int(1), Int(0) );
 }
 
 template<typename T>
-void MultiplyCSRInter
+void MultiplyCSR
 ( Orientation orientation, Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const T*   X, Int ldX,
   T beta,
-        T*   Y )
+        T*   Y, Int ldY )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSRInter"))
+    DEBUG_ONLY(CSE cse("MultiplyCSR"))
     if( numRHS == 1 )
     {
         MultiplyCSR
@@ -468,57 +382,10 @@ void MultiplyCSRInter
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, values, X, Int(1), ldX,
+      beta, Y, Int(1), ldY );
 }
 
 } // anonymous namespace
@@ -560,37 +427,33 @@ void Multiply
           !mpi::Congruent( X.Comm(), Y.Comm() ) )
           LogicError("Communicators did not match");
     )
-
-    const bool time = false;
-
     mpi::Comm comm = A.Comm();
-    const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm );
-    // TODO: Use sequential implementation if commSize = 1?
-
-    Timer totalTimer, timer;
-    if( time && commRank == 0 )
-        totalTimer.Start();
 
     // Y := beta Y
     Y *= beta;
 
     A.InitializeMultMeta();
     const auto& meta = A.multMeta;
+    auto& plan = A.multPlan;
 
-    // Convert the sizes and offsets to be compatible with the current width
+    // The entries of each local row of A involving the locally-owned rows of
+    // the multivector are multiplied while the remaining portions of the
+    // multivector are exchanged with the neighboring processes
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;    
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
+    const Int localHeight = A.LocalHeight();
+    const Int numSendInds = meta.sendInds.size();
+    const Int numRecvInds = meta.numRecvInds;
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    const Int* diagBegs = meta.diagBegs.data();
+    const Int* diagEnds = meta.diagEnds.data();
+    const Int numSendRanks = meta.sendRanks.size();
+    const Int numRecvRanks = meta.recvRanks.size();
+    plan.requests.resize( numSendRanks+numRecvRanks );
+    ProfileRegion region( "Multiply [DistSparseMatrix]" );
+    AddProfileFlops
+    ( (IsComplex<T>::value ? 8. : 2.)*A.NumLocalEntries()*b );
 
     if( orientation == NORMAL )
     {
@@ -599,39 +462,61 @@ void Multiply
         if( A.Width() != X.Height() )
             LogicError("The width of A must match the height of X");
 
-        // Pack the send values
-        const Int numSendInds = meta.sendInds.size();
         const Int firstLocalRow = X.FirstLocalRow();
-        vector<T> sendVals;
-        FastResize( sendVals, numSendInds*b );
-        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const T* XBuf = X.LockedMatrix().LockedBuffer();
         const Int ldX = X.LockedMatrix().LDim();
-        for( Int s=0; s<numSendInds; ++s )
+        T* YBuf = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        T* sendVals = plan.sendVals.Require( numSendInds*b );
+        T* recvVals = plan.recvVals.Require( numRecvInds*b );
+
+        // Post the receives for the remote rows of X
+        Int numRequests = 0;
+        for( Int r=0; r<numRecvRanks; ++r )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
+            const int q = meta.recvRanks[r];
+            mpi::IRecv
+            ( &recvVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+              plan.requests[numRequests++] );
         }
 
-        // Now send them
-        vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(), 
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+        // Pack and send the rows of X needed by each neighbor
+        for( Int r=0; r<numSendRanks; ++r )
+        {
+            const int q = meta.sendRanks[r];
+            const Int sendOff = meta.sendOffs[q];
+            const Int sendSize = meta.sendSizes[q];
+            for( Int s=sendOff; s<sendOff+sendSize; ++s )
+            {
+                const Int iLoc = meta.sendInds[s] - firstLocalRow;
+                for( Int t=0; t<b; ++t )
+                    sendVals[s*b+t] = XBuf[iLoc+t*ldX];
+            }
+            mpi::ISend
+            ( &sendVals[sendOff*b], sendSize*b, q, comm,
+              plan.requests[numRequests++] );
+        }
+
+        // Y += alpha A_{Diag} X_{Local}
+        MultiplyCSRNormal
+        ( localHeight, b,
+          alpha, diagBegs, diagEnds, targetBuf, firstLocalRow, valueBuf,
+          XBuf, Int(1), ldX,
+          T(1), YBuf, Int(1), ldY );
+
+        mpi::WaitAll( numRequests, plan.requests.data() );
+
+        // Y += alpha A_{OffDiag} X_{Remote}
+        MultiplyCSRNormal
+        ( localHeight, b,
+          alpha, offsetBuf, diagBegs, meta.colOffs.data(), Int(0), valueBuf,
+          recvVals, b, Int(1),
+          T(1), YBuf, Int(1), ldY );
+        MultiplyCSRNormal
+        ( localHeight, b,
+          alpha, diagEnds, offsetBuf+1, meta.colOffs.data(), Int(0), valueBuf,
+          recvVals, b, Int(1),
+          T(1), YBuf, Int(1), ldY );
     }
     else
     {
@@ -640,42 +525,69 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
-        if( time && commRank == 0 )
-            timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
-
-        // Inject the updates to Y into the network
-        const Int numRecvInds = meta.sendInds.size();
-        vector<T> recvVals;
-        FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
-     
-        // Accumulate the received indices onto Y
+        const bool conjugate = ( orientation == ADJOINT );
         const Int firstLocalRow = Y.FirstLocalRow();
-        T* YBuffer = Y.Matrix().Buffer(); 
+        const T* XBuf = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
+        T* YBuf = Y.Matrix().Buffer();
         const Int ldY = Y.Matrix().LDim();
-        for( Int s=0; s<numRecvInds; ++s )
+        // NOTE: The roles of the send and receive buffers are reversed
+        T* updates = plan.recvVals.Require( numRecvInds*b );
+        T* recvVals = plan.sendVals.Require( numSendInds*b );
+
+        // Post the receives for the updates to our rows of Y
+        Int numRequests = 0;
+        for( Int r=0; r<numSendRanks; ++r )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+            const int q = meta.sendRanks[r];
+            mpi::IRecv
+            ( &recvVals[meta.sendOffs[q]*b], meta.sendSizes[q]*b, q, comm,
+              plan.requests[numRequests++] );
+        }
+
+        // Form and send the updates to the remote rows of Y
+        MemZero( updates, numRecvInds*b );
+        MultiplyCSRAdjointUpdate
+        ( conjugate, localHeight, numRecvInds, b,
+          alpha, offsetBuf, diagBegs, meta.colOffs.data(), Int(0), valueBuf,
+          XBuf, Int(1), ldX,
+          updates, b, Int(1) );
+        MultiplyCSRAdjointUpdate
+        ( conjugate, localHeight, numRecvInds, b,
+          alpha, diagEnds, offsetBuf+1, meta.colOffs.data(), Int(0), valueBuf,
+          XBuf, Int(1), ldX,
+          updates, b, Int(1) );
+        for( Int r=0; r<numRecvRanks; ++r )
+        {
+            const int q = meta.recvRanks[r];
+            mpi::ISend
+            ( &updates[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+              plan.requests[numRequests++] );
+        }
+
+        // Y_{Local} += alpha op(A_{Diag}) X
+        MultiplyCSRAdjointUpdate
+        ( conjugate, localHeight, Y.LocalHeight(), b,
+          alpha, diagBegs, diagEnds, targetBuf, firstLocalRow, valueBuf,
+          XBuf, Int(1), ldX,
+          YBuf, Int(1), ldY );
+
+        mpi::WaitAll( numRequests, plan.requests.data() );
+
+        // Accumulate the received updates onto Y
+        for( Int r=0; r<numSendRanks; ++r )
+        {
+            const int q = meta.sendRanks[r];
+            const Int sendOff = meta.sendOffs[q];
+            const Int sendSize = meta.sendSizes[q];
+            for( Int s=sendOff; s<sendOff+sendSize; ++s )
+            {
+                const Int iLoc = meta.sendInds[s] - firstLocalRow;
+                for( Int t=0; t<b; ++t )
+                    YBuf[iLoc+t*ldY] += recvVals[s*b+t];
+            }
         }
     }
-    if( time && commRank == 0 )
-        Output("Multiply total time: ",totalTimer.Stop());
 }
 
 #define PROTO(T) \
@@ -695,6 +607,8 @@ void Multiply
             DistMultiVec<T>& Y );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -119,6 +119,8 @@ void Symm
           DistMatrix<T,MR,  STAR>& ZTrans_MR_STAR );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
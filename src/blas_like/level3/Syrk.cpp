@@ -36,6 +36,9 @@ void Syrk
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
     const Int k = ( orientation == NORMAL ? A.Width() : A.Height() );
+    ProfileRegion region( "blas::Syrk" );
+    AddProfileFlops
+    ( (IsComplex<T>::value ? 4. : 1.)*C.Height()*C.Height()*k );
     if( conjugate )
     {
         blas::Herk
@@ -119,6 +119,8 @@ void LocalTrmm
     T alpha, const DistMatrix<T,STAR,STAR>& A, ElementalMatrix<T>& B );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
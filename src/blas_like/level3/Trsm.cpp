@@ -56,6 +56,9 @@ void Trsm
             if( A.Get(j,j) == F(0) )
                 throw SingularMatrixException();
     }
+    ProfileRegion region( "blas::Trsm" );
+    AddProfileFlops
+    ( (IsComplex<F>::value ? 4. : 1.)*B.Height()*B.Width()*A.Height() );
     blas::Trsm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
@@ -89,6 +92,7 @@ void Trsm
               LogicError("Nonconformal Trsm");
       }
     )
+    ProfileRegion region( "Trsm" );
     B *= alpha;
 
     // Call the single right-hand side algorithm if appropriate
@@ -426,6 +430,8 @@ void LocalTrsm
     bool checkIfSingular );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
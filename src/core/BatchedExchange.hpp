@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_BATCHEDEXCHANGE_HPP
+#define EL_CORE_BATCHEDEXCHANGE_HPP
+
+namespace El {
+
+// Streaming exchange of queued remote items
+// =========================================
+// Rather than packing an entire queue into a single buffer for one AllToAll
+// (which doubles the memory required by a large assembly), the queue is
+// drained from its back in rounds of at most AssemblyBatchSize() items. Each
+// round is exchanged with non-blocking point-to-point messages between only
+// the processes which have data for one another, and the next round is packed
+// while the messages are in flight.
+//
+// The caller provides:
+//   owner(k)       the rank within 'comm' which should receive item k,
+//   pack(k)        the value of item k,
+//   truncate(n)    notification that items n and beyond have been packed and
+//                  may be released,
+//   unpack(buf)    processing of the vector of received items (which it may
+//                  modify).
+//
+// This routine is collective over 'comm'.
+
+template<typename Item,
+         typename OwnerFunc,typename PackFunc,
+         typename TruncateFunc,typename UnpackFunc>
+void BatchedExchange
+( Int numItems,
+  OwnerFunc owner, PackFunc pack, TruncateFunc truncate, UnpackFunc unpack,
+  mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("BatchedExchange"))
+    const int commSize = mpi::Size( comm );
+    const Int batchSize = Max( AssemblyBatchSize(), Int(1) );
+    const Int numRounds =
+      mpi::AllReduce( (numItems+batchSize-1)/batchSize, mpi::MAX, comm );
+    if( numRounds == 0 )
+        return;
+
+    struct Batch
+    {
+        vector<Item> sendBuf, recvBuf;
+        vector<int> owners, sendCounts, sendOffs, recvCounts, recvOffs;
+        vector<mpi::Request> requests;
+    };
+    Batch batches[2];
+
+    auto packBatch = [&]( Batch& batch )
+    {
+        const Int batchBeg = Max( numItems-batchSize, Int(0) );
+        const Int numPacked = numItems - batchBeg;
+        batch.owners.resize( numPacked );
+        batch.sendCounts.assign( commSize, 0 );
+        for( Int k=0; k<numPacked; ++k )
+        {
+            const int q = owner( batchBeg+k );
+            batch.owners[k] = q;
+            ++batch.sendCounts[q];
+        }
+        Scan( batch.sendCounts, batch.sendOffs );
+        batch.sendBuf.resize( numPacked );
+        auto offs = batch.sendOffs;
+        for( Int k=0; k<numPacked; ++k )
+            batch.sendBuf[offs[batch.owners[k]]++] = pack( batchBeg+k );
+        numItems = batchBeg;
+        truncate( numItems );
+    };
+
+    auto startBatch = [&]( Batch& batch )
+    {
+        batch.recvCounts.resize( commSize );
+        mpi::AllToAll
+        ( batch.sendCounts.data(), 1, batch.recvCounts.data(), 1, comm );
+        const int totalRecv = Scan( batch.recvCounts, batch.recvOffs );
+        batch.recvBuf.resize( totalRecv );
+
+        int numRequests = 0;
+        for( int q=0; q<commSize; ++q )
+            numRequests += (batch.recvCounts[q]!=0) + (batch.sendCounts[q]!=0);
+        batch.requests.resize( numRequests );
+        int r = 0;
+        for( int q=0; q<commSize; ++q )
+            if( batch.recvCounts[q] != 0 )
+                mpi::IRecv
+                ( &batch.recvBuf[batch.recvOffs[q]], batch.recvCounts[q], q,
+                  comm, batch.requests[r++] );
+        for( int q=0; q<commSize; ++q )
+            if( batch.sendCounts[q] != 0 )
+                mpi::ISend
+                ( &batch.sendBuf[batch.sendOffs[q]], batch.sendCounts[q], q,
+                  comm, batch.requests[r++] );
+    };
+
+    auto finishBatch = [&]( Batch& batch )
+    {
+        mpi::WaitAll( batch.requests.size(), batch.requests.data() );
+        unpack( batch.recvBuf );
+    };
+
+    packBatch( batches[0] );
+    startBatch( batches[0] );
+    for( Int round=0; round<numRounds; ++round )
+    {
+        Batch& curr = batches[round%2];
+        Batch& next = batches[(round+1)%2];
+        const bool haveNext = ( round+1 < numRounds );
+        if( haveNext )
+            packBatch( next );
+        finishBatch( curr );
+        if( haveNext )
+            startBatch( next );
+    }
+}
+
+// Release the unused capacity of a queue once it has mostly been drained
+template<typename T>
+inline void TruncateQueue( vector<T>& queue, Int newSize )
+{
+    queue.resize( newSize );
+    if( 2*queue.size() < queue.capacity() )
+        vector<T>( queue ).swap( queue );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BATCHEDEXCHANGE_HPP
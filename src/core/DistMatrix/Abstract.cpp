@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "../BatchedExchange.hpp"
 
 namespace El {
 
@@ -581,64 +582,56 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = Root();
-    const Int totalSend = remoteUpdates.size();
 
-    // Compute the metadata
-    // ====================
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
     if( includeViewers )
     {
         comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,distOwner,root);
-            const int owner = g.VCToViewing(vcOwner);
-            owners[k] = owner;
-            ++sendCounts[owner];
-        }
     }
     else
     {
         if( !Participating() )
             return;
         comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            const int owner = g.CoordsToVC(colDist,rowDist,distOwner,root);
-            owners[k] = owner;
-            ++sendCounts[owner];
-        }
     }
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<T>> sendBuf(totalSend);
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteUpdates[k];
-    SwapClear( remoteUpdates );
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast( recvBufSize, 0, RedundantComm() );
-    recvBuf.resize( recvBufSize );
-    mpi::Broadcast( recvBuf.data(), recvBufSize, 0, RedundantComm() );
-    // TODO: Make this loop faster
-    for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    auto owner = [&]( Int k )
+    {
+        const Entry<T>& entry = remoteUpdates[k];
+        const int distOwner = Owner(entry.i,entry.j);
+        const int vcOwner = g.CoordsToVC(colDist,rowDist,distOwner,root);
+        return includeViewers ? g.VCToViewing(vcOwner) : vcOwner;
+    };
+
+    // Exchange and unpack the data in rounds of at most AssemblyBatchSize()
+    // updates so that large assemblies need not be buffered all at once
+    // =====================================================================
+    BatchedExchange<Entry<T>>
+    ( remoteUpdates.size(), owner,
+      [&]( Int k ) { return remoteUpdates[k]; },
+      [&]( Int newSize ) { TruncateQueue( remoteUpdates, newSize ); },
+      [&]( vector<Entry<T>>& recvBuf )
+      {
+          Int recvBufSize = recvBuf.size();
+          mpi::Broadcast( recvBufSize, 0, RedundantComm() );
+          recvBuf.resize( recvBufSize );
+          mpi::Broadcast( recvBuf.data(), recvBufSize, 0, RedundantComm() );
+          if( recvBufSize == 0 )
+              return;
+          T* buffer = Buffer();
+          const Int ldim = LDim();
+          for( const auto& entry : recvBuf )
+          {
+              const Int iLoc = LocalRow(entry.i);
+              const Int jLoc = LocalCol(entry.j);
+              DEBUG_ONLY(
+                if( iLoc < 0 || iLoc >= LocalHeight() ||
+                    jLoc < 0 || jLoc >= LocalWidth() )
+                    LogicError("Received an update for a non-local entry");
+              )
+              buffer[iLoc+jLoc*ldim] += entry.value;
+          }
+      },
+      comm );
 }
 
 template<typename T>
@@ -977,6 +970,8 @@ AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
 #define PROTO(T) template class AbstractDistMatrix<T>;
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
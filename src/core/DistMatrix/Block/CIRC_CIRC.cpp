@@ -147,6 +147,8 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
   BOTH( T,VR,  STAR);
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -285,6 +285,8 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
   OTHER(T,VR,  STAR);
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
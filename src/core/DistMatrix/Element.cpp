@@ -893,6 +893,8 @@ ElementalMatrix<T>::ShallowSwap( ElementalMatrix<T>& A )
 #endif
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -415,6 +415,8 @@ void DistMultiVec<T>::ProcessQueues()
 #define PROTO(T) template class DistMultiVec<T>;
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
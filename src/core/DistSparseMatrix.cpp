@@ -20,6 +20,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./BatchedExchange.hpp"
 
 namespace El {
 
@@ -69,6 +70,7 @@ void DistSparseMatrix<T>::Empty( bool freeMemory )
     else
         vals_.resize( 0 );
     multMeta.Clear();
+    multPlan.Clear();
 
     SwapClear( remoteVals_ );
 }
@@ -248,72 +250,49 @@ void DistSparseMatrix<T>::ProcessQueues()
 
     // Send the remote updates
     // =======================
-    const int commSize = distGraph_.commSize_;
+    // The queues are drained in rounds so that at most AssemblyBatchSize()
+    // entries are packed at once and the next round is packed while the
+    // current one is in flight
     {
-        // Compute the send counts
-        // -----------------------
-        vector<int> sendCounts(commSize,0);
-        for( auto s : distGraph_.remoteSources_ )
-            ++sendCounts[RowOwner(s)];
-        // Pack the send data
-        // ------------------
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
-        auto offs = sendOffs;
-        vector<Entry<T>> sendBuf(totalSend);
-        for( Int i=0; i<totalSend; ++i )
-        {
-            const int owner = RowOwner(distGraph_.remoteSources_[i]);
-            sendBuf[offs[owner]++] = 
-                Entry<T>
-                { distGraph_.remoteSources_[i],
-                  distGraph_.remoteTargets_[i], remoteVals_[i] };
-        }
-        SwapClear( distGraph_.remoteSources_ );
-        SwapClear( distGraph_.remoteTargets_ );
-        SwapClear( remoteVals_ );
-        // Exchange and unpack
-        // -------------------
-        auto recvBuf=
-          mpi::AllToAll( sendBuf, sendCounts, sendOffs, distGraph_.comm_ );
-        if( !FrozenSparsity() )
-            Reserve( NumLocalEntries()+recvBuf.size() );
-        for( auto& entry : recvBuf )
-            QueueUpdate( entry );
+        auto& sources = distGraph_.remoteSources_;
+        auto& targets = distGraph_.remoteTargets_;
+        BatchedExchange<Entry<T>>
+        ( sources.size(),
+          [&]( Int k ) { return RowOwner(sources[k]); },
+          [&]( Int k )
+          { return Entry<T>{ sources[k], targets[k], remoteVals_[k] }; },
+          [&]( Int newSize )
+          {
+              TruncateQueue( sources, newSize );
+              TruncateQueue( targets, newSize );
+              TruncateQueue( remoteVals_, newSize );
+          },
+          [&]( vector<Entry<T>>& recvBuf )
+          {
+              if( !FrozenSparsity() )
+                  Reserve( NumLocalEntries()+recvBuf.size() );
+              for( auto& entry : recvBuf )
+                  QueueUpdate( entry );
+          },
+          distGraph_.comm_ );
     }
 
     // Send the remote entry removals
     // ==============================
     {
-        // Compute the send counts
-        // -----------------------
-        vector<int> sendCounts(commSize,0);
-        const Int numRemoteRemovals = distGraph_.remoteRemovals_.size();
-        for( Int i=0; i<numRemoteRemovals; ++i )
-            ++sendCounts[RowOwner(distGraph_.remoteRemovals_[i].first)];
-        // Pack the send data
-        // ------------------
-        vector<int> sendOffs;
-        const int totalSend = Scan( sendCounts, sendOffs );
-        auto offs = sendOffs;
-        vector<Int> sendRows(totalSend), sendCols(totalSend);
-        for( Int i=0; i<totalSend; ++i )
-        {
-            const int owner = RowOwner(distGraph_.remoteRemovals_[i].first);
-            sendRows[offs[owner]] = distGraph_.remoteRemovals_[i].first;
-            sendCols[offs[owner]] = distGraph_.remoteRemovals_[i].second;
-            ++offs[owner];
-        }
-        SwapClear( distGraph_.remoteRemovals_ );
-        // Exchange and unpack
-        // -------------------
-        auto recvRows = 
-          mpi::AllToAll(sendRows,sendCounts,sendOffs,distGraph_.comm_);
-        auto recvCols = 
-          mpi::AllToAll(sendCols,sendCounts,sendOffs,distGraph_.comm_);
-        const Int totalRecv = recvRows.size();
-        for( Int i=0; i<totalRecv; ++i )
-            QueueZero( recvRows[i], recvCols[i] );
+        auto& removals = distGraph_.remoteRemovals_;
+        BatchedExchange<ValueInt<Int>>
+        ( removals.size(),
+          [&]( Int k ) { return RowOwner(removals[k].first); },
+          [&]( Int k )
+          { return ValueInt<Int>{ removals[k].first, removals[k].second }; },
+          [&]( Int newSize ) { TruncateQueue( removals, newSize ); },
+          [&]( vector<ValueInt<Int>>& recvBuf )
+          {
+              for( auto& removal : recvBuf )
+                  QueueZero( removal.value, removal.index );
+          },
+          distGraph_.comm_ );
     }
 
     // Ensure that the kept local triplets are sorted and combined
@@ -358,7 +337,14 @@ void DistSparseMatrix<T>::ProcessLocalQueues()
             entries[s] = Entry<T>{distGraph_.sources_[s],
                                   distGraph_.targets_[s],vals_[s]};
     }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
+    // The entries are typically already sorted up to the updates queued
+    // since the last call, so only the new entries are sorted before the
+    // two runs are merged
+    auto sortedEnd =
+      std::is_sorted_until( entries.begin(), entries.end(), CompareEntries );
+    std::sort( sortedEnd, entries.end(), CompareEntries );
+    std::inplace_merge
+    ( entries.begin(), sortedEnd, entries.end(), CompareEntries );
     const Int numSorted = entries.size();
 
     // Combine duplicates
@@ -372,7 +358,7 @@ void DistSparseMatrix<T>::ProcessLocalQueues()
         else
             entries[lastUnique].value += entries[s].value;
     }
-    const Int numUnique = lastUnique+1;
+    const Int numUnique = ( numSorted==0 ? 0 : lastUnique+1 );
 
     entries.resize( numUnique );
     distGraph_.sources_.resize( numUnique );
@@ -761,6 +747,39 @@ DistSparseMultMeta DistSparseMatrix<T>::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Store the neighboring processes so that only they are communicated with
+    const int commRank = mpi::Rank( comm );
+    meta.sendRanks.clear();
+    meta.recvRanks.clear();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( meta.sendSizes[q] != 0 )
+            meta.sendRanks.push_back( q );
+        if( meta.recvSizes[q] != 0 )
+            meta.recvRanks.push_back( q );
+    }
+
+    // Find the portion of each (sorted) row which only involves the rows of
+    // the multivector owned by this process so that it can be multiplied
+    // while the remaining entries are communicated
+    const Int localHeight = LocalHeight();
+    const Int* offsetBuffer = LockedOffsetBuffer();
+    const Int diagFirst = meta.recvOffs[commRank];
+    const Int diagLast = diagFirst + meta.recvSizes[commRank];
+    meta.diagBegs.resize( localHeight );
+    meta.diagEnds.resize( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Int e = offsetBuffer[iLoc];
+        const Int eEnd = offsetBuffer[iLoc+1];
+        for( ; e<eEnd && meta.colOffs[e]<diagFirst; ++e );
+        meta.diagBegs[iLoc] = e;
+        for( ; e<eEnd && meta.colOffs[e]<diagLast; ++e );
+        meta.diagEnds[iLoc] = e;
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
@@ -851,6 +870,8 @@ bool DistSparseMatrix<T>::CompareEntries( const Entry<T>& a, const Entry<T>& b )
 
 #define PROTO(T) template class DistSparseMatrix<T>;
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
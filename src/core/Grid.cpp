@@ -187,6 +187,10 @@ Grid::~Grid()
 {
     if( !mpi::Finalized() )
     {
+        if( InGrid() )
+            for( auto& layers : layers_ )
+                mpi::Free( layers->depthComm );
+        layers_.clear();
         if( InGrid() )
         {
             mpi::Free( mdComm_ );
@@ -266,6 +270,59 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
     SetUpGrid();
 }
 
+const Grid::Layers& Grid::GetLayers( int c ) const
+{
+    DEBUG_ONLY(CSE cse("Grid::GetLayers"))
+    for( const auto& layers : layers_ )
+        if( layers->numLayers == c )
+            return *layers;
+
+    if( c < 1 || size_ % c != 0 )
+        LogicError
+        ("Number of layers ",c," does not divide the ",size_," processes");
+    if( mpi::Size(viewingComm_) != size_ )
+        LogicError("Layers require every viewing process to be in the grid");
+    const int pLayer = size_ / c;
+    const int layerHeight = FindFactor( pLayer );
+
+    auto layers = MakeUnique<Layers>();
+    layers->numLayers = c;
+    layers->grids.resize( c );
+    vector<int> ranks(pLayer);
+    for( int l=0; l<c; ++l )
+    {
+        for( int q=0; q<pLayer; ++q )
+            ranks[q] = l*pLayer + q;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, pLayer, ranks.data(), layerGroup );
+        layers->grids[l] =
+          MakeUnique<Grid>( viewingComm_, layerGroup, layerHeight );
+        mpi::Free( layerGroup );
+    }
+    mpi::Split
+    ( owningComm_, owningRank_ % pLayer, owningRank_ / pLayer,
+      layers->depthComm );
+
+    layers_.push_back( std::move(layers) );
+    return *layers_.back();
+}
+
+const Grid& Grid::LayerGrid( int c, int layer ) const
+{
+    DEBUG_ONLY(
+      CSE cse("Grid::LayerGrid");
+      if( layer < 0 || layer >= c )
+          LogicError("Layer ",layer," is not in [0,",c,")");
+    )
+    return *GetLayers(c).grids[layer];
+}
+
+mpi::Comm Grid::LayerDepthComm( int c ) const
+{
+    DEBUG_ONLY(CSE cse("Grid::LayerDepthComm"))
+    return GetLayers(c).depthComm;
+}
+
 int Grid::GCD() const EL_NO_EXCEPT { return gcd_; }
 int Grid::LCM() const EL_NO_EXCEPT { return size_/gcd_; }
 
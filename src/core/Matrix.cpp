@@ -695,6 +695,8 @@ void Matrix<T>::Resize_( Int height, Int width, Int ldim )
 
 #define PROTO(T) template class Matrix<T>;
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -2,53 +2,245 @@
    Copyright (c) 2009-2015, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
 
-//#define EL_MEMORY_MALLOC
+#include <map>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
 namespace {
 
-template<typename G>
-static G* New( size_t size )
+// Each block is over-allocated so that the returned pointer can be aligned
+// and immediately preceded by a header recording the underlying allocation
+struct BlockHeader
 {
-#ifdef EL_MEMORY_MALLOC
-    return (G*)malloc(size*sizeof(G));
-#else
-    return new G[size];
-#endif
+    void* raw;
+    size_t capacity;
+};
+
+size_t RoundToClass( size_t numBytes )
+{
+    const size_t minClass = 64;
+    if( numBytes <= minClass )
+        return minClass;
+    // Use four size classes between each pair of powers of two so that no
+    // more than a quarter of any block is wasted
+    size_t k = 0;
+    while( (size_t(1)<<(k+1)) < numBytes )
+        ++k;
+    const size_t step = size_t(1) << (k-2);
+    return ((numBytes+step-1)/step)*step;
+}
+
+class MemoryPool
+{
+public:
+    void* Allocate( size_t numBytes )
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        ++stats_.numRequests;
+        const size_t capacity =
+          ( enabled_ ? RoundToClass(numBytes) : numBytes );
+        void* ptr = nullptr;
+        if( enabled_ )
+        {
+            auto it = freeLists_.find( capacity );
+            if( it != freeLists_.end() && !it->second.empty() )
+            {
+                ptr = it->second.back();
+                it->second.pop_back();
+                stats_.bytesCached -= capacity;
+                ++stats_.numHits;
+            }
+        }
+        if( ptr == nullptr )
+        {
+            ptr = AllocateBlock( capacity );
+            if( ptr == nullptr )
+            {
+                // Return the cached blocks to the system and try once more
+                ClearCache();
+                ptr = AllocateBlock( capacity );
+                if( ptr == nullptr )
+                    throw std::bad_alloc();
+            }
+        }
+        stats_.bytesLive += capacity;
+        stats_.highWaterMark =
+          std::max( stats_.highWaterMark, stats_.bytesLive );
+        return ptr;
+    }
+
+    void Free( void* ptr )
+    {
+        if( ptr == nullptr )
+            return;
+        std::lock_guard<std::mutex> lock( mutex_ );
+        const BlockHeader& header = Header( ptr );
+        const size_t capacity = header.capacity;
+        stats_.bytesLive -= capacity;
+        // Only cache blocks which match a size class and the current alignment
+        if( enabled_ && RoundToClass(capacity) == capacity &&
+            size_t(ptr) % alignment_ == 0 )
+        {
+            freeLists_[capacity].push_back( ptr );
+            stats_.bytesCached += capacity;
+        }
+        else
+            std::free( header.raw );
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        ClearCache();
+    }
+
+    void SetEnabled( bool enabled )
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        enabled_ = enabled;
+        if( !enabled_ )
+            ClearCache();
+    }
+    bool Enabled()
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        return enabled_;
+    }
+
+    void SetAlignment( size_t alignment )
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        if( alignment < sizeof(void*) || (alignment & (alignment-1)) != 0 )
+            El::LogicError
+            ("Memory alignment must be a power of two of at least ",
+             sizeof(void*)," bytes");
+        if( alignment != alignment_ )
+        {
+            alignment_ = alignment;
+            ClearCache();
+        }
+    }
+    size_t Alignment()
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        return alignment_;
+    }
+
+    El::MemoryPoolStats Stats()
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        return stats_;
+    }
+    void ResetStats()
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        stats_.highWaterMark = stats_.bytesLive;
+        stats_.numRequests = 0;
+        stats_.numHits = 0;
+    }
+
+private:
+    std::mutex mutex_;
+    bool enabled_=true;
+    size_t alignment_=64;
+    std::map<size_t,std::vector<void*>> freeLists_;
+    El::MemoryPoolStats stats_;
+
+    static BlockHeader& Header( void* ptr )
+    { return *(static_cast<BlockHeader*>(ptr)-1); }
+
+    void* AllocateBlock( size_t capacity )
+    {
+        void* raw = std::malloc( capacity+alignment_+sizeof(BlockHeader) );
+        if( raw == nullptr )
+            return nullptr;
+        size_t address = size_t(raw) + sizeof(BlockHeader);
+        address = ((address+alignment_-1)/alignment_)*alignment_;
+        void* ptr = reinterpret_cast<void*>(address);
+        Header( ptr ).raw = raw;
+        Header( ptr ).capacity = capacity;
+        return ptr;
+    }
+
+    void ClearCache()
+    {
+        for( auto& freeList : freeLists_ )
+            for( void* ptr : freeList.second )
+                std::free( Header(ptr).raw );
+        freeLists_.clear();
+        stats_.bytesCached = 0;
+    }
+};
+
+// The pool is intentionally never destroyed so that Memory objects with
+// static storage duration may safely release their buffers at exit
+MemoryPool& Pool()
+{
+    static MemoryPool* pool = new MemoryPool;
+    return *pool;
 }
 
+// Match the semantics of new G[size], which default-constructs every entry
+// (and therefore zero-initializes Complex<Real> and the multi-double types)
 template<typename G>
-static void Delete( G*& ptr )
+void ConstructEntries( G* buffer, size_t size )
 {
-#ifdef EL_MEMORY_MALLOC
-    free( ptr );
-#else
-    delete[] ptr;
-#endif
-    ptr = nullptr;
+    static_assert
+    ( std::is_trivially_destructible<G>::value,
+      "Memory<G> releases its buffer without running destructors" );
+    if( std::is_trivially_default_constructible<G>::value )
+        return;
+    for( size_t i=0; i<size; ++i )
+        new (&buffer[i]) G;
 }
 
 } // anonymous namespace
 
 namespace El {
 
+void EnableMemoryPool( bool enable ) { Pool().SetEnabled( enable ); }
+void DisableMemoryPool() { Pool().SetEnabled( false ); }
+bool MemoryPoolEnabled() { return Pool().Enabled(); }
+
+void SetMemoryAlignment( size_t alignment ) { Pool().SetAlignment(alignment); }
+size_t MemoryAlignment() { return Pool().Alignment(); }
+
+MemoryPoolStats GetMemoryPoolStats() { return Pool().Stats(); }
+void ResetMemoryPoolStats() { Pool().ResetStats(); }
+void ClearMemoryPool() { Pool().Clear(); }
+
+void PrintMemoryPoolStats( ostream& os )
+{
+    const MemoryPoolStats stats = GetMemoryPoolStats();
+    os << "Memory pool (" << (MemoryPoolEnabled() ? "enabled" : "disabled")
+       << ", " << MemoryAlignment() << "-byte alignment):\n"
+       << "  live bytes:      " << stats.bytesLive << "\n"
+       << "  cached bytes:    " << stats.bytesCached << "\n"
+       << "  high-water mark: " << stats.highWaterMark << "\n"
+       << "  requests:        " << stats.numRequests << "\n"
+       << "  hit rate:        " << stats.HitRate() << endl;
+}
+
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), buffer_(nullptr)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), buffer_(nullptr)
 { Require( size ); }
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -59,14 +251,13 @@ template<typename G>
 void Memory<G>::ShallowSwap( Memory<G>& mem )
 {
     std::swap(size_,mem.size_);
-    std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
 }
 
 template<typename G>
-Memory<G>::~Memory() 
-{ 
-    Delete( rawBuffer_ );
+Memory<G>::~Memory()
+{
+    Pool().Free( buffer_ );
 }
 
 template<typename G>
@@ -80,24 +271,23 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Pool().Free( buffer_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
-
-            // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
-            buffer_ = rawBuffer_;
-
+            buffer_ = static_cast<G*>(Pool().Allocate( size*sizeof(G) ));
             size_ = size;
+            ConstructEntries( buffer_, size_ );
 #ifndef EL_RELEASE
-        } 
+        }
         catch( std::bad_alloc& e )
         {
             size_ = 0;
             ostringstream os;
-            os << "Failed to allocate " << size*sizeof(G) 
+            os << "Failed to allocate " << size*sizeof(G)
                << " bytes on process " << mpi::Rank() << endl;
             cerr << os.str();
             throw e;
@@ -120,7 +310,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Pool().Free( buffer_ );
     buffer_ = nullptr;
     size_ = 0;
 }
@@ -128,6 +318,8 @@ void Memory<G>::Empty()
 #define PROTO(T) template class Memory<T>;
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
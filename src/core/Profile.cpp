@@ -0,0 +1,422 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <climits>
+#include <map>
+
+namespace {
+using namespace El;
+
+struct ProfileNode
+{
+    string name;
+    Int parent;
+    bool comm;
+    std::map<string,Int> children;
+
+    Int numCalls=0;
+    double time=0, flops=0, bytes=0;
+
+    ProfileNode( const string& nodeName, Int nodeParent, bool nodeComm )
+    : name(nodeName), parent(nodeParent), comm(nodeComm)
+    { }
+};
+
+struct OpenRegion
+{
+    Int node;
+    Clock::time_point start;
+};
+
+struct ProfileEvent
+{
+    Int node;
+    double start, duration;
+};
+
+bool profilingEnabled = false;
+string profileBasename = "ElProfile";
+Int traceLimit = 10000;
+
+// The first node is the (unnamed) root of the region tree
+vector<ProfileNode> profileNodes;
+vector<OpenRegion> openRegions;
+vector<ProfileEvent> profileEvents;
+Int numDroppedEvents = 0;
+Clock::time_point profileEpoch = Clock::now();
+
+// Separates the names within a region path; it sorts below any printable
+// character so that sorting the paths lists each parent before its children
+const char pathSep = '\x1f';
+
+inline bool MasterThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+inline Int CurrentNode()
+{
+    if( profileNodes.empty() )
+        profileNodes.emplace_back( "", -1, false );
+    return ( openRegions.empty() ? 0 : openRegions.back().node );
+}
+
+inline double Seconds( Clock::time_point start, Clock::time_point stop )
+{ return duration_cast<duration<double>>(stop-start).count(); }
+
+string EscapeJSON( const string& s )
+{
+    string escaped;
+    for( const char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Concatenate the strings from each process onto the root (rank zero)
+vector<string> GatherStrings( const string& local, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Fall back to empty contributions rather than overflowing the counts
+    const size_t maxLocal = INT_MAX / commSize;
+    const int localSize = ( local.size() <= maxLocal ? local.size() : 0 );
+    if( size_t(localSize) != local.size() )
+        cerr << "Process " << commRank << " dropped " << local.size()
+             << " bytes of profiling output" << endl;
+
+    vector<int> sizes( commSize );
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    vector<int> offsets;
+    const int totalSize = ( commRank == 0 ? Scan( sizes, offsets ) : 0 );
+
+    vector<byte> recvBuf( totalSize );
+    mpi::Gather
+    ( reinterpret_cast<const byte*>(local.data()), localSize,
+      recvBuf.data(), sizes.data(), offsets.data(), 0, comm );
+
+    vector<string> strings;
+    if( commRank == 0 )
+    {
+        strings.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+            strings[q].assign
+            ( reinterpret_cast<const char*>(recvBuf.data())+offsets[q],
+              sizes[q] );
+    }
+    return strings;
+}
+
+// One line per region: path, calls, time, and the inclusive flops, bytes,
+// and communication time
+string SerializeSummary()
+{
+    const Int numNodes = profileNodes.size();
+    vector<double> flops(numNodes), bytes(numNodes), commTime(numNodes);
+    for( Int i=0; i<numNodes; ++i )
+    {
+        flops[i] = profileNodes[i].flops;
+        bytes[i] = profileNodes[i].bytes;
+        commTime[i] = ( profileNodes[i].comm ? profileNodes[i].time : 0 );
+    }
+    // Children are always created after their parents
+    for( Int i=numNodes-1; i>0; --i )
+    {
+        const Int parent = profileNodes[i].parent;
+        flops[parent] += flops[i];
+        bytes[parent] += bytes[i];
+        if( !profileNodes[parent].comm )
+            commTime[parent] += commTime[i];
+    }
+
+    vector<string> paths( numNodes );
+    ostringstream os;
+    os.precision( 17 );
+    for( Int i=1; i<numNodes; ++i )
+    {
+        const ProfileNode& node = profileNodes[i];
+        if( node.parent == 0 )
+            paths[i] = node.name;
+        else
+            paths[i] = paths[node.parent] + pathSep + node.name;
+        os << paths[i] << '\t' << node.numCalls << '\t' << node.time << '\t'
+           << flops[i] << '\t' << bytes[i] << '\t' << commTime[i] << '\n';
+    }
+    return os.str();
+}
+
+string SerializeTrace( int rank )
+{
+    ostringstream os;
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+       << ",\"args\":{\"name\":\"Process " << rank << "\"}}";
+    for( const ProfileEvent& event : profileEvents )
+    {
+        const ProfileNode& node = profileNodes[event.node];
+        os << ",\n{\"name\":\"" << EscapeJSON(node.name) << "\",\"cat\":\""
+           << (node.comm ? "comm" : "compute") << "\",\"ph\":\"X\",\"pid\":"
+           << rank << ",\"tid\":0,\"ts\":" << 1e6*event.start
+           << ",\"dur\":" << 1e6*event.duration << "}";
+    }
+    return os.str();
+}
+
+struct RegionSummary
+{
+    Int numProcs=0;
+    double numCalls=0, minTime=0, maxTime=0, sumTime=0,
+           flops=0, bytes=0, commTime=0;
+};
+
+void WriteSummary
+( const vector<string>& summaries, const string& filename )
+{
+    std::map<string,RegionSummary> regions;
+    for( const string& summary : summaries )
+    {
+        std::istringstream is( summary );
+        string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream lineStream( line );
+            string path;
+            std::getline( lineStream, path, '\t' );
+            Int numCalls;
+            double time, flops, bytes, commTime;
+            lineStream >> numCalls >> time >> flops >> bytes >> commTime;
+
+            RegionSummary& region = regions[path];
+            if( region.numProcs == 0 )
+            {
+                region.minTime = time;
+                region.maxTime = time;
+            }
+            else
+            {
+                region.minTime = Min( region.minTime, time );
+                region.maxTime = Max( region.maxTime, time );
+            }
+            ++region.numProcs;
+            region.numCalls += numCalls;
+            region.sumTime += time;
+            region.flops += flops;
+            region.bytes += bytes;
+            region.commTime += commTime;
+        }
+    }
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+    {
+        cerr << "Could not open " << filename << endl;
+        return;
+    }
+    const Int numProcs = summaries.size();
+    file << "Elemental profile over " << numProcs << " processes\n"
+         << "(times are in seconds over the processes which entered each "
+            "region; flops and\n bytes are summed over all processes)\n\n"
+         << std::left << std::setw(48) << "Region" << std::right
+         << std::setw(11) << "Calls/proc"
+         << std::setw(12) << "Min time" << std::setw(12) << "Avg time"
+         << std::setw(12) << "Max time" << std::setw(12) << "GFlop/s"
+         << std::setw(12) << "MB" << std::setw(8) << "%Comm" << "\n";
+    file << std::fixed;
+    for( const auto& entry : regions )
+    {
+        const string& path = entry.first;
+        const RegionSummary& region = entry.second;
+        const Int depth = std::count( path.begin(), path.end(), pathSep );
+        const string name =
+          string(2*depth,' ') + path.substr( path.rfind(pathSep)+1 );
+        const double avgTime = region.sumTime / region.numProcs;
+        const double gflops =
+          ( region.maxTime > 0 ? region.flops/(1e9*region.maxTime) : 0 );
+        const double commPercent =
+          ( region.sumTime > 0 ? 100*region.commTime/region.sumTime : 0 );
+        file << std::left << std::setw(48) << name << std::right
+             << std::setprecision(1)
+             << std::setw(11) << region.numCalls/region.numProcs
+             << std::setprecision(6)
+             << std::setw(12) << region.minTime
+             << std::setw(12) << avgTime
+             << std::setw(12) << region.maxTime
+             << std::setprecision(3)
+             << std::setw(12) << gflops
+             << std::setw(12) << region.bytes/1e6
+             << std::setprecision(1)
+             << std::setw(8) << commPercent << "\n";
+    }
+}
+
+void WriteTrace( const vector<string>& traces, const string& filename )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+    {
+        cerr << "Could not open " << filename << endl;
+        return;
+    }
+    file << "{\"traceEvents\":[\n";
+    for( size_t q=0; q<traces.size(); ++q )
+    {
+        if( q != 0 )
+            file << ",\n";
+        file << traces[q];
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableProfiling( bool enable )
+{
+    if( enable && !::profilingEnabled && ::profileNodes.empty() )
+        ::profileEpoch = Clock::now();
+    ::profilingEnabled = enable;
+}
+
+void DisableProfiling() { ::profilingEnabled = false; }
+
+bool ProfilingEnabled() { return ::profilingEnabled; }
+
+void SetProfileBasename( const string& basename )
+{ ::profileBasename = basename; }
+
+const string& ProfileBasename() { return ::profileBasename; }
+
+void SetProfileTraceLimit( Int maxEvents )
+{
+    if( maxEvents < 0 )
+        LogicError("The trace limit must be non-negative");
+    ::traceLimit = maxEvents;
+}
+
+Int ProfileTraceLimit() { return ::traceLimit; }
+
+bool PushProfileRegion( const char* name, bool comm )
+{
+    if( !::profilingEnabled || !MasterThread() )
+        return false;
+    const Int parent = CurrentNode();
+    if( comm && ::profileNodes[parent].comm )
+        return false;
+
+    Int node;
+    auto it = ::profileNodes[parent].children.find( name );
+    if( it == ::profileNodes[parent].children.end() )
+    {
+        node = ::profileNodes.size();
+        ::profileNodes[parent].children[name] = node;
+        ::profileNodes.emplace_back( name, parent, comm );
+    }
+    else
+        node = it->second;
+
+    OpenRegion region;
+    region.node = node;
+    region.start = Clock::now();
+    ::openRegions.push_back( region );
+    return true;
+}
+
+void PopProfileRegion()
+{
+    if( ::openRegions.empty() )
+        return;
+    const Clock::time_point stop = Clock::now();
+    const OpenRegion& region = ::openRegions.back();
+    const double time = Seconds( region.start, stop );
+
+    ProfileNode& node = ::profileNodes[region.node];
+    ++node.numCalls;
+    node.time += time;
+
+    if( Int(::profileEvents.size()) < ::traceLimit )
+    {
+        ProfileEvent event;
+        event.node = region.node;
+        event.start = Seconds( ::profileEpoch, region.start );
+        event.duration = time;
+        ::profileEvents.push_back( event );
+    }
+    else
+        ++::numDroppedEvents;
+
+    ::openRegions.pop_back();
+}
+
+void AddProfileFlops( double flops )
+{
+    if( ::profilingEnabled && MasterThread() )
+        ::profileNodes[CurrentNode()].flops += flops;
+}
+
+void AddProfileBytes( double numBytes )
+{
+    if( ::profilingEnabled && MasterThread() )
+        ::profileNodes[CurrentNode()].bytes += numBytes;
+}
+
+void ProfileReport()
+{
+    DEBUG_ONLY(CSE cse("ProfileReport"))
+    // Do not profile the aggregation itself
+    const bool wasEnabled = ::profilingEnabled;
+    ::profilingEnabled = false;
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int recorded = ( ::profileNodes.size() > 1 ? 1 : 0 );
+    if( mpi::AllReduce( recorded, mpi::MAX, comm ) == 0 )
+    {
+        ::profilingEnabled = wasEnabled;
+        return;
+    }
+
+    const int commRank = mpi::Rank( comm );
+    if( !::openRegions.empty() )
+        cerr << "Process " << commRank << " has " << ::openRegions.size()
+             << " open profiling regions" << endl;
+    if( ::numDroppedEvents > 0 )
+        cerr << "Process " << commRank << " dropped " << ::numDroppedEvents
+             << " trace events (see SetProfileTraceLimit)" << endl;
+
+    const vector<string> summaries =
+      GatherStrings( SerializeSummary(), comm );
+    if( commRank == 0 )
+        WriteSummary( summaries, ::profileBasename+".txt" );
+
+    const vector<string> traces =
+      GatherStrings( SerializeTrace(commRank), comm );
+    if( commRank == 0 )
+        WriteTrace( traces, ::profileBasename+".json" );
+
+    ::profilingEnabled = wasEnabled;
+}
+
+void ClearProfile()
+{
+    ::profileNodes.clear();
+    ::openRegions.clear();
+    ::profileEvents.clear();
+    ::numDroppedEvents = 0;
+    ::profileEpoch = Clock::now();
+}
+
+} // namespace El
@@ -448,6 +448,8 @@ void SparseMatrix<T>::AssertConsistent() const
 
 #define PROTO(T) template class SparseMatrix<T>;
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -434,6 +434,8 @@ DistMatrix<T,U,V> LockedMerge2x2
   PROTO_DIST(T,VR,  STAR)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
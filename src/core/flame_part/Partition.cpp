@@ -602,6 +602,8 @@ void LockedPartitionUpDiagonal
     ElementalMatrix<T>& ABL, ElementalMatrix<T>& ABR, Int diagDist );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -533,6 +533,8 @@ void LockedRepartitionDownDiagonal
     ElementalMatrix<T>& A22, Int bsize );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -25,6 +25,9 @@ Args* args = 0;
 // Default blocksizes for BlockMatrix
 Int blockHeight=32, blockWidth=32;
 
+// The maximum number of queued entries exchanged per round of assembly
+Int assemblyBatchSize = Int(1) << 20;
+
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
@@ -48,6 +51,8 @@ Int localSymvDoubleBlocksize = 64;
 #ifdef EL_HAVE_QUAD
 Int localSymvQuadBlocksize = 64;
 #endif
+Int localSymvDoubleDoubleBlocksize = 64;
+Int localSymvQuadDoubleBlocksize = 64;
 Int localSymvComplexFloatBlocksize = 64;
 Int localSymvComplexDoubleBlocksize = 64;
 #ifdef EL_HAVE_QUAD
@@ -392,6 +397,11 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        // Aggregate any profiling data while MPI is still available
+        if( !mpi::Finalized() )
+            ProfileReport();
+        ClearProfile();
+
         delete ::args;
         ::args = 0;
        
@@ -402,6 +412,9 @@ void Finalize()
         delete ::defaultGrid;
         ::defaultGrid = 0;
 
+        // Return any cached buffers to the system
+        ClearMemoryPool();
+
 #ifdef EL_HAVE_QT5
         if( ::elemInitializedQt )
         {
@@ -489,6 +502,18 @@ void SetDefaultBlockHeight( Int mb )
 void SetDefaultBlockWidth( Int nb )
 { ::blockWidth = nb; }
 
+Int AssemblyBatchSize()
+{ return ::assemblyBatchSize; }
+
+void SetAssemblyBatchSize( Int batchSize )
+{
+    DEBUG_ONLY(
+      if( batchSize < 1 )
+          LogicError("Assembly batch size must be positive");
+    )
+    ::assemblyBatchSize = batchSize;
+}
+
 std::mt19937& Generator()
 { return ::generator; }
 
@@ -669,6 +694,14 @@ void SetLocalSymvBlocksize<Quad>( Int blocksize )
 { ::localSymvQuadBlocksize = blocksize; }
 #endif
 
+template<>
+void SetLocalSymvBlocksize<DoubleDouble>( Int blocksize )
+{ ::localSymvDoubleDoubleBlocksize = blocksize; }
+
+template<>
+void SetLocalSymvBlocksize<QuadDouble>( Int blocksize )
+{ ::localSymvQuadDoubleBlocksize = blocksize; }
+
 template<>
 void SetLocalSymvBlocksize<Complex<float>>( Int blocksize )
 { ::localSymvComplexFloatBlocksize = blocksize; }
@@ -701,6 +734,14 @@ Int LocalSymvBlocksize<Quad>()
 { return ::localSymvQuadBlocksize; }
 #endif
 
+template<>
+Int LocalSymvBlocksize<DoubleDouble>()
+{ return ::localSymvDoubleDoubleBlocksize; }
+
+template<>
+Int LocalSymvBlocksize<QuadDouble>()
+{ return ::localSymvQuadDoubleBlocksize; }
+
 template<>
 Int LocalSymvBlocksize<Complex<float>>()
 { return ::localSymvComplexFloatBlocksize; }
@@ -866,6 +907,8 @@ Int Find( const vector<Int>& sortedInds, Int index )
   template bool IsSorted( const vector<T>& x ); \
   template bool IsStrictlySorted( const vector<T>& x );
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
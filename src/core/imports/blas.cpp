@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./blas/Gemm.hpp"
 
 using El::BlasInt;
 using El::scomplex;
@@ -556,6 +557,12 @@ template void Axpy
 ( BlasInt n, Complex<Quad> alpha, 
   const Complex<Quad>* x, BlasInt incx, Complex<Quad>* y, BlasInt incy );
 #endif
+template void Axpy
+( BlasInt n, DoubleDouble alpha, 
+  const DoubleDouble* x, BlasInt incx, DoubleDouble* y, BlasInt incy );
+template void Axpy
+( BlasInt n, QuadDouble alpha, 
+  const QuadDouble* x, BlasInt incx, QuadDouble* y, BlasInt incy );
 
 void Axpy
 ( BlasInt n, float alpha, const float* x, BlasInt incx, 
@@ -590,6 +597,12 @@ template void Copy
 ( BlasInt n, const Complex<Quad>* x, BlasInt incx, 
                    Complex<Quad>* y, BlasInt incy );
 #endif
+template void Copy
+( BlasInt n, const DoubleDouble* x, BlasInt incx, 
+                   DoubleDouble* y, BlasInt incy );
+template void Copy
+( BlasInt n, const QuadDouble* x, BlasInt incx, 
+                   QuadDouble* y, BlasInt incy );
 
 void Copy
 ( BlasInt n, const float* x, BlasInt incx, float* y, BlasInt incy )
@@ -628,6 +641,12 @@ template Complex<Quad> Dot
 ( BlasInt n, const Complex<Quad>* x, BlasInt incx, 
              const Complex<Quad>* y, BlasInt incy );
 #endif
+template DoubleDouble Dot
+( BlasInt n, const DoubleDouble* x, BlasInt incx, 
+             const DoubleDouble* y, BlasInt incy );
+template QuadDouble Dot
+( BlasInt n, const QuadDouble* x, BlasInt incx, 
+             const QuadDouble* y, BlasInt incy );
 
 // NOTE: I am under the impression that it is generally unsafe to return 
 //       anything except a double-precision float to C from Fortran
@@ -659,6 +678,12 @@ template Complex<Quad> Dotu
 ( BlasInt n, const Complex<Quad>* x, BlasInt incx, 
              const Complex<Quad>* y, BlasInt incy );
 #endif
+template DoubleDouble Dotu
+( BlasInt n, const DoubleDouble* x, BlasInt incx, 
+             const DoubleDouble* y, BlasInt incy );
+template QuadDouble Dotu
+( BlasInt n, const QuadDouble* x, BlasInt incx, 
+             const QuadDouble* y, BlasInt incy );
 
 double Dotu
 ( BlasInt n, const double* x, BlasInt incx, const double* y, BlasInt incy )
@@ -680,6 +705,8 @@ template float Nrm2( BlasInt n, const scomplex* x, BlasInt incx );
 template Quad Nrm2( BlasInt n, const Quad* x, BlasInt incx );
 template Quad Nrm2( BlasInt n, const Complex<Quad>* x, BlasInt incx );
 #endif
+template DoubleDouble Nrm2( BlasInt n, const DoubleDouble* x, BlasInt incx );
+template QuadDouble Nrm2( BlasInt n, const QuadDouble* x, BlasInt incx );
 
 double Nrm2( BlasInt n, const double* x, BlasInt incx )
 { return EL_BLAS(dnrm2)( &n, x, &incx ); }
@@ -708,6 +735,8 @@ template BlasInt MaxInd( BlasInt n, const Int* x, BlasInt incx );
 template BlasInt MaxInd( BlasInt n, const Quad* x, BlasInt incx );
 template BlasInt MaxInd( BlasInt n, const Complex<Quad>* x, BlasInt incx );
 #endif
+template BlasInt MaxInd( BlasInt n, const DoubleDouble* x, BlasInt incx );
+template BlasInt MaxInd( BlasInt n, const QuadDouble* x, BlasInt incx );
 
 BlasInt MaxInd( BlasInt n, const float* x, BlasInt incx )
 {
@@ -779,6 +808,10 @@ template void Scal
 ( BlasInt n, Complex<Quad> alpha, Complex<Quad>* x, BlasInt incx );
 #endif
 template void Scal
+( BlasInt n, DoubleDouble alpha, DoubleDouble* x, BlasInt incx );
+template void Scal
+( BlasInt n, QuadDouble alpha, QuadDouble* x, BlasInt incx );
+template void Scal
 ( BlasInt n, float alpha, Complex<float>* x, BlasInt incx );
 template void Scal
 ( BlasInt n, double alpha, Complex<double>* x, BlasInt incx );
@@ -811,6 +844,8 @@ template float Nrm1( BlasInt n, const scomplex* x, BlasInt incx );
 template Quad Nrm1( BlasInt n, const Quad* x, BlasInt incx );
 template Quad Nrm1( BlasInt n, const Complex<Quad>* x, BlasInt incx );
 #endif
+template DoubleDouble Nrm1( BlasInt n, const DoubleDouble* x, BlasInt incx );
+template QuadDouble Nrm1( BlasInt n, const QuadDouble* x, BlasInt incx );
 
 double Nrm1( BlasInt n, const double* x, BlasInt incx )
 { return EL_BLAS(dasum)( &n, x, &incx ); }
@@ -833,6 +868,10 @@ template void Swap( BlasInt n, Quad* x, BlasInt incx, Quad* y, BlasInt incy );
 template void Swap
 ( BlasInt n, Complex<Quad>* x, BlasInt incx, Complex<Quad>* y, BlasInt incy );
 #endif
+template void Swap
+( BlasInt n, DoubleDouble* x, BlasInt incx, DoubleDouble* y, BlasInt incy );
+template void Swap
+( BlasInt n, QuadDouble* x, BlasInt incx, QuadDouble* y, BlasInt incy );
 
 void Swap( BlasInt n, float* x, BlasInt incx, float* y, BlasInt incy )
 { EL_BLAS(sswap)( &n, x, &incx, y, &incy ); }
@@ -906,6 +945,16 @@ template void Gemv
                        const Complex<Quad>* x, BlasInt incx, 
   Complex<Quad> beta,        Complex<Quad>* y, BlasInt incy );
 #endif
+template void Gemv
+( char trans, BlasInt m, BlasInt n, 
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda,
+                      const DoubleDouble* x, BlasInt incx,
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy );
+template void Gemv
+( char trans, BlasInt m, BlasInt n, 
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda,
+                    const QuadDouble* x, BlasInt incx,
+  QuadDouble beta,        QuadDouble* y, BlasInt incy );
 
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
@@ -971,6 +1020,16 @@ template void Ger
                        const Complex<Quad>* y, BlasInt incy, 
                              Complex<Quad>* A, BlasInt lda );
 #endif
+template void Ger
+( BlasInt m, BlasInt n, 
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx, 
+              const DoubleDouble* y, BlasInt incy, 
+                    DoubleDouble* A, BlasInt lda );
+template void Ger
+( BlasInt m, BlasInt n, 
+  QuadDouble alpha, const QuadDouble* x, BlasInt incx, 
+              const QuadDouble* y, BlasInt incy, 
+                    QuadDouble* A, BlasInt lda );
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -1032,6 +1091,18 @@ template void Geru
   const Complex<Quad>* y, BlasInt incy, 
         Complex<Quad>* A, BlasInt lda );
 #endif
+template void Geru
+( BlasInt m, BlasInt n, 
+  DoubleDouble alpha,
+  const DoubleDouble* x, BlasInt incx, 
+  const DoubleDouble* y, BlasInt incy, 
+        DoubleDouble* A, BlasInt lda );
+template void Geru
+( BlasInt m, BlasInt n, 
+  QuadDouble alpha,
+  const QuadDouble* x, BlasInt incx, 
+  const QuadDouble* y, BlasInt incy, 
+        QuadDouble* A, BlasInt lda );
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -1128,6 +1199,16 @@ template void Hemv
                        const Complex<Quad>* x, BlasInt incx, 
   Complex<Quad> beta,        Complex<Quad>* y, BlasInt incy );
 #endif
+template void Hemv
+( char uplo, BlasInt m, 
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda, 
+              const DoubleDouble* x, BlasInt incx, 
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy );
+template void Hemv
+( char uplo, BlasInt m, 
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda, 
+              const QuadDouble* x, BlasInt incx, 
+  QuadDouble beta,        QuadDouble* y, BlasInt incy );
 
 void Hemv
 ( char uplo, BlasInt m,
@@ -1187,6 +1268,14 @@ template void Her
   Quad alpha, const Complex<Quad>* x, BlasInt incx, 
                     Complex<Quad>* A, BlasInt lda );
 #endif
+template void Her
+( char uplo, BlasInt m, 
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                            DoubleDouble* A, BlasInt lda );
+template void Her
+( char uplo, BlasInt m, 
+  QuadDouble alpha, const QuadDouble* x, BlasInt incx,
+                          QuadDouble* A, BlasInt lda );
 
 void Her
 ( char uplo, BlasInt m,
@@ -1246,6 +1335,16 @@ template void Her2
                        const Complex<Quad>* y, BlasInt incy, 
                              Complex<Quad>* A, BlasInt lda );
 #endif
+template void Her2
+( char uplo, BlasInt m, 
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx, 
+              const DoubleDouble* y, BlasInt incy, 
+                    DoubleDouble* A, BlasInt lda );
+template void Her2
+( char uplo, BlasInt m, 
+  QuadDouble alpha, const QuadDouble* x, BlasInt incx, 
+              const QuadDouble* y, BlasInt incy, 
+                    QuadDouble* A, BlasInt lda );
 
 void Her2
 ( char uplo, BlasInt m,
@@ -1338,6 +1437,16 @@ template void Symv
                        const Complex<Quad>* x, BlasInt incx, 
   Complex<Quad> beta,        Complex<Quad>* y, BlasInt incy );
 #endif
+template void Symv
+( char uplo, BlasInt m, 
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda, 
+              const DoubleDouble* x, BlasInt incx, 
+  DoubleDouble beta,        DoubleDouble* y, BlasInt incy );
+template void Symv
+( char uplo, BlasInt m, 
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda, 
+              const QuadDouble* x, BlasInt incx, 
+  QuadDouble beta,        QuadDouble* y, BlasInt incy );
 
 void Symv
 ( char uplo, BlasInt m,
@@ -1402,6 +1511,14 @@ template void Syr
   Complex<Quad> alpha, const Complex<Quad>* x, BlasInt incx, 
                              Complex<Quad>* A, BlasInt lda );
 #endif
+template void Syr
+( char uplo, BlasInt m, 
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx,
+                            DoubleDouble* A, BlasInt lda );
+template void Syr
+( char uplo, BlasInt m, 
+  QuadDouble alpha, const QuadDouble* x, BlasInt incx,
+                          QuadDouble* A, BlasInt lda );
 
 void Syr
 ( char uplo, BlasInt m,
@@ -1464,6 +1581,16 @@ template void Syr2
                        const Complex<Quad>* y, BlasInt incy, 
                              Complex<Quad>* A, BlasInt lda );
 #endif
+template void Syr2
+( char uplo, BlasInt m, 
+  DoubleDouble alpha, const DoubleDouble* x, BlasInt incx, 
+              const DoubleDouble* y, BlasInt incy, 
+                    DoubleDouble* A, BlasInt lda );
+template void Syr2
+( char uplo, BlasInt m, 
+  QuadDouble alpha, const QuadDouble* x, BlasInt incx, 
+              const QuadDouble* y, BlasInt incy, 
+                    QuadDouble* A, BlasInt lda );
 
 void Syr2
 ( char uplo, BlasInt m,
@@ -1608,6 +1735,12 @@ template void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
   const Complex<Quad>* A, BlasInt lda, Complex<Quad>* x, BlasInt incx );
 #endif
+template void Trmv
+( char uplo, char trans, char diag, BlasInt m,
+  const DoubleDouble* A, BlasInt lda, DoubleDouble* x, BlasInt incx );
+template void Trmv
+( char uplo, char trans, char diag, BlasInt m,
+  const QuadDouble* A, BlasInt lda, QuadDouble* x, BlasInt incx );
 
 void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
@@ -1716,6 +1849,12 @@ template void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
   const Complex<Quad>* A, BlasInt lda, Complex<Quad>* x, BlasInt incx );
 #endif
+template void Trsv
+( char uplo, char trans, char diag, BlasInt m,
+  const DoubleDouble* A, BlasInt lda, DoubleDouble* x, BlasInt incx );
+template void Trsv
+( char uplo, char trans, char diag, BlasInt m,
+  const QuadDouble* A, BlasInt lda, QuadDouble* x, BlasInt incx );
 
 void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
@@ -1759,115 +1898,7 @@ void Gemm
             for( BlasInt i=0; i<m; ++i )
                 C[i+j*ldc] *= beta;
 
-    // Naive implementation
-    if( transA == 'N' && transB == 'N' )
-    {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                const T gamma = alpha*B[l+j*ldb];
-                for( BlasInt i=0; i<m; ++i )
-                    C[i+j*ldc] += gamma*A[i+l*lda];
-            }
-        }
-    }
-    else if( transA == 'N' )
-    {
-        if( transB == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    const T gamma = alpha*B[j+l*ldb];
-                    for( BlasInt i=0; i<m; ++i )
-                        C[i+j*ldc] += gamma*A[i+l*lda];
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    const T gamma = alpha*Conj(B[j+l*ldb]);
-                    for( BlasInt i=0; i<m; ++i )
-                        C[i+j*ldc] += gamma*A[i+l*lda];
-                }
-            }
-        }
-    }
-    else if( transB == 'N' )
-    {
-        if( transA == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    T gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                        gamma += A[l+i*lda]*B[l+j*ldb];
-                    C[i+j*ldc] += alpha*gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    T gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                        gamma += Conj(A[l+i*lda])*B[l+j*ldb];
-                    C[i+j*ldc] += alpha*gamma;
-                }
-            }
-        }
-    }
-    else
-    {
-        if( transA == 'T' && transB == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-                for( BlasInt i=0; i<m; ++i )
-                    for( BlasInt l=0; l<k; ++l )
-                        C[i+j*ldc] += alpha*A[l+i*lda]*B[j+l*ldb];
-        }
-        else if( transA == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-                for( BlasInt i=0; i<m; ++i )
-                    for( BlasInt l=0; l<k; ++l )
-                        C[i+j*ldc] += alpha*A[l+i*lda]*Conj(B[j+l*ldb]);
-        }
-        else if( transB == 'T' )
-        {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-                for( BlasInt i=0; i<m; ++i )
-                    for( BlasInt l=0; l<k; ++l )
-                        C[i+j*ldc] += alpha*Conj(A[l+i*lda])*B[j+l*ldb];
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            for( BlasInt j=0; j<n; ++j )
-                for( BlasInt i=0; i<m; ++i )
-                    for( BlasInt l=0; l<k; ++l )
-                        C[i+j*ldc] += alpha*Conj(A[l+i*lda])*Conj(B[j+l*ldb]);
-        }
-    }
+    gemm::Update( transA, transB, m, n, k, alpha, A, lda, B, ldb, C, ldc );
 }
 template void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, 
@@ -1884,6 +1915,16 @@ template void Gemm
                        const Complex<Quad>* B, BlasInt ldb,
   Complex<Quad> beta,        Complex<Quad>* C, BlasInt ldc );
 #endif
+template void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, 
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda,
+                      const DoubleDouble* B, BlasInt ldb,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt ldc );
+template void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, 
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda,
+                    const QuadDouble* B, BlasInt ldb,
+  QuadDouble beta,        QuadDouble* C, BlasInt ldc );
 
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, 
@@ -2051,79 +2092,41 @@ void Hemm
            const T* B, BlasInt ldb,
   T beta,        T* C, BlasInt ldc )
 {
+    // Scale C
     if( beta == T(0) )
     {
         for( BlasInt j=0; j<n; ++j )
             for( BlasInt i=0; i<m; ++i )
                 C[i+j*ldc] = 0;
-        return;
     }
-
-    // Scale C
-    if( beta != T(1) )
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*ldc] *= beta;
-
-    // Naive implementation
-    if( side == 'L' && uplo == 'L' )
+    else if( beta != T(1) )
     {
-        // C := alpha tril(A) B + C
         for( BlasInt j=0; j<n; ++j )
             for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<=i; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*B[l+j*ldb];
-
-        // C := alpha tril(A,-1)^H B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=i+1; l<m; ++l )
-                    C[i+j*ldc] += alpha*Conj(A[l+i*lda])*B[l+j*ldb];
+                C[i+j*ldc] *= beta;
     }
-    else if( side == 'L' && uplo == 'U' )
-    {
-        // C := alpha triu(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=i; l<m; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*B[l+j*ldb];
+    if( side != 'L' && side != 'R' )
+        LogicError("Unsuported Hemm option");
 
-        // C := alpha triu(A,-)^H B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<i; ++l )
-                    C[i+j*ldc] += alpha*Conj(A[l+i*lda])*B[l+j*ldb];
-    }
-    else if( side == 'R' && uplo == 'L' )
+    // Explicitly form the full Hermitian matrix so that the packed Gemm
+    // implementation can be used
+    const BlasInt k = ( side == 'L' ? m : n );
+    vector<T> AFull;
+    FastResize( AFull, k*k );
+    for( BlasInt j=0; j<k; ++j )
     {
-        // C := alpha B tril(A) + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=j; l<n; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*A[l+j*lda];
-
-        // C := alpha B tril(A,-1)^H + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<j; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*Conj(A[j+l*lda]);
-    }
-    else if( side == 'R' && uplo == 'U' )
-    {
-        // C := alpha B triu(A) + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<=j; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*A[l+j*lda];
-
-        // C := alpha B triu(A,1)^H + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=j+1; l<n; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*Conj(A[j+l*lda]);
+        for( BlasInt i=0; i<k; ++i )
+        {
+            const bool stored = ( uplo == 'L' ? i >= j : i <= j );
+            AFull[i+j*k] = ( stored ? A[i+j*lda] : Conj(A[j+i*lda]) );
+        }
     }
+    if( side == 'L' )
+        gemm::Update
+        ( 'N', 'N', m, n, m, alpha, AFull.data(), k, B, ldb, C, ldc );
     else
-        LogicError("Unsuported Hemm option");
+        gemm::Update
+        ( 'N', 'N', m, n, n, alpha, B, ldb, AFull.data(), k, C, ldc );
 }
 template void Hemm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -2142,6 +2145,16 @@ template void Hemm
                        const Complex<Quad>* B, BlasInt ldb,
   Complex<Quad> beta,        Complex<Quad>* C, BlasInt ldc );
 #endif
+template void Hemm
+( char side, char uplo, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda, 
+              const DoubleDouble* B, BlasInt ldb,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt ldc );
+template void Hemm
+( char side, char uplo, BlasInt m, BlasInt n,
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda, 
+              const QuadDouble* B, BlasInt ldb,
+  QuadDouble beta,        QuadDouble* C, BlasInt ldc );
 
 void Hemm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -2235,20 +2248,21 @@ void Herk
   Base<T> alpha, const T* A, BlasInt lda, 
   Base<T> beta,        T* C, BlasInt ldc )
 {
-    if( uplo == 'L' )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=j; i<n; ++i )
-                for( BlasInt l=0; l<k; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*Conj(A[j+l*lda]);
-    }
-    else
+    // Scale the relevant triangle of C
+    for( BlasInt j=0; j<n; ++j )
     {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<=j; ++i )
-                for( BlasInt l=0; l<k; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*Conj(A[j+l*lda]);
+        const BlasInt iBeg = ( uplo == 'L' ? j : 0 );
+        const BlasInt iEnd = ( uplo == 'L' ? n : j+1 );
+        for( BlasInt i=iBeg; i<iEnd; ++i )
+        {
+            if( beta == Base<T>(0) )
+                C[i+j*ldc] = 0;
+            else if( beta != Base<T>(1) )
+                C[i+j*ldc] *= beta;
+        }
     }
+
+    gemm::TriangularUpdate( uplo, true, n, k, T(alpha), A, lda, C, ldc );
 }
 template void Herk
 ( char uplo, BlasInt n, BlasInt k, 
@@ -2264,6 +2278,14 @@ template void Herk
   Quad alpha, const Complex<Quad>* A, BlasInt lda, 
   Quad beta,        Complex<Quad>* C, BlasInt ldc );
 #endif
+template void Herk
+( char uplo, BlasInt n, BlasInt k, 
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda, 
+  DoubleDouble beta,        DoubleDouble* C, BlasInt ldc );
+template void Herk
+( char uplo, BlasInt n, BlasInt k, 
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda, 
+  QuadDouble beta,        QuadDouble* C, BlasInt ldc );
 
 void Herk
 ( char uplo, char trans, BlasInt n, BlasInt k,
@@ -2304,79 +2326,41 @@ void Symm
            const T* B, BlasInt ldb,
   T beta,        T* C, BlasInt ldc )
 {
+    // Scale C
     if( beta == T(0) )
     {
         for( BlasInt j=0; j<n; ++j )
             for( BlasInt i=0; i<m; ++i )
                 C[i+j*ldc] = 0;
-        return;
-    }
-
-    // Scale C
-    if( beta != T(1) )
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*ldc] *= beta;
-
-    // Naive implementation
-    if( side == 'L' && uplo == 'L' )
-    {
-        // C := alpha tril(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<=i; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*B[l+j*ldb];
-
-        // C := alpha tril(A,-1)^T B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=i+1; l<m; ++l )
-                    C[i+j*ldc] += alpha*A[l+i*lda]*B[l+j*ldb];
     }
-    else if( side == 'L' && uplo == 'U' )
-    {
-        // C := alpha triu(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=i; l<m; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*B[l+j*ldb];
-
-        // C := alpha triu(A,-)^T B + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<i; ++l )
-                    C[i+j*ldc] += alpha*A[l+i*lda]*B[l+j*ldb];
-    }
-    else if( side == 'R' && uplo == 'L' )
+    else if( beta != T(1) )
     {
-        // C := alpha B tril(A) + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=j; l<n; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*A[l+j*lda];
-
-        // C := alpha B tril(A,-1)^T + C
         for( BlasInt j=0; j<n; ++j )
             for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<j; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*A[j+l*lda];
+                C[i+j*ldc] *= beta;
     }
-    else if( side == 'R' && uplo == 'U' )
+    if( side != 'L' && side != 'R' )
+        LogicError("Unsuported Symm option");
+
+    // Explicitly form the full symmetric matrix so that the packed Gemm
+    // implementation can be used
+    const BlasInt k = ( side == 'L' ? m : n );
+    vector<T> AFull;
+    FastResize( AFull, k*k );
+    for( BlasInt j=0; j<k; ++j )
     {
-        // C := alpha B triu(A) + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=0; l<=j; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*A[l+j*lda];
-
-        // C := alpha B triu(A,1)^T + C
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                for( BlasInt l=j+1; l<n; ++l )
-                    C[i+j*ldc] += alpha*B[i+l*ldb]*A[j+l*lda];
+        for( BlasInt i=0; i<k; ++i )
+        {
+            const bool stored = ( uplo == 'L' ? i >= j : i <= j );
+            AFull[i+j*k] = ( stored ? A[i+j*lda] : A[j+i*lda] );
+        }
     }
+    if( side == 'L' )
+        gemm::Update
+        ( 'N', 'N', m, n, m, alpha, AFull.data(), k, B, ldb, C, ldc );
     else
-        LogicError("Unsuported Hemm option");
+        gemm::Update
+        ( 'N', 'N', m, n, n, alpha, B, ldb, AFull.data(), k, C, ldc );
 }
 template void Symm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -2395,6 +2379,16 @@ template void Symm
                        const Complex<Quad>* B, BlasInt ldb,
   Complex<Quad> beta,        Complex<Quad>* C, BlasInt ldc );
 #endif
+template void Symm
+( char side, char uplo, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda, 
+              const DoubleDouble* B, BlasInt ldb,
+  DoubleDouble beta,        DoubleDouble* C, BlasInt ldc );
+template void Symm
+( char side, char uplo, BlasInt m, BlasInt n,
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda, 
+              const QuadDouble* B, BlasInt ldb,
+  QuadDouble beta,        QuadDouble* C, BlasInt ldc );
 
 void Symm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -2481,20 +2475,21 @@ void Syrk
   T alpha, const T* A, BlasInt lda, 
   T beta,        T* C, BlasInt ldc )
 {
-    if( uplo == 'L' )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=j; i<n; ++i )
-                for( BlasInt l=0; l<k; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*A[j+l*lda];
-    }
-    else
+    // Scale the relevant triangle of C
+    for( BlasInt j=0; j<n; ++j )
     {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<=j; ++i )
-                for( BlasInt l=0; l<k; ++l )
-                    C[i+j*ldc] += alpha*A[i+l*lda]*A[j+l*lda];
+        const BlasInt iBeg = ( uplo == 'L' ? j : 0 );
+        const BlasInt iEnd = ( uplo == 'L' ? n : j+1 );
+        for( BlasInt i=iBeg; i<iEnd; ++i )
+        {
+            if( beta == T(0) )
+                C[i+j*ldc] = 0;
+            else if( beta != T(1) )
+                C[i+j*ldc] *= beta;
+        }
     }
+
+    gemm::TriangularUpdate( uplo, false, n, k, T(alpha), A, lda, C, ldc );
 }
 template void Syrk
 ( char uplo, BlasInt n, BlasInt k, 
@@ -2510,6 +2505,14 @@ template void Syrk
   Complex<Quad> alpha, const Complex<Quad>* A, BlasInt lda, 
   Complex<Quad> beta,        Complex<Quad>* C, BlasInt ldc );
 #endif
+template void Syrk
+( char uplo, BlasInt n, BlasInt k, 
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda, 
+  DoubleDouble beta,        DoubleDouble* C, BlasInt ldc );
+template void Syrk
+( char uplo, BlasInt n, BlasInt k, 
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda, 
+  QuadDouble beta,        QuadDouble* C, BlasInt ldc );
 
 void Syrk
 ( char uplo, char trans, BlasInt n, BlasInt k,
@@ -2535,6 +2538,158 @@ void Syrk
   dcomplex beta,        dcomplex* C, BlasInt ldc )
 { EL_BLAS(zsyrk)( &uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C, &ldc ); }
 
+// The textbook algorithms are used for the diagonal blocks of the blocked
+// Trmm and Trsm below
+template<typename T>
+void TrmmUnblocked
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  T alpha, const T* A, BlasInt lda, T* B, BlasInt ldb )
+{
+    // Return entry (i,j) of op(A)
+    auto opA = [&]( BlasInt i, BlasInt j ) -> T
+      { if( trans == 'N' )
+            return A[i+j*lda];
+        else if( trans == 'T' )
+            return A[j+i*lda];
+        else
+            return Conj(A[j+i*lda]); };
+    const bool opLower = ( (uplo == 'L') == (trans == 'N') );
+    const bool nonUnit = ( unit == 'N' );
+    if( side == 'L' )
+    {
+        // B := alpha op(A) B, one column at a time, overwriting each entry
+        // only after it is no longer needed
+        for( BlasInt j=0; j<n; ++j )
+        {
+            T* b = &B[j*ldb];
+            if( opLower )
+            {
+                for( BlasInt i=m-1; i>=0; --i )
+                {
+                    T gamma = ( nonUnit ? opA(i,i)*b[i] : b[i] );
+                    for( BlasInt k=0; k<i; ++k )
+                        gamma += opA(i,k)*b[k];
+                    b[i] = alpha*gamma;
+                }
+            }
+            else
+            {
+                for( BlasInt i=0; i<m; ++i )
+                {
+                    T gamma = ( nonUnit ? opA(i,i)*b[i] : b[i] );
+                    for( BlasInt k=i+1; k<m; ++k )
+                        gamma += opA(i,k)*b[k];
+                    b[i] = alpha*gamma;
+                }
+            }
+        }
+    }
+    else
+    {
+        // B := alpha B op(A), one column of the result at a time
+        for( BlasInt jj=0; jj<n; ++jj )
+        {
+            const BlasInt j = ( opLower ? jj : n-1-jj );
+            T* b = &B[j*ldb];
+            const T delta = ( nonUnit ? alpha*opA(j,j) : alpha );
+            for( BlasInt i=0; i<m; ++i )
+                b[i] *= delta;
+            const BlasInt kBeg = ( opLower ? j+1 : 0 );
+            const BlasInt kEnd = ( opLower ? n : j );
+            for( BlasInt k=kBeg; k<kEnd; ++k )
+            {
+                const T gamma = alpha*opA(k,j);
+                const T* bk = &B[k*ldb];
+                for( BlasInt i=0; i<m; ++i )
+                    b[i] += gamma*bk[i];
+            }
+        }
+    }
+}
+
+// Return a pointer to entry (i,j) of op(A), along with the orientation which
+// should be passed to gemm::Update in order to apply op(A)
+template<typename T>
+inline const T* OpEntry
+( char trans, const T* A, BlasInt lda, BlasInt i, BlasInt j )
+{ return ( trans == 'N' ? &A[i+j*lda] : &A[j+i*lda] ); }
+
+// Partition the triangular matrix into blocks so that all but the
+// (textbook) diagonal block updates are performed by the packed Gemm
+template<typename T>
+void Trmm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  T alpha, const T* A, BlasInt lda, T* B, BlasInt ldb )
+{
+    const bool opLower = ( (uplo == 'L') == (trans == 'N') );
+    const BlasInt nb = gemm::Blocksizes<T>::MC;
+    if( side == 'L' )
+    {
+        // Each block row of B is overwritten only after it has been used to
+        // update the rows which depend upon it
+        const BlasInt numBlocks = (m+nb-1)/nb;
+        for( BlasInt kk=0; kk<numBlocks; ++kk )
+        {
+            const BlasInt kBlock = ( opLower ? numBlocks-1-kk : kk );
+            const BlasInt k = kBlock*nb;
+            const BlasInt kb = Min(nb,m-k);
+            T* BRow = &B[k];
+            TrmmUnblocked
+            ( side, uplo, trans, unit, kb, n,
+              alpha, &A[k+k*lda], lda, BRow, ldb );
+            if( opLower && k > 0 )
+                gemm::Update
+                ( trans, 'N', kb, n, k,
+                  alpha, OpEntry(trans,A,lda,k,0), lda, B, ldb, BRow, ldb );
+            else if( !opLower && k+kb < m )
+                gemm::Update
+                ( trans, 'N', kb, n, m-(k+kb),
+                  alpha, OpEntry(trans,A,lda,k,k+kb), lda, &B[k+kb], ldb,
+                  BRow, ldb );
+        }
+    }
+    else
+    {
+        const BlasInt numBlocks = (n+nb-1)/nb;
+        for( BlasInt jj=0; jj<numBlocks; ++jj )
+        {
+            const BlasInt jBlock = ( opLower ? jj : numBlocks-1-jj );
+            const BlasInt j = jBlock*nb;
+            const BlasInt jb = Min(nb,n-j);
+            T* BCol = &B[j*ldb];
+            TrmmUnblocked
+            ( side, uplo, trans, unit, m, jb,
+              alpha, &A[j+j*lda], lda, BCol, ldb );
+            if( opLower && j+jb < n )
+                gemm::Update
+                ( 'N', trans, m, jb, n-(j+jb),
+                  alpha, &B[(j+jb)*ldb], ldb, OpEntry(trans,A,lda,j+jb,j), lda,
+                  BCol, ldb );
+            else if( !opLower && j > 0 )
+                gemm::Update
+                ( 'N', trans, m, jb, j,
+                  alpha, B, ldb, OpEntry(trans,A,lda,0,j), lda, BCol, ldb );
+        }
+    }
+}
+#ifdef EL_HAVE_QUAD
+template void Trmm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  Quad alpha, const Quad* A, BlasInt lda, Quad* B, BlasInt ldb );
+template void Trmm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  Complex<Quad> alpha, const Complex<Quad>* A, BlasInt lda,
+                             Complex<Quad>* B, BlasInt ldb );
+#endif
+template void Trmm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda,
+                            DoubleDouble* B, BlasInt ldb );
+template void Trmm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda,
+                          QuadDouble* B, BlasInt ldb );
+
 void Trmm
 ( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
   float alpha, const float* A, BlasInt lda, float* B, BlasInt ldb )
@@ -2569,6 +2724,149 @@ void Trmm
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &lda, B, &ldb );
 }
 
+template<typename F>
+void TrsmUnblocked
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  F alpha, const F* A, BlasInt lda, F* B, BlasInt ldb )
+{
+    // Return entry (i,j) of op(A)
+    auto opA = [&]( BlasInt i, BlasInt j ) -> F
+      { if( trans == 'N' )
+            return A[i+j*lda];
+        else if( trans == 'T' )
+            return A[j+i*lda];
+        else
+            return Conj(A[j+i*lda]); };
+    const bool opLower = ( (uplo == 'L') == (trans == 'N') );
+    const bool nonUnit = ( unit == 'N' );
+    if( side == 'L' )
+    {
+        // Solve op(A) X = alpha B one column at a time
+        for( BlasInt j=0; j<n; ++j )
+        {
+            F* b = &B[j*ldb];
+            for( BlasInt i=0; i<m; ++i )
+                b[i] *= alpha;
+            for( BlasInt kk=0; kk<m; ++kk )
+            {
+                const BlasInt k = ( opLower ? kk : m-1-kk );
+                if( nonUnit )
+                    b[k] /= opA(k,k);
+                const F gamma = b[k];
+                const BlasInt iBeg = ( opLower ? k+1 : 0 );
+                const BlasInt iEnd = ( opLower ? m : k );
+                for( BlasInt i=iBeg; i<iEnd; ++i )
+                    b[i] -= gamma*opA(i,k);
+            }
+        }
+    }
+    else
+    {
+        // Solve X op(A) = alpha B one column of X at a time
+        for( BlasInt i=0; i<n*ldb; i+=ldb )
+            for( BlasInt k=0; k<m; ++k )
+                B[i+k] *= alpha;
+        for( BlasInt jj=0; jj<n; ++jj )
+        {
+            const BlasInt j = ( opLower ? n-1-jj : jj );
+            F* b = &B[j*ldb];
+            const BlasInt kBeg = ( opLower ? j+1 : 0 );
+            const BlasInt kEnd = ( opLower ? n : j );
+            for( BlasInt k=kBeg; k<kEnd; ++k )
+            {
+                const F gamma = opA(k,j);
+                const F* bk = &B[k*ldb];
+                for( BlasInt i=0; i<m; ++i )
+                    b[i] -= gamma*bk[i];
+            }
+            if( nonUnit )
+            {
+                const F delta = opA(j,j);
+                for( BlasInt i=0; i<m; ++i )
+                    b[i] /= delta;
+            }
+        }
+    }
+}
+
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  F alpha, const F* A, BlasInt lda, F* B, BlasInt ldb )
+{
+    const bool opLower = ( (uplo == 'L') == (trans == 'N') );
+    const BlasInt nb = gemm::Blocksizes<F>::MC;
+    if( alpha != F(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*ldb] *= alpha;
+    if( side == 'L' )
+    {
+        // Solve against each diagonal block and then eliminate the solution
+        // from the remaining block rows
+        const BlasInt numBlocks = (m+nb-1)/nb;
+        for( BlasInt kk=0; kk<numBlocks; ++kk )
+        {
+            const BlasInt kBlock = ( opLower ? kk : numBlocks-1-kk );
+            const BlasInt k = kBlock*nb;
+            const BlasInt kb = Min(nb,m-k);
+            F* BRow = &B[k];
+            TrsmUnblocked
+            ( side, uplo, trans, unit, kb, n,
+              F(1), &A[k+k*lda], lda, BRow, ldb );
+            if( opLower && k+kb < m )
+                gemm::Update
+                ( trans, 'N', m-(k+kb), n, kb,
+                  F(-1), OpEntry(trans,A,lda,k+kb,k), lda, BRow, ldb,
+                  &B[k+kb], ldb );
+            else if( !opLower && k > 0 )
+                gemm::Update
+                ( trans, 'N', k, n, kb,
+                  F(-1), OpEntry(trans,A,lda,0,k), lda, BRow, ldb, B, ldb );
+        }
+    }
+    else
+    {
+        const BlasInt numBlocks = (n+nb-1)/nb;
+        for( BlasInt jj=0; jj<numBlocks; ++jj )
+        {
+            const BlasInt jBlock = ( opLower ? numBlocks-1-jj : jj );
+            const BlasInt j = jBlock*nb;
+            const BlasInt jb = Min(nb,n-j);
+            F* BCol = &B[j*ldb];
+            TrsmUnblocked
+            ( side, uplo, trans, unit, m, jb,
+              F(1), &A[j+j*lda], lda, BCol, ldb );
+            if( opLower && j > 0 )
+                gemm::Update
+                ( 'N', trans, m, j, jb,
+                  F(-1), BCol, ldb, OpEntry(trans,A,lda,j,0), lda, B, ldb );
+            else if( !opLower && j+jb < n )
+                gemm::Update
+                ( 'N', trans, m, n-(j+jb), jb,
+                  F(-1), BCol, ldb, OpEntry(trans,A,lda,j,j+jb), lda,
+                  &B[(j+jb)*ldb], ldb );
+        }
+    }
+}
+#ifdef EL_HAVE_QUAD
+template void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  Quad alpha, const Quad* A, BlasInt lda, Quad* B, BlasInt ldb );
+template void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  Complex<Quad> alpha, const Complex<Quad>* A, BlasInt lda,
+                             Complex<Quad>* B, BlasInt ldb );
+#endif
+template void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  DoubleDouble alpha, const DoubleDouble* A, BlasInt lda,
+                            DoubleDouble* B, BlasInt ldb );
+template void Trsm
+( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
+  QuadDouble alpha, const QuadDouble* A, BlasInt lda,
+                          QuadDouble* B, BlasInt ldb );
+
 void Trsm
 ( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n,
   float alpha, const float* A, BlasInt lda, float* B, BlasInt ldb )
@@ -0,0 +1,334 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_IMPORTS_BLAS_GEMM_HPP
+#define EL_IMPORTS_BLAS_GEMM_HPP
+
+namespace El {
+namespace blas {
+namespace gemm {
+
+// Cache-blocked GEMM for datatypes without a vendor BLAS
+// ======================================================
+// The following is a simple instance of the approach of
+//
+//   Kazushige Goto and Robert A. van de Geijn,
+//   "Anatomy of high-performance matrix multiplication",
+//   ACM Transactions on Mathematical Software, Vol. 34, No. 3, 2008,
+//
+// where kc x nc panels of op(B) are packed into contiguous slivers of width
+// NR, mc x kc blocks of alpha op(A) are packed into slivers of height MR, and
+// an MR x NR register tile of C is updated by each call to the micro-kernel.
+// The (independent) mc x nc blocks of C are distributed over OpenMP threads
+// when Elemental is built with EL_HYBRID.
+
+template<typename T>
+struct Blocksizes
+{
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    // Keep a packed mc x kc block of A in the L2 cache and a kc x NR sliver
+    // of B in the L1 cache
+    static const BlasInt KC = ( sizeof(T) > 8 ? 128 : 256 );
+    static const BlasInt MC = ( sizeof(T) > 8 ? 64 : 128 );
+    static const BlasInt NC = 2048;
+};
+
+// Problems with fewer multiply-adds than this are not worth packing
+inline Int NaiveCutoff() { return 4096; }
+
+// C := alpha op(A) op(B) + C using the textbook loops
+template<typename T>
+void Naive
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  T alpha, const T* A, BlasInt lda, const T* B, BlasInt ldb,
+                 T* C, BlasInt ldc )
+{
+    if( transA == 'N' && transB == 'N' )
+    {
+        // C := alpha A B + C
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt l=0; l<k; ++l )
+            {
+                const T gamma = alpha*B[l+j*ldb];
+                for( BlasInt i=0; i<m; ++i )
+                    C[i+j*ldc] += gamma*A[i+l*lda];
+            }
+        }
+    }
+    else if( transA == 'N' )
+    {
+        // C := alpha A op(B) + C
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt l=0; l<k; ++l )
+            {
+                const T gamma =
+                  alpha*( transB == 'C' ? Conj(B[j+l*ldb]) : B[j+l*ldb] );
+                for( BlasInt i=0; i<m; ++i )
+                    C[i+j*ldc] += gamma*A[i+l*lda];
+            }
+        }
+    }
+    else
+    {
+        // C := alpha op(A) op(B) + C
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt i=0; i<m; ++i )
+            {
+                T gamma = 0;
+                for( BlasInt l=0; l<k; ++l )
+                {
+                    const T alphaA =
+                      ( transA == 'C' ? Conj(A[l+i*lda]) : A[l+i*lda] );
+                    T betaB;
+                    if( transB == 'N' )
+                        betaB = B[l+j*ldb];
+                    else if( transB == 'T' )
+                        betaB = B[j+l*ldb];
+                    else
+                        betaB = Conj(B[j+l*ldb]);
+                    gamma += alphaA*betaB;
+                }
+                C[i+j*ldc] += alpha*gamma;
+            }
+        }
+    }
+}
+
+// Pack the mc x kc block alpha op(A) into slivers of height MR, padding the
+// last sliver with zeros
+template<typename T>
+void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  T alpha, const T* A, BlasInt lda, T* APack )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    for( BlasInt iSliver=0; iSliver<mc; iSliver+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-iSliver);
+        T* sliver = &APack[iSliver*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            T* a = &sliver[l*MR];
+            if( transA == 'N' )
+            {
+                for( BlasInt i=0; i<mr; ++i )
+                    a[i] = alpha*A[(iSliver+i)+l*lda];
+            }
+            else if( transA == 'T' )
+            {
+                for( BlasInt i=0; i<mr; ++i )
+                    a[i] = alpha*A[l+(iSliver+i)*lda];
+            }
+            else
+            {
+                for( BlasInt i=0; i<mr; ++i )
+                    a[i] = alpha*Conj(A[l+(iSliver+i)*lda]);
+            }
+            for( BlasInt i=mr; i<MR; ++i )
+                a[i] = 0;
+        }
+    }
+}
+
+// Pack the kc x nc panel op(B) into slivers of width NR, padding the last
+// sliver with zeros
+template<typename T>
+void PackB
+( char transB, BlasInt kc, BlasInt nc, const T* B, BlasInt ldb, T* BPack )
+{
+    const BlasInt NR = Blocksizes<T>::NR;
+    for( BlasInt jSliver=0; jSliver<nc; jSliver+=NR )
+    {
+        const BlasInt nr = Min(NR,nc-jSliver);
+        T* sliver = &BPack[jSliver*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            T* b = &sliver[l*NR];
+            if( transB == 'N' )
+            {
+                for( BlasInt j=0; j<nr; ++j )
+                    b[j] = B[l+(jSliver+j)*ldb];
+            }
+            else if( transB == 'T' )
+            {
+                for( BlasInt j=0; j<nr; ++j )
+                    b[j] = B[(jSliver+j)+l*ldb];
+            }
+            else
+            {
+                for( BlasInt j=0; j<nr; ++j )
+                    b[j] = Conj(B[(jSliver+j)+l*ldb]);
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                b[j] = 0;
+        }
+    }
+}
+
+// Update the mr x nr (mr <= MR, nr <= NR) tile of C with the product of
+// packed slivers of A and B
+template<typename T>
+inline void MicroKernel
+( BlasInt kc, const T* a, const T* b, T* C, BlasInt ldc,
+  BlasInt mr, BlasInt nr )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    const BlasInt NR = Blocksizes<T>::NR;
+    T acc[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+        acc[t] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* al = &a[l*MR];
+        const T* bl = &b[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            const T beta = bl[j];
+            for( BlasInt i=0; i<MR; ++i )
+                acc[i+j*MR] += al[i]*beta;
+        }
+    }
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*ldc] += acc[i+j*MR];
+}
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void Blocked
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  T alpha, const T* A, BlasInt lda, const T* B, BlasInt ldb,
+                 T* C, BlasInt ldc )
+{
+    const BlasInt MR = Blocksizes<T>::MR;
+    const BlasInt NR = Blocksizes<T>::NR;
+    const BlasInt KC = Blocksizes<T>::KC;
+    const BlasInt NC = Blocksizes<T>::NC;
+    BlasInt MC = Blocksizes<T>::MC;
+#ifdef EL_HYBRID
+    // Ensure that there are enough blocks of C for each thread to work on
+    if( !omp_in_parallel() )
+    {
+        const BlasInt numThreads = omp_get_max_threads();
+        const BlasInt mcBalanced = ((m/numThreads+MR-1)/MR)*MR;
+        MC = Max( Min(MC,mcBalanced), MR );
+    }
+#endif
+    const BlasInt numRowBlocks = (m+MC-1)/MC;
+
+    vector<T> BPack;
+    FastResize( BPack, KC*(((Min(NC,n)+NR-1)/NR)*NR) );
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            const T* BBlock =
+              ( transB == 'N' ? &B[pc+jc*ldb] : &B[jc+pc*ldb] );
+            PackB( transB, kc, nc, BBlock, ldb, BPack.data() );
+
+#ifdef EL_HYBRID
+            #pragma omp parallel for schedule(dynamic) \
+              if( numRowBlocks > 1 && double(m)*nc*kc >= 32768 )
+#endif
+            for( BlasInt icBlock=0; icBlock<numRowBlocks; ++icBlock )
+            {
+                const BlasInt ic = icBlock*MC;
+                const BlasInt mc = Min(MC,m-ic);
+                const T* ABlock =
+                  ( transA == 'N' ? &A[ic+pc*lda] : &A[pc+ic*lda] );
+                vector<T> APack;
+                FastResize( APack, ((mc+MR-1)/MR)*MR*kc );
+                PackA( transA, mc, kc, alpha, ABlock, lda, APack.data() );
+
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir);
+                        MicroKernel
+                        ( kc, &APack[ir*kc], &BPack[jr*kc],
+                          &C[(ic+ir)+(jc+jr)*ldc], ldc, mr, nr );
+                    }
+                }
+            }
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + C, choosing between the textbook loops and the
+// packed algorithm based upon the amount of work
+template<typename T>
+void Update
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  T alpha, const T* A, BlasInt lda, const T* B, BlasInt ldb,
+                 T* C, BlasInt ldc )
+{
+    if( m == 0 || n == 0 || k == 0 || alpha == T(0) )
+        return;
+    if( double(m)*double(n)*double(k) < double(NaiveCutoff()) )
+        Naive( transA, transB, m, n, k, alpha, A, lda, B, ldb, C, ldc );
+    else
+        Blocked( transA, transB, m, n, k, alpha, A, lda, B, ldb, C, ldc );
+}
+
+// Update the 'uplo' triangle of C with alpha A op(A), where op is either the
+// transpose or adjoint, by forming the off-diagonal panels with the packed
+// algorithm and the diagonal blocks in a temporary buffer
+template<typename T>
+void TriangularUpdate
+( char uplo, bool conjugate, BlasInt n, BlasInt k,
+  T alpha, const T* A, BlasInt lda, T* C, BlasInt ldc )
+{
+    if( n == 0 || k == 0 || alpha == T(0) )
+        return;
+    const char transOpp = ( conjugate ? 'C' : 'T' );
+    const BlasInt nb = Blocksizes<T>::MC;
+    vector<T> diagBuf;
+    FastResize( diagBuf, nb*nb );
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min(nb,n-j);
+
+        // Form the diagonal block in a temporary and keep its triangle
+        MemZero( diagBuf.data(), jb*jb );
+        Update
+        ( 'N', transOpp, jb, jb, k,
+          alpha, &A[j], lda, &A[j], lda, diagBuf.data(), jb );
+        for( BlasInt jj=0; jj<jb; ++jj )
+        {
+            const BlasInt iBeg = ( uplo == 'L' ? jj : 0 );
+            const BlasInt iEnd = ( uplo == 'L' ? jb : jj+1 );
+            for( BlasInt ii=iBeg; ii<iEnd; ++ii )
+                C[(j+ii)+(j+jj)*ldc] += diagBuf[ii+jj*jb];
+        }
+
+        // Update the panel below (or above) the diagonal block
+        if( uplo == 'L' && j+jb < n )
+            Update
+            ( 'N', transOpp, n-(j+jb), jb, k,
+              alpha, &A[j+jb], lda, &A[j], lda, &C[(j+jb)+j*ldc], ldc );
+        else if( uplo != 'L' && j > 0 )
+            Update
+            ( 'N', transOpp, j, jb, k,
+              alpha, A, lda, &A[j], lda, &C[j*ldc], ldc );
+    }
+}
+
+} // namespace gemm
+} // namespace blas
+} // namespace El
+
+#endif // ifndef EL_IMPORTS_BLAS_GEMM_HPP
@@ -245,6 +245,24 @@ void EL_LAPACK(zhseqr)
   dcomplex* w, dcomplex* Z, const BlasInt* ldZ,
   dcomplex* work, const BlasInt* workSize, BlasInt* info );
 
+// Reorder a Schur decomposition
+void EL_LAPACK(strexc)
+( const char* compQ, const BlasInt* n, float* T, const BlasInt* ldT,
+  float* Q, const BlasInt* ldQ, BlasInt* ifst, BlasInt* ilst,
+  float* work, BlasInt* info );
+void EL_LAPACK(dtrexc)
+( const char* compQ, const BlasInt* n, double* T, const BlasInt* ldT,
+  double* Q, const BlasInt* ldQ, BlasInt* ifst, BlasInt* ilst,
+  double* work, BlasInt* info );
+void EL_LAPACK(ctrexc)
+( const char* compQ, const BlasInt* n, scomplex* T, const BlasInt* ldT,
+  scomplex* Q, const BlasInt* ldQ, const BlasInt* ifst, const BlasInt* ilst,
+  BlasInt* info );
+void EL_LAPACK(ztrexc)
+( const char* compQ, const BlasInt* n, dcomplex* T, const BlasInt* ldT,
+  dcomplex* Q, const BlasInt* ldQ, const BlasInt* ifst, const BlasInt* ilst,
+  BlasInt* info );
+
 // Compute eigenpairs of a general matrix using the QR algorithm followed
 // by a sequence of careful triangular solves
 void EL_LAPACK(sgeev)
@@ -308,6 +326,22 @@ double MachineSafeMin<double>()
     return safeMin;
 }
 
+template<>
+DoubleDouble MachineEpsilon<DoubleDouble>()
+{ return std::numeric_limits<DoubleDouble>::epsilon(); }
+
+template<>
+QuadDouble MachineEpsilon<QuadDouble>()
+{ return std::numeric_limits<QuadDouble>::epsilon(); }
+
+template<>
+DoubleDouble MachineSafeMin<DoubleDouble>()
+{ return std::numeric_limits<DoubleDouble>::min(); }
+
+template<>
+QuadDouble MachineSafeMin<QuadDouble>()
+{ return std::numeric_limits<QuadDouble>::min(); }
+
 template<> 
 float MachineBase<float>()
 {
@@ -420,6 +454,8 @@ template float SafeNorm( float alpha, float beta );
 #ifdef EL_HAVE_QUAD
 template Quad SafeNorm( Quad alpha, Quad beta );
 #endif
+template DoubleDouble SafeNorm( DoubleDouble alpha, DoubleDouble beta );
+template QuadDouble SafeNorm( QuadDouble alpha, QuadDouble beta );
 
 double SafeNorm( double alpha, double beta )
 { return EL_LAPACK(dlapy2)( &alpha, &beta ); }
@@ -438,6 +474,10 @@ template float SafeNorm( float alpha, float beta, float gamma );
 #ifdef EL_HAVE_QUAD
 template Quad SafeNorm( Quad alpha, Quad beta, Quad gamma );
 #endif
+template DoubleDouble SafeNorm
+( DoubleDouble alpha, DoubleDouble beta, DoubleDouble gamma );
+template QuadDouble SafeNorm
+( QuadDouble alpha, QuadDouble beta, QuadDouble gamma );
 
 double SafeNorm( double alpha, double beta, double gamma )
 { return EL_LAPACK(dlapy3)( &alpha, &beta, &gamma ); }
@@ -490,6 +530,12 @@ template void Copy
 ( char uplo, BlasInt m, BlasInt n, 
   const Complex<Quad>* A, BlasInt lda, Complex<Quad>* B, BlasInt ldb );
 #endif
+template void Copy
+( char uplo, BlasInt m, BlasInt n, 
+  const DoubleDouble* A, BlasInt lda, DoubleDouble* B, BlasInt ldb );
+template void Copy
+( char uplo, BlasInt m, BlasInt n, 
+  const QuadDouble* A, BlasInt lda, QuadDouble* B, BlasInt ldb );
 
 void Copy
 ( char uplo, BlasInt m, BlasInt n, 
@@ -523,6 +569,42 @@ scomplex Givens( scomplex phi, scomplex gamma, float* c, scomplex* s )
 dcomplex Givens( dcomplex phi, dcomplex gamma, double* c, dcomplex* s )
 { dcomplex rho; EL_LAPACK(zlartg)( &phi, &gamma, c, s, &rho ); return rho; }
 
+// Follow the sign conventions of xLARTG for the types without LAPACK support
+template<typename Real>
+Real RealGivens( Real phi, Real gamma, Real* c, Real* s )
+{
+    if( gamma == Real(0) )
+    {
+        *c = 1;
+        *s = 0;
+        return phi;
+    }
+    if( phi == Real(0) )
+    {
+        *c = 0;
+        *s = 1;
+        return gamma;
+    }
+    Real rho = SafeNorm( phi, gamma );
+    *c = phi/rho;
+    *s = gamma/rho;
+    if( Abs(phi) > Abs(gamma) && *c < Real(0) )
+    {
+        *c = -*c;
+        *s = -*s;
+        rho = -rho;
+    }
+    return rho;
+}
+
+DoubleDouble Givens
+( DoubleDouble phi, DoubleDouble gamma, DoubleDouble* c, DoubleDouble* s )
+{ return RealGivens( phi, gamma, c, s ); }
+
+QuadDouble Givens
+( QuadDouble phi, QuadDouble gamma, QuadDouble* c, QuadDouble* s )
+{ return RealGivens( phi, gamma, c, s ); }
+
 // Compute the EVD of a symmetric tridiagonal matrix
 // =================================================
 
@@ -1808,6 +1890,73 @@ void HessenbergSchur
         RuntimeError("zhseqr's failed to compute all eigenvalues");
 }
 
+// Reorder a Schur decomposition
+// =============================
+
+bool SchurExchange
+( BlasInt n, float* T, BlasInt ldT, float* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    BlasInt ifstOne=ifst+1, ilstOne=ilst+1, info;
+    vector<float> work( n );
+    EL_LAPACK(strexc)
+    ( &compQ, &n, T, &ldT, Q, &ldQ, &ifstOne, &ilstOne, work.data(), &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    ifst = ifstOne-1;
+    ilst = ilstOne-1;
+    return info == 0;
+}
+
+bool SchurExchange
+( BlasInt n, double* T, BlasInt ldT, double* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    BlasInt ifstOne=ifst+1, ilstOne=ilst+1, info;
+    vector<double> work( n );
+    EL_LAPACK(dtrexc)
+    ( &compQ, &n, T, &ldT, Q, &ldQ, &ifstOne, &ilstOne, work.data(), &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    ifst = ifstOne-1;
+    ilst = ilstOne-1;
+    return info == 0;
+}
+
+bool SchurExchange
+( BlasInt n, scomplex* T, BlasInt ldT, scomplex* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    const BlasInt ifstOne=ifst+1, ilstOne=ilst+1;
+    BlasInt info;
+    EL_LAPACK(ctrexc)
+    ( &compQ, &n, T, &ldT, Q, &ldQ, &ifstOne, &ilstOne, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    return true;
+}
+
+bool SchurExchange
+( BlasInt n, dcomplex* T, BlasInt ldT, dcomplex* Q, BlasInt ldQ,
+  BlasInt& ifst, BlasInt& ilst )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    const BlasInt ifstOne=ifst+1, ilstOne=ilst+1;
+    BlasInt info;
+    EL_LAPACK(ztrexc)
+    ( &compQ, &n, T, &ldT, Q, &ldQ, &ifstOne, &ilstOne, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    return true;
+}
+
 // Compute eigenvalues/pairs of an upper Hessenberg matrix
 // =======================================================
 
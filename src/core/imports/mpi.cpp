@@ -30,6 +30,18 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// The total of the per-process counts of a variable-size collective, which
+// is only needed when profiling
+inline double
+SumCounts( const int* counts, El::mpi::Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    const int commSize = El::mpi::Size( comm );
+    double total = 0;
+    for( int q=0; q<commSize; ++q )
+        total += counts[q];
+    return total;
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -379,6 +391,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Barrier"))
+    ProfileRegion region( "mpi::Barrier", 0 );
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -396,6 +409,7 @@ bool Test( Request& request ) EL_NO_RELEASE_EXCEPT
 void Wait( Request& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Wait"))
+    ProfileRegion region( "mpi::Wait", 0 );
     Status status;
     SafeMpi( MPI_Wait( &request, &status ) );
 }
@@ -404,6 +418,7 @@ void Wait( Request& request ) EL_NO_RELEASE_EXCEPT
 void Wait( Request& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Wait"))
+    ProfileRegion region( "mpi::Wait", 0 );
     SafeMpi( MPI_Wait( &request, &status ) );
 }
 
@@ -411,6 +426,7 @@ void Wait( Request& request, Status& status ) EL_NO_RELEASE_EXCEPT
 void WaitAll( int numRequests, Request* requests ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::WaitAll"))
+    ProfileRegion region( "mpi::WaitAll", 0 );
     vector<Status> statuses( numRequests );
     SafeMpi( MPI_Waitall( numRequests, requests, statuses.data() ) );
 }
@@ -420,6 +436,7 @@ void WaitAll( int numRequests, Request* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::WaitAll"))
+    ProfileRegion region( "mpi::WaitAll", 0 );
     SafeMpi( MPI_Waitall( numRequests, requests, statuses ) );
 }
 
@@ -435,6 +452,135 @@ EL_NO_RELEASE_EXCEPT
 bool IProbe( int source, Comm comm, Status& status ) EL_NO_RELEASE_EXCEPT
 { return IProbe( source, 0, comm, status ); }
 
+// Derived datatypes
+// =================
+
+void Contiguous( int count, Datatype oldType, Datatype& newType )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::Contiguous"))
+    SafeMpi( MPI_Type_contiguous( count, oldType, &newType ) );
+}
+
+void Vector
+( int count, int blocklength, int stride, Datatype oldType, 
+  Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::Vector"))
+    SafeMpi
+    ( MPI_Type_vector( count, blocklength, stride, oldType, &newType ) );
+}
+
+void Indexed
+( int count, const int* blocklengths, const int* displs, Datatype oldType,
+  Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::Indexed"))
+    SafeMpi
+    ( MPI_Type_indexed
+      ( count, const_cast<int*>(blocklengths), const_cast<int*>(displs), 
+        oldType, &newType ) );
+}
+
+void HIndexed
+( int count, const int* blocklengths, const Aint* byteDispls, 
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::HIndexed"))
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( count, const_cast<int*>(blocklengths), const_cast<Aint*>(byteDispls),
+        oldType, &newType ) );
+}
+
+void Commit( Datatype& type ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::Commit"))
+    SafeMpi( MPI_Type_commit( &type ) );
+}
+
+// Parallel file I/O
+// =================
+
+bool FileOpen( Comm comm, const string& filename, int amode, File& file )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileOpen"))
+    const int error = 
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), amode, 
+        MPI_INFO_NULL, &file );
+    return error == MPI_SUCCESS;
+}
+
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileClose"))
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+Offset FileSize( File file ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileSize"))
+    Offset size;
+    SafeMpi( MPI_File_get_size( file, &size ) );
+    return size;
+}
+
+void FileSetSize( File file, Offset size ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileSetSize"))
+    SafeMpi( MPI_File_set_size( file, size ) );
+}
+
+void FileSetView( File file, Offset disp, Datatype etype, Datatype fileType )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileSetView"))
+    SafeMpi
+    ( MPI_File_set_view
+      ( file, disp, etype, fileType, const_cast<char*>("native"), 
+        MPI_INFO_NULL ) );
+}
+
+void FileReadAt
+( File file, Offset offset, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileReadAt"))
+    Status status;
+    SafeMpi( MPI_File_read_at( file, offset, buf, count, type, &status ) );
+}
+
+void FileWriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileWriteAt"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( file, offset, const_cast<void*>(buf), count, type, &status ) );
+}
+
+void FileReadAll( File file, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileReadAll"))
+    Status status;
+    SafeMpi( MPI_File_read_all( file, buf, count, type, &status ) );
+}
+
+void FileWriteAll( File file, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FileWriteAll"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( file, const_cast<void*>(buf), count, type, &status ) );
+}
+
 template<typename T>
 int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT
 {
@@ -449,6 +595,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_ONLY(CSE cse("mpi::Send"))
+    ProfileRegion region( "mpi::Send", sizeof(Real)*count );
     SafeMpi( 
       MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm )
@@ -461,6 +608,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Send"))
+    ProfileRegion region( "mpi::Send", sizeof(Complex<Real>)*count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -492,6 +640,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_ONLY(CSE cse("mpi::ISend"))
+    ProfileRegion region( "mpi::ISend", sizeof(Real)*count );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -504,6 +653,7 @@ void TaggedISend
   Request& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ISend"))
+    ProfileRegion region( "mpi::ISend", sizeof(Complex<Real>)*count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -539,6 +689,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ISSend"))
+    ProfileRegion region( "mpi::ISSend", sizeof(Real)*count );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -552,6 +703,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ISSend"))
+    ProfileRegion region( "mpi::ISSend", sizeof(Complex<Real>)*count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -580,6 +732,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Recv"))
+    ProfileRegion region( "mpi::Recv", sizeof(Real)*count );
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -590,6 +743,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Recv"))
+    ProfileRegion region( "mpi::Recv", sizeof(Complex<Real>)*count );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -622,6 +776,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::IRecv"))
+    ProfileRegion region( "mpi::IRecv", sizeof(Real)*count );
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request ) );
@@ -634,6 +789,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::IRecv"))
+    ProfileRegion region( "mpi::IRecv", sizeof(Complex<Real>)*count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &request ) );
@@ -666,6 +822,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    ProfileRegion region( "mpi::SendRecv", sizeof(Real)*(sc+rc) );
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -681,6 +838,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    ProfileRegion region( "mpi::SendRecv", sizeof(Complex<Real>)*(sc+rc) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -725,6 +883,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    ProfileRegion region( "mpi::SendRecv", 2*sizeof(Real)*count );
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -738,6 +897,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    ProfileRegion region( "mpi::SendRecv", 2*sizeof(Complex<Real>)*count );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -764,6 +924,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::Broadcast"))
     if( Size(comm) == 1 )
         return;
+    ProfileRegion region( "mpi::Broadcast", sizeof(Real)*count );
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
@@ -774,6 +935,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::Broadcast"))
     if( Size(comm) == 1 )
         return;
+    ProfileRegion region( "mpi::Broadcast", sizeof(Complex<Real>)*count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
@@ -789,9 +951,11 @@ template<typename Real>
 void IBroadcast( Real* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IBroadcast"))
+    ProfileRegion region( "mpi::IBroadcast", sizeof(Real)*count );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast( buf, count, TypeMap<Real>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)
+      ( buf, count, TypeMap<Real>(), root, comm.comm, &request ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
 #endif
@@ -802,13 +966,15 @@ void IBroadcast
 ( Complex<Real>* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IBroadcast"))
+    ProfileRegion region( "mpi::IBroadcast", sizeof(Complex<Real>)*count );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)
+      ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm, &request ) );
 #endif
 #else
@@ -827,6 +993,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    ProfileRegion region( "mpi::Gather", sizeof(Real)*sc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*rc*Size(comm) );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -840,6 +1009,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    ProfileRegion region( "mpi::Gather", sizeof(Complex<Real>)*sc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*rc*Size(comm) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -860,9 +1032,12 @@ void IGather
         Real* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IGather"))
+    ProfileRegion region( "mpi::IGather", sizeof(Real)*sc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*rc*Size(comm) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm, &request ) );
 #else
@@ -876,16 +1051,19 @@ void IGather
         Complex<Real>* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IGather"))
+    ProfileRegion region( "mpi::IGather", sizeof(Complex<Real>)*sc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*rc*Size(comm) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), 
         root, comm.comm, &request ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm, &request ) );
@@ -895,6 +1073,53 @@ void IGather
 #endif
 }
 
+template<typename Real>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather"))
+    ProfileRegion region( "mpi::IAllGather", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*(sc+rc*Size(comm)) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm, &request ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather"))
+    ProfileRegion region( "mpi::IAllGather", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Complex<Real>)*(sc+rc*Size(comm)) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real>
 void Gather
 ( const Real* sbuf, int sc,
@@ -902,6 +1127,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    ProfileRegion region( "mpi::Gather", sizeof(Real)*sc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*SumCounts(rcs,comm) );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf), 
@@ -923,6 +1151,9 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    ProfileRegion region( "mpi::Gather", sizeof(Complex<Real>)*sc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*SumCounts(rcs,comm) );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -964,6 +1195,9 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    ProfileRegion region( "mpi::AllGather", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*(sc+rc*Size(comm)) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -985,6 +1219,9 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    ProfileRegion region( "mpi::AllGather", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Complex<Real>)*(sc+rc*Size(comm)) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1016,6 +1253,9 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    ProfileRegion region( "mpi::AllGather", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*(sc+SumCounts(rcs,comm)) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1050,6 +1290,9 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    ProfileRegion region( "mpi::AllGather", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Complex<Real>)*(sc+SumCounts(rcs,comm)) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1100,6 +1343,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    ProfileRegion region( "mpi::Scatter", sizeof(Real)*rc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*sc*Size(comm) );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1113,6 +1359,9 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    ProfileRegion region( "mpi::Scatter", sizeof(Complex<Real>)*rc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*sc*Size(comm) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1133,6 +1382,9 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    ProfileRegion region( "mpi::Scatter", sizeof(Real)*rc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*sc*Size(comm) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1165,6 +1417,9 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    ProfileRegion region( "mpi::Scatter", sizeof(Complex<Real>)*rc );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*sc*Size(comm) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1225,6 +1480,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    ProfileRegion region( "mpi::AllToAll", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*(sc+rc)*Size(comm) );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1238,6 +1496,9 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    ProfileRegion region( "mpi::AllToAll", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Complex<Real>)*(sc+rc)*Size(comm) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1258,6 +1519,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    ProfileRegion region( "mpi::AllToAll", 0 );
+    if( region.Active() )
+        AddProfileBytes
+        ( sizeof(Real)*(SumCounts(scs,comm)+SumCounts(rcs,comm)) );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf), 
@@ -1278,6 +1543,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    ProfileRegion region( "mpi::AllToAll", 0 );
+    if( region.Active() )
+        AddProfileBytes
+        ( sizeof(Complex<Real>)*(SumCounts(scs,comm)+SumCounts(rcs,comm)) );
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1336,6 +1605,9 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    ProfileRegion region( "mpi::Reduce", sizeof(Real)*count );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*count );
     if( count == 0 )
         return;
 
@@ -1362,6 +1634,9 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    ProfileRegion region( "mpi::Reduce", sizeof(Complex<Real>)*count );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*count );
     if( count == 0 )
         return;
 
@@ -1423,6 +1698,9 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    ProfileRegion region( "mpi::Reduce", sizeof(Real)*count );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Real)*count );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -1466,6 +1744,9 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
     if( Size(comm) == 1 )
         return;
+    ProfileRegion region( "mpi::Reduce", sizeof(Complex<Real>)*count );
+    if( region.Active() && Rank(comm) == root )
+        AddProfileBytes( sizeof(Complex<Real>)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1562,6 +1843,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    ProfileRegion region( "mpi::AllReduce", 2*sizeof(Real)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1587,6 +1869,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    ProfileRegion region( "mpi::AllReduce", 2*sizeof(Complex<Real>)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1639,6 +1922,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    ProfileRegion region( "mpi::AllReduce", 2*sizeof(Real)*count );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -1670,6 +1954,7 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    ProfileRegion region( "mpi::AllReduce", 2*sizeof(Complex<Real>)*count );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -1741,6 +2026,9 @@ void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    ProfileRegion region( "mpi::ReduceScatter", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*rc*(Size(comm)+1) );
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -1772,6 +2060,9 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    ProfileRegion region( "mpi::ReduceScatter", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Complex<Real>)*rc*(Size(comm)+1) );
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Complex<Real>>().op; 
@@ -1822,6 +2113,9 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
     if( Size(comm) == 1 )
         return;
+    ProfileRegion region( "mpi::ReduceScatter", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*rc*(Size(comm)+1) );
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -1866,6 +2160,9 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
     if( Size(comm) == 1 )
         return;
+    ProfileRegion region( "mpi::ReduceScatter", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Complex<Real>)*rc*(Size(comm)+1) );
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -1926,6 +2223,9 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    ProfileRegion region( "mpi::ReduceScatter", 0 );
+    if( region.Active() )
+        AddProfileBytes( sizeof(Real)*(SumCounts(rcs,comm)+rcs[Rank(comm)]) );
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Real>().op; 
@@ -1949,6 +2249,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    ProfileRegion region( "mpi::ReduceScatter", 0 );
+    if( region.Active() )
+        AddProfileBytes
+        ( sizeof(Complex<Real>)*(SumCounts(rcs,comm)+rcs[Rank(comm)]) );
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Complex<Real>>().op; 
@@ -2012,6 +2316,7 @@ void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    ProfileRegion region( "mpi::Scan", 2*sizeof(Real)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2038,6 +2343,7 @@ void Scan
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    ProfileRegion region( "mpi::Scan", 2*sizeof(Complex<Real>)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2098,6 +2404,7 @@ void Scan( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    ProfileRegion region( "mpi::Scan", 2*sizeof(Real)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2129,6 +2436,7 @@ void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    ProfileRegion region( "mpi::Scan", 2*sizeof(Complex<Real>)*count );
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2329,6 +2637,8 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, Request& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2425,6 +2735,8 @@ MPI_PROTO(double)
 #ifdef EL_HAVE_QUAD
 MPI_PROTO(Quad)
 #endif
+MPI_PROTO(DoubleDouble)
+MPI_PROTO(QuadDouble)
 MPI_PROTO(Complex<float>)
 MPI_PROTO(Complex<double>)
 #ifdef EL_HAVE_QUAD
@@ -2437,6 +2749,8 @@ MPI_PROTO(ValueInt<double>)
 #ifdef EL_HAVE_QUAD
 MPI_PROTO(ValueInt<Quad>)
 #endif
+MPI_PROTO(ValueInt<DoubleDouble>)
+MPI_PROTO(ValueInt<QuadDouble>)
 MPI_PROTO(ValueInt<Complex<float>>)
 MPI_PROTO(ValueInt<Complex<double>>)
 #ifdef EL_HAVE_QUAD
@@ -2448,6 +2762,8 @@ MPI_PROTO(Entry<double>)
 #ifdef EL_HAVE_QUAD
 MPI_PROTO(Entry<Quad>)
 #endif
+MPI_PROTO(Entry<DoubleDouble>)
+MPI_PROTO(Entry<QuadDouble>)
 MPI_PROTO(Entry<Complex<float>>)
 MPI_PROTO(Entry<Complex<double>>)
 #ifdef EL_HAVE_QUAD
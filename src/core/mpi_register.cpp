@@ -14,6 +14,8 @@ using El::Int;
 #ifdef EL_HAVE_QUAD
 using El::Quad;
 #endif
+using El::DoubleDouble;
+using El::QuadDouble;
 using El::Complex;
 using std::function;
 
@@ -22,18 +24,21 @@ using std::function;
 #ifdef EL_HAVE_QUAD
 El::mpi::Datatype QuadType, QuadComplexType;
 #endif
+El::mpi::Datatype DoubleDoubleType, QuadDoubleType;
 
 El::mpi::Datatype IntIntType, floatIntType, doubleIntType,
                   floatComplexIntType, doubleComplexIntType;
 #ifdef EL_HAVE_QUAD
 El::mpi::Datatype QuadIntType, QuadComplexIntType;
 #endif
+El::mpi::Datatype DoubleDoubleIntType, QuadDoubleIntType;
 
 El::mpi::Datatype IntEntryType, floatEntryType, doubleEntryType,
                   floatComplexEntryType, doubleComplexEntryType;
 #ifdef EL_HAVE_QUAD
 El::mpi::Datatype QuadEntryType, QuadComplexEntryType;
 #endif
+El::mpi::Datatype DoubleDoubleEntryType, QuadDoubleEntryType;
 
 // Operations
 // ==========
@@ -42,26 +47,33 @@ El::mpi::Op minQuadOp;
 El::mpi::Op maxQuadOp;
 El::mpi::Op sumQuadOp, sumQuadComplexOp;
 #endif
+El::mpi::Op minDoubleDoubleOp, minQuadDoubleOp;
+El::mpi::Op maxDoubleDoubleOp, maxQuadDoubleOp;
+El::mpi::Op sumDoubleDoubleOp, sumQuadDoubleOp;
 
 El::mpi::Op maxLocIntOp, maxLocFloatOp, maxLocDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op maxLocQuadOp;
 #endif
+El::mpi::Op maxLocDoubleDoubleOp, maxLocQuadDoubleOp;
 
 El::mpi::Op maxLocPairIntOp, maxLocPairFloatOp, maxLocPairDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op maxLocPairQuadOp;
 #endif
+El::mpi::Op maxLocPairDoubleDoubleOp, maxLocPairQuadDoubleOp;
 
 El::mpi::Op minLocIntOp, minLocFloatOp, minLocDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op minLocQuadOp;
 #endif
+El::mpi::Op minLocDoubleDoubleOp, minLocQuadDoubleOp;
 
 El::mpi::Op minLocPairIntOp, minLocPairFloatOp, minLocPairDoubleOp;
 #ifdef EL_HAVE_QUAD
 El::mpi::Op minLocPairQuadOp;
 #endif
+El::mpi::Op minLocPairDoubleDoubleOp, minLocPairQuadDoubleOp;
 
 function<Int(const Int&,const Int&)>
   userIntFunc, userIntCommFunc;
@@ -93,6 +105,14 @@ function<Complex<Quad>(const Complex<Quad>&,const Complex<Quad>&)>
 El::mpi::Op userComplexQuadOp, userComplexQuadCommOp;
 #endif
 
+function<DoubleDouble(const DoubleDouble&,const DoubleDouble&)>
+  userDoubleDoubleFunc, userDoubleDoubleCommFunc;
+El::mpi::Op userDoubleDoubleOp, userDoubleDoubleCommOp;
+
+function<QuadDouble(const QuadDouble&,const QuadDouble&)>
+  userQuadDoubleFunc, userQuadDoubleCommFunc;
+El::mpi::Op userQuadDoubleOp, userQuadDoubleCommOp;
+
 // TODO: ValueInt<Real> user functions and ops
 // TODO: ValueIntPair<Real> user functions and ops
 
@@ -337,6 +357,72 @@ EL_NO_EXCEPT
 }
 #endif
 
+template<>
+void SetUserReduceFunc
+( function<DoubleDouble(const DoubleDouble&,const DoubleDouble&)> func,
+  bool commutative )
+{
+    if( commutative )
+        ::userDoubleDoubleCommFunc = func;
+    else
+        ::userDoubleDoubleFunc = func;
+}
+static void
+UserDoubleDoubleReduce
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = ::userDoubleDoubleFunc(inData[j],outData[j]);
+}
+static void
+UserDoubleDoubleReduceComm
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = ::userDoubleDoubleCommFunc(inData[j],outData[j]);
+}
+
+template<>
+void SetUserReduceFunc
+( function<QuadDouble(const QuadDouble&,const QuadDouble&)> func,
+  bool commutative )
+{
+    if( commutative )
+        ::userQuadDoubleCommFunc = func;
+    else
+        ::userQuadDoubleFunc = func;
+}
+static void
+UserQuadDoubleReduce
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const QuadDouble*>(inVoid);
+    auto outData = static_cast<      QuadDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = ::userQuadDoubleFunc(inData[j],outData[j]);
+}
+static void
+UserQuadDoubleReduceComm
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const QuadDouble*>(inVoid);
+    auto outData = static_cast<      QuadDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = ::userQuadDoubleCommFunc(inData[j],outData[j]);
+}
+
 #ifdef EL_HAVE_QUAD
 static void
 MaxQuad( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
@@ -390,6 +476,90 @@ EL_NO_EXCEPT
 }
 #endif 
 
+static void
+MaxDoubleDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+    {
+        if( inData[j] > outData[j] )
+            outData[j] = inData[j];
+    }
+}
+
+static void
+MinDoubleDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+    {
+        if( inData[j] < outData[j] )
+            outData[j] = inData[j];
+    }
+}
+
+static void
+SumDoubleDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const DoubleDouble*>(inVoid);
+    auto outData = static_cast<      DoubleDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] += inData[j];
+}
+
+static void
+MaxQuadDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const QuadDouble*>(inVoid);
+    auto outData = static_cast<      QuadDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+    {
+        if( inData[j] > outData[j] )
+            outData[j] = inData[j];
+    }
+}
+
+static void
+MinQuadDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const QuadDouble*>(inVoid);
+    auto outData = static_cast<      QuadDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+    {
+        if( inData[j] < outData[j] )
+            outData[j] = inData[j];
+    }
+}
+
+static void
+SumQuadDouble
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const QuadDouble*>(inVoid);
+    auto outData = static_cast<      QuadDouble*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] += inData[j];
+}
+
 template<typename T>
 static void
 MaxLocFunc( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
@@ -422,6 +592,12 @@ template void
 MaxLocFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
 #endif
+template void
+MaxLocFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
+template void
+MaxLocFunc<QuadDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
 
 template<typename T>
 static void
@@ -455,6 +631,12 @@ template void
 MaxLocPairFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
 #endif
+template void
+MaxLocPairFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
+template void
+MaxLocPairFunc<QuadDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
 
 template<typename T>
 static void
@@ -488,6 +670,12 @@ template void
 MinLocFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
 #endif
+template void
+MinLocFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
+template void
+MinLocFunc<QuadDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
 
 template<typename T>
 static void
@@ -521,6 +709,12 @@ template void
 MinLocPairFunc<Quad>( void* in, void* out, int* length, Datatype* datatype )
 EL_NO_EXCEPT;
 #endif
+template void
+MinLocPairFunc<DoubleDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
+template void
+MinLocPairFunc<QuadDouble>
+( void* in, void* out, int* length, Datatype* datatype ) EL_NO_EXCEPT;
 
 template<typename R> static Datatype& ValueIntType() EL_NO_EXCEPT;
 template<>
@@ -534,6 +728,12 @@ template<>
 Datatype& ValueIntType<Quad>() EL_NO_EXCEPT { return ::QuadIntType; }
 #endif
 template<>
+Datatype& ValueIntType<DoubleDouble>() EL_NO_EXCEPT
+{ return ::DoubleDoubleIntType; }
+template<>
+Datatype& ValueIntType<QuadDouble>() EL_NO_EXCEPT
+{ return ::QuadDoubleIntType; }
+template<>
 Datatype& ValueIntType<Complex<float>>() EL_NO_EXCEPT
 { return ::floatComplexIntType; }
 template<>
@@ -557,6 +757,12 @@ template<>
 Datatype& EntryType<Quad>() EL_NO_EXCEPT { return ::QuadEntryType; }
 #endif
 template<>
+Datatype& EntryType<DoubleDouble>() EL_NO_EXCEPT
+{ return ::DoubleDoubleEntryType; }
+template<>
+Datatype& EntryType<QuadDouble>() EL_NO_EXCEPT
+{ return ::QuadDoubleEntryType; }
+template<>
 Datatype& EntryType<Complex<float>>() EL_NO_EXCEPT
 { return ::floatComplexEntryType; }
 template<>
@@ -593,6 +799,10 @@ template<> Datatype TypeMap<double>() EL_NO_EXCEPT{ return MPI_DOUBLE; }
 #ifdef EL_HAVE_QUAD
 template<> Datatype TypeMap<Quad>() EL_NO_EXCEPT { return ::QuadType; }
 #endif
+template<> Datatype TypeMap<DoubleDouble>() EL_NO_EXCEPT
+{ return ::DoubleDoubleType; }
+template<> Datatype TypeMap<QuadDouble>() EL_NO_EXCEPT
+{ return ::QuadDoubleType; }
 
 /* I'm not sure of whether it is better to manually implement these
    or not. MPI_COMPLEX and MPI_DOUBLE_COMPLEX are dangerous since it 
@@ -634,6 +844,10 @@ template<> Datatype TypeMap<ValueInt<double>>() EL_NO_EXCEPT
 template<> Datatype TypeMap<ValueInt<Quad>>() EL_NO_EXCEPT
 { return ValueIntType<Quad>(); }
 #endif
+template<> Datatype TypeMap<ValueInt<DoubleDouble>>() EL_NO_EXCEPT
+{ return ValueIntType<DoubleDouble>(); }
+template<> Datatype TypeMap<ValueInt<QuadDouble>>() EL_NO_EXCEPT
+{ return ValueIntType<QuadDouble>(); }
 template<> Datatype TypeMap<ValueInt<Complex<float>>>() EL_NO_EXCEPT
 { return ValueIntType<Complex<float>>(); }
 template<> Datatype TypeMap<ValueInt<Complex<double>>>() EL_NO_EXCEPT
@@ -653,6 +867,10 @@ template<> Datatype TypeMap<Entry<double>>() EL_NO_EXCEPT
 template<> Datatype TypeMap<Entry<Quad>>() EL_NO_EXCEPT
 { return EntryType<Quad>(); }
 #endif
+template<> Datatype TypeMap<Entry<DoubleDouble>>() EL_NO_EXCEPT
+{ return EntryType<DoubleDouble>(); }
+template<> Datatype TypeMap<Entry<QuadDouble>>() EL_NO_EXCEPT
+{ return EntryType<QuadDouble>(); }
 template<> Datatype TypeMap<Entry<Complex<float>>>() EL_NO_EXCEPT
 { return EntryType<Complex<float>>(); }
 template<> Datatype TypeMap<Entry<Complex<double>>>() EL_NO_EXCEPT
@@ -694,6 +912,8 @@ template void CreateValueIntType<double>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void CreateValueIntType<Quad>() EL_NO_EXCEPT;
 #endif
+template void CreateValueIntType<DoubleDouble>() EL_NO_EXCEPT;
+template void CreateValueIntType<QuadDouble>() EL_NO_EXCEPT;
 template void CreateValueIntType<Complex<float>>() EL_NO_EXCEPT;
 template void CreateValueIntType<Complex<double>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
@@ -736,6 +956,8 @@ template void CreateEntryType<double>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
 template void CreateEntryType<Quad>() EL_NO_EXCEPT;
 #endif
+template void CreateEntryType<DoubleDouble>() EL_NO_EXCEPT;
+template void CreateEntryType<QuadDouble>() EL_NO_EXCEPT;
 template void CreateEntryType<Complex<float>>() EL_NO_EXCEPT;
 template void CreateEntryType<Complex<double>>() EL_NO_EXCEPT;
 #ifdef EL_HAVE_QUAD
@@ -757,6 +979,14 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     MPI_Type_contiguous( 4, MPI_DOUBLE, &::QuadComplexType );
     MPI_Type_commit( &::QuadComplexType );
 #endif
+
+    // Create MPI types for DoubleDouble and QuadDouble
+    // ------------------------------------------------
+    MPI_Type_contiguous( 2, MPI_DOUBLE, &::DoubleDoubleType );
+    MPI_Type_commit( &::DoubleDoubleType );
+    MPI_Type_contiguous( 4, MPI_DOUBLE, &::QuadDoubleType );
+    MPI_Type_commit( &::QuadDoubleType );
+
     // A value and an integer
     // ----------------------
     mpi::CreateValueIntType<Int>();
@@ -770,6 +1000,8 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #ifdef EL_HAVE_QUAD
     mpi::CreateValueIntType<Quad>();
 #endif
+    mpi::CreateValueIntType<DoubleDouble>();
+    mpi::CreateValueIntType<QuadDouble>();
     mpi::CreateValueIntType<Complex<float>>();
     mpi::CreateValueIntType<Complex<double>>();
 #ifdef EL_HAVE_QUAD
@@ -783,6 +1015,8 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #ifdef EL_HAVE_QUAD
     mpi::CreateEntryType<Quad>();
 #endif
+    mpi::CreateEntryType<DoubleDouble>();
+    mpi::CreateEntryType<QuadDouble>();
     mpi::CreateEntryType<Complex<float>>();
     mpi::CreateEntryType<Complex<double>>();
 #ifdef EL_HAVE_QUAD
@@ -827,6 +1061,16 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     Create
     ( (UserFunction*)UserComplexQuadReduceComm, true, ::userComplexQuadCommOp );
 #endif
+    Create
+    ( (UserFunction*)UserDoubleDoubleReduce, false, ::userDoubleDoubleOp );
+    Create
+    ( (UserFunction*)UserDoubleDoubleReduceComm, true,
+                   ::userDoubleDoubleCommOp );
+    Create
+    ( (UserFunction*)UserQuadDoubleReduce, false, ::userQuadDoubleOp );
+    Create
+    ( (UserFunction*)UserQuadDoubleReduceComm, true,
+                   ::userQuadDoubleCommOp );
    
     // Functions for scalar types
     // --------------------------
@@ -836,6 +1080,12 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     Create( (UserFunction*)SumQuad, true, ::sumQuadOp );
     Create( (UserFunction*)SumQuadComplex, true, ::sumQuadComplexOp );
 #endif
+    Create( (UserFunction*)MaxDoubleDouble, true, ::maxDoubleDoubleOp );
+    Create( (UserFunction*)MinDoubleDouble, true, ::minDoubleDoubleOp );
+    Create( (UserFunction*)SumDoubleDouble, true, ::sumDoubleDoubleOp );
+    Create( (UserFunction*)MaxQuadDouble, true, ::maxQuadDoubleOp );
+    Create( (UserFunction*)MinQuadDouble, true, ::minQuadDoubleOp );
+    Create( (UserFunction*)SumQuadDouble, true, ::sumQuadDoubleOp );
     // Functions for the value and integer
     // -----------------------------------
     Create( (UserFunction*)MaxLocFunc<Int>,    true, ::maxLocIntOp    );
@@ -855,6 +1105,14 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     Create( (UserFunction*)MaxLocFunc<Quad>,   true, ::maxLocQuadOp   );
     Create( (UserFunction*)MinLocFunc<Quad>,   true, ::minLocQuadOp   );
 #endif
+    Create
+    ( (UserFunction*)MaxLocFunc<DoubleDouble>, true, ::maxLocDoubleDoubleOp );
+    Create
+    ( (UserFunction*)MinLocFunc<DoubleDouble>, true, ::minLocDoubleDoubleOp );
+    Create
+    ( (UserFunction*)MaxLocFunc<QuadDouble>, true, ::maxLocQuadDoubleOp );
+    Create
+    ( (UserFunction*)MinLocFunc<QuadDouble>, true, ::minLocQuadDoubleOp );
     // Functions for the triplet of a value and a pair of integers
     // -----------------------------------------------------------
     Create( (UserFunction*)MaxLocPairFunc<Int>,    true, ::maxLocPairIntOp    );
@@ -867,6 +1125,18 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     Create( (UserFunction*)MaxLocPairFunc<Quad>,   true, ::maxLocPairQuadOp   );
     Create( (UserFunction*)MinLocPairFunc<Quad>,   true, ::minLocPairQuadOp   );
 #endif
+    Create
+    ( (UserFunction*)MaxLocPairFunc<DoubleDouble>, true,
+                   ::maxLocPairDoubleDoubleOp );
+    Create
+    ( (UserFunction*)MinLocPairFunc<DoubleDouble>, true,
+                   ::minLocPairDoubleDoubleOp );
+    Create
+    ( (UserFunction*)MaxLocPairFunc<QuadDouble>, true,
+                   ::maxLocPairQuadDoubleOp );
+    Create
+    ( (UserFunction*)MinLocPairFunc<QuadDouble>, true,
+                   ::minLocPairQuadDoubleOp );
 }
 
 void DestroyCustom() EL_NO_RELEASE_EXCEPT
@@ -877,6 +1147,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::QuadType );
     Free( ::QuadComplexType );
 #endif
+    Free( ::DoubleDoubleType );
+    Free( ::QuadDoubleType );
 
     Free( ValueIntType<Int>() );
 #ifdef EL_USE_64BIT_INTS
@@ -886,6 +1158,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
 #ifdef EL_HAVE_QUAD
     Free( ValueIntType<Quad>() );
 #endif
+    Free( ValueIntType<DoubleDouble>() );
+    Free( ValueIntType<QuadDouble>() );
     Free( ValueIntType<Complex<float>>() );
     Free( ValueIntType<Complex<double>>() );
 #ifdef EL_HAVE_QUAD
@@ -898,6 +1172,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
 #ifdef EL_HAVE_QUAD
     Free( EntryType<Quad>() );
 #endif
+    Free( EntryType<DoubleDouble>() );
+    Free( EntryType<QuadDouble>() );
     Free( EntryType<Complex<float>>() );
     Free( EntryType<Complex<double>>() );
 #ifdef EL_HAVE_QUAD
@@ -925,6 +1201,10 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::userComplexQuadOp );
     Free( ::userComplexQuadCommOp );
 #endif
+    Free( ::userDoubleDoubleOp );
+    Free( ::userDoubleDoubleCommOp );
+    Free( ::userQuadDoubleOp );
+    Free( ::userQuadDoubleCommOp );
 
 #ifdef EL_HAVE_QUAD
     Free( ::maxQuadOp );
@@ -932,6 +1212,12 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::sumQuadOp );
     Free( ::sumQuadComplexOp );
 #endif
+    Free( ::maxDoubleDoubleOp );
+    Free( ::minDoubleDoubleOp );
+    Free( ::sumDoubleDoubleOp );
+    Free( ::maxQuadDoubleOp );
+    Free( ::minQuadDoubleOp );
+    Free( ::sumQuadDoubleOp );
 
     Free( ::maxLocIntOp );
     Free( ::minLocIntOp );
@@ -945,6 +1231,10 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::maxLocQuadOp );
     Free( ::minLocQuadOp );
 #endif
+    Free( ::maxLocDoubleDoubleOp );
+    Free( ::minLocDoubleDoubleOp );
+    Free( ::maxLocQuadDoubleOp );
+    Free( ::minLocQuadDoubleOp );
 
     Free( ::maxLocPairIntOp );
     Free( ::minLocPairIntOp );
@@ -956,6 +1246,10 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     Free( ::maxLocPairQuadOp );
     Free( ::minLocPairQuadOp );
 #endif
+    Free( ::maxLocPairDoubleDoubleOp );
+    Free( ::minLocPairDoubleDoubleOp );
+    Free( ::maxLocPairQuadDoubleOp );
+    Free( ::minLocPairQuadDoubleOp );
 }
 
 template<> Op UserOp<Int>() EL_NO_EXCEPT { return ::userIntOp; }
@@ -971,6 +1265,10 @@ template<> Op UserOp<Quad>() EL_NO_EXCEPT
 template<> Op UserOp<Complex<Quad>>() EL_NO_EXCEPT
 { return ::userComplexQuadOp; }
 #endif
+template<> Op UserOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::userDoubleDoubleOp; }
+template<> Op UserOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::userQuadDoubleOp; }
 
 template<> Op UserCommOp<Int>() EL_NO_EXCEPT { return ::userIntCommOp; }
 template<> Op UserCommOp<float>() EL_NO_EXCEPT { return ::userFloatCommOp; }
@@ -985,6 +1283,10 @@ template<> Op UserCommOp<Quad>() EL_NO_EXCEPT
 template<> Op UserCommOp<Complex<Quad>>() EL_NO_EXCEPT
 { return ::userComplexQuadCommOp; }
 #endif
+template<> Op UserCommOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::userDoubleDoubleCommOp; }
+template<> Op UserCommOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::userQuadDoubleCommOp; }
 
 #ifdef EL_HAVE_QUAD
 template<> Op MaxOp<Quad>() EL_NO_EXCEPT { return ::maxQuadOp; }
@@ -994,12 +1296,30 @@ template<> Op SumOp<Quad>() EL_NO_EXCEPT { return ::sumQuadOp; }
 template<> Op SumOp<Complex<Quad>>() EL_NO_EXCEPT { return ::sumQuadComplexOp; }
 #endif
 
+template<> Op MaxOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::maxDoubleDoubleOp; }
+template<> Op MinOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::minDoubleDoubleOp; }
+template<> Op SumOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::sumDoubleDoubleOp; }
+
+template<> Op MaxOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::maxQuadDoubleOp; }
+template<> Op MinOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::minQuadDoubleOp; }
+template<> Op SumOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::sumQuadDoubleOp; }
+
 template<> Op MaxLocOp<Int>() EL_NO_EXCEPT { return ::maxLocIntOp; }
 template<> Op MaxLocOp<float>() EL_NO_EXCEPT { return ::maxLocFloatOp; }
 template<> Op MaxLocOp<double>() EL_NO_EXCEPT { return ::maxLocDoubleOp; }
 #ifdef EL_HAVE_QUAD
 template<> Op MaxLocOp<Quad>() EL_NO_EXCEPT { return ::maxLocQuadOp; }
 #endif
+template<> Op MaxLocOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::maxLocDoubleDoubleOp; }
+template<> Op MaxLocOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::maxLocQuadDoubleOp; }
 
 template<> Op MaxLocPairOp<Int>() EL_NO_EXCEPT
 { return ::maxLocPairIntOp; }
@@ -1011,6 +1331,10 @@ template<> Op MaxLocPairOp<double>() EL_NO_EXCEPT
 template<> Op MaxLocPairOp<Quad>() EL_NO_EXCEPT
 { return ::maxLocPairQuadOp; }
 #endif
+template<> Op MaxLocPairOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::maxLocPairDoubleDoubleOp; }
+template<> Op MaxLocPairOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::maxLocPairQuadDoubleOp; }
 
 template<> Op MinLocOp<Int>() EL_NO_EXCEPT { return ::minLocIntOp; }
 template<> Op MinLocOp<float>() EL_NO_EXCEPT { return ::minLocFloatOp; }
@@ -1018,6 +1342,10 @@ template<> Op MinLocOp<double>() EL_NO_EXCEPT { return ::minLocDoubleOp; }
 #ifdef EL_HAVE_QUAD
 template<> Op MinLocOp<Quad>() EL_NO_EXCEPT { return ::minLocQuadOp; }
 #endif
+template<> Op MinLocOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::minLocDoubleDoubleOp; }
+template<> Op MinLocOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::minLocQuadDoubleOp; }
 
 template<> Op MinLocPairOp<Int>() EL_NO_EXCEPT
 { return ::minLocPairIntOp; }
@@ -1029,6 +1357,10 @@ template<> Op MinLocPairOp<double>() EL_NO_EXCEPT
 template<> Op MinLocPairOp<Quad>() EL_NO_EXCEPT
 { return ::minLocPairQuadOp; }
 #endif
+template<> Op MinLocPairOp<DoubleDouble>() EL_NO_EXCEPT
+{ return ::minLocPairDoubleDoubleOp; }
+template<> Op MinLocPairOp<QuadDouble>() EL_NO_EXCEPT
+{ return ::minLocPairQuadDoubleOp; }
 
 } // namespace mpi
 } // namespace El
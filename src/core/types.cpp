@@ -189,6 +189,8 @@ template struct SafeProduct<double>;
 #ifdef EL_ENABLE_QUAD
 template struct SafeProduct<Quad>;
 #endif
+template struct SafeProduct<DoubleDouble>;
+template struct SafeProduct<QuadDouble>;
 template struct SafeProduct<Complex<float>>;
 template struct SafeProduct<Complex<double>>;
 #ifdef EL_ENABLE_QUAD
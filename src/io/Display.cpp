@@ -332,6 +332,8 @@ void DisplayLocal
   template void Display( const DistSparseMatrix<T>& A, string title );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
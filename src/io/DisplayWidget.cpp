@@ -180,6 +180,8 @@ void DisplayWidget<T>::SavePng( string basename ) const
 
 #define PROTO(T) template class DisplayWidget<T>;
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
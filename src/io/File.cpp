@@ -47,6 +47,9 @@ string FileExtension( FileFormat format )
 
 FileFormat FormatFromExtension( const string ext )
 {
+    // Matrix Market files are also commonly given the extension "mtx"
+    if( ext == string("mtx") )
+        return MATRIX_MARKET;
     bool foundFormat = false;
     FileFormat format = BINARY;
     for( int j=1; j<FileFormat_MAX; ++j )
@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_IO_MPIIO_HPP
+#define EL_IO_MPIIO_HPP
+
+// Collective MPI-IO transfers between a column-major file and the local
+// portion of an arbitrary distributed matrix. Each process describes the
+// entries it owns with a file view so that the entire matrix is moved with
+// a single MPI_File_read_all/MPI_File_write_all rather than from one root.
+
+namespace El {
+namespace mpi_io {
+
+// Form the datatypes describing the locally-owned entries of A within a
+// column-major file (with leading dimension A.Height()) and within the local
+// buffer. An inactive process contributes no entries.
+template<typename T>
+inline Int
+LocalTypes
+( const AbstractDistMatrix<T>& A, bool active,
+  mpi::Datatype& elemType, mpi::Datatype& fileType, mpi::Datatype& memType )
+{
+    DEBUG_ONLY(CSE cse("mpi_io::LocalTypes"))
+    // Move the raw bytes so that every supported scalar type is handled
+    mpi::Contiguous( sizeof(T), mpi::TypeMap<byte>(), elemType );
+    mpi::Commit( elemType );
+
+    const Int height = A.Height();
+    const Int localHeight = ( active ? A.LocalHeight() : 0 );
+    const Int localWidth = ( active ? A.LocalWidth() : 0 );
+    if( localHeight == 0 || localWidth == 0 )
+    {
+        mpi::Contiguous( 1, elemType, fileType );
+        mpi::Contiguous( 1, elemType, memType );
+        mpi::Commit( fileType );
+        mpi::Commit( memType );
+        return 0;
+    }
+
+    // Compress the locally-owned rows into contiguous runs
+    vector<int> rowLengths, rowDispls;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( rowDispls.size() > 0 && rowDispls.back()+rowLengths.back() == i )
+            ++rowLengths.back();
+        else
+        {
+            rowDispls.push_back( i );
+            rowLengths.push_back( 1 );
+        }
+    }
+    mpi::Datatype rowType;
+    mpi::Indexed
+    ( rowDispls.size(), rowLengths.data(), rowDispls.data(), elemType,
+      rowType );
+
+    // Place the row pattern at the start of each locally-owned column
+    vector<int> colLengths( localWidth, 1 );
+    vector<mpi::Aint> colDispls( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colDispls[jLoc] = mpi::Aint(A.GlobalCol(jLoc))*height*sizeof(T);
+    mpi::HIndexed
+    ( localWidth, colLengths.data(), colDispls.data(), rowType, fileType );
+    mpi::Commit( fileType );
+    mpi::Free( rowType );
+
+    // The local buffer is column-major with leading dimension A.LDim()
+    mpi::Vector( localWidth, localHeight, A.LDim(), elemType, memType );
+    mpi::Commit( memType );
+
+    return 1;
+}
+
+inline void
+FreeTypes
+( mpi::Datatype& elemType, mpi::Datatype& fileType, mpi::Datatype& memType )
+{
+    mpi::Free( memType );
+    mpi::Free( fileType );
+    mpi::Free( elemType );
+}
+
+// Fill every locally-owned entry of A from a column-major file whose data
+// begins 'disp' bytes into the file. Redundant copies are read in parallel.
+template<typename T>
+inline void
+ReadAll( AbstractDistMatrix<T>& A, mpi::File file, mpi::Offset disp )
+{
+    DEBUG_ONLY(CSE cse("mpi_io::ReadAll"))
+    mpi::Datatype elemType, fileType, memType;
+    const Int count =
+      LocalTypes( A, A.Participating(), elemType, fileType, memType );
+    mpi::FileSetView( file, disp, elemType, fileType );
+    mpi::FileReadAll( file, A.Buffer(), count, memType );
+    FreeTypes( elemType, fileType, memType );
+}
+
+// Write A into a column-major file whose data begins 'disp' bytes into the
+// file. Only the first of any redundant copies contributes its entries.
+template<typename T>
+inline void
+WriteAll( const AbstractDistMatrix<T>& A, mpi::File file, mpi::Offset disp )
+{
+    DEBUG_ONLY(CSE cse("mpi_io::WriteAll"))
+    const bool active = A.Participating() && A.RedundantRank() == 0;
+    mpi::Datatype elemType, fileType, memType;
+    const Int count = LocalTypes( A, active, elemType, fileType, memType );
+    mpi::FileSetView( file, disp, elemType, fileType );
+    mpi::FileWriteAll( file, A.LockedBuffer(), count, memType );
+    FreeTypes( elemType, fileType, memType );
+}
+
+// Independently transfer numBytes bytes starting at the given byte offset
+// (with respect to the default file view), splitting the transfer so that
+// the count of each MPI call fits within an int
+inline void
+ReadBytesAt
+( mpi::File file, mpi::Offset offset, void* buf, mpi::Offset numBytes )
+{
+    DEBUG_ONLY(CSE cse("mpi_io::ReadBytesAt"))
+    const mpi::Offset maxChunk = mpi::Offset(1) << 30;
+    byte* bytes = static_cast<byte*>(buf);
+    for( mpi::Offset k=0; k<numBytes; k+=maxChunk )
+    {
+        const int chunk = int(Min(maxChunk,numBytes-k));
+        mpi::FileReadAt
+        ( file, offset+k, bytes+k, chunk, mpi::TypeMap<byte>() );
+    }
+}
+
+inline void
+WriteBytesAt
+( mpi::File file, mpi::Offset offset, const void* buf, mpi::Offset numBytes )
+{
+    DEBUG_ONLY(CSE cse("mpi_io::WriteBytesAt"))
+    const mpi::Offset maxChunk = mpi::Offset(1) << 30;
+    const byte* bytes = static_cast<const byte*>(buf);
+    for( mpi::Offset k=0; k<numBytes; k+=maxChunk )
+    {
+        const int chunk = int(Min(maxChunk,numBytes-k));
+        mpi::FileWriteAt
+        ( file, offset+k, bytes+k, chunk, mpi::TypeMap<byte>() );
+    }
+}
+
+} // namespace mpi_io
+} // namespace El
+
+#endif // ifndef EL_IO_MPIIO_HPP
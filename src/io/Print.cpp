@@ -175,6 +175,8 @@ void Print( const vector<T>& x, string title, ostream& os )
   ( const DistSparseMatrix<T>& A, string title, ostream& os );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 
+#include "./MPIIO.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
@@ -54,7 +55,15 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename ); 
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( !sequential && (format == BINARY || format == BINARY_FLAT) )
+    {
+        // Every process collectively reads its own entries via MPI-IO
+        if( format == BINARY )
+            read::Binary( A, filename );
+        else
+            read::BinaryFlat( A, A.Height(), A.Width(), filename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
@@ -87,12 +96,6 @@ void Read
         case ASCII_MATLAB:
             read::AsciiMatlab( A, filename );
             break;
-        case BINARY:
-            read::Binary( A, filename );
-            break;
-        case BINARY_FLAT:
-            read::BinaryFlat( A, A.Height(), A.Width(), filename );
-            break;
         case MATRIX_MARKET:
             read::MatrixMarket( A, filename );
             break;
@@ -102,12 +105,56 @@ void Read
     }
 }
 
+template<typename T>
+void Read( SparseMatrix<T>& A, const string filename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Read"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY:
+        read::Binary( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for reading sparse matrices");
+    }
+}
+
+template<typename T>
+void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Read"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY:
+        read::Binary( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for reading sparse matrices");
+    }
+}
+
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const string filename, FileFormat format ); \
   template void Read \
   ( AbstractDistMatrix<T>& A, const string filename, \
-    FileFormat format, bool sequential );
+    FileFormat format, bool sequential ); \
+  template void Read \
+  ( SparseMatrix<T>& A, const string filename, FileFormat format ); \
+  template void Read \
+  ( DistSparseMatrix<T>& A, const string filename, FileFormat format );
 
 #include "El/macros/Instantiate.h"
 
@@ -46,61 +46,164 @@ inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     DEBUG_ONLY(CSE cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    if( !mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file ) )
         RuntimeError("Could not open ",filename);
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
+    Int dims[2];
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileReadAt
+        ( file, 0, dims, 2*sizeof(Int), mpi::TypeMap<byte>() );
+    mpi::Broadcast( dims, 2, 0, comm );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const Int numBytes = mpi::FileSize( file );
     const Int metaBytes = 2*sizeof(Int);
     const Int dataBytes = height*width*sizeof(T);
     const Int numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
+    mpi_io::ReadAll( A, file, metaBytes );
+    mpi::FileClose( file );
+}
+
+// Sparse matrices are stored in a compressed sparse row format: the height,
+// width, and number of entries, followed by the height+1 row offsets, the
+// column indices, and the values
+namespace csr {
+
+// Expand the row offsets into row indices while checking their consistency
+inline void ExpandOffsets
+( Int firstRow, Int numRows, Int width, const Int* offsetBuf,
+  const Int* targetBuf, Int* sourceBuf )
+{
+    DEBUG_ONLY(CSE cse("read::csr::ExpandOffsets"))
+    for( Int i=0; i<numRows; ++i )
     {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        if( offsetBuf[i] > offsetBuf[i+1] )
+            RuntimeError("Row offsets were not monotonic");
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
         {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
+            if( targetBuf[e] < 0 || targetBuf[e] >= width )
+                RuntimeError("Column index ",targetBuf[e]," out of bounds");
+            sourceBuf[e] = firstRow + i;
         }
     }
-    else
+}
+
+} // namespace csr
+
+template<typename T>
+inline void
+Binary( SparseMatrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::Binary"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int numBytes = FileSize( file );
+    const Int metaBytes = 3*sizeof(Int);
+    if( numBytes < metaBytes )
+        RuntimeError("File was only ",numBytes," bytes");
+    Int dims[3];
+    file.read( (char*)dims, metaBytes );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const Int numEntries = dims[2];
+    const Int dataBytes =
+      (height+1+numEntries)*sizeof(Int) + numEntries*sizeof(T);
+    const Int numBytesExp = metaBytes + dataBytes;
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+    Zeros( A, height, width );
+    A.ForceNumEntries( numEntries );
+    Int* offsetBuf = A.OffsetBuffer();
+    file.read( (char*)offsetBuf, (height+1)*sizeof(Int) );
+    file.read( (char*)A.TargetBuffer(), numEntries*sizeof(Int) );
+    file.read( (char*)A.ValueBuffer(), numEntries*sizeof(T) );
+    if( offsetBuf[0] != 0 || offsetBuf[height] != numEntries )
+        RuntimeError("Invalid row offsets");
+    csr::ExpandOffsets
+    ( 0, height, width, offsetBuf, A.LockedTargetBuffer(),
+      A.SourceBuffer() );
+    A.ForceConsistency();
+}
+
+// Each process independently reads the offsets, indices, and values of the
+// rows which it owns
+template<typename T>
+inline void
+Binary( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::Binary"))
+    mpi::Comm comm = A.Comm();
+    mpi::File file;
+    if( !mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file ) )
+        RuntimeError("Could not open ",filename);
+
+    const Int numBytes = mpi::FileSize( file );
+    const Int metaBytes = 3*sizeof(Int);
+    Int dims[3] = { 0, 0, 0 };
+    if( mpi::Rank(comm) == 0 && numBytes >= metaBytes )
+        mpi::FileReadAt
+        ( file, 0, dims, metaBytes, mpi::TypeMap<byte>() );
+    mpi::Broadcast( dims, 3, 0, comm );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const Int numEntries = dims[2];
+    const Int dataBytes =
+      (height+1+numEntries)*sizeof(Int) + numEntries*sizeof(T);
+    const Int numBytesExp = metaBytes + dataBytes;
+    if( numBytes < metaBytes || numBytes != numBytesExp )
     {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
+        mpi::FileClose( file );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+
+    Zeros( A, height, width );
+    const Int firstLocalRow = Min( A.FirstLocalRow(), height );
+    const Int localHeight = A.LocalHeight();
+    Int* offsetBuf = A.OffsetBuffer();
+    mpi_io::ReadBytesAt
+    ( file, metaBytes+firstLocalRow*sizeof(Int), offsetBuf,
+      (localHeight+1)*sizeof(Int) );
+    const Int localBeg = offsetBuf[0];
+    const Int numLocalEntries = offsetBuf[localHeight] - localBeg;
+    if( localBeg < 0 || numLocalEntries < 0 ||
+        localBeg+numLocalEntries > numEntries )
+    {
+        mpi::FileClose( file );
+        RuntimeError("Invalid row offsets");
     }
+    A.ForceNumLocalEntries( numLocalEntries );
+    offsetBuf = A.OffsetBuffer();
+    const Int targetBeg = metaBytes + (height+1)*sizeof(Int);
+    const Int valueBeg = targetBeg + numEntries*sizeof(Int);
+    mpi_io::ReadBytesAt
+    ( file, targetBeg+localBeg*sizeof(Int), A.TargetBuffer(),
+      numLocalEntries*sizeof(Int) );
+    mpi_io::ReadBytesAt
+    ( file, valueBeg+localBeg*sizeof(T), A.ValueBuffer(),
+      numLocalEntries*sizeof(T) );
+    mpi::FileClose( file );
+
+    for( Int iLoc=0; iLoc<=localHeight; ++iLoc )
+        offsetBuf[iLoc] -= localBeg;
+    csr::ExpandOffsets
+    ( firstLocalRow, localHeight, width, offsetBuf, A.LockedTargetBuffer(),
+      A.SourceBuffer() );
+    A.ForceConsistency();
 }
 
 } // namespace read
@@ -13,15 +13,23 @@
 namespace El {
 namespace read {
 
-template<typename T>
-inline void
-MatrixMarket( Matrix<T>& A, const string filename )
+namespace mm {
+
+struct Header
 {
-    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isGeneral, isSymmetric, isSkewSymmetric, isHermitian;
+    Int height, width, numNonzeros;
+    // The byte offset of the first line after the size line
+    mpi::Offset dataOffset;
+};
+
+// Parse and validate the banner, comments, and size line of a Matrix Market
+// file, leaving the stream positioned at the first entry
+inline Header ReadHeader( std::ifstream& file )
+{
+    DEBUG_ONLY(CSE cse("read::mm::ReadHeader"))
+    Header header;
 
     // Read the header
     // ===============
@@ -46,34 +54,35 @@ MatrixMarket( Matrix<T>& A, const string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    header.isMatrix = ( object == string("matrix") );
+    header.isArray = ( format == string("array") );
+    header.isComplex = ( field == string("complex") );
+    header.isPattern = ( field == string("pattern") );
+    header.isGeneral = ( symmetry == string("general") );
+    header.isSymmetric = ( symmetry == string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    header.isHermitian = ( symmetry == string("hermitian") );
+    if( !header.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !header.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern && 
+    if( !header.isComplex && !header.isPattern &&
         field != string("real") && 
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !header.isGeneral && !header.isSymmetric &&
+        !header.isSkewSymmetric && !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( header.isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
@@ -81,29 +90,211 @@ MatrixMarket( Matrix<T>& A, const string filename )
     while( file.peek() == '%' ) 
         std::getline( file, line );
   
-    int m, n;
+    // Read in the dimensions (and the number of nonzeros)
+    // ===================================================
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
-    if( isArray )
+    std::stringstream lineStream( line );
+    if( !(lineStream >> header.height) )
+        RuntimeError("Missing height: ",line);
+    if( header.isMatrix )
+    {
+        if( !(lineStream >> header.width) )
+            RuntimeError("Missing matrix width: ",line);
+    }
+    else
+        header.width = 1;
+    if( header.isArray )
+        header.numNonzeros = header.height*header.width;
+    else if( !(lineStream >> header.numNonzeros) )
+        RuntimeError("Missing nonzeros entry: ",line);
+    header.dataOffset = file.tellg();
+
+    return header;
+}
+
+// Non-allocating parsers which advance 'p' past the parsed token of a
+// null-terminated line and return false if no valid token was found
+inline bool ParseIndex( const char*& p, Int& index )
+{
+    while( *p == ' ' || *p == '\t' )
+        ++p;
+    if( *p < '0' || *p > '9' )
+        return false;
+    Int value = 0;
+    for( ; *p >= '0' && *p <= '9'; ++p )
+        value = 10*value + (*p-'0');
+    index = value;
+    return true;
+}
+
+inline bool ParseReal( const char*& p, double& alpha )
+{
+    char* next;
+    alpha = std::strtod( p, &next );
+    if( next == p )
+        return false;
+    p = next;
+    return true;
+}
+
+// Parse a single (null-terminated) coordinate line and queue the resulting
+// entry, as well as its mirror image for the symmetric storage formats.
+// Returns false if the line was blank.
+template<typename T,typename QueueFunction>
+inline bool ParseCoordinateLine
+( const Header& header, const char* line, QueueFunction& queue )
+{
+    const char* p = line;
+    Int i, j;
+    if( !ParseIndex( p, i ) )
+    {
+        while( *p == ' ' || *p == '\t' || *p == '\r' )
+            ++p;
+        if( *p == '\0' )
+            return false;
+        RuntimeError("Invalid Matrix Market entry: ",line);
+    }
+    if( header.isMatrix )
+    {
+        if( !ParseIndex( p, j ) )
+            RuntimeError("Could not extract column index: ",line);
+    }
+    else
+        j = 1;
+    if( i < 1 || i > header.height || j < 1 || j > header.width )
+        RuntimeError("Entry out of bounds: ",line);
+    // Convert from Fortran to C indexing
+    --i;
+    --j;
+
+    T value(1);
+    if( !header.isPattern )
     {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
+        double realPart, imagPart;
+        if( !ParseReal( p, realPart ) )
+            RuntimeError("Could not extract real part: ",line);
+        SetRealPart( value, Base<T>(realPart) );
+        if( header.isComplex )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
+            if( !ParseReal( p, imagPart ) )
+                RuntimeError("Could not extract imag part: ",line);
+            SetImagPart( value, Base<T>(imagPart) );
         }
-        else
+    }
+
+    queue( i, j, value );
+    if( i != j )
+    {
+        // As in the dense case, complex skew-symmetry is not conjugated
+        if( header.isSymmetric )
+            queue( j, i, value );
+        else if( header.isHermitian )
+            queue( j, i, Conj(value) );
+        else if( header.isSkewSymmetric )
+            queue( j, i, -value );
+    }
+    return true;
+}
+
+// Stream through the lines of the data section, [dataBeg,dataEnd), which
+// begin within the byte range [beg,end), reading the file in blocks via
+// readBytes(offset,buffer,numBytes), and return the number of entries parsed.
+// Partitioning [dataBeg,dataEnd) into disjoint byte ranges assigns each line
+// to exactly one range.
+template<typename T,typename ReadFunction,typename QueueFunction>
+inline Int ParseCoordinateRange
+( const Header& header,
+  mpi::Offset dataBeg, mpi::Offset dataEnd,
+  mpi::Offset beg, mpi::Offset end,
+  ReadFunction readBytes, QueueFunction queue )
+{
+    DEBUG_ONLY(CSE cse("read::mm::ParseCoordinateRange"))
+    const mpi::Offset blockSize = mpi::Offset(1) << 22;
+
+    // Unless the range begins the data section, the preceding byte is
+    // needed to decide whether a line begins at 'beg'
+    const bool seekLine = ( beg > dataBeg );
+    bool seeking = seekLine;
+    mpi::Offset bufferOffset = ( seekLine ? beg-1 : beg );
+    mpi::Offset readOffset = bufferOffset;
+    Int numCarried = 0;
+    Int numParsed = 0;
+    vector<char> buffer;
+    while( true )
+    {
+        // Append the next block (and terminate the final line if necessary)
+        const Int numRead = Int(Min( blockSize, dataEnd-readOffset ));
+        buffer.resize( numCarried+numRead+1 );
+        if( numRead > 0 )
+            readBytes( readOffset, &buffer[numCarried], numRead );
+        readOffset += numRead;
+        const bool atEnd = ( readOffset == dataEnd );
+        Int numValid = numCarried + numRead;
+        if( atEnd && numValid > 0 && buffer[numValid-1] != '\n' )
+            buffer[numValid++] = '\n';
+
+        char* p = buffer.data();
+        char* bufferEnd = p + numValid;
+        if( seeking )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
+            char* newline = (char*)std::memchr( p, '\n', numValid );
+            if( newline == nullptr )
+            {
+                if( atEnd )
+                    break;
+                bufferOffset += numValid;
+                numCarried = 0;
+                continue;
+            }
+            p = newline + 1;
+            seeking = false;
         }
 
+        bool finished = false;
+        while( true )
+        {
+            char* newline = (char*)std::memchr( p, '\n', bufferEnd-p );
+            if( newline == nullptr )
+                break;
+            if( bufferOffset+(p-buffer.data()) >= end )
+            {
+                finished = true;
+                break;
+            }
+            *newline = '\0';
+            if( *p != '%' && ParseCoordinateLine<T>( header, p, queue ) )
+                ++numParsed;
+            p = newline + 1;
+        }
+        if( finished || atEnd )
+            break;
+
+        // Carry the partial line over to the next block
+        numCarried = bufferEnd - p;
+        bufferOffset += p - buffer.data();
+        std::memmove( buffer.data(), p, numCarried );
+    }
+    return numParsed;
+}
+
+} // namespace mm
+
+template<typename T>
+inline void
+MatrixMarket( Matrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
+    typedef Base<T> Real;
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const mm::Header header = mm::ReadHeader( file );
+    const Int m = header.height;
+    const Int n = header.width;
+    string line;
+    if( header.isArray )
+    {
         // Resize the matrix
         // =================
         Zeros( A, m, n );
@@ -122,7 +313,7 @@ MatrixMarket( Matrix<T>& A, const string filename )
                     RuntimeError
                     ("Could not extract real part of entry (",i,",",j,")");
                 A.SetRealPart( i, j, realPart );
-                if( isComplex )
+                if( header.isComplex )
                 {
                     if( !(lineStream >> imagPart) )
                         RuntimeError
@@ -134,29 +325,6 @@ MatrixMarket( Matrix<T>& A, const string filename )
     }
     else
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-
         // Create a matrix of zeros
         // ========================
         Zeros( A, m, n );
@@ -165,7 +333,7 @@ MatrixMarket( Matrix<T>& A, const string filename )
         // ===========================
         int i, j;
         Real realPart, imagPart;
-        for( Int k=0; k<numNonzero; ++k )
+        for( Int k=0; k<header.numNonzeros; ++k )
         {
             if( !std::getline( file, line ) )
                 RuntimeError("Could not get nonzero ",k);
@@ -173,7 +341,7 @@ MatrixMarket( Matrix<T>& A, const string filename )
             if( !(lineStream >> i) )
                 RuntimeError("Could not extract row coordinate of nonzero ",k);
             --i; // convert from Fortran to C indexing
-            if( isMatrix )
+            if( header.isMatrix )
             {
                 if( !(lineStream >> j) )
                     RuntimeError
@@ -183,7 +351,7 @@ MatrixMarket( Matrix<T>& A, const string filename )
             else
                 j = 0;
 
-            if( isPattern )
+            if( header.isPattern )
             {
                 A.Set( i, j, T(1) );
             }
@@ -193,7 +361,7 @@ MatrixMarket( Matrix<T>& A, const string filename )
                     RuntimeError
                     ("Could not extract real part of entry (",i,",",j,")");
                 A.UpdateRealPart( i, j, realPart );
-                if( isComplex )
+                if( header.isComplex )
                 {
                     if( !(lineStream >> imagPart) )
                         RuntimeError
@@ -204,14 +372,14 @@ MatrixMarket( Matrix<T>& A, const string filename )
         }
     }
 
-    if( isSymmetric )
+    if( header.isSymmetric )
         MakeSymmetric( LOWER, A );
-    if( isHermitian )
+    if( header.isHermitian )
         MakeHermitian( LOWER, A );
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
     const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( header.isSkewSymmetric )
     {
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
@@ -235,6 +403,153 @@ MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
     Copy( A_CIRC_CIRC, A );
 }
 
+template<typename T>
+inline void
+MatrixMarket( SparseMatrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const mm::Header header = mm::ReadHeader( file );
+    if( header.isArray )
+        RuntimeError("Sparse matrices require the coordinate format");
+    if( header.isComplex && !IsComplex<T>::value )
+        RuntimeError("Cannot read complex data into a real matrix");
+    const mpi::Offset dataEnd = FileSize( file );
+
+    Zeros( A, header.height, header.width );
+    const bool mirrored = !header.isGeneral;
+    A.Reserve( mirrored ? 2*header.numNonzeros : header.numNonzeros );
+    const Int numParsed =
+      mm::ParseCoordinateRange<T>
+      ( header, header.dataOffset, dataEnd, header.dataOffset, dataEnd,
+        [&]( mpi::Offset offset, char* buf, Int numBytes )
+        {
+            file.seekg( offset );
+            file.read( buf, numBytes );
+        },
+        [&]( Int i, Int j, T value ) { A.QueueUpdate( i, j, value ); } );
+    if( numParsed != header.numNonzeros )
+        RuntimeError
+        ("Expected ",header.numNonzeros," nonzeros but found ",numParsed);
+    A.ProcessQueues();
+}
+
+// Each process parses the lines beginning within its own contiguous share
+// of the bytes of the data section and queues the entries for their owners
+template<typename T>
+inline void
+MatrixMarket( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Parse the header on the root and broadcast it (along with whether it
+    // was valid so that every process can throw)
+    mm::Header header;
+    string headerError;
+    Int meta[13];
+    if( commRank == 0 )
+    {
+        try
+        {
+            std::ifstream file( filename.c_str(), std::ios::binary );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+            header = mm::ReadHeader( file );
+            meta[0] = 1;
+        }
+        catch( std::exception& e )
+        {
+            headerError = e.what();
+            MemZero( meta, 13 );
+        }
+    }
+    if( commRank == 0 && meta[0] )
+    {
+        meta[1] = header.isMatrix;
+        meta[2] = header.isArray;
+        meta[3] = header.isComplex;
+        meta[4] = header.isPattern;
+        meta[5] = header.isGeneral;
+        meta[6] = header.isSymmetric;
+        meta[7] = header.isSkewSymmetric;
+        meta[8] = header.isHermitian;
+        meta[9] = header.height;
+        meta[10] = header.width;
+        meta[11] = header.numNonzeros;
+        meta[12] = Int(header.dataOffset);
+    }
+    mpi::Broadcast( meta, 13, 0, comm );
+    if( !meta[0] )
+    {
+        if( commRank == 0 )
+            RuntimeError(headerError);
+        else
+            RuntimeError("Could not read the header of ",filename);
+    }
+    header.isMatrix = meta[1];
+    header.isArray = meta[2];
+    header.isComplex = meta[3];
+    header.isPattern = meta[4];
+    header.isGeneral = meta[5];
+    header.isSymmetric = meta[6];
+    header.isSkewSymmetric = meta[7];
+    header.isHermitian = meta[8];
+    header.height = meta[9];
+    header.width = meta[10];
+    header.numNonzeros = meta[11];
+    header.dataOffset = meta[12];
+    if( header.isArray )
+        RuntimeError("Sparse matrices require the coordinate format");
+    if( header.isComplex && !IsComplex<T>::value )
+        RuntimeError("Cannot read complex data into a real matrix");
+
+    mpi::File file;
+    if( !mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file ) )
+        RuntimeError("Could not open ",filename);
+    const mpi::Offset dataBeg = header.dataOffset;
+    const mpi::Offset dataEnd = mpi::FileSize( file );
+    const mpi::Offset dataBytes = dataEnd - dataBeg;
+    const mpi::Offset beg = dataBeg + (dataBytes*commRank)/commSize;
+    const mpi::Offset end = dataBeg + (dataBytes*(commRank+1))/commSize;
+
+    Zeros( A, header.height, header.width );
+    Int numParsed = 0;
+    Int parseFailed = 0;
+    string parseError;
+    try
+    {
+        numParsed =
+          mm::ParseCoordinateRange<T>
+          ( header, dataBeg, dataEnd, beg, end,
+            [&]( mpi::Offset offset, char* buf, Int numBytes )
+            { mpi_io::ReadBytesAt( file, offset, buf, numBytes ); },
+            [&]( Int i, Int j, T value ) { A.QueueUpdate( i, j, value ); } );
+    }
+    catch( std::exception& e )
+    {
+        parseError = e.what();
+        parseFailed = 1;
+    }
+    mpi::FileClose( file );
+
+    // Agree upon success before the collective exchange of the entries
+    Int counts[2] = { numParsed, parseFailed };
+    mpi::AllReduce( counts, 2, comm );
+    if( parseFailed )
+        RuntimeError(parseError);
+    if( counts[1] != 0 )
+        RuntimeError("Could not parse the entries of ",filename);
+    if( counts[0] != header.numNonzeros )
+        RuntimeError
+        ("Expected ",header.numNonzeros," nonzeros but found ",counts[0]);
+    A.ProcessQueues();
+}
+
 } // namespace read
 } // namespace El
 
@@ -71,6 +71,8 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
   ( const AbstractDistMatrix<T>& A, string title, Base<T> tol );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
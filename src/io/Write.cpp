@@ -8,6 +8,7 @@
 */
 #include "El.hpp"
 
+#include "./MPIIO.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
@@ -49,7 +50,16 @@ void Write
   string basename, FileFormat format, string title )
 {
     DEBUG_ONLY(CSE cse("Write"))
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY )
+    {
+        // Every process collectively writes its own entries via MPI-IO
+        write::Binary( A, basename );
+    }
+    else if( format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -62,15 +72,48 @@ void Write
     }
 }
 
+template<typename T>
+void Write( const SparseMatrix<T>& A, string basename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Write"))
+    switch( format )
+    {
+    case BINARY:        write::Binary( A, basename );       break;
+    case MATRIX_MARKET: write::MatrixMarket( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing sparse matrices");
+    }
+}
+
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Write"))
+    switch( format )
+    {
+    case BINARY:        write::Binary( A, basename );       break;
+    case MATRIX_MARKET: write::MatrixMarket( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing sparse matrices");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const SparseMatrix<T>& A, string basename, FileFormat format ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, string basename, FileFormat format );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -36,6 +36,108 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::Binary"))
+
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    if( !mpi::FileOpen
+         ( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file ) )
+        RuntimeError("Could not open ",filename);
+
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, metaBytes+dataBytes );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        mpi::FileWriteAt
+        ( file, 0, dims, 2*sizeof(Int), mpi::TypeMap<byte>() );
+    }
+    mpi_io::WriteAll( A, file, metaBytes );
+    mpi::FileClose( file );
+}
+
+// Sparse matrices are written in the compressed sparse row format described
+// in src/io/Read/Binary.hpp
+template<typename T>
+inline void
+Binary( const SparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::Binary"))
+    
+    string filename = basename + "." + FileExtension(BINARY);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    A.AssertConsistent();
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    const Int dims[3] = { height, A.Width(), numEntries };
+    file.write( (char*)dims, 3*sizeof(Int) );
+    file.write( (char*)A.LockedOffsetBuffer(), (height+1)*sizeof(Int) );
+    file.write( (char*)A.LockedTargetBuffer(), numEntries*sizeof(Int) );
+    file.write( (char*)A.LockedValueBuffer(), numEntries*sizeof(T) );
+}
+
+template<typename T>
+inline void
+Binary( const DistSparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::Binary"))
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    A.AssertConsistent();
+
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int localBeg = mpi::Scan( numLocalEntries, comm ) - numLocalEntries;
+
+    // Convert the local row offsets into global ones, with the last process
+    // also writing the final offset
+    const Int firstLocalRow = Min( A.FirstLocalRow(), height );
+    const Int localHeight = A.LocalHeight();
+    const Int numOffsets =
+      ( commRank == commSize-1 ? localHeight+1 : localHeight );
+    const Int* localOffsetBuf = A.LockedOffsetBuffer();
+    vector<Int> offsets( numOffsets );
+    for( Int iLoc=0; iLoc<numOffsets; ++iLoc )
+        offsets[iLoc] = localBeg + localOffsetBuf[iLoc];
+
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::File file;
+    if( !mpi::FileOpen
+         ( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file ) )
+        RuntimeError("Could not open ",filename);
+
+    const Int metaBytes = 3*sizeof(Int);
+    const Int targetBeg = metaBytes + (height+1)*sizeof(Int);
+    const Int valueBeg = targetBeg + numEntries*sizeof(Int);
+    mpi::FileSetSize( file, valueBeg+numEntries*sizeof(T) );
+    if( commRank == 0 )
+    {
+        const Int dims[3] = { height, A.Width(), numEntries };
+        mpi_io::WriteBytesAt( file, 0, dims, metaBytes );
+    }
+    mpi_io::WriteBytesAt
+    ( file, metaBytes+firstLocalRow*sizeof(Int), offsets.data(),
+      numOffsets*sizeof(Int) );
+    mpi_io::WriteBytesAt
+    ( file, targetBeg+localBeg*sizeof(Int), A.LockedTargetBuffer(),
+      numLocalEntries*sizeof(Int) );
+    mpi_io::WriteBytesAt
+    ( file, valueBeg+localBeg*sizeof(T), A.LockedValueBuffer(),
+      numLocalEntries*sizeof(T) );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
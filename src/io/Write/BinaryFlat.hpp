@@ -31,6 +31,24 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::BinaryFlat"))
+
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    if( !mpi::FileOpen
+         ( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file ) )
+        RuntimeError("Could not open ",filename);
+
+    mpi::FileSetSize( file, A.Height()*A.Width()*sizeof(T) );
+    mpi_io::WriteAll( A, file, 0 );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -59,6 +59,93 @@ MatrixMarket( const Matrix<T>& A, string basename="matrix" )
     }
 }
 
+namespace mm {
+
+template<typename T>
+inline string CoordinateHeader( Int height, Int width, Int numEntries )
+{
+    ostringstream os;
+    os << "%%MatrixMarket matrix coordinate ";
+    if( IsComplex<T>::value )
+        os << "complex ";
+    else
+        os << "real ";
+    os << "general\n" << height << " " << width << " " << numEntries << "\n";
+    return os.str();
+}
+
+// Format the (1-based) coordinate lines of a contiguous set of entries with
+// enough digits for a double-precision value to survive the round trip
+template<typename T>
+inline string CoordinateLines
+( Int numEntries, const Int* sourceBuf, const Int* targetBuf,
+  const T* valueBuf )
+{
+    ostringstream os;
+    os.precision( 17 );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        os << sourceBuf[e]+1 << " " << targetBuf[e]+1 << " "
+           << RealPart(valueBuf[e]);
+        if( IsComplex<T>::value )
+            os << " " << ImagPart(valueBuf[e]);
+        os << "\n";
+    }
+    return os.str();
+}
+
+} // namespace mm
+
+template<typename T>
+inline void
+MatrixMarket( const SparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::MatrixMarket"))
+    
+    string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    file << mm::CoordinateHeader<T>( A.Height(), A.Width(), A.NumEntries() );
+    file << mm::CoordinateLines
+      ( A.NumEntries(), A.LockedSourceBuffer(), A.LockedTargetBuffer(),
+        A.LockedValueBuffer() );
+}
+
+// Each process formats its own rows and writes them at the offset given by
+// a prefix sum of the formatted sizes
+template<typename T>
+inline void
+MatrixMarket( const DistSparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::MatrixMarket"))
+    mpi::Comm comm = A.Comm();
+
+    const string header =
+      mm::CoordinateHeader<T>( A.Height(), A.Width(), A.NumEntries() );
+    const string lines =
+      mm::CoordinateLines
+      ( A.NumLocalEntries(), A.LockedSourceBuffer(), A.LockedTargetBuffer(),
+        A.LockedValueBuffer() );
+    const Int localBytes = lines.size();
+    const Int localOffset = mpi::Scan( localBytes, comm ) - localBytes;
+    const Int numBytes = mpi::AllReduce( localBytes, comm );
+
+    string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    mpi::File file;
+    if( !mpi::FileOpen
+         ( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file ) )
+        RuntimeError("Could not open ",filename);
+    const Int headerBytes = header.size();
+    mpi::FileSetSize( file, headerBytes+numBytes );
+    if( mpi::Rank(comm) == 0 )
+        mpi_io::WriteBytesAt( file, 0, header.data(), headerBytes );
+    mpi_io::WriteBytesAt
+    ( file, headerBytes+localOffset, lines.data(), localBytes );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -14,6 +14,7 @@
 #include "./HermitianTridiag/USquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -35,6 +36,11 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianTridiag"))
+    ProfileRegion region( "HermitianTridiag" );
+    if( ctrl.twoStage )
+        LogicError
+        ("The two-stage reduction cannot be packed into (A,t); "
+         "use herm_tridiag::TwoStage");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR> tProx( tPre );
@@ -145,6 +151,36 @@ void ExplicitCondensed
         MakeTrapezoidal( UPPER, A, -1 );
 }
 
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<F>& t,
+  ElementalMatrix<Base<F>>& d,
+  ElementalMatrix<Base<F>>& e,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStage"))
+    TwoStage
+    ( uplo, A, t, d, e,
+      (ElementalMatrix<F>*)nullptr, (ElementalMatrix<F>*)nullptr, ctrl );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  ElementalMatrix<F>& A,
+  ElementalMatrix<F>& t,
+  ElementalMatrix<Base<F>>& d,
+  ElementalMatrix<Base<F>>& e,
+  ElementalMatrix<F>& V2,
+  ElementalMatrix<F>& t2,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStage"))
+    TwoStage( uplo, A, t, d, e, &V2, &t2, ctrl );
+}
+
 } // namespace herm_tridiag
 
 #define PROTO(F) \
@@ -176,6 +212,28 @@ void ExplicitCondensed
     Orientation orientation, \
     const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& t, \
+          ElementalMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    ElementalMatrix<F>& A, \
+    ElementalMatrix<F>& t, \
+    ElementalMatrix<Base<F>>& d, \
+    ElementalMatrix<Base<F>>& e, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    ElementalMatrix<F>& A, \
+    ElementalMatrix<F>& t, \
+    ElementalMatrix<Base<F>>& d, \
+    ElementalMatrix<Base<F>>& e, \
+    ElementalMatrix<F>& V2, \
+    ElementalMatrix<F>& t2, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::ApplyTwoStageQ \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& t, \
+    const ElementalMatrix<F>& V2, \
+    const ElementalMatrix<F>& t2, \
           ElementalMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
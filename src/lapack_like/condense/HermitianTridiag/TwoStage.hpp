@@ -0,0 +1,506 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Reduction of a Hermitian matrix, stored in its lower triangle, to band form
+// ===========================================================================
+// Each panel of 'bandwidth' columns is annihilated below the band using a QR
+// factorization, A(k+b:n,k:k+b) = H D R, which leaves the reflectors defining
+// H in place and the band entries, H^H A(k+b:n,k:k+b) = D R, in the upper
+// trapezoid. Writing H^H = I - U S U^H, the trailing matrix is updated as
+//
+//   H^H A22 H = A22 - U W^H - W U^H,
+//
+// where X = A22 U S^H and W = X - (1/2) U (S U^H X), so that the update is
+// a Hemm and a Her2k rather than two Level 2 reflector applications per
+// column.
+template<typename F>
+inline void
+Band( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, Int bandwidth )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::Band"))
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Zeros( t, Max(n-b,0), 1 );
+
+    DistMatrix<F> U(g), X(g), Z(g);
+    DistMatrix<F,STAR,STAR> tPan(g), SInv(g);
+    DistMatrix<Base<F>,STAR,STAR> dPan(g);
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Int numRefl = Min(nb,n-(k+b));
+        const Range<Int> ind1( k, k+nb ), indB( k+b, n );
+
+        auto APan = A( indB, ind1 );
+        auto A22 = A( indB, indB );
+
+        QR( APan, tPan, dPan );
+        auto R = APan( IR(0,numRefl), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, R );
+        auto t1 = t( IR(k,k+numRefl), ALL );
+        t1 = tPan;
+
+        // Form the unit-diagonal reflectors and the inverse of S
+        U = APan( ALL, IR(0,numRefl) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        Herk( LOWER, ADJOINT, Base<F>(1), U, SInv );
+        for( Int j=0; j<numRefl; ++j )
+            SInv.SetLocal( j, j, F(1)/tPan.GetLocal(j,0) );
+
+        // X := A22 U S^H
+        X.AlignWith( A22 );
+        Zeros( X, A22.Height(), numRefl );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, X );
+
+        // X := X - 1/2 U (S U^H X)
+        Gemm( ADJOINT, NORMAL, F(1), U, X, Z );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, Z, F(1), X );
+
+        Her2k( LOWER, NORMAL, F(-1), U, X, Base<F>(1), A22 );
+    }
+}
+
+// The chase of column j of the band generates one reflector per step, with
+// the first reflector starting in row j+1 and each of the following ones
+// 'bandwidth' rows further down. Only the first reflector may have length one.
+inline Int NumChaseSteps( Int n, Int bandwidth, Int j )
+{
+    const Int b = bandwidth;
+    return 1 + ( b > 1 && j+3 <= n ? (n-3-j)/b : 0 );
+}
+
+// The reflectors of the chase of column j are stored in columns
+// offsets[j]:offsets[j+1] of the packed storage
+inline vector<Int> ChaseOffsets( Int n, Int bandwidth )
+{
+    const Int numSweeps = Max(n-1,Int(0));
+    vector<Int> offsets(numSweeps+1,0);
+    for( Int j=0; j<numSweeps; ++j )
+        offsets[j+1] = offsets[j] + NumChaseSteps( n, bandwidth, j );
+    return offsets;
+}
+
+// Reduction of a Hermitian band matrix to real symmetric tridiagonal form
+// ======================================================================
+// The band matrix is stored by (lower) diagonals, with W(i-j,j) = A(i,j)
+// for 0 <= i-j <= 2*bandwidth, where the second half of the storage holds
+// the bulges. Each column is annihilated below its subdiagonal with a
+// reflector which introduces a bulge below the band, and the first column of
+// each bulge is then chased off of the bottom of the matrix; the remainder
+// of each bulge is annihilated by the chase of the following column. The
+// last subdiagonal entry touched by each chase is made real with a reflector
+// of length one.
+//
+// Every reflector only touches the window of (at most 2b) columns between
+// the column it annihilates and the end of the diagonal block it is applied
+// to, so the sweeps are pipelined across the processes: each process owns a
+// contiguous range of (at least 2b) columns of the band, and a reflector is
+// applied by the owner of the last column of its window, which also keeps a
+// copy of the last 2b columns owned by its predecessor. The latest copy of
+// those shared columns is passed back and forth between the two neighbours,
+// so that a process may begin the chase of column j+1 as soon as the chase
+// of column j has moved more than 2b columns ahead, i.e., into the range of
+// the next process.
+//
+// If they are requested, the reflectors are returned in V2 and t2, where
+// H = I - tau u u^H, with column k of V2 holding u (with a unit first entry)
+// and t2(k) holding tau, and where the reflectors of the chase of column j
+// are stored in the columns offsets[j]:offsets[j+1] (see ChaseOffsets).
+// Since B = Q2 T Q2^H, Q2 is the product of the adjoints of the reflectors,
+// in the order in which they are stored.
+template<typename F>
+inline void
+ChaseBulges
+( const DistMatrix<F>& A,
+  Int bandwidth,
+  DistMatrix<Base<F>,STAR,STAR>& d,
+  DistMatrix<Base<F>,STAR,STAR>& e,
+  DistMatrix<F,STAR,VR>* V2=nullptr,
+  DistMatrix<F,VR,STAR>* t2=nullptr )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ChaseBulges"))
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    const Int maxOffset = 2*b;
+    mpi::Comm comm = g.VCComm();
+    const int commRank = g.VCRank();
+    const int commSize = g.Size();
+
+    // Partition the columns of the band into contiguous ranges. Since the
+    // chases of the columns to the left of column k all pass through it, the
+    // work per column is roughly proportional to k, and the ranges narrow
+    // towards the bottom-right corner of the band.
+    const int numActive = Max( Min(Int(commSize),n/(2*b)), Int(1) );
+    vector<Int> bounds(numActive+1);
+    for( Int q=0; q<numActive; ++q )
+        bounds[q] = Int(n*Sqrt(double(q)/double(numActive)));
+    bounds[numActive] = n;
+    for( Int q=numActive-1; q>0; --q )
+        bounds[q] = Min( bounds[q], bounds[q+1]-2*b );
+    for( Int q=1; q<numActive; ++q )
+        bounds[q] = Max( bounds[q], bounds[q-1]+2*b );
+    vector<int> ownerOf(n);
+    for( int q=0; q<numActive; ++q )
+        for( Int k=bounds[q]; k<bounds[q+1]; ++k )
+            ownerOf[k] = q;
+
+    // Store the locally-owned columns of the band, preceded by room for the
+    // last 2b columns owned by the previous process
+    const bool active = ( commRank < numActive );
+    const Int lo = ( active ? bounds[commRank] : n );
+    const Int hi = ( active ? bounds[commRank+1] : n );
+    const Int first = ( active && commRank > 0 ? lo-2*b : lo );
+    Matrix<F> W;
+    Zeros( W, maxOffset+1, hi-first );
+    DistMatrix<F,STAR,STAR> diag(g);
+    for( Int offset=0; offset<=b && offset<n; ++offset )
+    {
+        GetDiagonal( A, diag, -offset );
+        for( Int j=lo; j<Min(hi,n-offset); ++j )
+            W.Set( offset, j-first, diag.GetLocal(j,0) );
+    }
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    auto ABand = [&]( Int i, Int j ) -> F&
+      { return WBuf[(i-j)+(j-first)*WLDim]; };
+
+    if( V2 != nullptr )
+    {
+        const Int numRefl = ChaseOffsets( n, b ).back();
+        Zeros( *V2, b, numRefl );
+        Zeros( *t2, numRefl, 1 );
+    }
+
+    vector<F> u(b), p(b), w(b);
+
+    // Annihilate A(r+1:r+len,c) and apply the reflector as a similarity
+    auto reduce = [&]( Int c, Int r, Int len, Int k )
+    {
+        F tau;
+        u[0] = 1;
+        if( len == 1 )
+        {
+            // Scale by the unit-modulus 1 - tau = conj(alpha)/|alpha|
+            const F alpha = ABand(r,c);
+            const Real alphaAbs = Abs(alpha);
+            tau = ( alphaAbs == Real(0) ? F(0) : F(1)-Conj(alpha)/alphaAbs );
+            ABand(r,c) = alphaAbs;
+        }
+        else
+        {
+            F chi = ABand(r,c);
+            auto x = W( IR(r+1-c,r+len-c), IR(c-first,c-first+1) );
+            tau = LeftReflector( chi, x );
+            ABand(r,c) = chi;
+            for( Int l=1; l<len; ++l )
+            {
+                u[l] = x.Get(l-1,0);
+                x.Set(l-1,0,0);
+            }
+        }
+        if( V2 != nullptr )
+        {
+            for( Int l=0; l<len; ++l )
+                V2->QueueUpdate( l, k, u[l] );
+            t2->QueueUpdate( k, 0, tau );
+        }
+        if( tau == F(0) )
+            return;
+
+        // Apply H from the left to the remaining columns to the left of the
+        // diagonal block (the leftover portions of previous bulges)
+        for( Int col=Max(c+1,r-maxOffset); col<r; ++col )
+        {
+            const Int segLen = Min(len,col+maxOffset+1-r);
+            F* seg = &ABand(r,col);
+            F dot = 0;
+            for( Int l=0; l<segLen; ++l )
+                dot += Conj(u[l])*seg[l];
+            dot *= tau;
+            for( Int l=0; l<segLen; ++l )
+                seg[l] -= u[l]*dot;
+        }
+
+        // Apply H from both sides to the diagonal block:
+        //   H A H^H = A - u w^H - w u^H,
+        // with w = conj(tau) A u - (|tau|^2 u^H A u/2) u
+        for( Int l=0; l<len; ++l )
+            p[l] = 0;
+        for( Int jj=0; jj<len; ++jj )
+        {
+            p[jj] += ABand(r+jj,r+jj)*u[jj];
+            for( Int ii=jj+1; ii<len; ++ii )
+            {
+                const F alpha = ABand(r+ii,r+jj);
+                p[ii] += alpha*u[jj];
+                p[jj] += Conj(alpha)*u[ii];
+            }
+        }
+        Real beta = 0;
+        for( Int l=0; l<len; ++l )
+            beta += RealPart(Conj(u[l])*p[l]);
+        const Real gamma = Abs(tau)*Abs(tau)*beta/2;
+        for( Int l=0; l<len; ++l )
+            w[l] = Conj(tau)*p[l] - gamma*u[l];
+        for( Int jj=0; jj<len; ++jj )
+            for( Int ii=jj; ii<len; ++ii )
+                ABand(r+ii,r+jj) -= u[ii]*Conj(w[jj]) + w[ii]*Conj(u[jj]);
+
+        // Apply H^H from the right to the rows below the diagonal block,
+        // which creates the next bulge
+        const Int iEnd = Min(n,r+len+maxOffset);
+        for( Int i=r+len; i<iEnd; ++i )
+        {
+            const Int lBeg = Max(Int(0),i-maxOffset-r);
+            F dot = 0;
+            for( Int l=lBeg; l<len; ++l )
+                dot += ABand(i,r+l)*u[l];
+            dot *= Conj(tau);
+            for( Int l=lBeg; l<len; ++l )
+                ABand(i,r+l) -= dot*Conj(u[l]);
+        }
+    };
+
+    // Every active process walks through the reflectors in the sequential
+    // order, applying its own and handing the shared columns to (or back
+    // from) a neighbour when the neighbour's next reflector touches them
+    if( active )
+    {
+        const int me = commRank;
+        const Int zoneSize = 2*b*WLDim;
+        F* leftZone = WBuf;
+        F* rightZone =
+          ( me < numActive-1 ? &WBuf[(hi-2*b-first)*WLDim] : nullptr );
+        const Int leftBound = lo-2*b;
+        const Int rightBound = ( me < numActive-1 ? bounds[me+1]-2*b : n );
+        bool haveLeft=false, rightAway=false;
+        const vector<Int> offsets = ChaseOffsets( n, b );
+        for( Int j=0; j<n-1; ++j )
+        {
+            const Int numSteps = NumChaseSteps( n, b, j );
+            Int c=j, r=j+1;
+            for( Int s=0; s<numSteps; ++s, c=r, r+=b )
+            {
+                const Int len = Min(b,n-r);
+                const Int end = r+len;
+                const int owner = ownerOf[end-1];
+                if( owner == me )
+                {
+                    if( me > 0 && !haveLeft && c < lo )
+                    {
+                        mpi::Recv( leftZone, zoneSize, me-1, comm );
+                        haveLeft = true;
+                    }
+                    if( rightAway && end > rightBound )
+                    {
+                        mpi::Recv( rightZone, zoneSize, me+1, comm );
+                        rightAway = false;
+                    }
+                    reduce( c, r, len, offsets[j]+s );
+                }
+                else if( owner == me+1 && !rightAway && c < hi )
+                {
+                    mpi::Send( rightZone, zoneSize, me+1, comm );
+                    rightAway = true;
+                }
+                else if( owner == me-1 && haveLeft && end > leftBound )
+                {
+                    mpi::Send( leftZone, zoneSize, me-1, comm );
+                    haveLeft = false;
+                }
+            }
+        }
+        if( haveLeft )
+            mpi::Send( leftZone, zoneSize, me-1, comm );
+        if( rightAway )
+            mpi::Recv( rightZone, zoneSize, me+1, comm );
+    }
+
+    // Every subdiagonal entry is now real, and each one is stored by the
+    // owner of its column
+    Zeros( d, n, 1 );
+    Zeros( e, Max(n-1,Int(0)), 1 );
+    for( Int j=lo; j<hi; ++j )
+    {
+        d.SetLocal( j, 0, RealPart(ABand(j,j)) );
+        if( j < n-1 )
+            e.SetLocal( j, 0, RealPart(ABand(j+1,j)) );
+    }
+    mpi::AllReduce( d.Buffer(), n, comm );
+    mpi::AllReduce( e.Buffer(), Max(n-1,Int(0)), comm );
+
+    if( V2 != nullptr )
+    {
+        V2->ProcessQueues();
+        t2->ProcessQueues();
+    }
+}
+
+template<typename F>
+inline void
+TwoStage
+( UpperOrLower uplo,
+  ElementalMatrix<F>& APre,
+  ElementalMatrix<F>& tPre,
+  ElementalMatrix<Base<F>>& dPre,
+  ElementalMatrix<Base<F>>& ePre,
+  ElementalMatrix<F>* V2Pre,
+  ElementalMatrix<F>* t2Pre,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStage"))
+    ProfileRegion region( "herm_tridiag::TwoStage" );
+    typedef Base<F> Real;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> tProx( tPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> dProx( dPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> eProx( ePre );
+    auto& A = AProx.Get();
+    auto& t = tProx.Get();
+    auto& d = dProx.Get();
+    auto& e = eProx.Get();
+
+    const Int n = A.Height();
+    const Int bsize = ( ctrl.bandwidth > 0 ? ctrl.bandwidth : Blocksize() );
+    const Int b = Max( Min(bsize,n-1), Int(1) );
+
+    // The band reduction is performed on the lower triangle
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    Band( A, t, b );
+
+    if( V2Pre == nullptr )
+    {
+        ChaseBulges( A, b, d, e );
+    }
+    else
+    {
+        DistMatrixWriteProxy<F,F,STAR,VR> V2Prox( *V2Pre );
+        DistMatrixWriteProxy<F,F,VR,STAR> t2Prox( *t2Pre );
+        ChaseBulges( A, b, d, e, &V2Prox.Get(), &t2Prox.Get() );
+    }
+}
+
+// Applying Q2 to B
+// ----------------
+// Grouping the reflectors of step s of the chases of columns j0,...,j0+m-1,
+// which start in consecutive rows, into the compact WY form
+//
+//   H_{j0}^H H_{j0+1}^H ... H_{j0+m-1}^H = I - V T V^H,
+//
+// the reflectors only overlap those of the neighbouring steps, and Q2 is the
+// product, over the groups of chases in increasing order, of these blocks in
+// order of decreasing step. B is redistributed so that each process owns
+// entire columns, and the blocks of each group of chases are gathered and
+// applied locally with Level 3 updates.
+template<typename F>
+inline void
+ApplyTwoStageQ
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& t,
+  const ElementalMatrix<F>& V2Pre,
+  const ElementalMatrix<F>& t2Pre,
+        ElementalMatrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ApplyTwoStageQ"))
+    // Each column of the band reduction with a reflector was one of the
+    // first n-b columns
+    const Int n = A.Height();
+    const Int b = n - t.Height();
+    const Int numSweeps = Max(n-1,Int(0));
+    const Grid& g = B.Grid();
+
+    DistMatrixReadProxy<F,F,STAR,VR> V2Prox( V2Pre );
+    DistMatrixReadProxy<F,F,VR,STAR> t2Prox( t2Pre );
+    auto& V2 = V2Prox.GetLocked();
+    auto& t2 = t2Prox.GetLocked();
+
+    DistMatrix<F,STAR,VR> Y(g);
+    Copy( B, Y );
+    auto& YLoc = Y.Matrix();
+
+    const Int nb = Blocksize();
+    const vector<Int> offsets = ChaseOffsets( n, b );
+    DistMatrix<F,STAR,STAR> V2Sweeps(g), t2Sweeps(g);
+    Matrix<F> V, S, T, Z;
+    vector<F> tau(nb);
+    const Int numGroups = (numSweeps+nb-1)/nb;
+    for( Int group=numGroups-1; group>=0; --group )
+    {
+        const Int j0 = group*nb;
+        const Int j1 = Min(j0+nb,numSweeps);
+        const Int k0 = offsets[j0];
+        const Int k1 = offsets[j1];
+        V2Sweeps = V2( ALL, IR(k0,k1) );
+        t2Sweeps = t2( IR(k0,k1), ALL );
+
+        const Int numSteps = NumChaseSteps( n, b, j0 );
+        for( Int s=0; s<numSteps; ++s )
+        {
+            Int m = 1;
+            while( j0+m < j1 && NumChaseSteps(n,b,j0+m) > s )
+                ++m;
+            const Int r0 = j0+1+s*b;
+            const Int height = Min(m-1+b,n-r0);
+
+            Zeros( V, height, m );
+            for( Int i=0; i<m; ++i )
+            {
+                const Int len = Min(b,n-(r0+i));
+                const Int k = offsets[j0+i]-k0+s;
+                for( Int l=0; l<len; ++l )
+                    V.Set( i+l, i, V2Sweeps.GetLocal(l,k) );
+                tau[i] = Conj(t2Sweeps.GetLocal(k,0));
+            }
+
+            // T(0:i,i) := -tau_i T(0:i,0:i) V(:,0:i)^H v_i
+            Zeros( T, m, m );
+            for( Int i=0; i<m; ++i )
+            {
+                T.Set( i, i, tau[i] );
+                if( i == 0 )
+                    continue;
+                auto t01 = T( IR(0,i), IR(i,i+1) );
+                Gemv
+                ( ADJOINT, F(1), V(ALL,IR(0,i)), V(ALL,IR(i,i+1)),
+                  F(0), t01 );
+                Trmv( UPPER, NORMAL, NON_UNIT, T(IR(0,i),IR(0,i)), t01 );
+                t01 *= -tau[i];
+            }
+
+            // Y1 := (I - V T V^H) Y1
+            auto Y1 = YLoc( IR(r0,r0+height), ALL );
+            Gemm( ADJOINT, NORMAL, F(1), V, Y1, Z );
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T, Z );
+            Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), Y1 );
+        }
+    }
+
+    Copy( Y, B );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, -b, A, t, B );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -312,12 +312,29 @@ void GLM
     ldl::Separator rootSep;
     ldl::NestedDissection( J.LockedGraph(), map, rootSep, info );
     InvertMap( map, invMap );
-    ldl::Front<F> JFront( J, map, info );
-    LDL( info, JFront );
+    ldl::Front<F> JFront;
+    ldl::Front<Demote<F>> JFrontLow;
+    if( ctrl.solveCtrl.mixedPrecision )
+    {
+        SparseMatrix<Demote<F>> JLow;
+        Copy( J, JLow );
+        JFrontLow.Pull( JLow, map, info );
+        LDL( info, JFrontLow );
+    }
+    else
+    {
+        JFront.Pull( J, map, info );
+        LDL( info, JFront );
+    }
 
     // Solve the linear systems
     // ========================
-    reg_ldl::SolveAfter( JOrig, reg, invMap, info, JFront, G, ctrl.solveCtrl );
+    if( ctrl.solveCtrl.mixedPrecision )
+        reg_ldl::MixedSolveAfter
+        ( JOrig, reg, invMap, info, JFrontLow, G, ctrl.solveCtrl );
+    else
+        reg_ldl::SolveAfter
+        ( JOrig, reg, invMap, info, JFront, G, ctrl.solveCtrl );
 
     // Extract X and Y from G = [ Z; X/alpha; Y/alpha ]
     // ================================================
@@ -466,12 +483,29 @@ void GLM
     ldl::DistSeparator rootSep;
     ldl::NestedDissection( J.LockedDistGraph(), map, rootSep, info );
     InvertMap( map, invMap );
-    ldl::DistFront<F> JFront( J, map, rootSep, info );
-    LDL( info, JFront );
+    ldl::DistFront<F> JFront;
+    ldl::DistFront<Demote<F>> JFrontLow;
+    if( ctrl.solveCtrl.mixedPrecision )
+    {
+        DistSparseMatrix<Demote<F>> JLow(comm);
+        Copy( J, JLow );
+        JFrontLow.Pull( JLow, map, rootSep, info );
+        LDL( info, JFrontLow );
+    }
+    else
+    {
+        JFront.Pull( J, map, rootSep, info );
+        LDL( info, JFront );
+    }
 
     // Solve the linear systems
     // ========================
-    reg_ldl::SolveAfter( JOrig, reg, invMap, info, JFront, G, ctrl.solveCtrl );
+    if( ctrl.solveCtrl.mixedPrecision )
+        reg_ldl::MixedSolveAfter
+        ( JOrig, reg, invMap, info, JFrontLow, G, ctrl.solveCtrl );
+    else
+        reg_ldl::SolveAfter
+        ( JOrig, reg, invMap, info, JFront, G, ctrl.solveCtrl );
 
     // Extract X and Y from G = [ Z; X/alpha; Y/alpha ]
     // ================================================
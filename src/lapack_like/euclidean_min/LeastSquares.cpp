@@ -239,12 +239,29 @@ inline void Equilibrated
     ldl::Separator rootSep;
     ldl::NestedDissection( J.LockedGraph(), map, rootSep, info );
     InvertMap( map, invMap );
-    ldl::Front<F> JFront( J, map, info );
-    LDL( info, JFront );
+    ldl::Front<F> JFront;
+    ldl::Front<Demote<F>> JFrontLow;
+    if( ctrl.mixedPrecision )
+    {
+        SparseMatrix<Demote<F>> JLow;
+        Copy( J, JLow );
+        JFrontLow.Pull( JLow, map, info );
+        LDL( info, JFrontLow );
+    }
+    else
+    {
+        JFront.Pull( J, map, info );
+        LDL( info, JFront );
+    }
 
     // Successively solve each of the linear systems
     // =============================================
-    reg_ldl::SolveAfter( JOrig, reg, invMap, info, JFront, D, ctrl );
+    if( ctrl.mixedPrecision )
+        reg_ldl::MixedSolveAfter
+        ( JOrig, reg, invMap, info, JFrontLow, D, ctrl );
+    else
+        reg_ldl::SolveAfter
+        ( JOrig, reg, invMap, info, JFront, D, ctrl );
 
     Zeros( X, n, numRHS );
     if( m >= n )
@@ -464,11 +481,23 @@ void Equilibrated
     if( commRank == 0 && time )
         cout << "  ND: " << timer.Stop() << " secs" << endl;
     InvertMap( map, invMap );
-    ldl::DistFront<F> JFront( J, map, rootSep, info );
+    ldl::DistFront<F> JFront;
+    ldl::DistFront<Demote<F>> JFrontLow;
+    if( ctrl.mixedPrecision )
+    {
+        DistSparseMatrix<Demote<F>> JLow(comm);
+        Copy( J, JLow );
+        JFrontLow.Pull( JLow, map, rootSep, info );
+    }
+    else
+        JFront.Pull( J, map, rootSep, info );
 
     if( commRank == 0 && time )
         timer.Start();
-    LDL( info, JFront, LDL_2D );
+    if( ctrl.mixedPrecision )
+        LDL( info, JFrontLow, LDL_2D );
+    else
+        LDL( info, JFront, LDL_2D );
     if( commRank == 0 && time )
         cout << "  LDL: " << timer.Stop() << " secs" << endl;
 
@@ -476,7 +505,12 @@ void Equilibrated
     // ==========================
     if( commRank == 0 && time )
         timer.Start();
-    reg_ldl::SolveAfter( JOrig, reg, invMap, info, JFront, D, ctrl );
+    if( ctrl.mixedPrecision )
+        reg_ldl::MixedSolveAfter
+        ( JOrig, reg, invMap, info, JFrontLow, D, ctrl );
+    else
+        reg_ldl::SolveAfter
+        ( JOrig, reg, invMap, info, JFront, D, ctrl );
     if( commRank == 0 && time )
         cout << "  Solve: " << timer.Stop() << " secs" << endl;
 
@@ -16,6 +16,7 @@ ElError ElRegSolveCtrlDefault_s( ElRegSolveCtrl_s* ctrl )
 {
     const float eps = Epsilon<float>();
     ctrl->alg = EL_REG_SOLVE_FGMRES;
+    ctrl->mixedPrecision = false;
     ctrl->relTol = Pow(eps,float(0.5));
     ctrl->relTolRefine = Pow(eps,float(0.8));
     ctrl->maxIts = 4;
@@ -30,6 +31,7 @@ ElError ElRegSolveCtrlDefault_d( ElRegSolveCtrl_d* ctrl )
 {
     const double eps = Epsilon<double>();
     ctrl->alg = EL_REG_SOLVE_FGMRES;
+    ctrl->mixedPrecision = false;
     ctrl->relTol = Pow(eps,0.5);
     ctrl->relTolRefine = Pow(eps,0.8);
     ctrl->maxIts = 4;
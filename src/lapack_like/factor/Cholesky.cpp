@@ -67,7 +67,18 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     DEBUG_ONLY(CSE cse("Cholesky"))
-    if( scalapack )
+    CholeskyCtrl ctrl;
+    ctrl.scalapack = scalapack;
+    Cholesky( uplo, A, ctrl );
+}
+
+template<typename F> 
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("Cholesky"))
+    ProfileRegion region( "Cholesky" );
+    if( ctrl.scalapack )
     {
         AssertScaLAPACKSupport();
 #ifdef EL_HAVE_SCALAPACK
@@ -87,6 +98,13 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
         blacs::FreeHandle( bHandle );
 #endif
     }
+    else if( ctrl.lookAhead )
+    {
+        if( uplo == LOWER )
+            cholesky::LVar3LookAhead( A );
+        else
+            cholesky::UVar3LookAhead( A );
+    }
     else
     {
         if( uplo == LOWER )
@@ -101,6 +119,7 @@ void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
 {
     DEBUG_ONLY(CSE cse("Cholesky"))
+    ProfileRegion region( "Cholesky" );
     if( uplo == LOWER )
         cholesky::LVar3( A, p );
     else
@@ -194,6 +213,9 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, \
+    const CholeskyCtrl& ctrl ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
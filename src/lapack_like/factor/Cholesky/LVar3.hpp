@@ -10,6 +10,8 @@
 #ifndef EL_CHOLESKY_LVAR3_HPP
 #define EL_CHOLESKY_LVAR3_HPP
 
+#include "../PanelGather.hpp"
+
 namespace El {
 namespace cholesky {
 
@@ -204,6 +206,101 @@ LVar3( AbstractDistMatrix<F>& APre )
     }
 } 
 
+// A look-ahead of one panel: the columns of A22 which form the next panel are
+// updated first, and their redistribution to [MC,* ] is overlapped with the
+// update of the remainder of A22
+template<typename F>
+inline void
+LVar3LookAhead( AbstractDistMatrix<F>& APre )
+{
+    DEBUG_ONLY(
+      CSE cse("cholesky::LVar3LookAhead");
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
+    DistMatrix<F,MC,  STAR> panels[2] =
+      { DistMatrix<F,MC,STAR>(g), DistMatrix<F,MC,STAR>(g) };
+    PanelGather<F> gather;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n > 0 )
+    {
+        gather.Start( A( ALL, IR(0,Min(bsize,n)) ), panels[0] );
+        gather.Finish();
+    }
+    for( Int k=0, step=0; k<n; k+=bsize, ++step )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-(k+nb));
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        // The current panel, A(k:n,k:k+nb), was gathered during the previous
+        // iteration
+        auto& AB1_MC_STAR = panels[step%2];
+        auto& nextAB1_MC_STAR = panels[(step+1)%2];
+
+        A11_STAR_STAR = AB1_MC_STAR( IR(0,nb), ALL );
+        Cholesky( LOWER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = AB1_MC_STAR( IR(nb,END), ALL );
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21_VC_STAR;
+        A21Trans_STAR_MC.AlignWith( A22 );
+        A21Adj_STAR_MR.AlignWith( A22 );
+        Transpose( A21_VC_STAR, A21Trans_STAR_MC );
+        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+
+        // Update the next panel, A22(:,0:nbNext), and begin gathering it
+        const Range<Int> indT( 0, nbNext ), indB( nbNext, n-(k+nb) );
+        auto A22TL = A22( indT, indT );
+        auto A22BL = A22( indB, indT );
+        auto A22BR = A22( indB, indB );
+        auto A21Trans_STAR_MC_T = A21Trans_STAR_MC( ALL, indT );
+        auto A21Trans_STAR_MC_B = A21Trans_STAR_MC( ALL, indB );
+        auto A21Adj_STAR_MR_T = A21Adj_STAR_MR( ALL, indT );
+        auto A21Adj_STAR_MR_B = A21Adj_STAR_MR( ALL, indB );
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          F(-1), A21Trans_STAR_MC_T, A21Adj_STAR_MR_T, F(1), A22TL );
+        LocalGemm
+        ( TRANSPOSE, NORMAL,
+          F(-1), A21Trans_STAR_MC_B, A21Adj_STAR_MR_T, F(1), A22BL );
+        if( nbNext > 0 )
+            gather.Start( A22( ALL, indT ), nextAB1_MC_STAR );
+
+        // Update the remainder of A22 during the gather
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          F(-1), A21Trans_STAR_MC_B, A21Adj_STAR_MR_B, F(1), A22BR );
+
+        Transpose( A21Trans_STAR_MC, A21 );
+
+        gather.Finish();
+    }
+}
+
 template<typename F>
 inline void
 ReverseLVar3( AbstractDistMatrix<F>& APre )
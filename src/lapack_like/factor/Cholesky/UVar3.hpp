@@ -10,6 +10,8 @@
 #ifndef EL_CHOLESKY_UVAR3_HPP
 #define EL_CHOLESKY_UVAR3_HPP
 
+#include "../PanelGather.hpp"
+
 namespace El {
 namespace cholesky {
 
@@ -188,6 +190,97 @@ UVar3( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A look-ahead of one panel: the rows of A22 which form the next panel are
+// updated first, and their redistribution to [* ,MR] is overlapped with the
+// update of the remainder of A22
+template<typename F> 
+inline void
+UVar3LookAhead( AbstractDistMatrix<F>& APre )
+{
+    DEBUG_ONLY(
+      CSE cse("cholesky::UVar3LookAhead");
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,MC  > A12_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+    DistMatrix<F,STAR,MR  > panels[2] =
+      { DistMatrix<F,STAR,MR>(g), DistMatrix<F,STAR,MR>(g) };
+    PanelGather<F> gather;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n > 0 )
+    {
+        gather.Start( A( IR(0,Min(bsize,n)), ALL ), panels[0] );
+        gather.Finish();
+    }
+    for( Int k=0, step=0; k<n; k+=bsize, ++step )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-(k+nb));
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        // The current panel, A(k:k+nb,k:n), was gathered during the previous
+        // iteration
+        auto& A1R_STAR_MR = panels[step%2];
+        auto& nextA1R_STAR_MR = panels[(step+1)%2];
+
+        A11_STAR_STAR = A1R_STAR_MR( ALL, IR(0,nb) );
+        Cholesky( UPPER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A1R_STAR_MR( ALL, IR(nb,END) );
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MC.AlignWith( A22 );
+        A12_STAR_MC = A12_STAR_VR;
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+
+        // Update the next panel, A22(0:nbNext,:), and begin gathering it
+        const Range<Int> indT( 0, nbNext ), indB( nbNext, n-(k+nb) );
+        auto A22TL = A22( indT, indT );
+        auto A22TR = A22( indT, indB );
+        auto A22BR = A22( indB, indB );
+        auto A12_STAR_MC_L = A12_STAR_MC( ALL, indT );
+        auto A12_STAR_MC_R = A12_STAR_MC( ALL, indB );
+        auto A12_STAR_MR_L = A12_STAR_MR( ALL, indT );
+        auto A12_STAR_MR_R = A12_STAR_MR( ALL, indB );
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), A12_STAR_MC_L, A12_STAR_MR_L, F(1), A22TL );
+        LocalGemm
+        ( ADJOINT, NORMAL,
+          F(-1), A12_STAR_MC_L, A12_STAR_MR_R, F(1), A22TR );
+        if( nbNext > 0 )
+            gather.Start( A22( indT, ALL ), nextA1R_STAR_MR );
+
+        // Update the remainder of A22 during the gather
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), A12_STAR_MC_R, A12_STAR_MR_R, F(1), A22BR );
+        A12 = A12_STAR_MR;
+
+        gather.Finish();
+    }
+}
+
 template<typename F> 
 inline void
 ReverseUVar3( AbstractDistMatrix<F>& APre )
@@ -65,7 +65,8 @@ inline void UnpackEntriesLocal
   const vector<F>& rEntries, 
   const vector<Int>& rTargets,
         vector<int>& offs, 
-        vector<int>& entryOffs )
+        vector<int>& entryOffs,
+        DistFrontPullMeta* meta )
 {
     DEBUG_ONLY(CSE cse("UnpackEntriesLocal"))
 
@@ -80,7 +81,7 @@ inline void UnpackEntriesLocal
         front.children[c] = new Front<F>(&front);
         UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c], 
-          A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+          A, rRowLengths, rEntries, rTargets, offs, entryOffs, meta );
     }
     // Mark this node as a sparse leaf if it does not have any children
     // and is not a duplicate of a dense distributed node
@@ -91,6 +92,18 @@ inline void UnpackEntriesLocal
     const Int off = node.off;
     const Int lowerSize = node.lowerStruct.size();
 
+    // Record the destination of each received entry if requested
+    Int frontIndex = -1;
+    auto record = [&]( Int entry, Int target, Int mirror )
+      {
+        if( meta != nullptr )
+        {
+            meta->targetFronts[entry] = frontIndex;
+            meta->targetOffs[entry] = target;
+            meta->mirrorOffs[entry] = mirror;
+        }
+      };
+
     if( front.sparseLeaf )
     {
         front.workSparse.Empty();
@@ -98,6 +111,13 @@ inline void UnpackEntriesLocal
         Zeros( front.LDense, lowerSize, size );
         F* LDenseBuf = front.LDense.Buffer();
         const Int LDenseLDim = front.LDense.LDim();
+        if( meta != nullptr )
+        {
+            frontIndex = meta->frontLDims.size();
+            meta->frontLDims.push_back( LDenseLDim );
+        }
+        // The offsets into the sparse storage are only known once it is formed
+        vector<Int> sparseEntries, sparseRows, sparseCols;
 
         Int numSparseEntries = 0;
         auto offsCopy = offs;
@@ -145,6 +165,12 @@ inline void UnpackEntriesLocal
                     const F transVal = 
                       ( front.isHermitian ? Conj(value) : value );
                     front.workSparse.QueueUpdate( target-off, t, transVal );
+                    if( meta != nullptr )
+                    {
+                        sparseEntries.push_back( entryOff-1 );
+                        sparseRows.push_back( target-off );
+                        sparseCols.push_back( t );
+                    }
                 }
                 else
                 {
@@ -152,17 +178,34 @@ inline void UnpackEntriesLocal
                     Int origOff = Find( node.origLowerStruct, target );
                     const Int row = node.origLowerRelInds[origOff];
                     LDenseBuf[(row-size)+t*LDenseLDim] = value;
+                    record( entryOff-1, (row-size)+t*LDenseLDim, -1 );
                 }
             }
         }
         front.workSparse.ProcessQueues();
         MakeSymmetric( LOWER, front.workSparse, front.isHermitian );
+
+        const Int numSparseRecorded = sparseEntries.size();
+        for( Int e=0; e<numSparseRecorded; ++e )
+        {
+            const Int row = sparseRows[e];
+            const Int col = sparseCols[e];
+            record
+            ( sparseEntries[e], 
+              front.workSparse.Offset(row,col),
+              front.workSparse.Offset(col,row) );
+        }
     }
     else
     {
         Zeros( front.LDense, size+lowerSize, size );
         F* LDenseBuf = front.LDense.Buffer();
         const Int LDenseLDim = front.LDense.LDim();
+        if( meta != nullptr )
+        {
+            frontIndex = meta->frontLDims.size();
+            meta->frontLDims.push_back( LDenseLDim );
+        }
         for( Int t=0; t<size; ++t )
         {
             const Int i = sep.inds[t];
@@ -184,6 +227,7 @@ inline void UnpackEntriesLocal
                 if( target < off+size )
                 {
                     LDenseBuf[(target-off)+t*LDenseLDim] = value;
+                    record( entryOff-1, (target-off)+t*LDenseLDim, -1 );
                 }
                 else
                 {
@@ -191,6 +235,7 @@ inline void UnpackEntriesLocal
                     Int origOff = Find( node.origLowerStruct, target );
                     const Int row = node.origLowerRelInds[origOff];
                     LDenseBuf[row+t*LDenseLDim] = value;
+                    record( entryOff-1, row+t*LDenseLDim, -1 );
                 }
             }
         }
@@ -207,7 +252,8 @@ inline void UnpackEntries
   const vector<F>& rEntries, 
   const vector<Int>& rTargets,
         vector<int>& offs, 
-        vector<int>& entryOffs )
+        vector<int>& entryOffs,
+        DistFrontPullMeta* meta )
 {
     DEBUG_ONLY(CSE cse("UnpackEntries"))
     const Grid& grid = *node.grid;
@@ -218,7 +264,7 @@ inline void UnpackEntries
         front.duplicate = new Front<F>(&front);
         UnpackEntriesLocal
         ( *sep.duplicate, *node.duplicate, *front.duplicate, 
-          A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+          A, rRowLengths, rEntries, rTargets, offs, entryOffs, meta );
 
         front.L2D.Attach( grid, front.duplicate->LDense );
 
@@ -228,13 +274,32 @@ inline void UnpackEntries
     front.child = new DistFront<F>(&front);
     UnpackEntries
     ( *sep.child, *node.child, *front.child, 
-      A, rRowLengths, rEntries, rTargets, offs, entryOffs );
+      A, rRowLengths, rEntries, rTargets, offs, entryOffs, meta );
 
     const Int size = node.size;
     const Int off = node.off;
     const Int lowerSize = node.lowerStruct.size();
     front.L2D.SetGrid( grid );
     Zeros( front.L2D, size+lowerSize, size );
+
+    // Since each process in a column of the grid receives the entire column,
+    // only the locally-owned entries are recorded (the rest are pruned)
+    Int frontIndex = -1;
+    const Int L2DLDim = front.L2D.LDim();
+    if( meta != nullptr )
+    {
+        frontIndex = meta->frontLDims.size();
+        meta->frontLDims.push_back( L2DLDim );
+    }
+    auto record = [&]( Int entry, Int row, Int tLoc )
+      {
+        if( meta != nullptr && front.L2D.IsLocalRow(row) )
+        {
+            meta->targetFronts[entry] = frontIndex;
+            meta->targetOffs[entry] = front.L2D.LocalRow(row) + tLoc*L2DLDim;
+            meta->mirrorOffs[entry] = -1;
+        }
+      };
         
     const Int localWidth = front.L2D.LocalWidth();
     for( Int tLoc=0; tLoc<localWidth; ++tLoc )
@@ -259,6 +324,7 @@ inline void UnpackEntries
             if( target < off+size )
             {
                 front.L2D.Set( target-off, t, value );
+                record( entryOff-1, target-off, tLoc );
             }
             else 
             {
@@ -266,6 +332,7 @@ inline void UnpackEntries
                 const Int origOff = Find( node.origLowerStruct, target );
                 const Int row = node.origLowerRelInds[origOff];
                 front.L2D.Set( row, t, value );
+                record( entryOff-1, row, tLoc );
             }
         }
     }
@@ -289,19 +356,24 @@ void DistFront<F>::Pull
       conjugate );
 }
 
+// If 'meta' is non-null, the exchange of the entries and their destinations
+// within the frontal tree are recorded so that later pulls of matrices with
+// the same sparsity pattern can skip straight to streaming the values
 template<typename F>
-void DistFront<F>::Pull
-( const DistSparseMatrix<F>& A, 
+void PullEntries
+(       DistFront<F>& front,
+  const DistSparseMatrix<F>& A, 
   const DistMap& reordering,
   const DistSeparator& rootSep, 
   const DistNodeInfo& rootInfo,
         vector<Int>& mappedSources,
         vector<Int>& mappedTargets,
         vector<Int>& colOffs,
-  bool conjugate )
+  bool conjugate,
+        DistFrontPullMeta* meta )
 {
     DEBUG_ONLY(
-      CSE cse("DistFront::Pull");
+      CSE cse("ldl::PullEntries");
       if( A.LocalHeight() != reordering.NumLocalSources() )
           LogicError("Local mapping was not the right size");
     )
@@ -434,6 +506,8 @@ void DistFront<F>::Pull
     const int numSendEntries = Scan( sEntriesSizes, sEntriesOffs );
     vector<F> sEntries( numSendEntries );
     vector<Int> sTargets( numSendEntries );
+    if( meta != nullptr )
+        meta->sendSourceOffs.resize( numSendEntries );
     for( Int q=0; q<commSize; ++q )
     {
         Int index = sEntriesOffs[q];
@@ -454,6 +528,8 @@ void DistFront<F>::Pull
                     const F value = A.Value( rowOff+e );
                     sEntries[index] = (conjugate ? Conj(value) : value);
                     sTargets[index] = iReord;
+                    if( meta != nullptr )
+                        meta->sendSourceOffs[index] = rowOff+e;
                     ++index;
                 }
             }
@@ -498,13 +574,221 @@ void DistFront<F>::Pull
     if( time && commRank == 0 )
         timer.Start();
     // TODO: Modify constructor of [Dist]Front to default to SYMM_2D?
-    type = SYMM_2D;
-    isHermitian = conjugate;
+    front.type = SYMM_2D;
+    front.isHermitian = conjugate;
+    if( meta != nullptr )
+    {
+        meta->targetFronts.resize( numRecvEntries );
+        meta->targetOffs.resize( numRecvEntries );
+        meta->mirrorOffs.resize( numRecvEntries );
+        for( Int k=0; k<numRecvEntries; ++k )
+            meta->targetFronts[k] = -1;
+    }
+    auto entryOffs = rEntriesOffs;
     UnpackEntries
-    ( rootSep, rootInfo, *this, 
-      A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
+    ( rootSep, rootInfo, front,
+      A, rRowLengths, rEntries, rTargets, rRowOffs, entryOffs, meta );
     if( time && commRank == 0 )
         Output("Unpack: ",timer.Stop()," secs");
+    if( meta == nullptr )
+        return;
+
+    // Let the senders know which entries were not needed and then compress
+    // the plan down to the entries which were
+    vector<int> rKeep( numRecvEntries ), sKeep( numSendEntries );
+    for( Int k=0; k<numRecvEntries; ++k )
+        rKeep[k] = ( meta->targetFronts[k] >= 0 );
+    mpi::AllToAll
+    ( rKeep.data(), rEntriesSizes.data(), rEntriesOffs.data(),
+      sKeep.data(), sEntriesSizes.data(), sEntriesOffs.data(), comm );
+
+    meta->sendSizes.resize( commSize );
+    Int numKept = 0;
+    for( Int q=0; q<commSize; ++q )
+    {
+        meta->sendSizes[q] = 0;
+        const Int off = sEntriesOffs[q];
+        for( Int s=off; s<off+sEntriesSizes[q]; ++s )
+        {
+            if( sKeep[s] )
+            {
+                meta->sendSourceOffs[numKept++] = meta->sendSourceOffs[s];
+                ++meta->sendSizes[q];
+            }
+        }
+    }
+    meta->sendSourceOffs.resize( numKept );
+    Scan( meta->sendSizes, meta->sendOffs );
+
+    meta->recvSizes.resize( commSize );
+    numKept = 0;
+    for( Int q=0; q<commSize; ++q )
+    {
+        meta->recvSizes[q] = 0;
+        const Int off = rEntriesOffs[q];
+        for( Int k=off; k<off+rEntriesSizes[q]; ++k )
+        {
+            if( rKeep[k] )
+            {
+                meta->targetFronts[numKept] = meta->targetFronts[k];
+                meta->targetOffs[numKept] = meta->targetOffs[k];
+                meta->mirrorOffs[numKept] = meta->mirrorOffs[k];
+                ++numKept;
+                ++meta->recvSizes[q];
+            }
+        }
+    }
+    meta->targetFronts.resize( numKept );
+    meta->targetOffs.resize( numKept );
+    meta->mirrorOffs.resize( numKept );
+    Scan( meta->recvSizes, meta->recvOffs );
+
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    const Int* AColBuf = A.LockedTargetBuffer();
+    meta->patternOffsets.assign( AOffsetBuf, AOffsetBuf+localHeight+1 );
+    meta->patternTargets.assign( AColBuf, AColBuf+numLocalEntries );
+}
+
+template<typename F>
+void DistFront<F>::Pull
+( const DistSparseMatrix<F>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<Int>& mappedSources,
+        vector<Int>& mappedTargets,
+        vector<Int>& colOffs,
+  bool conjugate )
+{
+    DEBUG_ONLY(CSE cse("DistFront::Pull"))
+    PullEntries
+    ( *this, A, reordering, rootSep, rootInfo,
+      mappedSources, mappedTargets, colOffs, conjugate,
+      (DistFrontPullMeta*)nullptr );
+}
+
+template<typename F>
+void DistFront<F>::Pull
+( const DistSparseMatrix<F>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        DistFrontPullMeta& meta,
+  bool conjugate )
+{
+    DEBUG_ONLY(CSE cse("DistFront::Pull"))
+    mpi::Comm comm = A.Comm();
+
+    // Every process must agree on whether the plan can be reused
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    const Int* AColBuf = A.LockedTargetBuffer();
+    const bool samePattern =
+      Int(meta.patternOffsets.size()) == localHeight+1 &&
+      Int(meta.patternTargets.size()) == numLocalEntries &&
+      std::equal
+      ( AOffsetBuf, AOffsetBuf+localHeight+1, meta.patternOffsets.begin() ) &&
+      std::equal
+      ( AColBuf, AColBuf+numLocalEntries, meta.patternTargets.begin() );
+    if( !mpi::AllReduce( int(samePattern), mpi::MIN, comm ) )
+    {
+        meta.Empty();
+        vector<Int> mappedSources, mappedTargets, colOffs;
+        PullEntries
+        ( *this, A, reordering, rootSep, rootInfo,
+          mappedSources, mappedTargets, colOffs, conjugate, &meta );
+        return;
+    }
+
+    // Exchange the values of A
+    const F* AValBuf = A.LockedValueBuffer();
+    const Int numSendEntries = meta.sendSourceOffs.size();
+    const Int numRecvEntries = meta.targetFronts.size();
+    vector<F> sendVals( numSendEntries ), recvVals( numRecvEntries );
+    for( Int s=0; s<numSendEntries; ++s )
+        sendVals[s] = AValBuf[meta.sendSourceOffs[s]];
+    mpi::AllToAll
+    ( sendVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      recvVals.data(), meta.recvSizes.data(), meta.recvOffs.data(), comm );
+    SwapClear( sendVals );
+
+    // Return each front to its unfactored state (in the order of the plan)
+    vector<F*> denseBufs, sparseBufs;
+    auto pushBuffers = [&]( Matrix<F>& dense, SparseMatrix<F>* sparse )
+      {
+        if( dense.LDim() != meta.frontLDims[denseBufs.size()] )
+            LogicError("Front storage changed since the pull plan was formed");
+        denseBufs.push_back( dense.Buffer() );
+        sparseBufs.push_back
+        ( sparse == nullptr ? nullptr : sparse->ValueBuffer() );
+      };
+    function<void(Front<F>&)> resetLocal =
+      [&]( Front<F>& front )
+      {
+        for( auto* child : front.children )
+            resetLocal( *child );
+        front.type = SYMM_2D;
+        front.isHermitian = conjugate;
+        Zero( front.LDense );
+        pushBuffers
+        ( front.LDense, front.sparseLeaf ? &front.workSparse : nullptr );
+      };
+    function<void(DistFront<F>&)> reset =
+      [&]( DistFront<F>& front )
+      {
+        const bool was1D = FrontIs1D( front.type );
+        const Grid& grid = ( was1D ? front.L1D.Grid() : front.L2D.Grid() );
+        front.type = SYMM_2D;
+        front.isHermitian = conjugate;
+        if( front.duplicate != nullptr )
+        {
+            resetLocal( *front.duplicate );
+            front.L1D.Empty();
+            front.L2D.Attach( grid, front.duplicate->LDense );
+            return;
+        }
+        reset( *front.child );
+        if( was1D )
+        {
+            const Int height = front.L1D.Height();
+            const Int width = front.L1D.Width();
+            front.L2D.SetGrid( grid );
+            Zeros( front.L2D, height, width );
+            front.L1D.Empty();
+        }
+        else
+            Zero( front.L2D );
+        pushBuffers( front.L2D.Matrix(), nullptr );
+      };
+    reset( *this );
+
+    // Stream the values into the fronts
+    for( Int k=0; k<numRecvEntries; ++k )
+    {
+        const F value = recvVals[k];
+        const Int frontIndex = meta.targetFronts[k];
+        const Int target = meta.targetOffs[k];
+        const Int mirror = meta.mirrorOffs[k];
+        if( mirror < 0 )
+        {
+            denseBufs[frontIndex][target] = ( conjugate ? Conj(value) : value );
+        }
+        else if( mirror == target )
+        {
+            sparseBufs[frontIndex][target] =
+              ( conjugate ? F(RealPart(value)) : value );
+        }
+        else
+        {
+            // The transpose of the top-left of sparse leaves is stored
+            sparseBufs[frontIndex][target] = value;
+            sparseBufs[frontIndex][mirror] =
+              ( conjugate ? Conj(value) : value );
+        }
+    }
 }
 
 template<typename F>
@@ -213,6 +213,158 @@ void Front<F>::Pull
     pull( rootInfo, *this );
 }
 
+// Record where each lower-triangular entry of A landed during a Pull
+template<typename F>
+inline void FormPullMeta
+( const Front<F>& rootFront,
+  const SparseMatrix<F>& A,
+  const vector<Int>& reordering,
+  const NodeInfo& rootInfo,
+        FrontPullMeta& meta )
+{
+    DEBUG_ONLY(CSE cse("ldl::FormPullMeta"))
+    meta.Empty();
+
+    const Int n = reordering.size();
+    vector<Int> invReorder(n);
+    for( Int j=0; j<n; ++j )
+        invReorder[reordering[j]] = j;
+
+    const Int* AColBuf = A.LockedTargetBuffer();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    function<void(const NodeInfo&,const Front<F>&)> form = 
+      [&]( const NodeInfo& node, const Front<F>& front )
+      {
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            form( *node.children[c], *front.children[c] );
+
+        const Int frontIndex = meta.frontLDims.size();
+        const Int LDenseLDim = front.LDense.LDim();
+        meta.frontLDims.push_back( LDenseLDim );
+        for( Int t=0; t<node.size; ++t )
+        {
+            const Int j = invReorder[node.off+t];
+            const Int rowOff = AOffsetBuf[j];
+            const Int numConn = AOffsetBuf[j+1] - rowOff;
+            for( Int k=0; k<numConn; ++k )
+            {
+                const Int i = reordering[AColBuf[rowOff+k]];
+                if( i < node.off+t )
+                    continue;
+
+                meta.sourceOffs.push_back( rowOff+k );
+                meta.targetFronts.push_back( frontIndex );
+                if( i < node.off+node.size )
+                {
+                    const Int row = i - node.off;
+                    if( front.sparseLeaf )
+                    {
+                        meta.targetOffs.push_back
+                        ( front.workSparse.Offset(row,t) );
+                        meta.mirrorOffs.push_back
+                        ( front.workSparse.Offset(t,row) );
+                    }
+                    else
+                    {
+                        meta.targetOffs.push_back( row+t*LDenseLDim );
+                        meta.mirrorOffs.push_back( -1 );
+                    }
+                }
+                else
+                {
+                    const Int origOff = Find( node.origLowerStruct, i );
+                    Int row = node.origLowerRelInds[origOff];
+                    if( front.sparseLeaf )
+                        row -= node.size;
+                    meta.targetOffs.push_back( row+t*LDenseLDim );
+                    meta.mirrorOffs.push_back( -1 );
+                }
+            }
+        }
+      };
+    form( rootInfo, rootFront );
+
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    meta.patternOffsets.assign( AOffsetBuf, AOffsetBuf+height+1 );
+    meta.patternTargets.assign( AColBuf, AColBuf+numEntries );
+}
+
+template<typename F>
+void Front<F>::Pull
+( const SparseMatrix<F>& A, 
+  const vector<Int>& reordering,
+  const NodeInfo& rootInfo,
+        FrontPullMeta& meta,
+  bool conjugate )
+{
+    DEBUG_ONLY(CSE cse("Front::Pull"))
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    const Int* AOffsetBuf = A.LockedOffsetBuffer();
+    const Int* AColBuf = A.LockedTargetBuffer();
+    const bool samePattern =
+      Int(meta.patternOffsets.size()) == height+1 &&
+      Int(meta.patternTargets.size()) == numEntries &&
+      std::equal( AOffsetBuf, AOffsetBuf+height+1, 
+                  meta.patternOffsets.begin() ) &&
+      std::equal( AColBuf, AColBuf+numEntries, meta.patternTargets.begin() );
+    if( !samePattern )
+    {
+        Pull( A, reordering, rootInfo, conjugate );
+        FormPullMeta( *this, A, reordering, rootInfo, meta );
+        return;
+    }
+
+    // Return each front to its unfactored state
+    vector<F*> denseBufs, sparseBufs;
+    function<void(Front<F>&)> reset = 
+      [&]( Front<F>& front )
+      {
+        for( auto* child : front.children )
+            reset( *child );
+
+        front.type = SYMM_2D;
+        front.isHermitian = conjugate;
+        Zero( front.LDense );
+        if( front.LDense.LDim() != meta.frontLDims[denseBufs.size()] )
+            LogicError("Front storage changed since the pull plan was formed");
+        denseBufs.push_back( front.LDense.Buffer() );
+        sparseBufs.push_back
+        ( front.sparseLeaf ? front.workSparse.ValueBuffer() : nullptr );
+      };
+    reset( *this );
+
+    // Stream the values of A into the fronts
+    const F* AValBuf = A.LockedValueBuffer();
+    const Int numScattered = meta.sourceOffs.size();
+    for( Int e=0; e<numScattered; ++e )
+    {
+        const F value = AValBuf[meta.sourceOffs[e]];
+        const Int frontIndex = meta.targetFronts[e];
+        const Int target = meta.targetOffs[e];
+        const Int mirror = meta.mirrorOffs[e];
+        if( mirror < 0 )
+        {
+            denseBufs[frontIndex][target] = ( conjugate ? Conj(value) : value );
+        }
+        else if( mirror == target )
+        {
+            sparseBufs[frontIndex][target] =
+              ( conjugate ? F(RealPart(value)) : value );
+        }
+        else
+        {
+            // Since SuiteSparse makes use of column-major ordering, the
+            // transpose of the top-left of the sparse leaf is stored
+            sparseBufs[frontIndex][target] = value;
+            sparseBufs[frontIndex][mirror] =
+              ( conjugate ? Conj(value) : value );
+        }
+    }
+}
+
 template<typename F>
 void Front<F>::PullUpdate
 ( const SparseMatrix<F>& A, 
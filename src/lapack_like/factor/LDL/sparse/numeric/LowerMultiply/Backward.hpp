@@ -22,16 +22,17 @@
 #define EL_FACTOR_LDL_SPARSE_NUMERIC_LOWERMULTIPLY_BACKWARD_HPP
 
 #include "./FrontBackward.hpp"
+#include "../Subtree.hpp"
 
 namespace El {
 namespace ldl {
 
 template<typename F> 
-inline void LowerBackwardMultiply
+inline void LowerBackwardMultiplySubtree
 ( const NodeInfo& info, 
-  const Front<F>& front, MatrixNode<F>& X, bool conjugate )
+  const Front<F>& front, MatrixNode<F>& X, bool conjugate, Int depth )
 {
-    DEBUG_ONLY(CSE cse("ldl::LowerBackwardMultiply"))
+    DEBUG_ONLY(CSE cse("ldl::LowerBackwardMultiplySubtree"))
 
     auto* dupMV = X.duplicateMV;
     auto* dupMat = X.duplicateMat;
@@ -57,18 +58,16 @@ inline void LowerBackwardMultiply
         childWT = X.children[c]->matrix;
 
         // Update the child's workspace
-        const Int childUSize = childWB.Height();
-        for( Int iChild=0; iChild<childUSize; ++iChild )
-        {
-            const Int i = info.childRelInds[c][iChild];
-            for( Int j=0; j<numRHS; ++j )
-                childWB.Set( iChild, j, W.Get(i,j) );
-        }
+        ExtractRows( info.childRelInds[c], W, childWB );
     }
 
-    for( Int c=0; c<numChildren; ++c )
-        LowerBackwardMultiply
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+    ForEachChild
+    ( numChildren, depth, [&]( Int c )
+      {
+          LowerBackwardMultiplySubtree
+          ( *info.children[c], *front.children[c], *X.children[c], conjugate,
+            depth+1 );
+      } );
 
     FrontLowerBackwardMultiply( front, W, conjugate );
     if( haveParent )
@@ -88,6 +87,16 @@ inline void LowerBackwardMultiply
     }
 }
 
+template<typename F> 
+inline void LowerBackwardMultiply
+( const NodeInfo& info, 
+  const Front<F>& front, MatrixNode<F>& X, bool conjugate )
+{
+    DEBUG_ONLY(CSE cse("ldl::LowerBackwardMultiply"))
+    SubtreeRoot
+    ( [&]() { LowerBackwardMultiplySubtree( info, front, X, conjugate, 0 ); } );
+}
+
 template<typename F>
 inline void LowerBackwardMultiply
 ( const DistNodeInfo& info,
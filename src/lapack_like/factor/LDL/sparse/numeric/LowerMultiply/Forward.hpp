@@ -22,21 +22,25 @@
 #define EL_FACTOR_LDL_SPARSE_NUMERIC_LOWERMULTIPLY_FORWARD_HPP
 
 #include "./FrontForward.hpp"
+#include "../Subtree.hpp"
 
 namespace El {
 namespace ldl {
 
 template<typename F> 
-inline void LowerForwardMultiply
+inline void LowerForwardMultiplySubtree
 ( const NodeInfo& info, 
-  const Front<F>& front, MatrixNode<F>& X )
+  const Front<F>& front, MatrixNode<F>& X, Int depth )
 {
-    DEBUG_ONLY(CSE cse("ldl::LowerForwardMultiply"))
+    DEBUG_ONLY(CSE cse("ldl::LowerForwardMultiplySubtree"))
 
     const Int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
-        LowerForwardMultiply
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    ForEachChild
+    ( numChildren, depth, [&]( Int c )
+      {
+          LowerForwardMultiplySubtree
+          ( *info.children[c], *front.children[c], *X.children[c], depth+1 );
+      } );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -58,15 +62,8 @@ inline void LowerForwardMultiply
         auto& childW = X.children[c]->work;
         const Int childSize = info.children[c]->size;
         const Int childHeight = childW.Height();
-        const Int childUSize = childHeight-childSize;
-
         auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
-        for( Int iChild=0; iChild<childUSize; ++iChild )
-        {
-            const Int iFront = info.childRelInds[c][iChild]; 
-            for( Int j=0; j<numRHS; ++j )
-                W.Update( iFront, j, childU.Get(iChild,j) );
-        }
+        ExtendAddRows( info.childRelInds[c], childU, W );
         childW.Empty();
     }
 
@@ -74,6 +71,16 @@ inline void LowerForwardMultiply
     X.matrix = WT;
 }
 
+template<typename F> 
+inline void LowerForwardMultiply
+( const NodeInfo& info, 
+  const Front<F>& front, MatrixNode<F>& X )
+{
+    DEBUG_ONLY(CSE cse("ldl::LowerForwardMultiply"))
+    SubtreeRoot
+    ( [&]() { LowerForwardMultiplySubtree( info, front, X, 0 ); } );
+}
+
 template<typename F>
 inline void LowerForwardMultiply
 ( const DistNodeInfo& info,
@@ -22,17 +22,18 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_BACKWARD_HPP
 
 #include "./FrontBackward.hpp"
+#include "../Subtree.hpp"
 
 namespace El {
 namespace ldl {
 
 template<typename F> 
-inline void LowerBackwardSolve
+inline void LowerBackwardSolveSubtree
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X, bool conjugate )
+        MatrixNode<F>& X, bool conjugate, Int depth )
 {
-    DEBUG_ONLY(CSE cse("ldl::LowerBackwardSolve"))
+    DEBUG_ONLY(CSE cse("ldl::LowerBackwardSolveSubtree"))
 
     auto* dupMV = X.duplicateMV;
     auto* dupMat = X.duplicateMat;
@@ -53,8 +54,6 @@ inline void LowerBackwardSolve
         X.matrix = W( IR(0,info.size), IR(0,numRHS) );
 
     const Int numChildren = front.children.size();
-    const F* WBuf = W.LockedBuffer();
-    const Int WLDim = W.LDim();
     for( Int c=0; c<numChildren; ++c )
     {
         // Set up a workspace for the child
@@ -65,15 +64,7 @@ inline void LowerBackwardSolve
         childWT = X.children[c]->matrix;
 
         // Update the child's workspace
-        const Int childUSize = childWB.Height();
-        F* childWBBuf = childWB.Buffer();
-        const Int childWBLDim = childWB.LDim();
-        for( Int iChild=0; iChild<childUSize; ++iChild )
-        {
-            const Int i = info.childRelInds[c][iChild];
-            for( Int j=0; j<numRHS; ++j )
-                childWBBuf[iChild+j*childWBLDim] = WBuf[i+j*WLDim];
-        }
+        ExtractRows( info.childRelInds[c], W, childWB );
     }
     if( haveParent )
         X.work.Empty();
@@ -82,9 +73,24 @@ inline void LowerBackwardSolve
     else if( haveDupMatParent )
         dupMat->work.Empty();
 
-    for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+    ForEachChild
+    ( numChildren, depth, [&]( Int c )
+      {
+          LowerBackwardSolveSubtree
+          ( *info.children[c], *front.children[c], *X.children[c], conjugate,
+            depth+1 );
+      } );
+}
+
+template<typename F> 
+inline void LowerBackwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    DEBUG_ONLY(CSE cse("ldl::LowerBackwardSolve"))
+    SubtreeRoot
+    ( [&]() { LowerBackwardSolveSubtree( info, front, X, conjugate, 0 ); } );
 }
 
 template<typename F>
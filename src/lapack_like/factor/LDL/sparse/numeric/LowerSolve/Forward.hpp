@@ -22,22 +22,26 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FORWARD_HPP
 
 #include "./FrontForward.hpp"
+#include "../Subtree.hpp"
 
 namespace El {
 namespace ldl {
 
 template<typename F> 
-inline void LowerForwardSolve
+inline void LowerForwardSolveSubtree
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X, Int depth )
 {
-    DEBUG_ONLY(CSE cse("ldl::LowerForwardSolve"))
+    DEBUG_ONLY(CSE cse("ldl::LowerForwardSolveSubtree"))
 
     const Int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    ForEachChild
+    ( numChildren, depth, [&]( Int c )
+      {
+          LowerForwardSolveSubtree
+          ( *info.children[c], *front.children[c], *X.children[c], depth+1 );
+      } );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -51,24 +55,13 @@ inline void LowerForwardSolve
     Zero( WB );
 
     // Update using the children (if they exist)
-    F* WBuf = W.Buffer();
-    const Int WLDim = W.LDim();
     for( Int c=0; c<numChildren; ++c )
     {
         auto& childW = X.children[c]->work;
         const Int childSize = info.children[c]->size;
         const Int childHeight = childW.Height();
-        const Int childUSize = childHeight-childSize;
-
         auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
-        const F* childUBuf = childU.LockedBuffer();
-        const Int childULDim = childU.LDim();
-        for( Int iChild=0; iChild<childUSize; ++iChild )
-        {
-            const Int iFront = info.childRelInds[c][iChild]; 
-            for( Int j=0; j<numRHS; ++j )
-                WBuf[iFront+j*WLDim] += childUBuf[iChild+j*childULDim];
-        }
+        ExtendAddRows( info.childRelInds[c], childU, W );
         childW.Empty();
     }
 
@@ -79,6 +72,16 @@ inline void LowerForwardSolve
     X.matrix = WT;
 }
 
+template<typename F> 
+inline void LowerForwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    DEBUG_ONLY(CSE cse("ldl::LowerForwardSolve"))
+    SubtreeRoot( [&]() { LowerForwardSolveSubtree( info, front, X, 0 ); } );
+}
+
 template<typename F>
 inline void LowerForwardSolve
 ( const DistNodeInfo& info,
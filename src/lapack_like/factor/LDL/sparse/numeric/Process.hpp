@@ -23,15 +23,17 @@
 
 #include "ElSuiteSparse/ldl.hpp"
 #include "./ProcessFront.hpp"
+#include "./Subtree.hpp"
 
 namespace El {
 namespace ldl {
 
 template<typename F> 
 inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+ProcessSubtree
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType, Int depth )
 {
-    DEBUG_ONLY(CSE cse("ldl::Process"))
+    DEBUG_ONLY(CSE cse("ldl::ProcessSubtree"))
     const int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
@@ -118,33 +120,34 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
               LogicError("Front was not the proper size");
         )
 
-        // Process children and add in their updates
+        // Process the children (concurrently, if possible)
         const int numChildren = info.children.size();
+        ForEachChild
+        ( numChildren, depth, [&]( Int c )
+          {
+              ProcessSubtree
+              ( *info.children[c], *front.children[c], factorType, depth+1 );
+          } );
+
+        // Add in the children's updates
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
-
             auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
-            {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
-                {
-                    const int i = info.childRelInds[c][iChild];
-                    const F value = childU.Get(iChild,jChild);
-                    if( j < info.size )
-                        FL.Update( i, j, value );
-                    else
-                        FBR.Update( i-info.size, j-info.size, value );
-                }
-            }
+            ExtendAddUpdate( info.childRelInds[c], info.size, childU, FL, FBR );
             childU.Empty();
         }
         ProcessFront( front, factorType );
     }
 }
 
+template<typename F> 
+inline void 
+Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_ONLY(CSE cse("ldl::Process"))
+    SubtreeRoot( [&]() { ProcessSubtree( info, front, factorType, 0 ); } );
+}
+
 template<typename F>
 inline void
 Process
@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_FACTOR_LDL_NUMERIC_SUBTREE_HPP
+#define EL_FACTOR_LDL_NUMERIC_SUBTREE_HPP
+
+#include <exception>
+
+namespace El {
+namespace ldl {
+
+// Task-parallel traversal of the sequential elimination tree
+// ==========================================================
+// When Elemental is built with EL_HYBRID, the children of each node in the
+// top levels of a sequential subtree are processed as OpenMP tasks so that
+// independent subtrees are factored (or solved against) concurrently. Below
+// SubtreeTaskDepth levels, the traversal is serial within each task.
+//
+// Since the thread which began an OpenMP region must own the call stack and
+// profiling data, the tasks are generated by the master thread, and any
+// exception thrown within a task is rethrown once all of its siblings have
+// completed.
+
+#ifdef EL_HYBRID
+inline Int SubtreeTaskDepth()
+{
+    // Create roughly eight times as many tasks as there are threads so that
+    // imbalanced subtrees can be compensated for
+    const Int numThreads = omp_get_num_threads();
+    Int depth = 3;
+    while( (Int(1)<<(depth-3)) < numThreads )
+        ++depth;
+    return depth;
+}
+#endif
+
+template<typename Function>
+inline void SubtreeRoot( Function func )
+{
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() && omp_get_max_threads() > 1 )
+    {
+        std::exception_ptr except;
+        #pragma omp parallel
+        {
+            #pragma omp master
+            {
+                try { func(); }
+                catch( ... ) { except = std::current_exception(); }
+            }
+        }
+        if( except )
+            std::rethrow_exception( except );
+        return;
+    }
+#endif
+    func();
+}
+
+// Call func(c) for each child c of a node at the given depth of the tree
+template<typename Function>
+inline void ForEachChild( Int numChildren, Int depth, Function func )
+{
+#ifdef EL_HYBRID
+    if( numChildren > 1 && omp_in_parallel() && depth < SubtreeTaskDepth() )
+    {
+        vector<std::exception_ptr> excepts( numChildren );
+        for( Int c=0; c<numChildren-1; ++c )
+        {
+            #pragma omp task default(shared) firstprivate(c)
+            {
+                try { func( c ); }
+                catch( ... ) { excepts[c] = std::current_exception(); }
+            }
+        }
+        // Keep the last child on this thread
+        try { func( numChildren-1 ); }
+        catch( ... ) { excepts[numChildren-1] = std::current_exception(); }
+        #pragma omp taskwait
+
+        for( Int c=0; c<numChildren; ++c )
+            if( excepts[c] )
+                std::rethrow_exception( excepts[c] );
+        return;
+    }
+#endif
+    for( Int c=0; c<numChildren; ++c )
+        func( c );
+}
+
+// Extend-add kernels
+// ==================
+// The relative indices of a child's update within its parent are increasing
+// and typically consist of long runs of consecutive indices, which are
+// handled as contiguous (vectorizable) updates.
+
+// dst[relInds[i]-offset] += src[i] for 0 <= i < n
+template<typename F>
+inline void ExtendAddColumn
+( Int n, const Int* relInds, Int offset, const F* src, F* dst )
+{
+    Int i=0;
+    while( i < n )
+    {
+        const Int runStart = i;
+        const Int shift = relInds[runStart] - runStart;
+        for( ++i; i<n && relInds[i]==i+shift; ++i );
+
+        F* dstRun = &dst[relInds[runStart]-offset];
+        const F* srcRun = &src[runStart];
+        const Int runSize = i - runStart;
+        for( Int k=0; k<runSize; ++k )
+            dstRun[k] += srcRun[k];
+    }
+}
+
+// dst[i] = src[relInds[i]] for 0 <= i < n
+template<typename F>
+inline void ExtractColumn( Int n, const Int* relInds, const F* src, F* dst )
+{
+    Int i=0;
+    while( i < n )
+    {
+        const Int runStart = i;
+        const Int shift = relInds[runStart] - runStart;
+        for( ++i; i<n && relInds[i]==i+shift; ++i );
+
+        const F* srcRun = &src[relInds[runStart]];
+        F* dstRun = &dst[runStart];
+        const Int runSize = i - runStart;
+        for( Int k=0; k<runSize; ++k )
+            dstRun[k] = srcRun[k];
+    }
+}
+
+// Add the lower triangle of a child's update matrix into the left portion
+// (FL) and bottom-right Schur complement (FBR) of its parent's front
+template<typename F>
+inline void ExtendAddUpdate
+( const vector<Int>& relInds, Int frontSize,
+  const Matrix<F>& childU, Matrix<F>& FL, Matrix<F>& FBR )
+{
+    DEBUG_ONLY(CSE cse("ldl::ExtendAddUpdate"))
+    const Int childUSize = childU.Height();
+    const F* childUBuf = childU.LockedBuffer();
+    const Int childULDim = childU.LDim();
+    F* FLBuf = FL.Buffer();
+    F* FBRBuf = FBR.Buffer();
+    const Int FLLDim = FL.LDim();
+    const Int FBRLDim = FBR.LDim();
+    for( Int jChild=0; jChild<childUSize; ++jChild )
+    {
+        const Int j = relInds[jChild];
+        const F* src = &childUBuf[jChild+jChild*childULDim];
+        const Int numRows = childUSize - jChild;
+        if( j < frontSize )
+            ExtendAddColumn
+            ( numRows, &relInds[jChild], 0, src, &FLBuf[j*FLLDim] );
+        else
+            ExtendAddColumn
+            ( numRows, &relInds[jChild], frontSize,
+              src, &FBRBuf[(j-frontSize)*FBRLDim] );
+    }
+}
+
+// Add the bottom of a child's workspace into the rows of its parent's
+template<typename F>
+inline void ExtendAddRows
+( const vector<Int>& relInds, const Matrix<F>& childU, Matrix<F>& W )
+{
+    DEBUG_ONLY(CSE cse("ldl::ExtendAddRows"))
+    const Int childUSize = childU.Height();
+    const Int numRHS = childU.Width();
+    const F* childUBuf = childU.LockedBuffer();
+    const Int childULDim = childU.LDim();
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    for( Int j=0; j<numRHS; ++j )
+        ExtendAddColumn
+        ( childUSize, relInds.data(), 0,
+          &childUBuf[j*childULDim], &WBuf[j*WLDim] );
+}
+
+// Fill the bottom of a child's workspace from the rows of its parent's
+template<typename F>
+inline void ExtractRows
+( const vector<Int>& relInds, const Matrix<F>& W, Matrix<F>& childWB )
+{
+    DEBUG_ONLY(CSE cse("ldl::ExtractRows"))
+    const Int childUSize = childWB.Height();
+    const Int numRHS = childWB.Width();
+    const F* WBuf = W.LockedBuffer();
+    const Int WLDim = W.LDim();
+    F* childWBBuf = childWB.Buffer();
+    const Int childWBLDim = childWB.LDim();
+    for( Int j=0; j<numRHS; ++j )
+        ExtractColumn
+        ( childUSize, relInds.data(),
+          &WBuf[j*WLDim], &childWBBuf[j*childWBLDim] );
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_FACTOR_LDL_NUMERIC_SUBTREE_HPP
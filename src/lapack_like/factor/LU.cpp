@@ -13,6 +13,7 @@
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
+#include "./LU/LookAhead.hpp"
 
 namespace El {
 
@@ -47,6 +48,7 @@ template<typename F>
 void LU( ElementalMatrix<F>& APre )
 {
     DEBUG_ONLY(CSE cse("LU"))
+    ProfileRegion region( "LU" );
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -152,12 +154,25 @@ void LU
 }
 
 template<typename F> 
-void LU( ElementalMatrix<F>& APre, DistPermutation& P )
+void LU( ElementalMatrix<F>& A, DistPermutation& P )
 {
     DEBUG_ONLY(CSE cse("LU"))
+    LU( A, P, LUCtrl() );
+}
+
+template<typename F> 
+void LU( ElementalMatrix<F>& APre, DistPermutation& P, const LUCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    ProfileRegion region( "LU" );
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
+    if( ctrl.lookAhead )
+    {
+        lu::LookAhead( A, P );
+        return;
+    }
 
     const Grid& g = A.Grid();
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
@@ -227,6 +242,7 @@ void LU
   DistPermutation& Q )
 {
     DEBUG_ONLY(CSE cse("LU"))
+    ProfileRegion region( "LU" );
     lu::Full( A, P, Q );
 }
 
@@ -241,6 +257,10 @@ void LU
   ( ElementalMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( ElementalMatrix<F>& A, \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -306,6 +326,8 @@ void LU
           ElementalMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+#include "../PanelGather.hpp"
+
+namespace El {
+namespace lu {
+
+// LU with partial pivoting and a look-ahead of one panel: the columns of the
+// trailing matrix which form the next panel are updated first, and their
+// redistribution to [MC,* ] is overlapped with the rest of the update
+template<typename F>
+inline void
+LookAhead( DistMatrix<F>& A, DistPermutation& P )
+{
+    DEBUG_ONLY(CSE cse("lu::LookAhead"))
+    const Grid& g = A.Grid();
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
+    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
+    DistMatrix<F,  MC,  STAR> panels[2] =
+      { DistMatrix<F,MC,STAR>(g), DistMatrix<F,MC,STAR>(g) };
+    PanelGather<F> gather;
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    DistPermutation PB(g);
+
+    vector<F> panelBuf, pivotBuf;
+    const Int bsize = Blocksize();
+    if( minDim > 0 )
+    {
+        gather.Start( A( ALL, IR(0,Min(bsize,minDim)) ), panels[0] );
+        gather.Finish();
+    }
+    for( Int k=0, step=0; k<minDim; k+=bsize, ++step )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Int nbNext = Min(bsize,minDim-(k+nb));
+        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB  = A( indB, ALL );
+
+        // The current panel, A(k:m,k:k+nb), was gathered during the previous
+        // iteration
+        auto& AB1_MC_STAR = panels[step%2];
+        auto& nextAB1_MC_STAR = panels[(step+1)%2];
+
+        const Int A21Height = A21.Height();
+        const Int A21LocHeight = A21.LocalHeight();
+        const Int panelLDim = nb+A21LocHeight;
+        FastResize( panelBuf, panelLDim*nb );
+        A11_STAR_STAR.Attach
+        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
+        A21_MC_STAR.Attach
+        ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
+        A11_STAR_STAR = AB1_MC_STAR( IR(0,nb), ALL );
+        A21_MC_STAR = AB1_MC_STAR( IR(nb,END), ALL );
+        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+
+        PB.PermuteRows( AB );
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+
+        // Update the next panel and begin gathering it
+        const IR indL( 0, nbNext ), indR( nbNext, END );
+        auto A22L = A22( ALL, indL );
+        auto A22R = A22( ALL, indR );
+        LocalGemm
+        ( NORMAL, NORMAL,
+          F(-1), A21_MC_STAR, A12_STAR_MR( ALL, indL ), F(1), A22L );
+        if( nbNext > 0 )
+            gather.Start( A22L, nextAB1_MC_STAR );
+
+        // Update the remainder of the trailing matrix during the gather
+        LocalGemm
+        ( NORMAL, NORMAL,
+          F(-1), A21_MC_STAR, A12_STAR_MR( ALL, indR ), F(1), A22R );
+
+        A11 = A11_STAR_STAR;
+        A12 = A12_STAR_MR;
+        A21 = A21_MC_STAR;
+
+        gather.Finish();
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
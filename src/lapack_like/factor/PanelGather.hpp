@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_FACTOR_PANELGATHER_HPP
+#define EL_FACTOR_PANELGATHER_HPP
+
+namespace El {
+
+// Split-phase redistribution of a panel of an [MC,MR] matrix into either
+// [MC,* ] (a column panel, gathered within process rows) or [* ,MR] (a row
+// panel, gathered within process columns). The look-ahead factorizations
+// start the gather of the next panel once it has been updated and finish it
+// after the remainder of the trailing update, so that, when Elemental was
+// configured with non-blocking collectives, the two overlap. Otherwise the
+// gather completes within Start.
+template<typename F>
+class PanelGather
+{
+public:
+    void Start( const DistMatrix<F,MC,MR>& A, DistMatrix<F,MC,STAR>& B )
+    {
+        DEBUG_ONLY(CSE cse("PanelGather::Start [MC,* ]"))
+        B.AlignWith( A );
+        B.Resize( A.Height(), A.Width() );
+        colPanel_ = &B;
+        rowPanel_ = nullptr;
+        StartGather
+        ( A, A.Width(), A.RowAlign(), A.RowStride(), A.RowComm(), true );
+    }
+
+    void Start( const DistMatrix<F,MC,MR>& A, DistMatrix<F,STAR,MR>& B )
+    {
+        DEBUG_ONLY(CSE cse("PanelGather::Start [* ,MR]"))
+        B.AlignWith( A );
+        B.Resize( A.Height(), A.Width() );
+        colPanel_ = nullptr;
+        rowPanel_ = &B;
+        StartGather
+        ( A, A.Height(), A.ColAlign(), A.ColStride(), A.ColComm(), false );
+    }
+
+    void Finish()
+    {
+        DEBUG_ONLY(CSE cse("PanelGather::Finish"))
+        if( !started_ )
+            return;
+        started_ = false;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        mpi::Wait( request_ );
+#endif
+        if( colPanel_ != nullptr )
+        {
+            // Unpack the local columns of each member of our process row
+            auto& BLoc = colPanel_->Matrix();
+            const Int localHeight = BLoc.Height();
+            F* BBuf = BLoc.Buffer();
+            const Int BLDim = BLoc.LDim();
+            for( Int q=0; q<stride_; ++q )
+            {
+                const Int shift = Shift( q, align_, stride_ );
+                const Int localWidth = Length( gatherDim_, shift, stride_ );
+                const F* data = &recvBuf_[q*portionSize_];
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    MemCopy
+                    ( &BBuf[(shift+jLoc*stride_)*BLDim],
+                      &data[jLoc*localHeight], localHeight );
+            }
+        }
+        else
+        {
+            // Unpack the local rows of each member of our process column
+            auto& BLoc = rowPanel_->Matrix();
+            const Int localWidth = BLoc.Width();
+            F* BBuf = BLoc.Buffer();
+            const Int BLDim = BLoc.LDim();
+            for( Int q=0; q<stride_; ++q )
+            {
+                const Int shift = Shift( q, align_, stride_ );
+                const Int localHeight = Length( gatherDim_, shift, stride_ );
+                const F* data = &recvBuf_[q*portionSize_];
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        BBuf[(shift+iLoc*stride_)+jLoc*BLDim] =
+                          data[iLoc+jLoc*localHeight];
+            }
+        }
+    }
+
+private:
+    DistMatrix<F,MC,STAR>* colPanel_=nullptr;
+    DistMatrix<F,STAR,MR>* rowPanel_=nullptr;
+    vector<F> sendBuf_, recvBuf_;
+    mpi::Request request_;
+    Int gatherDim_=0, align_=0, stride_=1, portionSize_=0;
+    bool started_=false;
+
+    void StartGather
+    ( const DistMatrix<F,MC,MR>& A,
+      Int gatherDim, Int align, Int stride, mpi::Comm comm,
+      bool columnPanel )
+    {
+        if( started_ )
+            LogicError("Previous panel gather was not finished");
+        if( !A.Participating() )
+            return;
+        gatherDim_ = gatherDim;
+        align_ = align;
+        stride_ = stride;
+
+        // Pack our local portion, padded to the maximum over the team
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Int maxLocalDim = MaxLength( gatherDim, stride );
+        portionSize_ =
+          ( columnPanel ? localHeight : localWidth )*maxLocalDim;
+        FastResize( sendBuf_, portionSize_ );
+        FastResize( recvBuf_, portionSize_*stride );
+        auto& ALoc = A.LockedMatrix();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( &sendBuf_[jLoc*localHeight], ALoc.LockedBuffer(0,jLoc),
+              localHeight );
+
+        started_ = true;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        mpi::IAllGather
+        ( sendBuf_.data(), portionSize_, recvBuf_.data(), portionSize_,
+          comm, request_ );
+#else
+        mpi::AllGather
+        ( sendBuf_.data(), portionSize_, recvBuf_.data(), portionSize_,
+          comm );
+#endif
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_PANELGATHER_HPP
@@ -35,6 +35,7 @@ void QR
   ElementalMatrix<Base<F>>& d )
 {
     DEBUG_ONLY(CSE cse("QR"))
+    ProfileRegion region( "QR" );
     qr::Householder( A, t, d );
 }
 
@@ -44,6 +45,7 @@ void QR
   DistMatrix<F,MR,STAR,BLOCK>& t )
 {
     DEBUG_ONLY(CSE cse("QR"))
+    ProfileRegion region( "QR" );
     AssertScaLAPACKSupport();
 #ifdef EL_HAVE_SCALAPACK
     const Int m = A.Height();
@@ -87,6 +89,7 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("QR"))
+    ProfileRegion region( "QR" );
     qr::BusingerGolub( A, t, d, Omega, ctrl );
 }
 
@@ -178,10 +181,12 @@ void QR
   template void qr::Cholesky \
   ( ElementalMatrix<F>& A, \
     ElementalMatrix<F>& R ); \
-  template qr::TreeData<F> qr::TS( const ElementalMatrix<F>& A ); \
+  template qr::TreeData<F> qr::TS \
+  ( const ElementalMatrix<F>& A, Int arity ); \
   template void qr::ExplicitTS \
   ( ElementalMatrix<F>& A, \
-    ElementalMatrix<F>& R ); \
+    ElementalMatrix<F>& R, \
+    Int arity ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const ElementalMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
@@ -192,6 +197,8 @@ void QR
   ( ElementalMatrix<F>& A, const TreeData<F>& treeData ); 
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -14,6 +14,199 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// The shape of the reduction tree as seen from a single process: its parent
+// (-1 for the root), the children it absorbs (in order), and the heights of
+// the two upper-trapezoidal blocks stacked during each of those merges
+struct Tree
+{
+    Int parent=-1;
+    Int height=0;
+    vector<Int> children, topHeights, bottomHeights;
+};
+
+// Process r absorbs processes r+span, r+2*span, ..., r+(arity-1)*span at the
+// level with the given span whenever r is a multiple of arity*span. An arity
+// of two yields a binary tree, while an arity of at least p yields a flat tree.
+// Any number of processes is supported, and no process needs to own more rows
+// than there are columns.
+template<typename F>
+Tree BuildTree( const ElementalMatrix<F>& A, Int arity )
+{
+    DEBUG_ONLY(CSE cse("qr::ts::BuildTree"))
+    if( arity < 2 )
+        LogicError("TSQR tree arity must be at least two");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = mpi::Size( A.ColComm() );
+    const Int rank = mpi::Rank( A.ColComm() );
+
+    vector<Int> rows(p);
+    for( Int q=0; q<p; ++q )
+        rows[q] = Length( m, Shift(q,A.ColAlign(),p), p );
+
+    Tree tree;
+    for( Int span=1; span<p; span*=arity )
+    {
+        for( Int r=0; r<p; r+=arity*span )
+        {
+            for( Int c=1; c<arity && r+c*span<p; ++c )
+            {
+                const Int child = r + c*span;
+                if( r == rank )
+                {
+                    tree.children.push_back( child );
+                    tree.topHeights.push_back( Min(rows[r],n) );
+                    tree.bottomHeights.push_back( Min(rows[child],n) );
+                }
+                else if( child == rank )
+                    tree.parent = r;
+                rows[r] += rows[child];
+            }
+        }
+    }
+    tree.height = Min(rows[rank],n);
+    return tree;
+}
+
+inline Int TrapezoidSize( Int height, Int width )
+{
+    Int size = 0;
+    for( Int j=0; j<width; ++j )
+        size += Min(j+1,height);
+    return size;
+}
+
+// Only the upper trapezoids are communicated during the reduction
+template<typename F>
+void PackTrapezoid( const Matrix<F>& R, vector<F>& buf )
+{
+    const Int height = R.Height();
+    const Int width = R.Width();
+    buf.resize( TrapezoidSize(height,width) );
+    Int offset = 0;
+    for( Int j=0; j<width; ++j )
+    {
+        const Int len = Min(j+1,height);
+        MemCopy( &buf[offset], R.LockedBuffer(0,j), len );
+        offset += len;
+    }
+}
+
+template<typename F>
+void UnpackTrapezoid( const vector<F>& buf, Matrix<F>& R )
+{
+    const Int height = R.Height();
+    const Int width = R.Width();
+    Int offset = 0;
+    for( Int j=0; j<width; ++j )
+    {
+        const Int len = Min(j+1,height);
+        MemCopy( R.Buffer(0,j), &buf[offset], len );
+        offset += len;
+    }
+}
+
+// Factor a stack of an upper-triangular n x n matrix on top of an upper
+// trapezoid using the same packed format as QR. The reflector for column k
+// only involves row k of the top triangle and the first k+1 rows of the
+// bottom trapezoid, so the work is roughly a fifth of that of a general QR
+// of the stacked matrix. If the top block is not a full triangle, the general
+// QR is used instead.
+template<typename F>
+void StackedQR( Matrix<F>& S, Int topHeight, Matrix<F>& t, Matrix<Base<F>>& d )
+{
+    DEBUG_ONLY(CSE cse("qr::ts::StackedQR"))
+    typedef Base<F> Real;
+    const Int n = S.Width();
+    if( topHeight != n )
+    {
+        QR( S, t, d );
+        return;
+    }
+    const Int bottomHeight = S.Height() - n;
+    const Int ldim = S.LDim();
+    t.Resize( n, 1 );
+    d.Resize( n, 1 );
+
+    Matrix<F> z;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int len = Min(k+1,bottomHeight);
+        const IR ind1( k ), ind2( k+1, n ), indB( n, n+len );
+
+        auto alpha11 = S( ind1, ind1 );
+        auto a12     = S( ind1, ind2 );
+        auto uB      = S( indB, ind1 );
+        auto AB2     = S( indB, ind2 );
+
+        const F tau = LeftReflector( alpha11, uB );
+        t.Set( k, 0, tau );
+
+        // | a12 | := (I - tau | 1  | | 1, uB^H |) | a12 |
+        // | AB2 |             | uB |              | AB2 |
+        const Int width = n-(k+1);
+        F* a12Buf = a12.Buffer();
+        z.Resize( width, 1 );
+        F* zBuf = z.Buffer();
+        for( Int j=0; j<width; ++j )
+            zBuf[j] = Conj(a12Buf[j*ldim]);
+        Gemv( ADJOINT, F(1), AB2, uB, F(1), z );
+        for( Int j=0; j<width; ++j )
+            a12Buf[j*ldim] -= tau*Conj(zBuf[j]);
+        Ger( -tau, uB, z, AB2 );
+    }
+    // Form d and rescale R
+    auto R = S( IR(0,n), ALL );
+    GetRealPartOfDiagonal(R,d);
+    auto sgn = []( Real delta )
+               { return delta >= Real(0) ? Real(1) : Real(-1); };
+    EntrywiseMap( d, function<Real(Real)>(sgn) );
+    DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, d, R );
+}
+
+// Overwrite Z with Q Z, where Q is the unitary factor from StackedQR
+template<typename F>
+void ApplyStackedQ
+( const Matrix<F>& S,
+        Int topHeight,
+  const Matrix<F>& t,
+  const Matrix<Base<F>>& d,
+        Matrix<F>& Z )
+{
+    DEBUG_ONLY(CSE cse("qr::ts::ApplyStackedQ"))
+    const Int n = S.Width();
+    if( topHeight != n )
+    {
+        ApplyQ( LEFT, NORMAL, S, t, d, Z );
+        return;
+    }
+    const Int bottomHeight = S.Height() - n;
+    const Int width = Z.Width();
+    const Int ldim = Z.LDim();
+
+    auto ZTop = Z( IR(0,n), ALL );
+    DiagonalScale( LEFT, NORMAL, d, ZTop );
+
+    Matrix<F> z(width,1);
+    F* zBuf = z.Buffer();
+    for( Int k=n-1; k>=0; --k )
+    {
+        const Int len = Min(k+1,bottomHeight);
+        const IR indB( n, n+len );
+        const F tauConj = Conj(t.Get(k,0));
+        auto uB = S( indB, IR(k) );
+        auto ZB = Z( indB, ALL );
+
+        F* zkBuf = Z.Buffer(k,0);
+        for( Int j=0; j<width; ++j )
+            zBuf[j] = Conj(zkBuf[j*ldim]);
+        Gemv( ADJOINT, F(1), ZB, uB, F(1), z );
+        for( Int j=0; j<width; ++j )
+            zkBuf[j*ldim] -= tauConj*Conj(zBuf[j]);
+        Ger( -tauConj, uB, z, ZB );
+    }
+}
+
 template<typename F>
 void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -22,68 +215,67 @@ void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData )
       if( A.RowDist() != STAR )
           LogicError("Invalid row distribution for TSQR");
     )
-    const Int m =  A.Height();
+    const Int m = A.Height();
     const Int n = A.Width();
     const mpi::Comm colComm = A.ColComm();
     const Int p = mpi::Size( colComm );
     if( p == 1 )
         return;
-    const Int rank = mpi::Rank( colComm );
-    if( m < p*n ) 
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = Log2(p);
+    if( m < n )
+        LogicError("TSQR requires the height to be at least the width");
+    const Tree tree = BuildTree( A, treeData.arity );
+    const Int numMerges = tree.children.size();
 
-    Matrix<F> lastZ;
-    lastZ = treeData.QR0( IR(0,n), IR(0,n) );
-
-    treeData.QRList.resize( logp );
-    treeData.tList.resize( logp );
-    treeData.dList.resize( logp );
+    treeData.QRList.resize( numMerges );
+    treeData.tList.resize( numMerges );
+    treeData.dList.resize( numMerges );
 
-    // Run the binary tree reduction
-    Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+    // Post the receives for every level up front so that the triangles from
+    // the children can arrive while earlier levels are being factored
+    vector<vector<F>> recvBufs( numMerges );
+    vector<mpi::Request> requests( numMerges );
+    for( Int i=0; i<numMerges; ++i )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
-        else
-        {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
-            break;
-        }
+        recvBufs[i].resize( TrapezoidSize(tree.bottomHeights[i],n) );
+        mpi::IRecv
+        ( recvBufs[i].data(), recvBufs[i].size(), tree.children[i], colComm,
+          requests[i] );
+    }
 
-        auto& QRFact = treeData.QRList[stage];
-        auto& t = treeData.tList[stage];
-        auto& d = treeData.dList[stage];
-        QRFact.Resize( 2*n, n, 2*n );
-        t.Resize( n, 1 );
-        d.Resize( n, 1 );
-        auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
-        auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
-        QRFactBot = ZBot;
+    Matrix<F> lastZ;
+    lastZ = treeData.QR0( IR(0,Min(treeData.QR0.Height(),n)), ALL );
+    MakeTrapezoidal( UPPER, lastZ );
+
+    for( Int i=0; i<numMerges; ++i )
+    {
+        const Int topHeight = tree.topHeights[i];
+        const Int height = topHeight + tree.bottomHeights[i];
+        auto& QRFact = treeData.QRList[i];
+        Zeros( QRFact, height, n );
+        auto QRFactTop = QRFact( IR(0,topHeight),      ALL );
+        auto QRFactBot = QRFact( IR(topHeight,height), ALL );
+        QRFactTop = lastZ;
+        mpi::Wait( requests[i] );
+        UnpackTrapezoid( recvBufs[i], QRFactBot );
 
         // Note that the last QR is not performed by this routine, as many
         // higher-level routines, such as TS-SVT, are simplified if the final
         // small matrix is left alone.
-        if( stage < logp-1 )
+        if( tree.parent != -1 || i < numMerges-1 )
         {
-            // TODO: Exploit double-triangular structure
-            QR( QRFact, t, d );
-            lastZ = QRFact( IR(0,n), IR(0,n) );
+            StackedQR
+            ( QRFact, topHeight, treeData.tList[i], treeData.dList[i] );
+            lastZ = QRFact( IR(0,Min(height,n)), ALL );
+            MakeTrapezoidal( UPPER, lastZ );
         }
     }
+
+    if( tree.parent != -1 )
+    {
+        vector<F> sendBuf;
+        PackTrapezoid( lastZ, sendBuf );
+        mpi::Send( sendBuf.data(), sendBuf.size(), tree.parent, colComm );
+    }
 }
 
 template<typename F>
@@ -196,63 +388,58 @@ void Scatter( ElementalMatrix<F>& A, const TreeData<F>& treeData )
     const Int p = mpi::Size( colComm );
     if( p == 1 )
         return;
-    const Int rank = mpi::Rank( colComm );
-    if( m < p*n ) 
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = Log2(p);
-
-    // Run the binary tree scatter
-    Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
-    if( rank == 0 )
-        Z = RootQR( A, treeData );
-    auto ZTop = Z( IR(0,n),   IR(0,n) );
-    auto ZBot = Z( IR(n,2*n), IR(0,n) );
-    for( Int revStage=0; revStage<logp; ++revStage )
+    if( m < n )
+        LogicError("TSQR requires the height to be at least the width");
+    const Tree tree = BuildTree( A, treeData.arity );
+    const Int numMerges = tree.children.size();
+
+    // Receive our portion of the implicit Q from our parent
+    Matrix<F> ZHalf;
+    if( tree.parent == -1 )
+        ZHalf = RootQR( A, treeData );
+    else
     {
-        const Int stage = (logp-1)-revStage;
-        // Skip this stage if the first stage bits of our rank are not zero
-        if( stage>0 && (Unsigned(rank) & ((Unsigned(1)<<stage)-1)) )
-            continue;
-
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            if( stage < logp-1 )
-            {
-                // Multiply by the current Q
-                ZTop = ZHalf;        
-                Zero( ZBot );
-
-                // TODO: Exploit sparsity?
-                ApplyQ
-                ( LEFT, NORMAL, 
-                  treeData.QRList[stage],
-                  treeData.tList[stage], 
-                  treeData.dList[stage],
-                  Z );
-            }
-            // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
-            ZHalf = ZTop; 
-        }
+        Zeros( ZHalf, tree.height, n );
+        mpi::Recv( ZHalf.Buffer(), tree.height*n, tree.parent, colComm );
+    }
+
+    // Run the tree scatter, sending each child its portion without waiting
+    // for the previous sends to complete
+    vector<Matrix<F>> sendBufs( numMerges );
+    vector<mpi::Request> requests( numMerges );
+    Matrix<F> Z;
+    for( Int i=numMerges-1; i>=0; --i )
+    {
+        const Int topHeight = tree.topHeights[i];
+        const Int height = topHeight + tree.bottomHeights[i];
+        if( tree.parent == -1 && i == numMerges-1 )
+            Z = ZHalf;
         else
         {
-            // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            Zeros( Z, height, n );
+            auto ZTop = Z( IR(0,ZHalf.Height()), ALL );
+            ZTop = ZHalf;
+            ApplyStackedQ
+            ( treeData.QRList[i], topHeight,
+              treeData.tList[i], treeData.dList[i], Z );
         }
+        sendBufs[i] = Z( IR(topHeight,height), ALL );
+        mpi::ISend
+        ( sendBufs[i].LockedBuffer(), sendBufs[i].Height()*n,
+          tree.children[i], colComm, requests[i] );
+        ZHalf = Z( IR(0,topHeight), ALL );
     }
 
     // Apply the initial Q
     Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
+    auto ATop = A.Matrix()( IR(0,ZHalf.Height()), ALL );
     ATop = ZHalf;
 
     // TODO: Exploit sparsity
     ApplyQ( LEFT, NORMAL, treeData.QR0, treeData.t0, treeData.d0, A.Matrix() );
+
+    if( numMerges > 0 )
+        mpi::WaitAll( numMerges, requests.data() );
 }
 
 template<typename F>
@@ -298,11 +485,14 @@ FormQ( ElementalMatrix<F>& A, TreeData<F>& treeData )
     {
         if( A.ColRank() == 0 )
         {
-            ExpandPackedReflectors
-            ( LOWER, VERTICAL, CONJUGATED, 0, 
-              RootQR(A,treeData), RootPhases(A,treeData) );
-            DiagonalScale
-            ( RIGHT, NORMAL, RootSignature(A,treeData), RootQR(A,treeData) );
+            const Tree tree = BuildTree( A, treeData.arity );
+            auto& QRRoot = RootQR(A,treeData);
+            Matrix<F> Z;
+            Identity( Z, QRRoot.Height(), A.Width() );
+            ApplyStackedQ
+            ( QRRoot, tree.topHeights.back(),
+              RootPhases(A,treeData), RootSignature(A,treeData), Z );
+            QRRoot = Z;
         }
         Scatter( A, treeData );
     }
@@ -311,11 +501,12 @@ FormQ( ElementalMatrix<F>& A, TreeData<F>& treeData )
 } // namespace ts
 
 template<typename F>
-TreeData<F> TS( const ElementalMatrix<F>& A )
+TreeData<F> TS( const ElementalMatrix<F>& A, Int arity )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
     TreeData<F> treeData;
+    treeData.arity = arity;
     treeData.QR0 = A.LockedMatrix();
     QR( treeData.QR0, treeData.t0, treeData.d0 );
 
@@ -324,18 +515,21 @@ TreeData<F> TS( const ElementalMatrix<F>& A )
     {
         ts::Reduce( A, treeData );
         if( A.ColRank() == 0 )
-            QR
-            ( ts::RootQR(A,treeData),
+        {
+            const ts::Tree tree = ts::BuildTree( A, arity );
+            ts::StackedQR
+            ( ts::RootQR(A,treeData), tree.topHeights.back(),
               ts::RootPhases(A,treeData), 
               ts::RootSignature(A,treeData) );
+        }
     }
     return treeData;
 }
 
 template<typename F>
-void ExplicitTS( ElementalMatrix<F>& A, ElementalMatrix<F>& R )
+void ExplicitTS( ElementalMatrix<F>& A, ElementalMatrix<F>& R, Int arity )
 {
-    auto treeData = TS( A );
+    auto treeData = TS( A, arity );
     Copy( ts::FormR( A, treeData ), R );
     ts::FormQ( A, treeData );
 }
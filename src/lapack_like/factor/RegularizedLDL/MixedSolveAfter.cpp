@@ -0,0 +1,306 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The following routines mirror reg_ldl::SolveAfter, but the frontal tree
+// holds a factorization of the regularized matrix in the demoted precision
+// (e.g., single-precision for a double-precision system). The regularized
+// refinement and the outer Krylov method are carried out in the working
+// precision so that the fast, low-precision solves only act as a
+// preconditioner.
+
+namespace El {
+namespace reg_ldl {
+
+template<typename F,class ApplyAType,class PrecondType>
+inline Int MixedOuterSolve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::MixedOuterSolve"))
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F,class ApplyAType,class PrecondType>
+inline Int MixedOuterSolve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::MixedOuterSolve"))
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F>
+Int MixedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::MixedSolveAfter"))
+    typedef Demote<F> FLow;
+
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyAReg =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    Matrix<FLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        Copy( Y, YLow );
+        ldl::MatrixNode<FLow> YNodal( invMap, info, YLow );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow );
+        Copy( YLow, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        RefinedSolve
+        ( applyAReg, applyAInv, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    return MixedOuterSolve( applyA, precond, B, ctrl );
+}
+
+template<typename F>
+Int MixedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::MixedSolveAfter"))
+    typedef Demote<F> FLow;
+
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyAReg =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    Matrix<FLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        Copy( Y, YLow );
+        ldl::MatrixNode<FLow> YNodal( invMap, info, YLow );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow );
+        Copy( YLow, Y );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        RefinedSolve
+        ( applyAReg, applyAInv, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    return MixedOuterSolve( applyA, precond, B, ctrl );
+}
+
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::MixedSolveAfter"))
+    typedef Demote<F> FLow;
+    mpi::Comm comm = B.Comm();
+
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyAReg =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    // The communication metadata is only formed on the first solve
+    ldl::DistMultiVecNodeMeta meta;
+    DistMultiVec<FLow> YLow(comm);
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        Copy( Y, YLow );
+        ldl::DistMultiVecNode<FLow> YNodal;
+        YNodal.Pull( invMap, info, YLow, meta );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow, meta );
+        Copy( YLow, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        RefinedSolve
+        ( applyAReg, applyAInv, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    return MixedOuterSolve( applyA, precond, B, ctrl );
+}
+
+template<typename F>
+Int MixedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("reg_ldl::MixedSolveAfter"))
+    typedef Demote<F> FLow;
+    mpi::Comm comm = B.Comm();
+
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto applyAReg =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    ldl::DistMultiVecNodeMeta meta;
+    DistMultiVec<FLow> YLow(comm);
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        Copy( Y, YLow );
+        ldl::DistMultiVecNode<FLow> YNodal;
+        YNodal.Pull( invMap, info, YLow, meta );
+        ldl::SolveAfter( info, front, YNodal );
+        YNodal.Push( invMap, info, YLow, meta );
+        Copy( YLow, Y );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        RefinedSolve
+        ( applyAReg, applyAInv, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    return MixedOuterSolve( applyA, precond, B, ctrl );
+}
+
+#define PROTO(F) \
+  template Int MixedSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const Matrix<Base<F>>& d, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int MixedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace reg_ldl
+} // namespace El
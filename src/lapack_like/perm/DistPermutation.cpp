@@ -359,6 +359,7 @@ void DistPermutation::MakeIdentity( Int size )
     
     numSwaps_ = 0;
     implicitSwapOrigins_ = true;
+    staleMeta_ = true;
 }
 
 void DistPermutation::ReserveSwaps( Int maxSwaps )
@@ -397,6 +398,7 @@ void DistPermutation::RowSwap( Int origin, Int dest )
         staleMeta_ = true;
         return;
     }
+    staleMeta_ = true;
 
     if( !implicitSwapOrigins_ )
     {
@@ -595,6 +597,7 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     colMeta_ = P.colMeta_;
     rowMeta_ = P.rowMeta_;
     staleMeta_ = P.staleMeta_;
+    metaOffset_ = P.metaOffset_;
 
     return *this;
 }
@@ -671,6 +674,70 @@ const DistMatrix<Int,VC,STAR> DistPermutation::SwapDestinations() const
     return swapDests_(IR(0,numSwaps_),ALL);
 }
 
+const PermutationMeta& DistPermutation::SwapMeta
+( std::map<keyType_,PermutationMeta>& metaMap,
+  Int align, mpi::Comm comm, Int offset ) const
+{
+    DEBUG_ONLY(CSE cse("DistPermutation::SwapMeta"))
+    if( staleMeta_ || offset != metaOffset_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        metaOffset_ = offset;
+        staleMeta_ = false;
+    }
+
+    keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+    auto data = metaMap.find( key );
+    if( data == metaMap.end() )
+    {
+        auto activeInd = IR(0,numSwaps_);
+        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR( grid_ );
+        if( !implicitSwapOrigins_ )
+            origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+
+        // Track the original row currently held by each row touched by the
+        // sequence of swaps
+        std::map<Int,Int> preimageMap;
+        auto preimageOf =
+          [&]( Int i )
+          {
+              auto entry = preimageMap.find( i );
+              return entry == preimageMap.end() ? i : entry->second;
+          };
+        for( Int j=0; j<numSwaps_; ++j )
+        {
+            const Int origin =
+              ( implicitSwapOrigins_ ? j : origins_STAR_STAR.GetLocal(j,0) );
+            const Int dest = dests_STAR_STAR.GetLocal(j,0);
+            const Int originPreimage = preimageOf( origin+offset );
+            const Int destPreimage = preimageOf( dest+offset );
+            preimageMap[origin+offset] = destPreimage;
+            preimageMap[dest+offset] = originPreimage;
+        }
+
+        vector<Int> image, preimage;
+        image.reserve( preimageMap.size() );
+        preimage.reserve( preimageMap.size() );
+        for( const auto& entry : preimageMap )
+        {
+            if( entry.first != entry.second )
+            {
+                image.push_back( entry.first );
+                preimage.push_back( entry.second );
+            }
+        }
+
+        metaMap.emplace
+        ( std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(image,preimage,align,comm) );
+        data = metaMap.find( key );
+    }
+    return data->second;
+}
+
 template<typename T>
 void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 {
@@ -683,6 +750,16 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
         if( height == 0 || width == 0 )
             return;
 
+        // Rather than exchanging columns once per swap, compose the swaps
+        // and move every affected column with a single exchange
+        if( A.Wrap() == ELEMENT )
+        {
+            const auto& meta =
+              SwapMeta( colMeta_, A.RowAlign(), A.RowComm(), offset );
+            El::PermuteCols( A, meta );
+            return;
+        }
+
         auto activeInd = IR(0,numSwaps_);
 
         // TODO: Introduce an std::map for caching the pivots this process
@@ -763,6 +840,14 @@ void DistPermutation::InversePermuteCols
         if( height == 0 || width == 0 )
             return;
 
+        if( A.Wrap() == ELEMENT )
+        {
+            const auto& meta =
+              SwapMeta( colMeta_, A.RowAlign(), A.RowComm(), offset );
+            El::PermuteCols( A, meta, true );
+            return;
+        }
+
         auto activeInd = IR(0,numSwaps_);
 
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
@@ -837,6 +922,16 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
         if( height == 0 || width == 0 )
             return;
 
+        // Each process column applies the composed swaps with a single
+        // packed AllToAll
+        if( A.Wrap() == ELEMENT )
+        {
+            const auto& meta =
+              SwapMeta( rowMeta_, A.ColAlign(), A.ColComm(), offset );
+            El::PermuteRows( A, meta );
+            return;
+        }
+
         auto activeInd = IR(0,numSwaps_);
 
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
@@ -912,6 +1007,14 @@ void DistPermutation::InversePermuteRows
         if( height == 0 || width == 0 )
             return;
 
+        if( A.Wrap() == ELEMENT )
+        {
+            const auto& meta =
+              SwapMeta( rowMeta_, A.ColAlign(), A.ColComm(), offset );
+            El::PermuteRows( A, meta, true );
+            return;
+        }
+
         auto activeInd = IR(0,numSwaps_);
 
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
@@ -1156,6 +1259,8 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
     bool conjugate, \
     Int offset ) const;
 
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -781,6 +781,8 @@ void Permutation::ExplicitMatrix( Matrix<Int>& P ) const
     bool conjugate, \
     Int offset ) const;
 
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
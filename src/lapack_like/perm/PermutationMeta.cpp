@@ -103,4 +103,55 @@ PermutationMeta::PermutationMeta
     )
 }
 
+PermutationMeta::PermutationMeta
+( const vector<Int>& image,
+  const vector<Int>& preimage,
+        Int permAlign,
+        mpi::Comm permComm )
+{
+    DEBUG_ONLY(
+      CSE cse("PermutationMeta::PermutationMeta");
+      if( image.size() != preimage.size() )
+          LogicError("Image and preimage lists must be the same size");
+    )
+    comm = permComm;
+    align = permAlign;
+    const Int permStride = mpi::Size( permComm );
+    const Int permShift = Shift( mpi::Rank(permComm), permAlign, permStride );
+    const Int numMoved = image.size();
+
+    sendCounts.resize( permStride, 0 );
+    recvCounts.resize( permStride, 0 );
+    sendIdx.resize( 0 );
+    recvIdx.resize( 0 );
+    sendRanks.resize( 0 );
+    recvRanks.resize( 0 );
+    // Every process traverses the moves in the same order, so the packing
+    // order of each sender matches the unpacking order of each receiver
+    for( Int k=0; k<numMoved; ++k )
+    {
+        const Int preVal = preimage[k];
+        const Int postVal = image[k];
+        if( Mod(preVal,permStride) == permShift )
+        {
+            const Int iLoc = (preVal-permShift) / permStride;
+            const Int sendTo = Mod(postVal+permAlign,permStride);
+            sendIdx.push_back( iLoc );
+            sendRanks.push_back( sendTo );
+            ++sendCounts[sendTo];
+        }
+        if( Mod(postVal,permStride) == permShift )
+        {
+            const Int iLoc = (postVal-permShift) / permStride;
+            const Int recvFrom = Mod(preVal+permAlign,permStride);
+            recvIdx.push_back( iLoc );
+            recvRanks.push_back( recvFrom );
+            ++recvCounts[recvFrom];
+        }
+    }
+
+    Scan( sendCounts, sendDispls );
+    Scan( recvCounts, recvDispls );
+}
+
 } // namespace El
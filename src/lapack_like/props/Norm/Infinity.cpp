@@ -163,6 +163,8 @@ Base<F> InfinityNorm( const DistSparseMatrix<F>& A )
   template Base<T> InfinityNorm( const DistSparseMatrix<T>& A );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -271,6 +271,8 @@ Base<F> OneNorm( const DistSparseMatrix<F>& A )
   template Base<T> OneNorm( const DistSparseMatrix<T>& A );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
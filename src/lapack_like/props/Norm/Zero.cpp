@@ -72,6 +72,8 @@ Int ZeroNorm( const DistSparseMatrix<T>& A, Base<T> tol )
   template Int ZeroNorm( const DistSparseMatrix<T>& A, Base<T> tol );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -165,6 +165,8 @@ void ApplyPackedReflectors
           ElementalMatrix<F>& A );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
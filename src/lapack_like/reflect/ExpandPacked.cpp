@@ -46,6 +46,8 @@ void ExpandPackedReflectors
     Int offset, ElementalMatrix<F>& H, const ElementalMatrix<F>& t );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
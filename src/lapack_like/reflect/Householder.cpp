@@ -252,6 +252,8 @@ F RightReflector( F& chi, ElementalMatrix<F>& x )
   ( ElementalMatrix<F>& chi, ElementalMatrix<F>& x );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -42,6 +42,142 @@ void Overwrite
     cholesky::SolveAfter( uplo, orientation, A, B );
 }
 
+// Factor in the lower precision and refine with GMRES-IR
+template<typename F>
+void MixedPrecision
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("hpd_solve::MixedPrecision"))
+    typedef Demote<F> FLow;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    // Since A is Hermitian, A^T = conj(A) is applied as conj(A conj(X))
+    Matrix<F> XConj;
+    Matrix<FLow> WLow;
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+        if( orientation == TRANSPOSE )
+        {
+            XConj = X;
+            Conjugate( XConj );
+            Conjugate( Y );
+            Hemv( uplo, Conj(alpha), A, XConj, Conj(beta), Y );
+            Conjugate( Y );
+        }
+        else
+            Hemv( uplo, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        Copy( W, WLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, WLow );
+        Copy( WLow, W );
+      };
+
+    // Only overwrite B if the refinement succeeds for every column
+    Matrix<F> X( B );
+    GMRESIR
+    ( applyA, precond, X, HermitianInfinityNorm(uplo,A),
+      ctrl.relTol, ctrl.innerRelTol,
+      ctrl.restart, ctrl.maxIts, ctrl.maxRefineIts, ctrl.progress );
+    B = X;
+}
+
+template<typename F>
+void MixedPrecision
+( UpperOrLower uplo,
+  Orientation orientation,
+  const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("hpd_solve::MixedPrecision"))
+    typedef Demote<F> FLow;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<FLow> ALow(g);
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    // The iterates are kept in a [VC,STAR] distribution aligned with A, so
+    // that each column of A X only requires the [MC,STAR] and [MR,STAR]
+    // gathers of x and the contractions of the local products (as within
+    // Hemv), while the preconditioner stages its input through a single
+    // low-precision vector.
+    //
+    // Since A is Hermitian, A^T = conj(A) is applied as conj(A conj(X))
+    const Int n = A.Height();
+    DistMatrix<F,MC,STAR> x_MC_STAR(g), z_MC_STAR(g);
+    DistMatrix<F,MR,STAR> x_MR_STAR(g), z_MR_STAR(g);
+    DistMatrix<F,VR,STAR> z_VR_STAR(g);
+    DistMatrix<F,VC,STAR> z_VC_STAR(g);
+    x_MC_STAR.AlignWith( A );
+    z_MC_STAR.AlignWith( A );
+    x_MR_STAR.AlignWith( A );
+    z_MR_STAR.AlignWith( A );
+    z_VR_STAR.AlignWith( A );
+    z_VC_STAR.AlignWith( A );
+    auto applyA =
+      [&]( F alpha, const DistMatrix<F,VC,STAR>& X,
+           F beta,        DistMatrix<F,VC,STAR>& Y )
+      {
+        const bool transpose = ( orientation == TRANSPOSE );
+        Y *= beta;
+        for( Int j=0; j<X.Width(); ++j )
+        {
+            x_MC_STAR = X( ALL, IR(j) );
+            if( transpose )
+                Conjugate( x_MC_STAR );
+            x_MR_STAR = x_MC_STAR;
+            Zeros( z_MC_STAR, n, 1 );
+            Zeros( z_MR_STAR, n, 1 );
+            symv::LocalColAccumulate
+            ( uplo, transpose ? Conj(alpha) : alpha, A,
+              x_MC_STAR, x_MR_STAR, z_MC_STAR, z_MR_STAR, true );
+
+            Zeros( z_VR_STAR, n, 1 );
+            AxpyContract( F(1), z_MR_STAR, z_VR_STAR );
+            z_VC_STAR = z_VR_STAR;
+            AxpyContract( F(1), z_MC_STAR, z_VC_STAR );
+            if( transpose )
+                Conjugate( z_VC_STAR );
+            auto y = Y( ALL, IR(j) );
+            y += z_VC_STAR;
+        }
+      };
+    DistMatrix<FLow> WLow(g);
+    WLow.AlignWith( ALow );
+    auto precond =
+      [&]( DistMatrix<F,VC,STAR>& W )
+      {
+        Copy( W, WLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, WLow );
+        Copy( WLow, W );
+      };
+
+    // Only overwrite B if the refinement succeeds for every column
+    DistMatrix<F,VC,STAR> X(g);
+    X.AlignWith( A );
+    Copy( B, X );
+    GMRESIR
+    ( applyA, precond, X, HermitianInfinityNorm(uplo,A),
+      ctrl.relTol, ctrl.innerRelTol,
+      ctrl.restart, ctrl.maxIts, ctrl.maxRefineIts, ctrl.progress );
+    Copy( X, B );
+}
+
 } // namespace hpd_solve
 
 template<typename F>
@@ -49,9 +185,25 @@ void HPDSolve
 ( UpperOrLower uplo,
   Orientation orientation, 
   const Matrix<F>& A,
-        Matrix<F>& B )
+        Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HPDSolve"))
+    if( ctrl.mixedPrecision )
+    {
+        try
+        {
+            hpd_solve::MixedPrecision( uplo, orientation, A, B, ctrl );
+            return;
+        }
+        catch( const RefinementFailureException& )
+        {
+            if( !ctrl.fallback )
+                throw;
+            if( ctrl.progress )
+                Output("Mixed-precision solve failed; refactoring");
+        }
+    }
     Matrix<F> ACopy( A );
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
@@ -61,9 +213,25 @@ void HPDSolve
 ( UpperOrLower uplo,
   Orientation orientation, 
   const ElementalMatrix<F>& A,
-        ElementalMatrix<F>& B )
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HPDSolve"))
+    if( ctrl.mixedPrecision )
+    {
+        try
+        {
+            hpd_solve::MixedPrecision( uplo, orientation, A, B, ctrl );
+            return;
+        }
+        catch( const RefinementFailureException& )
+        {
+            if( !ctrl.fallback )
+                throw;
+            if( ctrl.progress && A.Grid().Rank() == 0 )
+                Output("Mixed-precision solve failed; refactoring");
+        }
+    }
     DistMatrix<F> ACopy( A );
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
@@ -129,10 +297,12 @@ void HPDSolve
     ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
-    const Matrix<F>& A, Matrix<F>& B ); \
+    const Matrix<F>& A, Matrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
-    const ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
+    const ElementalMatrix<F>& A, ElementalMatrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void HPDSolve \
   ( const SparseMatrix<F>& A, Matrix<F>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
@@ -204,12 +204,123 @@ void Overwrite
     }
 }
 
+// Factor in the lower precision and refine with GMRES-IR
+template<typename F>
+void MixedPrecision
+( const Matrix<F>& A,
+        Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lin_solve::MixedPrecision"))
+    typedef Demote<F> FLow;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+
+    Matrix<FLow> WLow;
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+        Gemv( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        Copy( W, WLow );
+        lu::SolveAfter( NORMAL, ALow, P, WLow );
+        Copy( WLow, W );
+      };
+
+    // Only overwrite B if the refinement succeeds for every column
+    Matrix<F> X( B );
+    GMRESIR
+    ( applyA, precond, X, InfinityNorm(A), ctrl.relTol, ctrl.innerRelTol,
+      ctrl.restart, ctrl.maxIts, ctrl.maxRefineIts, ctrl.progress );
+    B = X;
+}
+
+template<typename F>
+void MixedPrecision
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lin_solve::MixedPrecision"))
+    typedef Demote<F> FLow;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<FLow> ALow(g);
+    Copy( A, ALow );
+    DistPermutation P(g);
+    LU( ALow, P );
+
+    // The iterates are kept in a [VC,STAR] distribution aligned with A, so
+    // that applying A only requires the [MR,STAR] gather of the input and the
+    // reduce-scatter of the local products (as within Gemv), while the
+    // preconditioner stages its input through a single low-precision vector
+    DistMatrix<F,MR,STAR> X_MR_STAR(g);
+    DistMatrix<F,MC,STAR> Z_MC_STAR(g);
+    X_MR_STAR.AlignWith( A );
+    Z_MC_STAR.AlignWith( A );
+    auto applyA =
+      [&]( F alpha, const DistMatrix<F,VC,STAR>& X,
+           F beta,        DistMatrix<F,VC,STAR>& Y )
+      {
+        X_MR_STAR = X;
+        Zeros( Z_MC_STAR, A.Height(), X.Width() );
+        LocalGemm( NORMAL, NORMAL, alpha, A, X_MR_STAR, F(0), Z_MC_STAR );
+        Y *= beta;
+        AxpyContract( F(1), Z_MC_STAR, Y );
+      };
+    DistMatrix<FLow> WLow(g);
+    WLow.AlignWith( ALow );
+    auto precond =
+      [&]( DistMatrix<F,VC,STAR>& W )
+      {
+        Copy( W, WLow );
+        lu::SolveAfter( NORMAL, ALow, P, WLow );
+        Copy( WLow, W );
+      };
+
+    // Only overwrite B if the refinement succeeds for every column
+    DistMatrix<F,VC,STAR> X(g);
+    X.AlignWith( A );
+    Copy( B, X );
+    GMRESIR
+    ( applyA, precond, X, InfinityNorm(A), ctrl.relTol, ctrl.innerRelTol,
+      ctrl.restart, ctrl.maxIts, ctrl.maxRefineIts, ctrl.progress );
+    Copy( X, B );
+}
+
 } // namespace lin_solve
 
 template<typename F> 
-void LinearSolve( const Matrix<F>& A, Matrix<F>& B )
+void LinearSolve
+( const Matrix<F>& A,
+        Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LinearSolve"))
+    if( ctrl.mixedPrecision )
+    {
+        try
+        {
+            lin_solve::MixedPrecision( A, B, ctrl );
+            return;
+        }
+        catch( const RefinementFailureException& )
+        {
+            if( !ctrl.fallback )
+                throw;
+            if( ctrl.progress )
+                Output("Mixed-precision solve failed; refactoring");
+        }
+    }
     Matrix<F> ACopy( A );
     lin_solve::Overwrite( ACopy, B );
 }
@@ -217,9 +328,25 @@ void LinearSolve( const Matrix<F>& A, Matrix<F>& B )
 template<typename F> 
 void LinearSolve
 ( const ElementalMatrix<F>& A,
-        ElementalMatrix<F>& B )
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CSE cse("LinearSolve"))
+    if( ctrl.mixedPrecision )
+    {
+        try
+        {
+            lin_solve::MixedPrecision( A, B, ctrl );
+            return;
+        }
+        catch( const RefinementFailureException& )
+        {
+            if( !ctrl.fallback )
+                throw;
+            if( ctrl.progress && A.Grid().Rank() == 0 )
+                Output("Mixed-precision solve failed; refactoring");
+        }
+    }
     DistMatrix<F> ACopy( A );
     lin_solve::Overwrite( ACopy, B );
 }
@@ -280,14 +407,20 @@ void LinearSolve
     B = X;
 }
 
-#define PROTO(F) \
+#define PROTO_DENSE(F) \
   template void lin_solve::Overwrite( Matrix<F>& A, Matrix<F>& B ); \
   template void lin_solve::Overwrite \
   ( ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
-  template void LinearSolve( const Matrix<F>& A, Matrix<F>& B ); \
+  template void LinearSolve \
+  ( const Matrix<F>& A, Matrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const ElementalMatrix<F>& A, \
-          ElementalMatrix<F>& B ); \
+          ElementalMatrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl );
+
+#define PROTO(F) \
+  PROTO_DENSE(F) \
   template void LinearSolve \
   ( const DistMatrix<F,MC,MR,BLOCK>& A, \
           DistMatrix<F,MC,MR,BLOCK>& B ); \
@@ -298,7 +431,14 @@ void LinearSolve
   ( const DistSparseMatrix<F>& A, DistMultiVec<F>& B, \
     const LeastSquaresCtrl<Base<F>>& ctrl );
 
+// Only the dense solvers (which are amenable to mixed-precision refinement)
+// are instantiated for the double-double and quad-double types
+#define PROTO_DOUBLEDOUBLE PROTO_DENSE(DoubleDouble)
+#define PROTO_QUADDOUBLE PROTO_DENSE(QuadDouble)
+
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
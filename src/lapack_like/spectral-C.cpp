@@ -34,6 +34,18 @@ ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
     return EL_SUCCESS;
 }
 
+/* HermitianDCCtrl */
+ElError ElHermitianDCCtrlDefault_s( ElHermitianDCCtrl_s* ctrl )
+{
+    ctrl->cutoff = 64;
+    return EL_SUCCESS;
+}
+ElError ElHermitianDCCtrlDefault_d( ElHermitianDCCtrl_d* ctrl )
+{
+    ctrl->cutoff = 64;
+    return EL_SUCCESS;
+}
+
 /* HermitianEigSubset */
 ElError ElHermitianEigSubsetDefault_s( ElHermitianEigSubset_s* subset )
 {
@@ -61,28 +73,36 @@ ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl )
 {
     ElHermitianTridiagCtrlDefault_s( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+    ElHermitianDCCtrlDefault_s( &ctrl->dcCtrl );
     ctrl->useSDC = false;
+    ctrl->useDC = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
 {
     ElHermitianTridiagCtrlDefault_d( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+    ElHermitianDCCtrlDefault_d( &ctrl->dcCtrl );
     ctrl->useSDC = false;
+    ctrl->useDC = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_c( ElHermitianEigCtrl_c* ctrl )
 {
     ElHermitianTridiagCtrlDefault_c( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+    ElHermitianDCCtrlDefault_s( &ctrl->dcCtrl );
     ctrl->useSDC = false;
+    ctrl->useDC = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_z( ElHermitianEigCtrl_z* ctrl )
 {
     ElHermitianTridiagCtrlDefault_z( &ctrl->tridiagCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+    ElHermitianDCCtrlDefault_d( &ctrl->dcCtrl );
     ctrl->useSDC = false;
+    ctrl->useDC = false;
     return EL_SUCCESS;
 }
 
@@ -124,6 +144,10 @@ ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl )
     ctrl->distAED = false;
     ctrl->blockHeight = DefaultBlockHeight();
     ctrl->blockWidth = DefaultBlockWidth();
+    ctrl->scalapack = false;
+    ctrl->minMultiBulgeSize = 256;
+    ctrl->numShifts = 0;
+    ctrl->deflationSize = 0;
     return EL_SUCCESS;
 }
 
@@ -189,6 +189,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion region( "HermitianEig" );
     const Int n = A.Height();
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -241,6 +242,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion region( "HermitianEig" );
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
 
@@ -277,7 +279,19 @@ void HermitianEig
     }
    
     // Tridiagonalize A
-    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
+    DistMatrix<Base<F>,STAR,STAR> d(A.Grid()), e(A.Grid());
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        DistMatrix<F,STAR,STAR> t(A.Grid());
+        herm_tridiag::TwoStage( uplo, A, t, d, e, ctrl.tridiagCtrl );
+    }
+    else
+    {
+        herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
+        const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        GetRealPartOfDiagonal( A, d );
+        GetRealPartOfDiagonal( A, e, subdiagonal );
+    }
 
     if( ctrl.timeStages )
     {
@@ -290,10 +304,10 @@ void HermitianEig
     }
 
     // Solve the symmetric tridiagonal EVP
-    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-    auto d = GetRealPartOfDiagonal(A);
-    auto e = GetRealPartOfDiagonal(A,subdiagonal);
-    HermitianTridiagEig( d, e, w, sort, subset );
+    if( ctrl.useDC )
+        HermitianTridiagEigDC( d, e, w, sort, subset );
+    else
+        HermitianTridiagEig( d, e, w, sort, subset );
 
     if( ctrl.timeStages )
     {
@@ -315,6 +329,7 @@ void HermitianEig
   const HermitianEigSubset<Base<F>> subset )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion region( "HermitianEig" );
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
 
@@ -430,6 +445,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion region( "HermitianEig" );
     const Int n = A.Height();
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -495,6 +511,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion region( "HermitianEig" );
     typedef Base<F> Real;
     const Int n = APre.Height();
     if( APre.Height() != APre.Width() )
@@ -536,8 +553,16 @@ void HermitianEig
 
     // Tridiagonalize A
     const Grid& g = A.Grid();
+    const bool twoStage = ctrl.tridiagCtrl.twoStage;
     DistMatrix<F,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
+    DistMatrix<F,STAR,VR> V2(g);
+    DistMatrix<F,VR,STAR> t2(g);
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(g), eTwoStage(g);
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, t, d_STAR_STAR, eTwoStage, V2, t2, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
 
     if( ctrl.timeStages )
     {
@@ -549,31 +574,19 @@ void HermitianEig
         }
     }
 
-    Int kEst;
-    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-    auto d = GetRealPartOfDiagonal(A);
-    auto e = GetRealPartOfDiagonal(A,subdiagonal);
-    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d );
     DistMatrix<Real,STAR,STAR> e_STAR_STAR( g );
     e_STAR_STAR.Resize( n-1, 1, n );
-    e_STAR_STAR = e;
-    if( subset.rangeSubset )
+    if( twoStage )
     {
-        // Get an upper-bound on the number of local eigenvalues in the range
-        kEst = HermitianTridiagEigEstimate
-          ( d, e, g.VRComm(), subset.lowerBound, subset.upperBound );
+        e_STAR_STAR = eTwoStage;
     }
-    else if( subset.indexSubset )
-        kEst = subset.upperIndex-subset.lowerIndex+1;
     else
-        kEst = n;
-
-    // We will use the same buffer for Z in the vector distribution used by 
-    // PMRRR as for the matrix distribution used by Elemental. In order to 
-    // do so, we must pad Z's dimensions slightly.
-    const Int N = MaxLength(n,g.Height())*g.Height();
-    const Int K = MaxLength(kEst,g.Size())*g.Size(); 
-
+    {
+        const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        d_STAR_STAR = GetRealPartOfDiagonal(A);
+        e_STAR_STAR = GetRealPartOfDiagonal(A,subdiagonal);
+    }
+    // PMRRR requires Z to be aligned with the origin
     ElementalProxyCtrl proxCtrl;
     proxCtrl.colConstrain = true;
     proxCtrl.rowConstrain = true;
@@ -583,29 +596,61 @@ void HermitianEig
     DistMatrixWriteProxy<F,F,MC,MR> ZProx( ZPre, proxCtrl );
     auto& Z = ZProx.Get();
 
-    Z.Resize( N, K );
+    DistMatrix<Real,VC,STAR> Z_VC_STAR(g);
     DistMatrix<Real,STAR,VR> Z_STAR_VR(g);
+    Int K=0;
+    if( ctrl.useDC )
     {
-        // Grab a slice of size Z_STAR_VR_BufferSize from the very end
-        // of ZBuf so that we can later redistribute in place
-        Real* ZBuf = (Real*)Z.Buffer();
-        const Int ZBufSize =
-            ( IsComplex<F>::value ? 2*Z.LDim()*Z.LocalWidth()
-                                  :   Z.LDim()*Z.LocalWidth() );
-        const Int Z_STAR_VR_LocalWidth = Length(kEst,g.VRRank(),g.Size());
-        const Int Z_STAR_VR_BufSize = n*Z_STAR_VR_LocalWidth;
-        Real* Z_STAR_VR_Buf = &ZBuf[ZBufSize-Z_STAR_VR_BufSize];
-        Z_STAR_VR.Attach( n, kEst, g, 0, 0, Z_STAR_VR_Buf, n );
-    }
-    // NOTE: We should be guaranteeing that Z_STAR_VR does not need to
-    //       reallocate a buffer
-    if( subset.rangeSubset )
-        HermitianTridiagEigPostEstimate
-        ( d_STAR_STAR, e_STAR_STAR, w, Z_STAR_VR, UNSORTED,
-          subset.lowerBound, subset.upperBound );
+        HermitianTridiagEigDC
+        ( d_STAR_STAR, e_STAR_STAR, w, Z_VC_STAR, UNSORTED, subset,
+          ctrl.dcCtrl );
+    }
     else
-        HermitianTridiagEig
-        ( d_STAR_STAR, e_STAR_STAR, w, Z_STAR_VR, UNSORTED, subset );
+    {
+        Int kEst;
+        if( subset.rangeSubset )
+        {
+            // Get an upper-bound on the number of local eigenvalues in the
+            // range
+            kEst = HermitianTridiagEigEstimate
+              ( d_STAR_STAR, e_STAR_STAR, g.VRComm(),
+                subset.lowerBound, subset.upperBound );
+        }
+        else if( subset.indexSubset )
+            kEst = subset.upperIndex-subset.lowerIndex+1;
+        else
+            kEst = n;
+
+        // We will use the same buffer for Z in the vector distribution used
+        // by PMRRR as for the matrix distribution used by Elemental. In order
+        // to do so, we must pad Z's dimensions slightly.
+        const Int N = MaxLength(n,g.Height())*g.Height();
+        K = MaxLength(kEst,g.Size())*g.Size(); 
+
+        Z.Resize( N, K );
+        {
+            // Grab a slice of size Z_STAR_VR_BufferSize from the very end
+            // of ZBuf so that we can later redistribute in place
+            Real* ZBuf = (Real*)Z.Buffer();
+            const Int ZBufSize =
+                ( IsComplex<F>::value ? 2*Z.LDim()*Z.LocalWidth()
+                                      :   Z.LDim()*Z.LocalWidth() );
+            const Int Z_STAR_VR_LocalWidth =
+              Length(kEst,g.VRRank(),g.Size());
+            const Int Z_STAR_VR_BufSize = n*Z_STAR_VR_LocalWidth;
+            Real* Z_STAR_VR_Buf = &ZBuf[ZBufSize-Z_STAR_VR_BufSize];
+            Z_STAR_VR.Attach( n, kEst, g, 0, 0, Z_STAR_VR_Buf, n );
+        }
+        // NOTE: We should be guaranteeing that Z_STAR_VR does not need to
+        //       reallocate a buffer
+        if( subset.rangeSubset )
+            HermitianTridiagEigPostEstimate
+            ( d_STAR_STAR, e_STAR_STAR, w, Z_STAR_VR, UNSORTED,
+              subset.lowerBound, subset.upperBound );
+        else
+            HermitianTridiagEig
+            ( d_STAR_STAR, e_STAR_STAR, w, Z_STAR_VR, UNSORTED, subset );
+    }
 
     if( ctrl.timeStages )
     {
@@ -617,16 +662,21 @@ void HermitianEig
         }
     }
 
-    const Int k = w.Height();
+    if( ctrl.useDC )
+    {
+        Copy( Z_VC_STAR, Z );
+    }
+    else
     {
-        // Redistribute Z piece-by-piece in place. This is to keep the 
+        // Redistribute Z piece-by-piece in place. This is to keep the
         // send/recv buffer memory usage low.
+        const Int k = w.Height();
         const Int p = g.Size();
         const Int numEqualPanels = K/p;
         const Int numPanelsPerComm = (numEqualPanels / TARGET_CHUNKS) + 1;
         const Int nbProp = numPanelsPerComm*p;
 
-        // Manually maintain information about the implicit Z[* ,VR] stored 
+        // Manually maintain information about the implicit Z[* ,VR] stored
         // at the end of the Z[MC,MR] buffers.
         Int alignment = 0;
         const Real* readBuffer = Z_STAR_VR.LockedBuffer();
@@ -645,8 +695,8 @@ void HermitianEig
             readBuffer = &readBuffer[localWidth*n];
             alignment = (alignment+nb) % p;
         }
+        Z.Resize( n, k ); // We can simply shrink matrices
     }
-    Z.Resize( n, k ); // We can simply shrink matrices
 
     if( ctrl.timeStages )
     {
@@ -659,7 +709,10 @@ void HermitianEig
     }
 
     // Backtransform the tridiagonal eigenvectors, Z
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
+    if( twoStage )
+        herm_tridiag::ApplyTwoStageQ( A, t, V2, t2, Z );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
 
     if( ctrl.timeStages )
     {
@@ -694,6 +747,7 @@ void HermitianEig
   const HermitianEigSubset<Base<F>> subset )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion region( "HermitianEig" );
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
 
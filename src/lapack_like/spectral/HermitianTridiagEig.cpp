@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./HermitianTridiagEig/Sort.hpp"
+#include "./HermitianTridiagEig/DC.hpp"
 
 // NOTE: dSubReal and ZReal could be packed into their complex counterparts
 
@@ -576,6 +577,153 @@ void HermitianTridiagEigPostEstimate
     herm_eig::Sort( w, Z, sort );
 }
 
+// Divide and conquer
+// ==================
+
+template<typename F>
+void HermitianTridiagEigDC
+( const ElementalMatrix<Base<F>>& d,
+  const ElementalMatrix<F>& dSub,
+        ElementalMatrix<Base<F>>& w,
+        SortType sort,
+  const HermitianEigSubset<Base<F>>& subset )
+{
+    DEBUG_ONLY(CSE cse("HermitianTridiagEigDC"))
+    // Without eigenvectors there is nothing to merge, and, as in LAPACK's
+    // divide-and-conquer driver, the eigenvalues are computed directly in the
+    // working precision. Rather than each process redundantly computing the
+    // entire spectrum, each computes a contiguous block of the requested
+    // eigenvalues by bisection, and the blocks are then gathered.
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d ), w_STAR_STAR( g );
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR( dSub );
+    if( g.InGrid() )
+    {
+        vector<Real> dVec(n), dSubReal(Max(n-1,Int(0)));
+        for( Int j=0; j<n; ++j )
+            dVec[j] = d_STAR_STAR.GetLocal(j,0);
+        for( Int j=0; j<n-1; ++j )
+            dSubReal[j] = Abs(dSub_STAR_STAR.GetLocal(j,0));
+
+        // Convert the requested subset into the range of (ascending) indices
+        // [jBeg,jEnd), where a range subset is the half-open interval
+        // (lowerBound,upperBound]
+        Int jBeg=0, jEnd=n;
+        if( subset.indexSubset )
+        {
+            jBeg = subset.lowerIndex;
+            jEnd = subset.upperIndex+1;
+        }
+        else if( subset.rangeSubset )
+        {
+            jBeg = herm_tridiag_eig::dc::NumEigAtMost
+              ( dVec, dSubReal, subset.lowerBound );
+            jEnd = herm_tridiag_eig::dc::NumEigAtMost
+              ( dVec, dSubReal, subset.upperBound );
+        }
+        const Int k = Max( jEnd-jBeg, Int(0) );
+
+        const int commSize = g.Size();
+        const int commRank = g.VCRank();
+        vector<int> counts(commSize), offsets;
+        for( int q=0; q<commSize; ++q )
+            counts[q] = ((q+1)*k)/commSize - (q*k)/commSize;
+        Scan( counts, offsets );
+        const Int localBeg = jBeg + offsets[commRank];
+        const Int localSize = counts[commRank];
+
+        // LAPACK overwrites the diagonal and subdiagonal
+        vector<Real> wLoc(localSize);
+        if( localSize > 0 )
+            lapack::SymmetricTridiagEig
+            ( BlasInt(n), dVec.data(), dSubReal.data(), wLoc.data(),
+              BlasInt(localBeg), BlasInt(localBeg+localSize-1) );
+
+        w_STAR_STAR.Resize( k, 1 );
+        mpi::AllGather
+        ( wLoc.data(), localSize,
+          w_STAR_STAR.Buffer(), counts.data(), offsets.data(), g.VCComm() );
+        Sort( w_STAR_STAR.Matrix(), sort );
+    }
+    Copy( w_STAR_STAR, w );
+}
+
+template<typename F>
+void HermitianTridiagEigDC
+( const ElementalMatrix<Base<F>>& d,
+  const ElementalMatrix<F>& dSub,
+        ElementalMatrix<Base<F>>& w,
+        ElementalMatrix<F>& Z,
+        SortType sort,
+  const HermitianEigSubset<Base<F>>& subset,
+  const HermitianDCCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("HermitianTridiagEigDC"))
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+
+    // Make the subdiagonal real and nonnegative with the unitary diagonal
+    // similarity transformation diag(y)
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d );
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR( dSub );
+    vector<Real> dVec(n), dSubReal(Max(n-1,Int(0))), wVec;
+    vector<F> y(n);
+    for( Int j=0; j<n; ++j )
+        dVec[j] = d_STAR_STAR.GetLocal(j,0);
+    if( n > 0 )
+        y[0] = 1;
+    for( Int j=0; j<n-1; ++j )
+    {
+        const F psi = dSub_STAR_STAR.GetLocal(j,0);
+        const Real psiAbs = Abs(psi);
+        y[j+1] = ( psiAbs == Real(0) ? F(1) : (psi/psiAbs)*y[j] );
+        dSubReal[j] = psiAbs;
+    }
+
+    DistMatrix<Real,VC,STAR> ZReal(g);
+    herm_tridiag_eig::dc::DivideAndConquer( dVec, dSubReal, wVec, ZReal, ctrl );
+
+    // Extract the requested subset of the (ascending) eigenpairs
+    Int jBeg=0, jEnd=n;
+    if( subset.indexSubset )
+    {
+        jBeg = subset.lowerIndex;
+        jEnd = subset.upperIndex+1;
+    }
+    else if( subset.rangeSubset )
+    {
+        // The eigenvalues in the half-open interval (lowerBound,upperBound]
+        jBeg = std::upper_bound
+          ( wVec.begin(), wVec.end(), subset.lowerBound ) - wVec.begin();
+        jEnd = std::upper_bound
+          ( wVec.begin(), wVec.end(), subset.upperBound ) - wVec.begin();
+    }
+    const Int k = Max( jEnd-jBeg, Int(0) );
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( k, 1, g );
+    for( Int j=0; j<k; ++j )
+        w_STAR_STAR.SetLocal( j, 0, wVec[jBeg+j] );
+    DistMatrix<F,VC,STAR> Z_VC_STAR(g);
+    Z_VC_STAR.AlignWith( ZReal );
+    Z_VC_STAR.Resize( n, k );
+    for( Int j=0; j<k; ++j )
+        for( Int iLoc=0; iLoc<Z_VC_STAR.LocalHeight(); ++iLoc )
+        {
+            const Int i = Z_VC_STAR.GlobalRow(iLoc);
+            Z_VC_STAR.SetLocal( iLoc, j, y[i]*ZReal.GetLocal(iLoc,jBeg+j) );
+        }
+
+    herm_eig::Sort( w_STAR_STAR, Z_VC_STAR, sort );
+    Copy( w_STAR_STAR, w );
+    Copy( Z_VC_STAR, Z );
+}
+
 #define PROTO(F) \
   template void herm_eig::Sort \
   ( Matrix<Base<F>>& w, \
@@ -610,7 +758,21 @@ void HermitianTridiagEigPostEstimate
           ElementalMatrix<Base<F>>& w, \
           ElementalMatrix<F>& Z, \
           SortType sort, \
-    const HermitianEigSubset<Base<F>>& subset );
+    const HermitianEigSubset<Base<F>>& subset ); \
+  template void HermitianTridiagEigDC \
+  ( const ElementalMatrix<Base<F>>& d, \
+    const ElementalMatrix<F>& dSub, \
+          ElementalMatrix<Base<F>>& w, \
+          SortType sort, \
+    const HermitianEigSubset<Base<F>>& subset ); \
+  template void HermitianTridiagEigDC \
+  ( const ElementalMatrix<Base<F>>& d, \
+    const ElementalMatrix<F>& dSub, \
+          ElementalMatrix<Base<F>>& w, \
+          ElementalMatrix<F>& Z, \
+          SortType sort, \
+    const HermitianEigSubset<Base<F>>& subset, \
+    const HermitianDCCtrl<Base<F>>& ctrl );
 
 #define PROTO_REAL(Real) \
   PROTO(Real) \
@@ -0,0 +1,441 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAGEIG_DC_HPP
+#define EL_HERMITIANTRIDIAGEIG_DC_HPP
+
+// Cuppen's divide and conquer for real symmetric tridiagonal matrices:
+//
+//   T = | T1 0  | + rho v v^T,  v = [e_last; sgn(rho) e_first],
+//       | 0  T2 |
+//
+// where the last diagonal entry of T1 and the first of T2 were reduced by
+// |rho|. Given T1 = Q1 D1 Q1^T and T2 = Q2 D2 Q2^T, the eigenvectors of T are
+// diag(Q1,Q2) U, where U are the eigenvectors of the rank-one modification
+// D + |rho| z z^T, with z = diag(Q1,Q2)^T v. Components of z which are
+// negligible, and pairs of nearly-equal entries of D, are deflated as in
+// LAPACK's [sd]laed2, the roots of the secular equation are found in the
+// working precision, and the Gu/Eisenstat recomputation of z keeps the
+// columns of U numerically orthogonal.
+//
+// The eigenvectors are stored in a [VC,* ] distribution so that the
+// deflating rotations and permutations of columns are purely local and each
+// merge is a local Level 3 update of the owned rows; the only communication
+// is a few length-k summations per merge. The roots of each secular equation
+// are divided cyclically amongst the processes, and the leaf subproblems are
+// (cheaply) solved redundantly by LAPACK.
+
+namespace El {
+namespace herm_tridiag_eig {
+namespace dc {
+
+// Returns the root of
+//
+//   f(lambda) = 1/beta + sum_i z_i^2 / (d_i - lambda)
+//
+// lying in (d_j,d_{j+1}) (or in (d_{k-1},d_{k-1}+beta z^T z) if j=k-1) as
+// lambda = d_origin + tau, so that the differences d_i - lambda may be
+// formed accurately as (d_i-d_origin)-tau
+template<typename Real>
+void SecularRoot
+( Int j, Int k, const Real* d, const Real* z, Real beta, Real zNormSq,
+  Int& origin, Real& tau )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::dc::SecularRoot"))
+    const Real eps = Epsilon<Real>();
+    const Real betaInv = Real(1)/beta;
+    const bool last = ( j == k-1 );
+
+    Real lo, hi;
+    if( last )
+    {
+        origin = j;
+        lo = 0;
+        hi = beta*zNormSq;
+    }
+    else
+    {
+        // Shift the origin to the pole nearest the root
+        const Real halfGap = (d[j+1]-d[j])/2;
+        Real fMid = betaInv;
+        for( Int i=0; i<k; ++i )
+            fMid += z[i]*z[i] / ((d[i]-d[j])-halfGap);
+        if( fMid >= Real(0) )
+        {
+            origin = j;
+            lo = 0;
+            hi = halfGap;
+        }
+        else
+        {
+            origin = j+1;
+            lo = -halfGap;
+            hi = 0;
+        }
+    }
+
+    const Real dOrigin = d[origin];
+    tau = (lo+hi)/2;
+    Real fAbsPrev = std::numeric_limits<Real>::max();
+    const Int maxIts = 200;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // Evaluate the pieces of f (and their derivatives) with poles at or
+        // below d_j and above d_j
+        Real psi=0, psiDeriv=0, phi=0, phiDeriv=0;
+        for( Int i=0; i<=j; ++i )
+        {
+            const Real temp = z[i] / ((d[i]-dOrigin)-tau);
+            psi += z[i]*temp;
+            psiDeriv += temp*temp;
+        }
+        for( Int i=j+1; i<k; ++i )
+        {
+            const Real temp = z[i] / ((d[i]-dOrigin)-tau);
+            phi += z[i]*temp;
+            phiDeriv += temp*temp;
+        }
+        const Real f = betaInv + psi + phi;
+        const Real fAbs = Abs(f);
+        if( fAbs <= 8*k*eps*(betaInv+Abs(psi)+Abs(phi)) )
+            break;
+        if( f < Real(0) )
+            lo = tau;
+        else
+            hi = tau;
+        if( hi-lo <= 2*eps*Max(Abs(lo),Abs(hi)) )
+            break;
+
+        // Interpolate psi and phi with simple poles at d_j and d_{j+1}
+        // (Bunch, Nielsen, and Sorensen) and solve for the step
+        const Real a = (d[j]-dOrigin)-tau;
+        Real eta;
+        bool haveStep = true;
+        if( last )
+        {
+            const Real c = betaInv + psi - a*psiDeriv;
+            if( c > Real(0) )
+                eta = a + a*a*psiDeriv/c;
+            else
+                haveStep = false;
+        }
+        else
+        {
+            const Real b = (d[j+1]-dOrigin)-tau;
+            const Real s = a*a*psiDeriv;
+            const Real S = b*b*phiDeriv;
+            const Real c = f - a*psiDeriv - b*phiDeriv;
+            // c eta^2 - (c (a+b) + s + S) eta + (c a b + s b + S a) = 0
+            const Real B = c*(a+b) + s + S;
+            const Real C = c*a*b + s*b + S*a;
+            if( c == Real(0) )
+            {
+                if( B != Real(0) )
+                    eta = C / B;
+                else
+                    haveStep = false;
+            }
+            else
+            {
+                const Real disc = Max( B*B-4*c*C, Real(0) );
+                const Real root =
+                  ( B >= Real(0) ? B+Sqrt(disc) : B-Sqrt(disc) );
+                const Real eta0 = root / (2*c);
+                const Real eta1 = ( root != Real(0) ? 2*C/root : eta0 );
+                eta = ( eta0 > a && eta0 < b ? eta0 : eta1 );
+            }
+        }
+
+        // Fall back to bisection if the step leaves the bracket or if the
+        // rational model is not making sufficient progress
+        const Real tauNew = tau + eta;
+        if( haveStep && tauNew > lo && tauNew < hi && fAbs <= fAbsPrev/2 )
+            tau = tauNew;
+        else
+            tau = (lo+hi)/2;
+        fAbsPrev = fAbs;
+    }
+}
+
+template<typename Real>
+void Leaf
+( Int a, Int b, const vector<Real>& d, const vector<Real>& e,
+  vector<Real>& w, Matrix<Real>& ZLoc, Int colShift, Int colStride )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::dc::Leaf"))
+    const Int n = b-a;
+    Matrix<Real> dLeaf( n, 1 ), eLeaf( n, 1 ), wLeaf( n, 1 ), ZLeaf( n, n );
+    for( Int i=0; i<n; ++i )
+        dLeaf.Set( i, 0, d[a+i] );
+    for( Int i=0; i<n-1; ++i )
+        eLeaf.Set( i, 0, e[a+i] );
+    lapack::SymmetricTridiagEig
+    ( BlasInt(n), dLeaf.Buffer(), eLeaf.Buffer(), wLeaf.Buffer(),
+      ZLeaf.Buffer(), BlasInt(ZLeaf.LDim()) );
+    for( Int j=0; j<n; ++j )
+        w[a+j] = wLeaf.Get(j,0);
+
+    // Keep the owned rows
+    const Int iLocBeg = Length(a,colShift,colStride);
+    const Int iLocEnd = Length(b,colShift,colStride);
+    for( Int j=0; j<n; ++j )
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            ZLoc.Set( iLoc, a+j, ZLeaf.Get(colShift+iLoc*colStride-a,j) );
+}
+
+// Merge the eigensystems of the blocks [a,m) and [m,b) of the tridiagonal
+// matrix, which were coupled by 'rho'. On entry, w[a:b) holds the two sets of
+// ascending eigenvalues and ZLoc(:,a:b) the owned rows of the block-diagonal
+// eigenvector matrix; on exit they hold the merged eigensystem.
+template<typename Real>
+void Merge
+( Int a, Int m, Int b, Real rho, vector<Real>& w, Matrix<Real>& ZLoc,
+  Int colShift, Int colStride, int commRank, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::dc::Merge"))
+    const Int n = b-a;
+    const Int n1 = m-a;
+    const Real eps = Epsilon<Real>();
+    const Int iLocBeg = Length(a,colShift,colStride);
+    const Int nLoc = Length(b,colShift,colStride) - iLocBeg;
+    auto ZBlock = ZLoc( IR(iLocBeg,iLocBeg+nLoc), IR(a,b) );
+    Real* ZBuf = ZBlock.Buffer();
+    const Int ZLDim = ZBlock.LDim();
+
+    // Form z from the last row of Q1 and the first row of Q2
+    vector<Real> z( n, Real(0) );
+    if( (m-1) % colStride == colShift )
+    {
+        const Int iLoc = (m-1-colShift)/colStride - iLocBeg;
+        for( Int j=0; j<n1; ++j )
+            z[j] = ZBuf[iLoc+j*ZLDim];
+    }
+    if( m % colStride == colShift )
+    {
+        const Int iLoc = (m-colShift)/colStride - iLocBeg;
+        const Real sgn = ( rho >= Real(0) ? Real(1) : Real(-1) );
+        for( Int j=n1; j<n; ++j )
+            z[j] = sgn*ZBuf[iLoc+j*ZLDim];
+    }
+    mpi::AllReduce( z.data(), n, comm );
+
+    // Since z is the concatenation of two unit vectors, normalizing it
+    // doubles the scalar
+    const Real beta = 2*Abs(rho);
+    const Real zScale = Real(1)/Sqrt(Real(2));
+
+    // Sort the poles and apply the deflation criteria
+    vector<ValueInt<Real>> pairs(n);
+    for( Int j=0; j<n; ++j )
+    {
+        pairs[j].value = w[a+j];
+        pairs[j].index = j;
+    }
+    std::stable_sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+    vector<Real> dSort(n), zSort(n);
+    Real dMax=0, zMax=0;
+    for( Int j=0; j<n; ++j )
+    {
+        dSort[j] = pairs[j].value;
+        zSort[j] = zScale*z[pairs[j].index];
+        dMax = Max( dMax, Abs(dSort[j]) );
+        zMax = Max( zMax, Abs(zSort[j]) );
+    }
+    const Real tol = 8*eps*Max(dMax,zMax);
+    vector<Int> active, deflated;
+    Int prev = -1;
+    for( Int j=0; j<n; ++j )
+    {
+        if( beta*Abs(zSort[j]) <= tol )
+        {
+            deflated.push_back( j );
+            continue;
+        }
+        if( prev >= 0 )
+        {
+            // Rotate away the component of z corresponding to a pole which
+            // is numerically indistinguishable from the previous one
+            const Real tauRot = lapack::SafeNorm( zSort[j], zSort[prev] );
+            const Real c = zSort[j] / tauRot;
+            const Real s = -zSort[prev] / tauRot;
+            if( Abs((dSort[j]-dSort[prev])*c*s) <= tol )
+            {
+                zSort[j] = tauRot;
+                zSort[prev] = 0;
+                if( nLoc > 0 )
+                    blas::Rot
+                    ( nLoc, &ZBuf[pairs[prev].index*ZLDim], 1,
+                            &ZBuf[pairs[j].index*ZLDim], 1, c, s );
+                const Real dPrev = dSort[prev]*c*c + dSort[j]*s*s;
+                dSort[j] = dSort[prev]*s*s + dSort[j]*c*c;
+                dSort[prev] = dPrev;
+                deflated.push_back( prev );
+                prev = j;
+                continue;
+            }
+            active.push_back( prev );
+        }
+        prev = j;
+    }
+    if( prev >= 0 )
+        active.push_back( prev );
+    const Int k = active.size();
+
+    // Solve the (cyclically distributed) secular equations
+    vector<Real> dAct(k), zAct(k), tau(k,Real(0));
+    vector<Int> origin(k,0);
+    Real zNormSq = 0;
+    for( Int j=0; j<k; ++j )
+    {
+        dAct[j] = dSort[active[j]];
+        zAct[j] = zSort[active[j]];
+        zNormSq += zAct[j]*zAct[j];
+    }
+    const int commSize = mpi::Size( comm );
+    for( Int j=commRank; j<k; j+=commSize )
+        SecularRoot
+        ( j, k, dAct.data(), zAct.data(), beta, zNormSq, origin[j], tau[j] );
+    mpi::AllReduce( tau.data(), k, comm );
+    mpi::AllReduce( origin.data(), k, comm );
+
+    // Recompute z so that the computed roots are the exact eigenvalues of a
+    // nearby rank-one modification (Gu and Eisenstat)
+    vector<Real> zHat( k, Real(0) );
+    for( Int i=commRank; i<k; i+=commSize )
+    {
+        Real prod = (tau[i]-(dAct[i]-dAct[origin[i]])) / beta;
+        for( Int j=0; j<k; ++j )
+            if( j != i )
+                prod *= (tau[j]-(dAct[i]-dAct[origin[j]])) / (dAct[j]-dAct[i]);
+        zHat[i] = ( zAct[i] >= Real(0) ? Sqrt(Abs(prod)) : -Sqrt(Abs(prod)) );
+    }
+    mpi::AllReduce( zHat.data(), k, comm );
+
+    // Form the new eigenvectors, with those of the active poles in the
+    // leading k columns, via local panels of
+    //
+    //   ZNew(:,0:k) := Z(:,active) U
+    //
+    Matrix<Real> ZAct( nLoc, k ), ZNew( nLoc, n ), U;
+    for( Int j=0; j<k; ++j )
+        MemCopy
+        ( ZAct.Buffer(0,j), &ZBuf[pairs[active[j]].index*ZLDim], nLoc );
+    const Int bsize = Max( Blocksize(), Int(1) );
+    for( Int jBeg=0; jBeg<k; jBeg+=bsize )
+    {
+        const Int nb = Min(bsize,k-jBeg);
+        U.Resize( k, nb );
+        for( Int jj=0; jj<nb; ++jj )
+        {
+            const Int j = jBeg + jj;
+            const Real dOrigin = dAct[origin[j]];
+            Real* u = U.Buffer(0,jj);
+            for( Int i=0; i<k; ++i )
+                u[i] = zHat[i] / ((dAct[i]-dOrigin)-tau[j]);
+            const Real uNorm = blas::Nrm2( k, u, 1 );
+            blas::Scal( k, Real(1)/uNorm, u, 1 );
+        }
+        auto ZNew1 = ZNew( ALL, IR(jBeg,jBeg+nb) );
+        Gemm( NORMAL, NORMAL, Real(1), ZAct, U, Real(0), ZNew1 );
+    }
+    vector<ValueInt<Real>> eigPairs(n);
+    for( Int j=0; j<k; ++j )
+    {
+        eigPairs[j].value = dAct[origin[j]] + tau[j];
+        eigPairs[j].index = j;
+    }
+    for( Int j=0; j<n-k; ++j )
+    {
+        MemCopy
+        ( ZNew.Buffer(0,k+j), &ZBuf[pairs[deflated[j]].index*ZLDim], nLoc );
+        eigPairs[k+j].value = dSort[deflated[j]];
+        eigPairs[k+j].index = k+j;
+    }
+
+    // Return the eigenpairs in ascending order
+    std::stable_sort
+    ( eigPairs.begin(), eigPairs.end(), ValueInt<Real>::Lesser );
+    for( Int j=0; j<n; ++j )
+    {
+        w[a+j] = eigPairs[j].value;
+        MemCopy( &ZBuf[j*ZLDim], ZNew.LockedBuffer(0,eigPairs[j].index), nLoc );
+    }
+}
+
+template<typename Real>
+void Recurse
+( Int a, Int b, vector<Real>& d, const vector<Real>& e, vector<Real>& w,
+  Matrix<Real>& ZLoc, Int colShift, Int colStride, int commRank,
+  mpi::Comm comm, const HermitianDCCtrl<Real>& ctrl )
+{
+    if( b-a <= Max(ctrl.cutoff,Int(2)) )
+    {
+        Leaf( a, b, d, e, w, ZLoc, colShift, colStride );
+        return;
+    }
+    const Int m = a + (b-a)/2;
+    const Real rho = e[m-1];
+    d[m-1] -= Abs(rho);
+    d[m] -= Abs(rho);
+    Recurse( a, m, d, e, w, ZLoc, colShift, colStride, commRank, comm, ctrl );
+    Recurse( m, b, d, e, w, ZLoc, colShift, colStride, commRank, comm, ctrl );
+    Merge( a, m, b, rho, w, ZLoc, colShift, colStride, commRank, comm );
+}
+
+// Returns the number of eigenvalues of the real symmetric tridiagonal matrix
+// with diagonal d and subdiagonal e which are at most sigma, i.e., the number
+// of nonpositive pivots of the LDL^T factorization of T - sigma I (with tiny
+// pivots perturbed as in LAPACK's xLAEBZ)
+template<typename Real>
+Int NumEigAtMost( const vector<Real>& d, const vector<Real>& e, Real sigma )
+{
+    const Int n = d.size();
+    const Real pivMin = lapack::MachineSafeMin<Real>();
+    Int numEig = 0;
+    Real pivot = 1;
+    for( Int j=0; j<n; ++j )
+    {
+        pivot = d[j] - sigma - ( j>0 ? e[j-1]*e[j-1]/pivot : Real(0) );
+        if( Abs(pivot) < pivMin )
+            pivot = -pivMin;
+        if( pivot <= Real(0) )
+            ++numEig;
+    }
+    return numEig;
+}
+
+// Computes all of the eigenpairs of the real symmetric tridiagonal matrix
+// with diagonal d and subdiagonal e, with the eigenvalues in ascending order
+template<typename Real>
+void DivideAndConquer
+( const vector<Real>& d,
+  const vector<Real>& e,
+        vector<Real>& w,
+        DistMatrix<Real,VC,STAR>& Z,
+  const HermitianDCCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag_eig::dc::DivideAndConquer"))
+    const Int n = d.size();
+    Zeros( Z, n, n );
+    w.resize( n );
+    if( n == 0 )
+        return;
+    if( !Z.Participating() )
+        LogicError("All processes must participate in divide and conquer");
+    vector<Real> dMod( d );
+    Recurse
+    ( Int(0), n, dMod, e, w, Z.Matrix(), Z.ColShift(), Z.ColStride(),
+      Z.DistRank(), Z.DistComm(), ctrl );
+}
+
+} // namespace dc
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAGEIG_DC_HPP
@@ -11,6 +11,7 @@
 #include "./Schur/CheckReal.hpp"
 #include "./Schur/RealToComplex.hpp"
 #include "./Schur/QuasiTriangEig.hpp"
+#include "./Schur/HessenbergQR.hpp"
 #include "./Schur/QR.hpp"
 #include "./Schur/SDC.hpp"
 #include "./Schur/InverseFreeSDC.hpp"
@@ -62,7 +63,6 @@ void Schur
   const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Schur"))
-#ifdef EL_HAVE_SCALAPACK
     if( ctrl.useSDC )
     {
         if( fullTriangle )
@@ -74,18 +74,7 @@ void Schur
             schur::SDC( A, w, ctrl.sdcCtrl );
     }
     else
-    {
         schur::QR( A, w, fullTriangle, ctrl.qrCtrl );
-    }
-#else
-    if( fullTriangle )
-    {
-        DistMatrix<F> Q(A.Grid());
-        schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
-    }
-    else
-        schur::SDC( A, w, ctrl.sdcCtrl );
-#endif
 }
 
 template<typename F>
@@ -108,14 +97,10 @@ void Schur
   const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Schur"))
-#ifdef EL_HAVE_SCALAPACK
     if( ctrl.useSDC )
         schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
     else
         schur::QR( A, w, Q, fullTriangle, ctrl.qrCtrl );
-#else
-    schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
-#endif
 }
 
 template<typename F>
@@ -0,0 +1,599 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SCHUR_HESSENBERGQR_HPP
+#define EL_SCHUR_HESSENBERGQR_HPP
+
+namespace El {
+namespace schur {
+
+// The small-bulge multishift QR algorithm with aggressive early deflation
+// (AED) of Braman, Byers, and Mathias, applied directly to an upper
+// Hessenberg matrix in an [MC,MR] distribution.
+//
+// Everything but the level 3 updates is performed redundantly on small
+// diagonal windows which have been gathered into [* ,* ] matrices: the AED
+// window, each of the windows that a chain of bulges is chased through, and
+// any active block which is small enough to be handed to LAPACK. The unitary
+// transformation accumulated within a window is then applied to the rest of
+// the matrix (and to the Schur vectors) with local Gemm's after gathering
+// the affected panels into either [MC,* ] or [* ,MR] distributions.
+
+namespace hess_qr {
+
+template<typename Real>
+inline void FromComplex( const Complex<Real>& alpha, Real& beta )
+{ beta = alpha.real(); }
+
+template<typename Real>
+inline void FromComplex( const Complex<Real>& alpha, Complex<Real>& beta )
+{ beta = alpha; }
+
+// Overwrite x, which is of length m, with [beta; v] and return the tau such
+// that (I - tau [1; v] [1; v]^H) x = beta e_0
+template<typename F>
+inline F MakeReflector( Int m, F* x )
+{
+    Matrix<F> xBot;
+    xBot.Attach( m-1, 1, &x[1], Max(m-1,Int(1)) );
+    return LeftReflector( x[0], xBot );
+}
+
+// Apply I - tau [1; v] [1; v]^H, where v is of length m-1, from the left to
+// rows [i,i+m) and columns [jBeg,jEnd) of A
+template<typename F>
+inline void ApplyLeft
+( Int m, F tau, const F* v, F* A, Int ALDim, Int i, Int jBeg, Int jEnd )
+{
+    for( Int j=jBeg; j<jEnd; ++j )
+    {
+        F* a = &A[i+j*ALDim];
+        F gamma = a[0];
+        for( Int l=1; l<m; ++l )
+            gamma += Conj(v[l-1])*a[l];
+        gamma *= tau;
+        a[0] -= gamma;
+        for( Int l=1; l<m; ++l )
+            a[l] -= v[l-1]*gamma;
+    }
+}
+
+// Apply the adjoint of I - tau [1; v] [1; v]^H from the right to columns
+// [j,j+m) and rows [iBeg,iEnd) of A
+template<typename F>
+inline void ApplyRight
+( Int m, F tau, const F* v, F* A, Int ALDim, Int j, Int iBeg, Int iEnd )
+{
+    const F tauConj = Conj(tau);
+    for( Int i=iBeg; i<iEnd; ++i )
+    {
+        F gamma = A[i+j*ALDim];
+        for( Int l=1; l<m; ++l )
+            gamma += A[i+(j+l)*ALDim]*v[l-1];
+        gamma *= tauConj;
+        A[i+j*ALDim] -= gamma;
+        for( Int l=1; l<m; ++l )
+            A[i+(j+l)*ALDim] -= gamma*Conj(v[l-1]);
+    }
+}
+
+// Overwrite the diagonal window H(ind,ind), where ind=[winBeg,winEnd), with
+// HWin = V^H H(ind,ind) V and apply V to the portion of H above the window
+// (starting at row 'rowBeg'), to the portion of H right of the window (up to
+// column 'colEnd'), and to the corresponding columns of Q
+template<typename F>
+inline void UpdateWindow
+( DistMatrix<F>& H, DistMatrix<F>* Q,
+  const DistMatrix<F,STAR,STAR>& HWin, const DistMatrix<F,STAR,STAR>& V,
+  Int winBeg, Int winEnd, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::UpdateWindow"))
+    const Grid& g = H.Grid();
+    const IR winInd( winBeg, winEnd );
+    auto HWinDist = H( winInd, winInd );
+    HWinDist = HWin;
+
+    DistMatrix<F,MC,STAR> X_MC_STAR(g), Y_MC_STAR(g);
+    if( rowBeg < winBeg )
+    {
+        auto HAbove = H( IR(rowBeg,winBeg), winInd );
+        X_MC_STAR.AlignWith( HAbove );
+        Y_MC_STAR.AlignWith( HAbove );
+        X_MC_STAR = HAbove;
+        LocalGemm( NORMAL, NORMAL, F(1), X_MC_STAR, V, Y_MC_STAR );
+        HAbove = Y_MC_STAR;
+    }
+    if( winEnd < colEnd )
+    {
+        auto HRight = H( winInd, IR(winEnd,colEnd) );
+        DistMatrix<F,STAR,MR> X_STAR_MR(g), Y_STAR_MR(g);
+        X_STAR_MR.AlignWith( HRight );
+        Y_STAR_MR.AlignWith( HRight );
+        X_STAR_MR = HRight;
+        LocalGemm( ADJOINT, NORMAL, F(1), V, X_STAR_MR, Y_STAR_MR );
+        HRight = Y_STAR_MR;
+    }
+    if( Q != nullptr )
+    {
+        auto QWin = (*Q)( ALL, winInd );
+        X_MC_STAR.AlignWith( QWin );
+        Y_MC_STAR.AlignWith( QWin );
+        X_MC_STAR = QWin;
+        LocalGemm( NORMAL, NORMAL, F(1), X_MC_STAR, V, Y_MC_STAR );
+        QWin = Y_MC_STAR;
+    }
+}
+
+// Compute the Schur decomposition of the active block H(ind,ind), where
+// ind=[ktop,kbot), redundantly with LAPACK
+template<typename F>
+inline void SmallBlock
+( DistMatrix<F>& H, DistMatrix<F>* Q,
+  Int ktop, Int kbot, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::SmallBlock"))
+    const Int blockSize = kbot-ktop;
+    const IR ind( ktop, kbot );
+    DistMatrix<F,STAR,STAR> T( H(ind,ind) ),
+                            V( blockSize, blockSize, H.Grid() );
+    vector<Complex<Base<F>>> w( blockSize );
+    lapack::HessenbergSchur
+    ( blockSize, T.Buffer(), T.LDim(), w.data(), V.Buffer(), V.LDim(),
+      true, false );
+    UpdateWindow( H, Q, T, V, ktop, kbot, rowBeg, colEnd );
+}
+
+// Default number of shifts per sweep and deflation window size for an
+// active block of size n, as suggested by LAPACK's xLAQR0 and IPARMQ
+inline Int DefaultNumShifts( Int n )
+{
+    Int numShifts;
+    if( n < 30 )
+        numShifts = 2;
+    else if( n < 60 )
+        numShifts = 4;
+    else if( n < 150 )
+        numShifts = 10;
+    else if( n < 590 )
+        numShifts =
+          Max( Int(10), n/Int(std::round(std::log2(double(n)))) );
+    else if( n < 3000 )
+        numShifts = 64;
+    else if( n < 6000 )
+        numShifts = 128;
+    else
+        numShifts = 256;
+    return numShifts - numShifts%2;
+}
+
+inline Int DefaultDeflationSize( Int n, Int numShifts )
+{ return ( n <= 500 ? numShifts : (3*numShifts)/2 ); }
+
+// Run AED on the window [kbot-deflationSize,kbot) of the active block
+// [ktop,kbot): the window is reduced to Schur form, and every eigenvalue
+// whose corresponding entry of the spike is negligible is deflated after
+// all of the others have been reordered to the top of the window. The number
+// of deflated eigenvalues is returned, and the undeflated eigenvalues, which
+// are the natural shifts for the next sweep, are returned in 'shifts'.
+template<typename F>
+inline Int AED
+( DistMatrix<F>& H, DistMatrix<F>* Q,
+  Int ktop, Int kbot, Int deflationSize, Int rowBeg, Int colEnd,
+  vector<Complex<Base<F>>>& shifts )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::AED"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Int nw = deflationSize;
+    const Int winBeg = kbot-nw;
+    const IR winInd( winBeg, kbot );
+    const F eta = ( winBeg > ktop ? H.Get(winBeg,winBeg-1) : F(0) );
+
+    DistMatrix<F,STAR,STAR> T( H(winInd,winInd) ), V( nw, nw, H.Grid() );
+    F* TBuf = T.Buffer();
+    F* VBuf = V.Buffer();
+    const Int TLDim = T.LDim();
+    const Int VLDim = V.LDim();
+    vector<C> wWin( nw );
+    lapack::HessenbergSchur
+    ( nw, TBuf, TLDim, wWin.data(), VBuf, VLDim, true, false );
+
+    // The spike is eta times the conjugate of the first row of V
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real smallNum = lapack::MachineSafeMin<Real>()*(Real(nw)/ulp);
+    Int numUndeflated = nw, ilst = 0;
+    while( ilst < numUndeflated )
+    {
+        const Int k = numUndeflated-1;
+        const bool twoByTwo =
+          !IsComplex<F>::value && k > ilst && TBuf[k+(k-1)*TLDim] != F(0);
+        const Int blockSize = ( twoByTwo ? 2 : 1 );
+        Real scale = Abs(TBuf[k+k*TLDim]);
+        Real spike = Abs(eta*VBuf[k*VLDim]);
+        if( twoByTwo )
+        {
+            scale += Sqrt(Abs(TBuf[k+(k-1)*TLDim]))*
+                     Sqrt(Abs(TBuf[(k-1)+k*TLDim]));
+            spike = Max( spike, Abs(eta*VBuf[(k-1)*VLDim]) );
+        }
+        if( scale == Real(0) )
+            scale = Abs(eta);
+        if( spike <= Max( smallNum, ulp*scale ) )
+        {
+            numUndeflated -= blockSize;
+        }
+        else
+        {
+            // Move the undeflatable block to the top of the window. A
+            // rejected real swap leaves the block in place, as in xLAQR3.
+            BlasInt ifst=k-blockSize+1, ilstNew=ilst;
+            lapack::SchurExchange
+            ( nw, TBuf, TLDim, VBuf, VLDim, ifst, ilstNew );
+            ilst += blockSize;
+        }
+    }
+
+    shifts.resize( numUndeflated );
+    if( numUndeflated > 0 )
+    {
+        auto TTL = T.LockedMatrix()( IR(0,numUndeflated), IR(0,numUndeflated) );
+        Matrix<C> wUndeflated;
+        QuasiTriangEig( TTL, wUndeflated );
+        for( Int i=0; i<numUndeflated; ++i )
+            shifts[i] = wUndeflated.Get(i,0);
+    }
+
+    // Reduce the undeflated portion of the spike to a multiple of e_0 and
+    // then restore the Hessenberg form of the undeflated block
+    F beta = 0;
+    if( numUndeflated > 0 && eta != F(0) )
+    {
+        const Int ns = numUndeflated;
+        vector<F> x( ns );
+        for( Int i=0; i<ns; ++i )
+            x[i] = eta*Conj(VBuf[i*VLDim]);
+        if( ns > 1 )
+        {
+            const F tau = MakeReflector( ns, x.data() );
+            ApplyLeft( ns, tau, &x[1], TBuf, TLDim, 0, 0, nw );
+            ApplyRight( ns, tau, &x[1], TBuf, TLDim, 0, 0, nw );
+            ApplyRight( ns, tau, &x[1], VBuf, VLDim, 0, 0, nw );
+        }
+        beta = x[0];
+        if( ns > 2 )
+        {
+            auto TTL = T.Matrix()( IR(0,ns), IR(0,ns) );
+            auto TTR = T.Matrix()( IR(0,ns), IR(ns,nw) );
+            auto VL = V.Matrix()( ALL, IR(0,ns) );
+            Matrix<F> t;
+            Hessenberg( UPPER, TTL, t );
+            hessenberg::ApplyQ( LEFT, UPPER, ADJOINT, TTL, t, TTR );
+            hessenberg::ApplyQ( RIGHT, UPPER, NORMAL, TTL, t, VL );
+            MakeTrapezoidal( UPPER, TTL, -1 );
+        }
+    }
+
+    UpdateWindow( H, Q, T, V, winBeg, kbot, rowBeg, colEnd );
+    if( winBeg > ktop )
+        H.Set( winBeg, winBeg-1, beta );
+    return nw - numUndeflated;
+}
+
+// Group the candidate shifts, from the bottom of the list upwards, into at
+// most maxShifts/2 pairs. For real matrices, each pair is either a complex
+// conjugate pair or two real shifts (possibly the same one twice) so that
+// every double-shift bulge is real.
+template<typename F>
+inline vector<Complex<Base<F>>> PairShifts
+( const vector<Complex<Base<F>>>& candidates, Int maxShifts )
+{
+    typedef Base<F> Real;
+    vector<Complex<Base<F>>> shifts;
+    Int i = candidates.size()-1;
+    while( i >= 0 && Int(shifts.size())+2 <= maxShifts )
+    {
+        if( IsComplex<F>::value )
+        {
+            if( i == 0 )
+                break;
+            shifts.push_back( candidates[i-1] );
+            shifts.push_back( candidates[i] );
+            i -= 2;
+        }
+        else if( ImagPart(candidates[i]) != Real(0) )
+        {
+            if( i == 0 )
+                break;
+            shifts.push_back( candidates[i-1] );
+            shifts.push_back( candidates[i] );
+            i -= 2;
+        }
+        else if( i > 0 && ImagPart(candidates[i-1]) == Real(0) )
+        {
+            shifts.push_back( candidates[i-1] );
+            shifts.push_back( candidates[i] );
+            i -= 2;
+        }
+        else
+        {
+            shifts.push_back( candidates[i] );
+            shifts.push_back( candidates[i] );
+            i -= 1;
+        }
+    }
+    return shifts;
+}
+
+// Advance the bulge which is next to be chased from column k of the window
+// W, accumulating the reflection into U. All indices are relative to the
+// window, and the bulge is introduced from a pair of shifts if k=ktop-1.
+template<typename F>
+inline void BulgeStep
+( Matrix<F>& W, Matrix<F>& U, Int k, Int ktop, Int kbot,
+  const Complex<Base<F>>& shift0, const Complex<Base<F>>& shift1 )
+{
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    const Int m = Min( Int(3), kbot-(k+1) );
+    F x[3];
+    if( k < ktop )
+    {
+        // A multiple of the first column of (H - shift0 I)(H - shift1 I)
+        const C eta00 = WBuf[ktop    + ktop   *WLDim],
+                eta10 = WBuf[(ktop+1)+ ktop   *WLDim],
+                eta01 = WBuf[ktop    +(ktop+1)*WLDim],
+                eta11 = WBuf[(ktop+1)+(ktop+1)*WLDim],
+                eta21 = WBuf[(ktop+2)+(ktop+1)*WLDim];
+        const Real scale = Abs(eta00-shift1) + Abs(eta10);
+        if( scale == Real(0) )
+            return;
+        const C eta10Scaled = eta10/scale;
+        FromComplex
+        ( eta10Scaled*eta01 + (eta00-shift0)*((eta00-shift1)/scale), x[0] );
+        FromComplex( eta10Scaled*(eta00+eta11-shift0-shift1), x[1] );
+        FromComplex( eta10Scaled*eta21, x[2] );
+    }
+    else
+    {
+        for( Int l=0; l<m; ++l )
+            x[l] = WBuf[(k+1+l)+k*WLDim];
+    }
+
+    const F tau = MakeReflector( m, x );
+    if( k >= ktop )
+    {
+        WBuf[(k+1)+k*WLDim] = x[0];
+        for( Int l=1; l<m; ++l )
+            WBuf[(k+1+l)+k*WLDim] = 0;
+    }
+    ApplyLeft( m, tau, &x[1], WBuf, WLDim, k+1, k+1, W.Width() );
+    ApplyRight( m, tau, &x[1], WBuf, WLDim, k+1, 0, Min(k+m+2,kbot) );
+    ApplyRight( m, tau, &x[1], U.Buffer(), U.LDim(), k+1, 0, U.Height() );
+}
+
+// Chase a chain of double-shift bulges through the active block [ktop,kbot).
+// Consecutive bulges are kept four columns apart so that they do not
+// interact, and each diagonal window is twice as large as the chain so that
+// the chain advances by roughly its own length before the accumulated
+// transformation of the window is applied to the rest of the matrix.
+template<typename F>
+inline void Sweep
+( DistMatrix<F>& H, DistMatrix<F>* Q,
+  const vector<Complex<Base<F>>>& shifts,
+  Int ktop, Int kbot, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::Sweep"))
+    const Int numBulges = shifts.size()/2;
+    if( numBulges == 0 )
+        return;
+    const Int winSize = Min( 8*numBulges+6, kbot-ktop );
+
+    // pos[j] is the column which bulge j will next be chased from
+    vector<Int> pos( numBulges, ktop-1 );
+    auto active = [&]( Int j ) { return pos[j] <= kbot-3; };
+
+    DistMatrix<F,STAR,STAR> W( H.Grid() ), U( H.Grid() );
+    Int winBeg = ktop;
+    while( active(numBulges-1) )
+    {
+        const Int winEnd = Min( winBeg+winSize, kbot );
+        const IR winInd( winBeg, winEnd );
+        W = H( winInd, winInd );
+        Identity( U, winEnd-winBeg, winEnd-winBeg );
+
+        Int numSteps = 0;
+        bool progress = true;
+        while( progress )
+        {
+            progress = false;
+            for( Int j=0; j<numBulges; ++j )
+            {
+                const Int k = pos[j];
+                if( !active(j) )
+                    continue;
+                if( j > 0 && active(j-1) && pos[j-1] < k+4 )
+                    continue;
+                if( Max(k,ktop) < winBeg || Min(k+5,kbot) > winEnd )
+                    continue;
+                BulgeStep
+                ( W.Matrix(), U.Matrix(), k-winBeg, ktop-winBeg, kbot-winBeg,
+                  shifts[2*j], shifts[2*j+1] );
+                ++pos[j];
+                ++numSteps;
+                progress = true;
+            }
+        }
+        if( numSteps == 0 )
+            LogicError("Bulge chase did not progress");
+        UpdateWindow( H, Q, W, U, winBeg, winEnd, rowBeg, colEnd );
+
+        // The next window begins at the column of the trailing bulge
+        winBeg = Max( pos[numBulges-1], ktop );
+    }
+}
+
+// Overwrite the upper Hessenberg matrix H with its (quasi-)triangular Schur
+// factor and, if Q is non-null, multiply Q from the right by the Schur
+// vectors. Unless 'fullTriangle' is true or the Schur vectors are requested,
+// only the diagonal blocks needed to determine the eigenvalues are computed.
+template<typename F>
+inline void Run
+( DistMatrix<F>& H,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>* Q,
+  bool fullTriangle,
+  const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::Run"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+    const bool wantT = fullTriangle || Q != nullptr;
+    const Int minMultiBulgeSize = Max( ctrl.minMultiBulgeSize, Int(12) );
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real smallNum = lapack::MachineSafeMin<Real>()*(Real(n)/ulp);
+    const Int maxIts = 30*Max(Int(10),n);
+
+    DistMatrix<F,STAR,STAR> d(g), e(g);
+    vector<C> candidates, shifts;
+    Int kbot = n, numIts = 0, itsSinceDefl = 0;
+    while( kbot > 0 )
+    {
+        // Search for the last negligible subdiagonal entry of H(0:kbot,0:kbot)
+        auto HAct = H( IR(0,kbot), IR(0,kbot) );
+        GetDiagonal( HAct, d );
+        GetDiagonal( HAct, e, -1 );
+        const F* dBuf = d.LockedBuffer();
+        const F* eBuf = e.LockedBuffer();
+        Int ktop = 0;
+        for( Int k=kbot-1; k>0; --k )
+        {
+            const Real sub = Abs(eBuf[k-1]);
+            Real tst = Abs(dBuf[k-1]) + Abs(dBuf[k]);
+            if( tst == Real(0) )
+            {
+                if( k > 1 )
+                    tst += Abs(eBuf[k-2]);
+                if( k < kbot-1 )
+                    tst += Abs(eBuf[k]);
+            }
+            if( sub <= Max( smallNum, ulp*tst ) )
+            {
+                H.Set( k, k-1, F(0) );
+                ktop = k;
+                break;
+            }
+        }
+        const Int activeSize = kbot-ktop;
+        const Int rowBeg = ( wantT ? 0 : ktop );
+        const Int colEnd = ( wantT ? n : kbot );
+
+        if( activeSize <= minMultiBulgeSize )
+        {
+            SmallBlock( H, Q, ktop, kbot, rowBeg, colEnd );
+            kbot = ktop;
+            itsSinceDefl = 0;
+            continue;
+        }
+        if( ++numIts > maxIts )
+            RuntimeError("Hessenberg QR algorithm did not converge");
+
+        Int numShifts =
+          ( ctrl.numShifts > 0 ? ctrl.numShifts
+                               : DefaultNumShifts(activeSize) );
+        numShifts = Max( Int(2), Min( numShifts, activeSize-2 ) );
+        numShifts -= numShifts%2;
+        Int deflationSize =
+          ( ctrl.deflationSize > 0 ?
+            ctrl.deflationSize :
+            DefaultDeflationSize(activeSize,numShifts) );
+        deflationSize = Max( Int(2), Min( deflationSize, activeSize-1 ) );
+
+        const Int numDeflated =
+          AED
+          ( H, Q, ktop, kbot, deflationSize, rowBeg, colEnd, candidates );
+        kbot -= numDeflated;
+        itsSinceDefl = ( numDeflated > 0 ? 0 : itsSinceDefl+1 );
+
+        // As in LAPACK, skip the sweep if AED was sufficiently successful
+        const Int nibble = 14;
+        if( kbot-ktop <= minMultiBulgeSize ||
+            (numDeflated > 0 && 100*numDeflated > nibble*deflationSize) )
+            continue;
+
+        numShifts = Min( numShifts, kbot-ktop-2 );
+        numShifts -= numShifts%2;
+        if( itsSinceDefl > 0 && itsSinceDefl % 6 == 0 )
+        {
+            // Exceptional shifts
+            shifts.clear();
+            for( Int i=kbot-1;
+                 i>ktop && Int(shifts.size())+2<=numShifts; i-=2 )
+            {
+                Real scale = Abs(eBuf[i-1]);
+                if( i-2 >= ktop )
+                    scale += Abs(eBuf[i-2]);
+                const C alpha = C(dBuf[i]) + Real(0.75)*scale;
+                const C mu( 0, Sqrt(Real(0.4375))*scale );
+                shifts.push_back( alpha+mu );
+                shifts.push_back( alpha-mu );
+            }
+        }
+        else if( candidates.size() >= 2 )
+        {
+            shifts = PairShifts<F>( candidates, numShifts );
+        }
+        else
+        {
+            // Use the eigenvalues of the trailing block as the shifts
+            const IR ind( kbot-numShifts, kbot );
+            DistMatrix<F,STAR,STAR> HBR( H(ind,ind) );
+            candidates.resize( numShifts );
+            lapack::HessenbergEig
+            ( numShifts, HBR.Buffer(), HBR.LDim(), candidates.data() );
+            shifts = PairShifts<F>( candidates, numShifts );
+        }
+        Sweep( H, Q, shifts, ktop, kbot, rowBeg, colEnd );
+    }
+
+    QuasiTriangEig( H, w );
+}
+
+} // namespace hess_qr
+
+template<typename F>
+inline void HessenbergQR
+( DistMatrix<F>& H,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  bool fullTriangle,
+  const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::HessenbergQR"))
+    hess_qr::Run<F>( H, w, nullptr, fullTriangle, ctrl );
+}
+
+template<typename F>
+inline void HessenbergQR
+( DistMatrix<F>& H,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Q,
+  bool fullTriangle,
+  const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::HessenbergQR"))
+    hess_qr::Run( H, w, &Q, fullTriangle, ctrl );
+}
+
+} // namespace schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_HESSENBERGQR_HPP
@@ -56,175 +56,210 @@ QR
     }
 }
 
+// Unless ctrl.scalapack is true, the QR algorithm is run natively upon the
+// [MC,MR] distribution (see HessenbergQR.hpp)
+
 template<typename F>
 inline void
 QR
-( DistMatrix<F,MC,MR,BLOCK>& A,
-  ElementalMatrix<Complex<Base<F>>>& w,
-  bool fullTriangle,
-  const HessQRCtrl& ctrl )
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<Complex<Base<F>>>& w, 
+  bool fullTriangle, const HessQRCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("schur::QR"))
-    AssertScaLAPACKSupport();
-#ifdef EL_HAVE_SCALAPACK
-    const Int n = A.Height();
-    const int bHandle = blacs::Handle( A );
-    const int context = blacs::GridInit( bHandle, A );
-    auto descA = FillDesc( A, context );
+    if( ctrl.scalapack )
+        AssertScaLAPACKSupport();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
 
     // Reduce the matrix to upper-Hessenberg form in an elemental form
-    DistMatrix<F> AElem( A );
     DistMatrix<F,STAR,STAR> t( A.Grid() );
-    Hessenberg( UPPER, AElem, t );
-    MakeTrapezoidal( UPPER, AElem, -1 );
-    A = AElem;
+    Hessenberg( UPPER, A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
 
-    // Run the QR algorithm in block form
-    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, A.Grid() );
+    if( !ctrl.scalapack )
+    {
+        HessenbergQR( A, w, fullTriangle, ctrl );
+    }
+    else
+    {
+#ifdef EL_HAVE_SCALAPACK
+        // Run the QR algorithm in block form
+        const Int n = A.Height(); 
+        const Int mb = ctrl.blockHeight;
+        const Int nb = ctrl.blockWidth;
+        DistMatrix<F,MC,MR,BLOCK> ABlock( n, n, A.Grid(), mb, nb );
+        ABlock = A;
+        const int bHandle = blacs::Handle( ABlock );
+        const int context = blacs::GridInit( bHandle, ABlock );
+        blacs::Desc descA = FillDesc( ABlock, context );
+        DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, A.Grid() );
 
 #define FORCE_WANTZ_TRUE 1
 #if FORCE_WANTZ_TRUE
-    DistMatrix<F,MC,MR,BLOCK> Z(n,n,A.Grid(),A.BlockHeight(),A.BlockWidth());
-    Identity( Z, n, n );
-    bool multiplyZ=true;
-    scalapack::HessenbergSchur
-    ( n,
-      A.Buffer(), descA.data(),
-      w_STAR_STAR.Buffer(),
-      Z.Buffer(), descA.data(),
-      fullTriangle, multiplyZ, ctrl.distAED );
+        DistMatrix<F,MC,MR,BLOCK> Z(n,n,A.Grid(),mb,nb);
+        Identity( Z, n, n );
+        blacs::Desc descZ = FillDesc( Z, context );
+        bool multiplyZ=true;
+        scalapack::HessenbergSchur
+        ( n,
+          ABlock.Buffer(), descA.data(),
+          w_STAR_STAR.Buffer(),
+          Z.Buffer(), descZ.data(),
+          fullTriangle, multiplyZ, ctrl.distAED );
 #else
-    scalapack::HessenbergSchur
-    ( n,
-      A.Buffer(), descA.data(),
-      w_STAR_STAR.Buffer(),
-      fullTriangle, ctrl.distAED );
+        scalapack::HessenbergSchur
+        ( n, 
+          ABlock.Buffer(), descA.data(),
+          w_STAR_STAR.Buffer(), 
+          fullTriangle, ctrl.distAED );
 #endif
-    Copy( w_STAR_STAR, w );
 
-    // TODO: Cache context, handle, and exit BLACS during El::Finalize()
-    blacs::FreeGrid( context );
-    blacs::FreeHandle( bHandle );
+        A = ABlock;
+        Copy( w_STAR_STAR, w );
+
+        // TODO: Cache context, handle, and exit BLACS during El::Finalize()
+        blacs::FreeGrid( context );
+        blacs::FreeHandle( bHandle );
 #endif
+    }
     if( IsComplex<F>::value )
         MakeTrapezoidal( UPPER, A );
     else
     {
         MakeTrapezoidal( UPPER, A, -1 );
-        // NOTE: This routine is not yet implemented
-        //DEBUG_ONLY(CheckRealSchur(A))
+        DEBUG_ONLY(CheckRealSchur(A))
     }
 }
 
 template<typename F>
 inline void
 QR
-( DistMatrix<F,MC,MR,BLOCK>& A,
-  ElementalMatrix<Complex<Base<F>>>& w,
-  DistMatrix<F,MC,MR,BLOCK>& Q,
-  bool fullTriangle, const HessQRCtrl& ctrl )
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<Complex<Base<F>>>& w, 
+  ElementalMatrix<F>& QPre,
+  bool fullTriangle,
+  const HessQRCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("schur::QR"))
-    AssertScaLAPACKSupport();
-#ifdef EL_HAVE_SCALAPACK
-    const Int n = A.Height();
-    const int bHandle = blacs::Handle( A );
-    const int context = blacs::GridInit( bHandle, A );
-    Q.AlignWith( A );
-    Q.Resize( n, n, A.LDim() );
-    auto descA = FillDesc( A, context );
-    auto descQ = FillDesc( Q, context );
+    if( ctrl.scalapack )
+        AssertScaLAPACKSupport();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& A = AProx.Get();
+    auto& Q = QProx.Get();
 
+    const Int n = A.Height();
     // Reduce A to upper-Hessenberg form in an element-wise distribution
     // and form the explicit reflector matrix
-    DistMatrix<F> AElem( A ), QElem( A.Grid() );
     DistMatrix<F,STAR,STAR> t( A.Grid() );
-    Hessenberg( UPPER, AElem, t );
+    Hessenberg( UPPER, A, t );
     // There is not yet a 'form Q'
-    Identity( QElem, n, n ); 
-    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, AElem, t, QElem );
-    MakeTrapezoidal( UPPER, AElem, -1 );
-    A = AElem;
-    Q = QElem;
-    
-    // Compute the Schur decomposition in block form, multiplying the 
-    // accumulated Householder reflectors from the right
-    DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, A.Grid() );
-    const bool multiplyQ = true;
-    scalapack::HessenbergSchur
-    ( n,
-      A.Buffer(), descA.data(),
-      w_STAR_STAR.Buffer(), 
-      Q.Buffer(), descQ.data(),
-      fullTriangle, multiplyQ, ctrl.distAED );
-    Copy( w_STAR_STAR, w );
+    Identity( Q, n, n ); 
+    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, A, t, Q );
+    MakeTrapezoidal( UPPER, A, -1 );
 
-    // TODO: Cache context, handle, and exit BLACS during El::Finalize()
-    blacs::FreeGrid( context );
-    blacs::FreeHandle( bHandle );
+    if( !ctrl.scalapack )
+    {
+        HessenbergQR( A, w, Q, fullTriangle, ctrl );
+    }
+    else
+    {
+#ifdef EL_HAVE_SCALAPACK
+        // Run the Hessenberg QR algorithm in block form
+        const Int mb = ctrl.blockHeight;
+        const Int nb = ctrl.blockWidth;
+        DistMatrix<F,MC,MR,BLOCK>
+          ABlock( n, n, A.Grid(), mb, nb ), 
+          QBlock( n, n, A.Grid(), mb, nb );
+        ABlock = A;
+        QBlock = Q;
+        const int bHandle = blacs::Handle( ABlock );
+        const int context = blacs::GridInit( bHandle, ABlock );
+        auto descA = FillDesc( ABlock, context );
+        auto descQ = FillDesc( QBlock, context );
+
+        // Compute the Schur decomposition in block form, multiplying the 
+        // accumulated Householder reflectors from the right
+        DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, A.Grid() );
+        const bool multiplyQ = true;
+        scalapack::HessenbergSchur
+        ( n,
+          ABlock.Buffer(), descA.data(),
+          w_STAR_STAR.Buffer(), 
+          QBlock.Buffer(), descQ.data(),
+          fullTriangle, multiplyQ, ctrl.distAED );
+        A = ABlock;
+        Q = QBlock;
+        Copy( w_STAR_STAR, w );
+
+        // TODO: Cache context, handle, and exit BLACS during El::Finalize()
+        blacs::FreeGrid( context );
+        blacs::FreeHandle( bHandle );
 #endif
+    }
     if( IsComplex<F>::value )
         MakeTrapezoidal( UPPER, A );
     else
     {
         MakeTrapezoidal( UPPER, A, -1 );
-        // NOTE: This routine is not yet implemented
-        //DEBUG_ONLY(CheckRealSchur(A))
+        DEBUG_ONLY(CheckRealSchur(A))
     }
 }
 
 template<typename F>
 inline void
 QR
-( ElementalMatrix<F>& APre,
-  ElementalMatrix<Complex<Base<F>>>& w, 
-  bool fullTriangle, const HessQRCtrl& ctrl )
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  bool fullTriangle,
+  const HessQRCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("schur::QR"))
+    if( !ctrl.scalapack )
+    {
+        DistMatrix<F> AElem( A );
+        QR( AElem, w, fullTriangle, ctrl );
+        A = AElem;
+        return;
+    }
     AssertScaLAPACKSupport();
-
-    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
-    auto& A = AProx.Get();
-
 #ifdef EL_HAVE_SCALAPACK
+    const Int n = A.Height();
+    const int bHandle = blacs::Handle( A );
+    const int context = blacs::GridInit( bHandle, A );
+    auto descA = FillDesc( A, context );
+
     // Reduce the matrix to upper-Hessenberg form in an elemental form
+    DistMatrix<F> AElem( A );
     DistMatrix<F,STAR,STAR> t( A.Grid() );
-    Hessenberg( UPPER, A, t );
-    MakeTrapezoidal( UPPER, A, -1 );
+    Hessenberg( UPPER, AElem, t );
+    MakeTrapezoidal( UPPER, AElem, -1 );
+    A = AElem;
 
     // Run the QR algorithm in block form
-    // TODO: Create schur::HessenbergQR
-    const Int n = A.Height(); 
-    const Int mb = ctrl.blockHeight;
-    const Int nb = ctrl.blockWidth;
-    DistMatrix<F,MC,MR,BLOCK> ABlock( n, n, A.Grid(), mb, nb );
-    ABlock = A;
-    const int bHandle = blacs::Handle( ABlock );
-    const int context = blacs::GridInit( bHandle, ABlock );
-    blacs::Desc descA = FillDesc( ABlock, context );
     DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, A.Grid() );
 
 #define FORCE_WANTZ_TRUE 1
 #if FORCE_WANTZ_TRUE
-    DistMatrix<F,MC,MR,BLOCK> Z(n,n,A.Grid(),mb,nb);
+    DistMatrix<F,MC,MR,BLOCK> Z(n,n,A.Grid(),A.BlockHeight(),A.BlockWidth());
     Identity( Z, n, n );
-    blacs::Desc descZ = FillDesc( Z, context );
     bool multiplyZ=true;
     scalapack::HessenbergSchur
     ( n,
-      ABlock.Buffer(), descA.data(),
+      A.Buffer(), descA.data(),
       w_STAR_STAR.Buffer(),
-      Z.Buffer(), descZ.data(),
+      Z.Buffer(), descA.data(),
       fullTriangle, multiplyZ, ctrl.distAED );
 #else
     scalapack::HessenbergSchur
-    ( n, 
-      ABlock.Buffer(), descA.data(),
-      w_STAR_STAR.Buffer(), 
+    ( n,
+      A.Buffer(), descA.data(),
+      w_STAR_STAR.Buffer(),
       fullTriangle, ctrl.distAED );
 #endif
-
-    A = ABlock;
     Copy( w_STAR_STAR, w );
 
     // TODO: Cache context, handle, and exit BLACS during El::Finalize()
@@ -236,63 +271,60 @@ QR
     else
     {
         MakeTrapezoidal( UPPER, A, -1 );
-        DEBUG_ONLY(CheckRealSchur(A))
+        // NOTE: This routine is not yet implemented
+        //DEBUG_ONLY(CheckRealSchur(A))
     }
 }
 
 template<typename F>
 inline void
 QR
-( ElementalMatrix<F>& APre,
-  ElementalMatrix<Complex<Base<F>>>& w, 
-  ElementalMatrix<F>& QPre,
-  bool fullTriangle,
-  const HessQRCtrl& ctrl )
+( DistMatrix<F,MC,MR,BLOCK>& A,
+  ElementalMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F,MC,MR,BLOCK>& Q,
+  bool fullTriangle, const HessQRCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("schur::QR"))
+    if( !ctrl.scalapack )
+    {
+        DistMatrix<F> AElem( A ), QElem( A.Grid() );
+        QR( AElem, w, QElem, fullTriangle, ctrl );
+        A = AElem;
+        Q = QElem;
+        return;
+    }
     AssertScaLAPACKSupport();
-
-    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
-    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
-    auto& A = AProx.Get();
-    auto& Q = QProx.Get();
-
 #ifdef EL_HAVE_SCALAPACK
     const Int n = A.Height();
+    const int bHandle = blacs::Handle( A );
+    const int context = blacs::GridInit( bHandle, A );
+    Q.AlignWith( A );
+    Q.Resize( n, n, A.LDim() );
+    auto descA = FillDesc( A, context );
+    auto descQ = FillDesc( Q, context );
+
     // Reduce A to upper-Hessenberg form in an element-wise distribution
     // and form the explicit reflector matrix
+    DistMatrix<F> AElem( A ), QElem( A.Grid() );
     DistMatrix<F,STAR,STAR> t( A.Grid() );
-    Hessenberg( UPPER, A, t );
+    Hessenberg( UPPER, AElem, t );
     // There is not yet a 'form Q'
-    Identity( Q, n, n ); 
-    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, A, t, Q );
-    MakeTrapezoidal( UPPER, A, -1 );
-
-    // Run the Hessenberg QR algorithm in block form
-    const Int mb = ctrl.blockHeight;
-    const Int nb = ctrl.blockWidth;
-    DistMatrix<F,MC,MR,BLOCK>
-      ABlock( n, n, A.Grid(), mb, nb ), 
-      QBlock( n, n, A.Grid(), mb, nb );
-    ABlock = A;
-    QBlock = Q;
-    const int bHandle = blacs::Handle( ABlock );
-    const int context = blacs::GridInit( bHandle, ABlock );
-    auto descA = FillDesc( ABlock, context );
-    auto descQ = FillDesc( QBlock, context );
-
+    Identity( QElem, n, n ); 
+    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, AElem, t, QElem );
+    MakeTrapezoidal( UPPER, AElem, -1 );
+    A = AElem;
+    Q = QElem;
+    
     // Compute the Schur decomposition in block form, multiplying the 
     // accumulated Householder reflectors from the right
     DistMatrix<Complex<Base<F>>,STAR,STAR> w_STAR_STAR( n, 1, A.Grid() );
     const bool multiplyQ = true;
     scalapack::HessenbergSchur
     ( n,
-      ABlock.Buffer(), descA.data(),
+      A.Buffer(), descA.data(),
       w_STAR_STAR.Buffer(), 
-      QBlock.Buffer(), descQ.data(),
+      Q.Buffer(), descQ.data(),
       fullTriangle, multiplyQ, ctrl.distAED );
-    A = ABlock;
-    Q = QBlock;
     Copy( w_STAR_STAR, w );
 
     // TODO: Cache context, handle, and exit BLACS during El::Finalize()
@@ -304,7 +336,8 @@ QR
     else
     {
         MakeTrapezoidal( UPPER, A, -1 );
-        DEBUG_ONLY(CheckRealSchur(A))
+        // NOTE: This routine is not yet implemented
+        //DEBUG_ONLY(CheckRealSchur(A))
     }
 }
 
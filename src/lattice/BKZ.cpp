@@ -0,0 +1,314 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The following is a relatively simple implementation of the BKZ reduction
+// of
+//
+//   Claus-Peter Schnorr and M. Euchner,
+//   "Lattice basis reduction: Improved practical algorithms and solving
+//   subset sum problems", Mathematical Programming, Vol. 66, pp. 181--199,
+//   1994,
+//
+// with some of the improvements from
+//
+//   Yuanmi Chen and Phong Q. Nguyen,
+//   "BKZ 2.0: Better Lattice Security Estimates", ASIACRYPT 2011,
+//
+// namely, pruned enumeration (here, the linear pruning of Gama, Nguyen, and
+// Regev), bounding the enumeration radius using the Gaussian heuristic, and
+// early termination. The (numerically stable) Householder-based LLL is used
+// both for the initial reduction and for removing the linear dependency
+// after each insertion.
+//
+// Future work will involve recursive preprocessing of the blocks and
+// updating only the affected portion of the QR factorization after an
+// insertion.
+//
+
+namespace El {
+
+namespace bkz {
+
+// The radius of the ball whose volume is equal to the covolume of the
+// lattice generated by the columns of the upper-triangular matrix R
+template<typename Real>
+Real GaussianHeuristic( const Matrix<Real>& R )
+{
+    DEBUG_ONLY(CSE cse("bkz::GaussianHeuristic"))
+    const Int n = R.Width();
+    Real logVol = 0;
+    for( Int i=0; i<n; ++i )
+        logVol += Log( R.Get(i,i) );
+    const Real logGamma = Real(std::lgamma(double(n)/2+1));
+    return Exp( (logGamma+logVol)/Real(n) ) / Sqrt(Real(Pi));
+}
+
+// Search for the shortest nonzero vector, R x, of the lattice generated by
+// the columns of the upper-triangular matrix R (with a positive diagonal)
+// such that || R x ||_2^2 < radiusSquared using Schnorr-Euchner enumeration.
+template<typename Real>
+bool Enumerate
+( const Matrix<Real>& R,
+        Real radiusSquared,
+        bool prune,
+        vector<Real>& xBest )
+{
+    DEBUG_ONLY(CSE cse("bkz::Enumerate"))
+    const Int n = R.Width();
+
+    Matrix<Real> mu( R );
+    vector<Real> rSquared(n);
+    for( Int i=0; i<n; ++i )
+    {
+        const Real rho = R.Get(i,i);
+        rSquared[i] = rho*rho;
+        for( Int j=i+1; j<n; ++j )
+            mu.Set( i, j, R.Get(i,j)/rho );
+    }
+
+    // With linear pruning, the partial squared norm after fixing the last
+    // n-i coefficients must be less than (n-i)/n times the squared radius
+    auto bound =
+      [&]( Int i )
+      { return prune ? radiusSquared*Real(n-i)/Real(n) : radiusSquared; };
+
+    bool found = false;
+    vector<Real> x(n,0), c(n,0), dx(n,1), ddx(n,1), l(n+1,0);
+    Int i = n-1;
+    while( true )
+    {
+        const Real diff = x[i]-c[i];
+        const Real li = l[i+1] + diff*diff*rSquared[i];
+        if( li < bound(i) )
+        {
+            if( i > 0 )
+            {
+                l[i] = li;
+                --i;
+                Real center = 0;
+                for( Int j=i+1; j<n; ++j )
+                    center -= mu.Get(i,j)*x[j];
+                c[i] = center;
+                x[i] = Round(center);
+                dx[i] = ddx[i] = ( center >= x[i] ? 1 : -1 );
+                continue;
+            }
+            else if( li > Real(0) )
+            {
+                radiusSquared = li;
+                xBest = x;
+                found = true;
+            }
+        }
+        else if( ++i == n )
+            break;
+
+        // Move to the next candidate for x[i] in zig-zag order around c[i],
+        // avoiding the enumeration of both v and -v
+        if( l[i+1] == Real(0) )
+        {
+            x[i] += 1;
+        }
+        else
+        {
+            x[i] += dx[i];
+            ddx[i] = -ddx[i];
+            dx[i] = ddx[i] - dx[i];
+        }
+    }
+    return found;
+}
+
+// Return g = gcd(a,b) >= 0 and set s and t such that s a + t b = g
+inline Int ExtendedGCD( Int a, Int b, Int& s, Int& t )
+{
+    Int r0=a, r1=b, s0=1, s1=0, t0=0, t1=1;
+    while( r1 != 0 )
+    {
+        const Int q = r0 / r1;
+        Int tmp;
+        tmp = r0 - q*r1; r0 = r1; r1 = tmp;
+        tmp = s0 - q*s1; s0 = s1; s1 = tmp;
+        tmp = t0 - q*t1; t0 = t1; t1 = tmp;
+    }
+    if( r0 < 0 )
+    {
+        r0 = -r0;
+        s0 = -s0;
+        t0 = -t0;
+    }
+    s = s0;
+    t = t0;
+    return r0;
+}
+
+// Overwrite B with B U, where U is unimodular and U e_0 = x / gcd(x), so
+// that the first column of B becomes B x / gcd(x)
+template<typename Real>
+void Insert( Matrix<Real>& B, const vector<Real>& x )
+{
+    DEBUG_ONLY(CSE cse("bkz::Insert"))
+    const Int m = B.Height();
+    const Int n = B.Width();
+    Real* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+
+    vector<Int> a(n);
+    for( Int j=0; j<n; ++j )
+        a[j] = Int(x[j]);
+
+    // Successively fold the coefficient of column j into column j-1 using
+    // the 2x2 unimodular transformation
+    //
+    //   | a_{j-1}/g  -t |
+    //   |   a_j/g     s |,  where s a_{j-1} + t a_j = g
+    //
+    for( Int j=n-1; j>0; --j )
+    {
+        if( a[j] == 0 )
+            continue;
+        Int s, t;
+        const Int g = ExtendedGCD( a[j-1], a[j], s, t );
+        const Real alpha = Real(a[j-1]/g);
+        const Real beta = Real(a[j]/g);
+        Real* b0 = &BBuf[(j-1)*BLDim];
+        Real* b1 = &BBuf[j*BLDim];
+        for( Int i=0; i<m; ++i )
+        {
+            const Real beta0 = b0[i];
+            const Real beta1 = b1[i];
+            b0[i] = alpha*beta0 + beta*beta1;
+            b1[i] = Real(s)*beta1 - Real(t)*beta0;
+        }
+        a[j-1] = g;
+        a[j] = 0;
+    }
+}
+
+} // namespace bkz
+
+template<typename Real>
+Int BKZ
+( Matrix<Real>& B,
+  Matrix<Real>& QR,
+  const BKZCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("BKZ"))
+    if( ctrl.delta > Real(1) )
+        LogicError("delta is assumed to be at most 1");
+    if( ctrl.blocksize < 2 )
+        LogicError("The blocksize must be at least two");
+    const Int n = B.Width();
+
+    Timer enumTimer, lllTimer;
+    if( ctrl.time )
+        lllTimer.Start();
+    LLL( B, QR, ctrl.delta, ctrl.innerTol );
+    if( ctrl.time )
+        lllTimer.Stop();
+
+    Int numTours=0;
+    vector<Real> x;
+    Matrix<Real> QRLead, t, d;
+    bool fullyReduced = true;
+    while( numTours < ctrl.maxTours )
+    {
+        ++numTours;
+        Int numInsertions=0;
+        for( Int k=0; k<n-1; ++k )
+        {
+            const Int h = Min(k+ctrl.blocksize,n);
+            Matrix<Real> R( QR(IR(k,h),IR(k,h)) );
+            MakeTrapezoidal( UPPER, R );
+
+            // Only search for vectors which would violate the (generalized)
+            // Lovasz condition for b_k
+            const Real rho = R.Get(0,0);
+            Real radiusSquared = ctrl.delta*rho*rho;
+            if( ctrl.ghFactor > Real(0) )
+            {
+                const Real radius =
+                  ctrl.ghFactor*bkz::GaussianHeuristic( R );
+                radiusSquared = Min( radiusSquared, radius*radius );
+            }
+
+            if( ctrl.time )
+                enumTimer.Start();
+            const bool found =
+              bkz::Enumerate( R, radiusSquared, ctrl.prune, x );
+            if( ctrl.time )
+                enumTimer.Stop();
+            if( !found )
+                continue;
+
+            ++numInsertions;
+            auto BBlock = B( ALL, IR(k,h) );
+            bkz::Insert( BBlock, x );
+
+            // Only the leading h columns were modified, so only they are
+            // LLL-reduced again. The projections of the trailing columns
+            // orthogonal to the leading ones are unchanged, but the rest of
+            // their R factor is not, so it is recomputed.
+            if( ctrl.time )
+                lllTimer.Start();
+            auto BLead = B( ALL, IR(0,h) );
+            LLL( BLead, QRLead, ctrl.delta, ctrl.innerTol );
+            if( h < n )
+            {
+                QR = B;
+                El::QR( QR, t, d );
+                fullyReduced = false;
+            }
+            else
+                QR = QRLead;
+            if( ctrl.time )
+                lllTimer.Stop();
+        }
+        if( ctrl.progress )
+            Output
+            ("BKZ tour ",numTours,": ",numInsertions," insertions, "
+             "|| b_0 ||_2 = ",FrobeniusNorm(B(ALL,IR(0))));
+        if( numInsertions == 0 )
+            break;
+    }
+
+    // The trailing columns may not have been size-reduced against the
+    // modified leading columns
+    if( !fullyReduced )
+    {
+        if( ctrl.time )
+            lllTimer.Start();
+        LLL( B, QR, ctrl.delta, ctrl.innerTol );
+        if( ctrl.time )
+            lllTimer.Stop();
+    }
+
+    if( ctrl.time )
+    {
+        Output("  Enumeration time: ",enumTimer.Total());
+        Output("  LLL time:         ",lllTimer.Total());
+    }
+
+    return numTours;
+}
+
+#define PROTO(Real) \
+  template Int BKZ \
+  ( Matrix<Real>& B, \
+    Matrix<Real>& QR, \
+    const BKZCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#include "El/macros/Instantiate.h"
+
+} // namespace El
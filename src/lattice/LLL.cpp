@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include <exception>
 
 // The implementations of Householder-based LLL in this file are extensions of
 // the algorithm discussed in:
@@ -427,41 +428,36 @@ void BlockStep
     lll::BlockHouseholderStep( k, B, QR, V, SInv, t, d, zeroTol, time );
 }
 
+// Continue the reduction from column k, assuming that the first k columns of
+// B are already reduced and that their portions of QR, t, and d are up to
+// date. The columns in [k,numValid) are furthermore assumed to already be
+// size-reduced and to have up-to-date columns of QR (and Householder
+// reflectors), so that they need not be re-expanded unless a swap
+// invalidates them.
 template<typename F>
-Int UnblockedAlg
-( Matrix<F>& B,
+Int UnblockedLoop
+( Int k,
+  Int numValid,
+  Matrix<F>& B,
   Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
   Base<F> delta,
   Base<F> loopTol,
+  Base<F> zeroTol,
   bool progress,
   bool time )
 {
-    DEBUG_ONLY(CSE cse("lll::UnblockedAlg"))
+    DEBUG_ONLY(CSE cse("lll::UnblockedLoop"))
     typedef Base<F> Real;
-    if( time )
-    {
-        applyHouseTimer.Reset();
-        roundTimer.Reset();
-    }
-
-    Real zeroTol = Pow(Epsilon<Real>(),Real(0.5));
-
-    const Int m = B.Height();
     const Int n = B.Width();
-    const Int minDim = Min(m,n);
-    Matrix<F> t;
-    Matrix<Real> d;
-    Zeros( QR, m, n );
-    Zeros( d, minDim, 1 );
-    Zeros( t, minDim, 1 );
-
-    // Perform the first step of Householder reduction
-    lll::HouseholderStep( 0, B, QR, t, d, zeroTol, time );
 
-    Int k=1, numBacktrack=0;
+    Int numBacktrack=0;
     while( k < n )
     {
-        lll::Step( k, B, QR, t, d, delta, loopTol, zeroTol, progress, time );
+        if( k >= numValid )
+            lll::Step
+            ( k, B, QR, t, d, delta, loopTol, zeroTol, progress, time );
 
         const Real bNorm = FrobeniusNorm( B(ALL,IR(k)) );
         const Real rTNorm = FrobeniusNorm( QR(IR(0,k-1),IR(k)) );
@@ -477,6 +473,7 @@ Int UnblockedAlg
             if( progress )
                 Output("Dropping from k=",k," to ",Max(k-1,1));
             ColSwap( B, k-1, k );
+            numValid = Min( numValid, k-1 );
             if( k == 1 )
             {
                 // We must reinitialize since we keep k=1
@@ -488,6 +485,43 @@ Int UnblockedAlg
             }
         }
     }
+    return numBacktrack;
+}
+
+template<typename F>
+Int UnblockedAlg
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Base<F> loopTol,
+  bool progress,
+  bool time )
+{
+    DEBUG_ONLY(CSE cse("lll::UnblockedAlg"))
+    typedef Base<F> Real;
+    if( time )
+    {
+        applyHouseTimer.Reset();
+        roundTimer.Reset();
+    }
+
+    Real zeroTol = Pow(Epsilon<Real>(),Real(0.5));
+
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+    Matrix<F> t;
+    Matrix<Real> d;
+    Zeros( QR, m, n );
+    Zeros( d, minDim, 1 );
+    Zeros( t, minDim, 1 );
+
+    // Perform the first step of Householder reduction
+    lll::HouseholderStep( 0, B, QR, t, d, zeroTol, time );
+
+    const Int numBacktrack =
+      lll::UnblockedLoop
+      ( 1, 1, B, QR, t, d, delta, loopTol, zeroTol, progress, time );
 
     if( time )
     {
@@ -575,6 +609,286 @@ Int BlockedAlg
     return numBacktrack;
 }
 
+// Deep insertion
+// ==============
+// Rather than only swapping b_{k-1} and b_k when the Lovasz condition fails,
+// b_k is inserted at the first position i for which
+//
+//   delta R(i,i)^2 > || b_k ||^2 - sum_{j<i} |R(j,k)|^2,
+//
+// i.e., where the projection of b_k orthogonal to b_0, ..., b_{i-1} is
+// shorter than (a delta fraction of) the i'th Gram-Schmidt vector. Cf.
+//
+//   Claus-Peter Schnorr and M. Euchner,
+//   "Lattice basis reduction: Improved practical algorithms and solving
+//   subset sum problems", Mathematical Programming, Vol. 66, pp. 181--199,
+//   1994.
+//
+// Since the worst-case complexity is not polynomial, insertions at positions
+// i >= depth (other than the usual LLL swap at position k-1) can be
+// disallowed by choosing a positive depth.
+template<typename F>
+Int DeepAlg
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Int depth,
+  Base<F> loopTol,
+  bool progress,
+  bool time )
+{
+    DEBUG_ONLY(CSE cse("lll::DeepAlg"))
+    typedef Base<F> Real;
+    if( time )
+    {
+        applyHouseTimer.Reset();
+        roundTimer.Reset();
+    }
+
+    Real zeroTol = Pow(Epsilon<Real>(),Real(0.5));
+
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+    Matrix<F> t;
+    Matrix<Real> d;
+    Zeros( QR, m, n );
+    Zeros( d, minDim, 1 );
+    Zeros( t, minDim, 1 );
+
+    // Perform the first step of Householder reduction
+    lll::HouseholderStep( 0, B, QR, t, d, zeroTol, time );
+
+    Int k=1, numInsertions=0;
+    while( k < n )
+    {
+        lll::Step( k, B, QR, t, d, delta, loopTol, zeroTol, progress, time );
+
+        // Search for the first position where b_k should be inserted
+        const Real bNorm = FrobeniusNorm( B(ALL,IR(k)) );
+        Real C = bNorm*bNorm;
+        Int i=0;
+        for( ; i<k; ++i )
+        {
+            if( depth > 0 && i >= depth && i < k-1 )
+            {
+                C -= Pow(Abs(QR.Get(i,k)),Real(2));
+                continue;
+            }
+            const Real rho_i_i = QR.GetRealPart(i,i);
+            if( delta*rho_i_i*rho_i_i > C )
+                break;
+            C -= Pow(Abs(QR.Get(i,k)),Real(2));
+        }
+        if( i == k )
+        {
+            ++k;
+            continue;
+        }
+
+        ++numInsertions;
+        if( progress )
+            Output("Inserting b_",k," at position ",i);
+        for( Int j=k; j>i; --j )
+            ColSwap( B, j-1, j );
+        if( i == 0 )
+        {
+            // The first reflector must be recomputed since we keep k=1
+            lll::HouseholderStep( 0, B, QR, t, d, zeroTol, time );
+            k = 1;
+        }
+        else
+        {
+            k = i;
+        }
+    }
+
+    if( time )
+    {
+        Output("  Apply Householder time: ",applyHouseTimer.Total());
+        Output("  Round time:             ",roundTimer.Total());
+    }
+
+    return numInsertions;
+}
+
+
+// Recursive (segmented) LLL
+// =========================
+// The two halves of the basis are independently reduced (as OpenMP tasks
+// when Elemental is built with EL_HYBRID) before being merged, which
+// involves a Householder QR factorization of the combined basis, a blocked
+// (Level 3) size-reduction of the right half against the left half, and
+// finally the usual LLL loop starting from the first column of the right
+// half. Since the columns of the right half only need to be re-expanded
+// once they are invalidated by a swap, merges which involve few swaps are
+// almost entirely Level 3.
+//
+// A distributed analogue, where the segments are reduced by different
+// teams of processes, would be a natural extension.
+
+// Size-reduce the columns B(:,k:n) via the nearest-plane algorithm, assuming
+// that the upper triangle of QR contains the R factor of B and that the
+// columns B(:,0:k) are already size-reduced. The columns B(:,k:n) are first
+// reduced against each other, with the resulting unimodular transformation
+// applied to B via Trmm, and then against B(:,0:k), where the diagonal blocks
+// of R are traversed from the bottom-right to the top-left so that all but
+// the updates within each diagonal block can be performed with Gemm. The
+// R factor (and the Householder reflectors) are kept up to date.
+template<typename F>
+void BlockSizeReduce( Int k, Matrix<F>& B, Matrix<F>& QR )
+{
+    DEBUG_ONLY(CSE cse("lll::BlockSizeReduce"))
+    const Int n = B.Width();
+    const Int nRight = n-k;
+    F* QRBuf = QR.Buffer();
+    const Int QRLDim = QR.LDim();
+
+    Matrix<F> U;
+    Identity( U, nRight, nRight );
+    F* UBuf = U.Buffer();
+    const Int ULDim = U.LDim();
+    for( Int j=1; j<nRight; ++j )
+    {
+        F* rj = &QRBuf[(k+j)*QRLDim];
+        for( Int i=j-1; i>=0; --i )
+        {
+            const F* ri = &QRBuf[(k+i)*QRLDim];
+            const F chi = Round(rj[k+i]/ri[k+i]);
+            if( chi == F(0) )
+                continue;
+            blas::Axpy( k+i+1, -chi, ri, 1, rj, 1 );
+            blas::Axpy( i+1, -chi, &UBuf[i*ULDim], 1, &UBuf[j*ULDim], 1 );
+        }
+    }
+    auto BR = B( ALL, IR(k,n) );
+    Trmm( RIGHT, UPPER, NORMAL, UNIT, F(1), U, BR );
+
+    auto R11 = QR( IR(0,k), IR(0,k) );
+    auto R12 = QR( IR(0,k), IR(k,n) );
+    F* R12Buf = R12.Buffer();
+    const F* R11Buf = R11.LockedBuffer();
+    const Int R11LDim = R11.LDim();
+    const Int R12LDim = R12.LDim();
+
+    Matrix<F> X;
+    Zeros( X, k, nRight );
+    F* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
+
+    const Int bsize = Blocksize();
+    for( Int iEnd=k; iEnd>0; iEnd-=bsize )
+    {
+        const Int iBeg = Max(iEnd-bsize,Int(0));
+        for( Int j=0; j<nRight; ++j )
+        {
+            for( Int i=iEnd-1; i>=iBeg; --i )
+            {
+                const F chi = Round(R12Buf[i+j*R12LDim]/R11Buf[i+i*R11LDim]);
+                if( chi == F(0) )
+                    continue;
+                XBuf[i+j*XLDim] = chi;
+                for( Int l=iBeg; l<=i; ++l )
+                    R12Buf[l+j*R12LDim] -= chi*R11Buf[l+i*R11LDim];
+            }
+        }
+        if( iBeg == 0 )
+            break;
+        auto R11Above = R11( IR(0,iBeg), IR(iBeg,iEnd) );
+        auto X1 = X( IR(iBeg,iEnd), ALL );
+        auto R12Above = R12( IR(0,iBeg), ALL );
+        Gemm( NORMAL, NORMAL, F(-1), R11Above, X1, F(1), R12Above );
+    }
+
+    auto BL = B( ALL, IR(0,k) );
+    Gemm( NORMAL, NORMAL, F(-1), BL, X, F(1), BR );
+}
+
+template<typename F>
+Int RecursiveAlg
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Base<F> loopTol,
+  Int cutoff,
+  bool progress,
+  bool time )
+{
+    DEBUG_ONLY(CSE cse("lll::RecursiveAlg"))
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    // NOTE: The timers of the unblocked algorithm are shared and so they
+    //       are not used within the (possibly concurrent) recursion
+    if( n <= Max(cutoff,Int(2)) )
+        return lll::UnblockedAlg( B, QR, delta, loopTol, false, false );
+
+    const Int n1 = n/2;
+    auto BL = B( ALL, IR(0,n1) );
+    auto BR = B( ALL, IR(n1,n) );
+    Matrix<F> QRL, QRR;
+    Int numLeft=0, numRight=0;
+    auto reduceLeft =
+      [&]()
+      { numLeft =
+          RecursiveAlg( BL, QRL, delta, loopTol, cutoff, progress, time ); };
+    auto reduceRight =
+      [&]()
+      { numRight =
+          RecursiveAlg( BR, QRR, delta, loopTol, cutoff, progress, time ); };
+#ifdef EL_HYBRID
+    if( omp_in_parallel() )
+    {
+        std::exception_ptr except;
+        #pragma omp task default(shared)
+        {
+            try { reduceLeft(); }
+            catch( ... ) { except = std::current_exception(); }
+        }
+        // Keep the right half on this thread
+        std::exception_ptr exceptRight;
+        try { reduceRight(); }
+        catch( ... ) { exceptRight = std::current_exception(); }
+        #pragma omp taskwait
+        if( except )
+            std::rethrow_exception( except );
+        if( exceptRight )
+            std::rethrow_exception( exceptRight );
+    }
+    else
+#endif
+    {
+        reduceLeft();
+        reduceRight();
+    }
+    QRL.Empty();
+    QRR.Empty();
+
+    // Merge the two halves
+    Timer timer;
+    if( time )
+        timer.Start();
+    const Real zeroTol = Pow(Epsilon<Real>(),Real(0.5));
+    Matrix<F> t;
+    Matrix<Real> d;
+    QR = B;
+    El::QR( QR, t, d );
+    lll::BlockSizeReduce( n1, B, QR );
+    const Int numMerge =
+      lll::UnblockedLoop
+      ( n1, n, B, QR, t, d, delta, loopTol, zeroTol, false, false );
+    if( progress || time )
+    {
+        ostringstream os;
+        os << "Merged " << n1 << " and " << n-n1 << " columns with "
+           << numMerge << " swaps";
+        if( time )
+            os << " in " << timer.Stop() << " seconds";
+        Output( os.str() );
+    }
+
+    return numLeft + numRight + numMerge;
+}
+
 } // namespace lll
 
 template<typename F>
@@ -617,6 +931,74 @@ Int LLL
         return lll::UnblockedAlg( B, QR, delta, loopTol, progress, time );
 }
 
+template<typename F>
+Int DeepLLL
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Int depth,
+  Base<F> loopTol,
+  bool progress,
+  bool time )
+{
+    DEBUG_ONLY(CSE cse("DeepLLL"))
+    typedef Base<F> Real;
+    if( delta > Real(1) )
+        LogicError("delta is assumed to be at most 1");
+
+    // Force the input to be integer-valued; it would be okay to assume this
+    Round( B );
+
+    return lll::DeepAlg( B, QR, delta, depth, loopTol, progress, time );
+}
+
+template<typename F>
+Int RecursiveLLL
+( Matrix<F>& B,
+  Matrix<F>& QR,
+  Base<F> delta,
+  Base<F> loopTol,
+  Int cutoff,
+  bool progress,
+  bool time )
+{
+    DEBUG_ONLY(CSE cse("RecursiveLLL"))
+    typedef Base<F> Real;
+    if( delta > Real(1) )
+        LogicError("delta is assumed to be at most 1");
+
+    // Force the input to be integer-valued; it would be okay to assume this
+    Round( B );
+
+    Int numBacktrack = 0;
+#ifdef EL_HYBRID
+    // The tasks are generated by the master thread, which owns the call
+    // stack, and any exception is rethrown outside of the parallel region
+    if( !omp_in_parallel() && omp_get_max_threads() > 1 )
+    {
+        std::exception_ptr except;
+        #pragma omp parallel
+        {
+            #pragma omp master
+            {
+                try
+                {
+                    numBacktrack = lll::RecursiveAlg
+                    ( B, QR, delta, loopTol, cutoff, progress, time );
+                }
+                catch( ... ) { except = std::current_exception(); }
+            }
+        }
+        if( except )
+            std::rethrow_exception( except );
+        return numBacktrack;
+    }
+#endif
+    numBacktrack =
+      lll::RecursiveAlg( B, QR, delta, loopTol, cutoff, progress, time );
+    return numBacktrack;
+}
+
 template<typename F>
 Base<F> LLLDelta( const Matrix<F>& QR )
 {
@@ -680,9 +1062,27 @@ Base<F> LLLDelta( const Matrix<F>& QR )
     bool smallestFirst, \
     bool progress, \
     bool time ); \
+  template Int DeepLLL \
+  ( Matrix<F>& B, \
+    Matrix<F>& QR, \
+    Base<F> delta, \
+    Int depth, \
+    Base<F> loopTol, \
+    bool progress, \
+    bool time ); \
+  template Int RecursiveLLL \
+  ( Matrix<F>& B, \
+    Matrix<F>& QR, \
+    Base<F> delta, \
+    Base<F> loopTol, \
+    Int cutoff, \
+    bool progress, \
+    bool time ); \
   template Base<F> LLLDelta( const Matrix<F>& QR );
 
 #define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -51,6 +51,8 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
   template void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
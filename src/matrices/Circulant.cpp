@@ -35,6 +35,8 @@ void Circulant( AbstractDistMatrix<T>& A, const vector<T>& a )
   template void Circulant( AbstractDistMatrix<T>& A, const vector<T>& a );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -142,6 +142,8 @@ void Diagonal( DistSparseMatrix<S>& D, const DistMultiVec<T>& d )
   PROTO_TYPES(S,S)
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -121,6 +121,8 @@ void DynamicRegCounter( DistSparseMatrix<T>& A, Int n )
   template void DynamicRegCounter( DistSparseMatrix<T>& A, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -36,6 +36,8 @@ void Fiedler( AbstractDistMatrix<F>& A, const vector<F>& c )
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -33,6 +33,8 @@ void GCDMatrix( AbstractDistMatrix<T>& G, Int m, Int n )
   template void GCDMatrix( AbstractDistMatrix<T>& G, Int m, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -50,6 +50,8 @@ void GEPPGrowth( ElementalMatrix<T>& A, Int n )
   template void GEPPGrowth( ElementalMatrix<T>& A, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -45,6 +45,8 @@ void Gear( AbstractDistMatrix<T>& G, Int n, Int s, Int t )
   template void Gear( AbstractDistMatrix<T>& G, Int n, Int s, Int t );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
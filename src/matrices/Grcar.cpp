@@ -41,6 +41,8 @@ void Grcar( AbstractDistMatrix<T>& A, Int n, Int k )
   template void Grcar( AbstractDistMatrix<T>& A, Int n, Int k );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -41,6 +41,8 @@ void Hankel( AbstractDistMatrix<T>& A, Int m, Int n, const vector<T>& a )
   ( AbstractDistMatrix<T>& A, Int m, Int n, const vector<T>& a );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
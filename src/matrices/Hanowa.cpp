@@ -72,6 +72,8 @@ void Hanowa( ElementalMatrix<T>& A, Int n, T mu )
   template void Hanowa( ElementalMatrix<T>& A, Int n, T mu );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
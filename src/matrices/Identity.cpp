@@ -81,6 +81,8 @@ void Identity( DistSparseMatrix<T>& I, Int m, Int n )
   template void Identity( DistSparseMatrix<T>& I, Int m, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
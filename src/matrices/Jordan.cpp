@@ -33,6 +33,8 @@ void Jordan( AbstractDistMatrix<T>& J, Int n, T lambda )
   template void Jordan( AbstractDistMatrix<T>& J, Int n, T lambda );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
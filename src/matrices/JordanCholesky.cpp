@@ -95,6 +95,8 @@ void JordanCholesky( DistSparseMatrix<T>& A, Int n )
   template void JordanCholesky( DistSparseMatrix<T>& A, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -39,6 +39,8 @@ void KMS( AbstractDistMatrix<T>& K, Int n, T rho )
   template void KMS( AbstractDistMatrix<T>& K, Int n, T rho );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -135,6 +135,8 @@ void Laplacian( DistSparseMatrix<F>& L, Int nx, Int ny, Int nz )
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -44,6 +44,8 @@ void Lauchli( ElementalMatrix<T>& A, Int n, T mu )
   template void Lauchli( ElementalMatrix<T>& A, Int n, T mu );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
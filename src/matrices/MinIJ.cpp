@@ -33,6 +33,8 @@ void MinIJ( AbstractDistMatrix<T>& M, Int n )
   template void MinIJ( AbstractDistMatrix<T>& M, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -35,6 +35,8 @@ void OneTwoOne( AbstractDistMatrix<T>& A, Int n )
   template void OneTwoOne( AbstractDistMatrix<T>& A, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -58,6 +58,8 @@ void Ones( DistSparseMatrix<T>& A, Int m, Int n )
   template void Ones( DistSparseMatrix<T>& A, Int m, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
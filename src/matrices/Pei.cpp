@@ -31,6 +31,8 @@ void Pei( AbstractDistMatrix<T>& P, Int n, T alpha )
   template void Pei( AbstractDistMatrix<T>& P, Int n, T alpha );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
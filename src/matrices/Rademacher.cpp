@@ -29,6 +29,8 @@ void Rademacher( AbstractDistMatrix<T>& A, Int m, Int n )
   template void Rademacher( AbstractDistMatrix<T>& A, Int m, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
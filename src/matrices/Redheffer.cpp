@@ -39,6 +39,8 @@ void Redheffer( AbstractDistMatrix<T>& R, Int n )
   template void Redheffer( AbstractDistMatrix<T>& R, Int n );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -42,6 +42,8 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
   ( AbstractDistMatrix<T>& A, Int m, Int n, double p );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -39,6 +39,8 @@ void TriW( AbstractDistMatrix<T>& A, Int n, T alpha, Int k )
   template void TriW( AbstractDistMatrix<T>& A, Int n, T alpha, Int k );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
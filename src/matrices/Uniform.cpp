@@ -78,6 +78,8 @@ void Uniform( DistMultiVec<T>& A, Int m, Int n, T center, Base<T> radius )
   ( DistMultiVec<T>& A, Int m, Int n, T center, Base<T> radius );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
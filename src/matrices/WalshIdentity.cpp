@@ -46,6 +46,8 @@ void WalshIdentity( ElementalMatrix<T>& A, Int k, bool binary )
   template void WalshIdentity( ElementalMatrix<T>& A, Int k, bool binary );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -33,6 +33,8 @@ void Wigner( ElementalMatrix<F>& A, Int n, F mean, Base<F> stddev )
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
@@ -45,6 +45,8 @@ void Wilkinson( AbstractDistMatrix<T>& A, Int k )
   template void Wilkinson( AbstractDistMatrix<T>& A, Int k );
 
 #define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
 #include "El/macros/Instantiate.h"
 
 } // namespace El
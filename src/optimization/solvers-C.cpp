@@ -14,6 +14,28 @@ extern "C" {
 
 /* Mehrotra Predictor-Corrector IPM
    ================================ */
+ElError ElGondzioCtrlDefault_s( ElGondzioCtrl_s* ctrl )
+{
+    ctrl->maxCorrectors = 0;
+    ctrl->adaptive = true;
+    ctrl->stepIncrease = 0.1;
+    ctrl->minImprovement = 0.1;
+    ctrl->betaMin = 0.1;
+    ctrl->betaMax = 10;
+    return EL_SUCCESS;
+}
+
+ElError ElGondzioCtrlDefault_d( ElGondzioCtrl_d* ctrl )
+{
+    ctrl->maxCorrectors = 0;
+    ctrl->adaptive = true;
+    ctrl->stepIncrease = 0.1;
+    ctrl->minImprovement = 0.1;
+    ctrl->betaMin = 0.1;
+    ctrl->betaMax = 10;
+    return EL_SUCCESS;
+}
+
 ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
 {
     ctrl->primalInit = false;
@@ -24,6 +46,7 @@ ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
     ctrl->mehrotra = true;
+    ElGondzioCtrlDefault_s( &ctrl->gondzioCtrl );
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_s( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
@@ -57,6 +80,7 @@ ElError ElMehrotraCtrlDefault_d( ElMehrotraCtrl_d* ctrl )
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
     ctrl->mehrotra = true;
+    ElGondzioCtrlDefault_d( &ctrl->gondzioCtrl );
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_d( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
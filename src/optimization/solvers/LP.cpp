@@ -31,6 +31,25 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const Matrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c, 
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LP"))
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra
+        ( A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void LP
 ( const Matrix<Real>& A,
@@ -70,6 +89,25 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const ElementalMatrix<Real>& A, 
+  const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z, 
+        DistMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LP"))
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra
+        ( A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void LP
 ( const ElementalMatrix<Real>& A,
@@ -107,6 +145,25 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c, 
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LP"))
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra
+        ( A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void LP
 ( const SparseMatrix<Real>& A,
@@ -144,6 +201,25 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DistSparseMatrix<Real>& A, 
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c, 
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z, 
+        DistSparseMehrotraSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LP"))
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra
+        ( A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void LP
 ( const DistSparseMatrix<Real>& A,
@@ -174,6 +250,15 @@ void LP
           Matrix<Real>& z, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& G, \
     const Matrix<Real>& b, \
@@ -193,6 +278,15 @@ void LP
           ElementalMatrix<Real>& z, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const ElementalMatrix<Real>& A, \
+    const ElementalMatrix<Real>& b, \
+    const ElementalMatrix<Real>& c, \
+          ElementalMatrix<Real>& x, \
+          ElementalMatrix<Real>& y, \
+          ElementalMatrix<Real>& z, \
+          DistMehrotraSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& G, \
     const ElementalMatrix<Real>& b, \
@@ -212,6 +306,15 @@ void LP
           Matrix<Real>& z, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const SparseMatrix<Real>& A, \
     const SparseMatrix<Real>& G, \
     const Matrix<Real>& b, \
@@ -231,6 +334,15 @@ void LP
           DistMultiVec<Real>& z, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistSparseMehrotraSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const DistSparseMatrix<Real>& A, \
     const DistSparseMatrix<Real>& G, \
     const DistMultiVec<Real>& b, \
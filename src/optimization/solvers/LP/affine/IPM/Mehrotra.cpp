@@ -115,10 +115,12 @@ void Mehrotra
     Matrix<Real> J, d,
                  rmu,   rc,    rb,    rh,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCorr, dyCorr, dzCorr, dsCorr, rmuCorr;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -198,6 +200,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -253,6 +256,8 @@ void Mehrotra
              dzErrorNrm2/(1+rhNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -276,6 +281,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -307,6 +313,70 @@ void Mehrotra
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Solve for the direction
+                // -----------------------
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -456,16 +526,22 @@ void Mehrotra
     DistMatrix<Real> J(grid),     d(grid), 
                      rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                      dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
-                     dx(grid),    dy(grid),    dz(grid),    ds(grid);
+                     dx(grid),    dy(grid),    dz(grid),    ds(grid),
+                     dxCorr(grid), dyCorr(grid), dzCorr(grid), dsCorr(grid),
+                     rmuCorr(grid);
     dsAff.AlignWith( s );
     dzAff.AlignWith( s );
     ds.AlignWith( s );
     dz.AlignWith( s );
     rmu.AlignWith( s );
+    dzCorr.AlignWith( s );
+    dsCorr.AlignWith( s );
+    rmuCorr.AlignWith( s );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -546,6 +622,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
         // r_mu := s o z
         // -------------
         rmu = z;
@@ -599,6 +676,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rhNrm2));
         }
  
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -622,6 +701,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -653,6 +733,71 @@ void Mehrotra
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            grid.Comm() );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Solve for the direction
+                // -----------------------
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -796,15 +941,18 @@ void Mehrotra
 
     SparseMatrix<Real> J, JOrig;
     ldl::Front<Real> JFront;
+    ldl::FrontPullMeta JFrontMeta;
     Matrix<Real> d,
                  w,
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCorr, dyCorr, dzCorr, dsCorr, rmuCorr;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -888,6 +1036,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -916,7 +1065,7 @@ void Mehrotra
             else
                 Ones( dInner, J.Height(), 1 );
 
-            JFront.Pull( J, map, info );
+            JFront.Pull( J, map, info, JFrontMeta );
 
             LDL( info, JFront, LDL_2D );
             if( ctrl.resolveReg )
@@ -967,6 +1116,8 @@ void Mehrotra
              dzErrorNrm2/(1+rhNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -990,6 +1141,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -1031,6 +1183,81 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Solve for the proposed step
+                // ---------------------------
+                try
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -1211,16 +1438,20 @@ void Mehrotra
 
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
+    ldl::DistFrontPullMeta JFrontMeta;
     DistMultiVec<Real> d(comm),
                        w(comm),
                        rc(comm),    rb(comm),    rh(comm),    rmu(comm),
                        dxAff(comm), dyAff(comm), dzAff(comm), dsAff(comm),
-                       dx(comm),    dy(comm),    dz(comm),    ds(comm);
+                       dx(comm),    dy(comm),    dz(comm),    ds(comm),
+                       dxCorr(comm), dyCorr(comm), dzCorr(comm), dsCorr(comm),
+                       rmuCorr(comm);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1305,6 +1536,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -1339,8 +1571,7 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            JFront.Pull
-            ( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
+            JFront.Pull( J, map, rootSep, info, JFrontMeta );
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1401,6 +1632,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rhNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -1424,6 +1657,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -1469,6 +1703,87 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            comm );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Solve for the direction
+                // -----------------------
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          dmvMeta, ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          dmvMeta, ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Corrector: ",timer.Stop()," secs");
+                }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
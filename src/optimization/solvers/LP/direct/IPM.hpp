@@ -23,12 +23,32 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(false) );
 template<typename Real>
 void Mehrotra
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(false) );
+template<typename Real>
+void Mehrotra
+( const ElementalMatrix<Real>& A,
+  const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(false) );
+template<typename Real>
+void Mehrotra
 ( const ElementalMatrix<Real>& A,
   const ElementalMatrix<Real>& b,
   const ElementalMatrix<Real>& c,
         ElementalMatrix<Real>& x,
         ElementalMatrix<Real>& y,
         ElementalMatrix<Real>& z,
+        DistMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(false) );
 template<typename Real>
 void Mehrotra
@@ -41,12 +61,32 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(true) );
 template<typename Real>
 void Mehrotra
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(true) );
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y, 
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(true) );
+template<typename Real>
+void Mehrotra
 ( const DistSparseMatrix<Real>& A,
   const DistMultiVec<Real>& b,
   const DistMultiVec<Real>& c,
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y, 
         DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>(true) );
 
 // NOTE: This should be in a different header
@@ -40,6 +40,7 @@ void Mehrotra
         Matrix<Real>& x, 
         Matrix<Real>& y, 
         Matrix<Real>& z,
+        MehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
@@ -66,16 +67,46 @@ void Mehrotra
     const Int n = A.Width();
     const Int degree = n;
     Real bScale, cScale;
-    Matrix<Real> dRow, dCol;
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -86,11 +117,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -107,6 +138,7 @@ void Mehrotra
         cScale = 1;
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -120,17 +152,21 @@ void Mehrotra
     }
 
     Initialize
-    ( A, b, c, x, y, z, ctrl.primalInit, ctrl.dualInit, standardShift ); 
+    ( A, b, c, x, y, z, primalInit, dualInit, standardShift ); 
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
 
     Real muOld = 0.1;
     Real relError = 1;
     Matrix<Real> J, d, 
                  rb,    rc,    rmu,
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCorr, dyCorr, dzCorr, rmuCorr;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -202,6 +238,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -314,6 +351,8 @@ void Mehrotra
              dzErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -337,6 +376,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -409,6 +449,98 @@ void Mehrotra
         }
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == NORMAL_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    NormalKKTRHS( A, gamma, x, z, rc, rb, rmuCorr, dyCorr );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, dyCorr, false ); }
+                    catch(...) { break; }
+                    ExpandNormalSolution
+                    ( A, gamma, x, z, rc, rmuCorr, dxCorr, dyCorr, dzCorr );
+                }
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -463,6 +595,25 @@ void Mehrotra
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const Matrix<Real>& A, 
+  const Matrix<Real>& b, 
+  const Matrix<Real>& c,
+        Matrix<Real>& x, 
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))
+    MehrotraSession<Real> session;
+    Mehrotra( A, b, c, x, y, z, session, ctrl );
 }
 
 template<typename Real>
@@ -473,6 +624,7 @@ void Mehrotra
         ElementalMatrix<Real>& xPre, 
         ElementalMatrix<Real>& yPre,
         ElementalMatrix<Real>& zPre,
+        DistMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
@@ -492,6 +644,8 @@ void Mehrotra
     const Real delta = 0;
 
     const Grid& grid = APre.Grid();
+    if( session.x.Grid() != grid )
+        LogicError("The session was formed over a different grid");
     const int commRank = grid.Rank();
 
     // Ensure that the inputs have the appropriate read/write properties
@@ -510,31 +664,60 @@ void Mehrotra
     control.rowAlign = 0;
 
     DistMatrixReadWriteProxy<Real,Real,MC,MR>
-    // NOTE: x does not need to be a read proxy when !ctrl.primalInit
+    // NOTE: x does not need to be a read proxy when !primalInit
       xProx( xPre, control ),
-    // NOTE: {y,z} do not need to be read proxies when !ctrl.dualInit
+    // NOTE: {y,z} do not need to be read proxies when !dualInit
       yProx( yPre, control ),
       zProx( zPre, control );
     auto& x = xProx.Get();
     auto& y = yProx.Get();
     auto& z = zProx.Get();
 
-    // Equilibrate the LP by diagonally scaling A
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
     Real bScale, cScale;
-    DistMatrix<Real,MC,STAR> dRow(grid);
-    DistMatrix<Real,MR,STAR> dCol(grid);
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    // Equilibrate the LP by diagonally scaling A
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -545,11 +728,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -566,6 +749,7 @@ void Mehrotra
         cScale = 1;
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -582,7 +766,9 @@ void Mehrotra
     }
 
     Initialize
-    ( A, b, c, x, y, z, ctrl.primalInit, ctrl.dualInit, standardShift ); 
+    ( A, b, c, x, y, z, primalInit, dualInit, standardShift ); 
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
 
     Real muOld = 0.1;
     Real relError = 1;
@@ -590,16 +776,21 @@ void Mehrotra
         J(grid), d(grid), 
         rc(grid),    rb(grid),    rmu(grid), 
         dxAff(grid), dyAff(grid), dzAff(grid),
-        dx(grid),    dy(grid),    dz(grid);
+        dx(grid),    dy(grid),    dz(grid),
+        dxCorr(grid), dyCorr(grid), dzCorr(grid), rmuCorr(grid);
     dx.AlignWith( x );
     dz.AlignWith( x );
     dxAff.AlignWith( x );
     dzAff.AlignWith( x );
     rmu.AlignWith( x );
+    dxCorr.AlignWith( x );
+    dzCorr.AlignWith( x );
+    rmuCorr.AlignWith( x );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -672,6 +863,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -785,6 +977,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rmuNrm2)); 
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -808,6 +1002,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -880,6 +1075,99 @@ void Mehrotra
         }
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            grid.Comm() );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == NORMAL_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    NormalKKTRHS( A, gamma, x, z, rc, rb, rmuCorr, dyCorr );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, dyCorr, false ); }
+                    catch(...) { break; }
+                    ExpandNormalSolution
+                    ( A, gamma, x, z, rc, rmuCorr, dxCorr, dyCorr, dzCorr );
+                }
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -935,6 +1223,25 @@ void Mehrotra
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const ElementalMatrix<Real>& A, 
+  const ElementalMatrix<Real>& b, 
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x, 
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))
+    DistMehrotraSession<Real> session( A.Grid() );
+    Mehrotra( A, b, c, x, y, z, session, ctrl );
 }
 
 template<typename Real>
@@ -945,6 +1252,7 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y, 
         Matrix<Real>& z,
+        MehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
@@ -982,16 +1290,46 @@ void Mehrotra
     const Int n = A.Width();
     const Int degree = n;
     Real bScale, cScale;
-    Matrix<Real> dRow, dCol;
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -1002,11 +1340,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -1023,6 +1361,7 @@ void Mehrotra
         cScale = 1;
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1036,17 +1375,23 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    // Reuse the analysis of the KKT system from the previous solve of the
+    // session if the problem has the same structure
+    const bool analyzed = session.Analyzed( APre, ctrl.system );
+    if( !analyzed )
+        session.ResetAnalysis();
+    auto& map = session.map;
+    auto& invMap = session.invMap;
+    auto& info = *session.info;
+    auto& rootSep = *session.rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && !analyzed )
     {
         Initialize
         ( A, b, c, x, y, z, map, invMap, rootSep, info,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
@@ -1055,8 +1400,10 @@ void Mehrotra
         ldl::Separator augRootSep;
         Initialize
         ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1086,17 +1433,20 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     SparseMatrix<Real> J, JOrig;
-    ldl::Front<Real> JFront;
+    auto& JFront = *session.front;
+    auto& JFrontMeta = session.frontMeta;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCorr, dyCorr, dzCorr, rmuCorr;
 
     Real muOld = 0.1;
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1176,6 +1526,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1220,12 +1571,12 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 )
+                if( numIts == 0 && !analyzed )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
                 }
-                JFront.Pull( J, map, info );
+                JFront.Pull( J, map, info, JFrontMeta );
 
                 LDL( info, JFront, LDL_2D );
                 if( ctrl.resolveReg )
@@ -1264,12 +1615,12 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == 0 && !analyzed )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
                 }
-                JFront.Pull( J, map, info );
+                JFront.Pull( J, map, info, JFrontMeta );
 
                 LDL( info, JFront, LDL_2D );
                 // NOTE: regTmp should be all zeros; replace with unregularized
@@ -1322,6 +1673,8 @@ void Mehrotra
              dzErrorNrm2/(1+rmuNrm2)); 
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -1345,10 +1698,10 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
-        // TODO: Gondzio's corrections 
         if( ctrl.mehrotra )
         {
             // r_mu += dxAff o dzAff
@@ -1432,6 +1785,113 @@ void Mehrotra
         }
         // TODO: Residual checks 
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+                    try
+                    {
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                    }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+                    try
+                    {
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                    }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else
+                {
+                    NormalKKTRHS( A, gamma, x, z, rc, rb, rmuCorr, dyCorr );
+                    try
+                    {
+                        reg_ldl::RegularizedSolveAfter
+                        ( J, regTmp, invMap, info, JFront, dyCorr,
+                          ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                    }
+                    catch(...) { break; }
+                    ExpandNormalSolution
+                    ( A, gamma, x, z, rc, rmuCorr, dxCorr, dyCorr, dzCorr );
+                }
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -1488,6 +1948,26 @@ void Mehrotra
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+    session.RecordAnalysis( APre, ctrl.system );
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))
+    MehrotraSession<Real> session;
+    Mehrotra( A, b, c, x, y, z, session, ctrl );
 }
 
 // TODO: Not use temporary regularization except in final iterations?
@@ -1499,6 +1979,7 @@ void Mehrotra
         DistMultiVec<Real>& x, 
         DistMultiVec<Real>& y, 
         DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
@@ -1540,20 +2021,50 @@ void Mehrotra
     const Int n = A.Width();
     const Int degree = n;
     Real bScale, cScale;
-    DistMultiVec<Real> dRow(comm), dCol(comm);
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
         if( commRank == 0 && ctrl.time )
             timer.Start();
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
         if( commRank == 0 && ctrl.time )
             Output("RuizEquil: ",timer.Stop()," secs");
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -1564,11 +2075,11 @@ void Mehrotra
         cScale = Max(MaxNorm(c),Real(1));
         b *= Real(1)/bScale;
         c *= Real(1)/cScale;
-        if( ctrl.primalInit )
+        if( primalInit )
         {
             x *= Real(1)/bScale;
         }
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             y *= Real(1)/cScale;
             z *= Real(1)/cScale;
@@ -1585,6 +2096,7 @@ void Mehrotra
         cScale = 1;
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1603,21 +2115,27 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
+    // Reuse the analysis of the KKT system from the previous solve of the
+    // session if the problem has the same structure
+    const bool analyzed = session.Analyzed( APre, ctrl.system );
+    if( !analyzed )
+        session.ResetAnalysis();
+    auto& map = session.map;
+    auto& invMap = session.invMap;
+    auto& info = *session.info;
+    auto& rootSep = *session.rootSep;
     vector<Int> mappedSources, mappedTargets, colOffs;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && !analyzed )
     {
         Initialize
         ( A, b, c, x, y, z, map, invMap, rootSep, info, 
           mappedSources, mappedTargets, colOffs,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
@@ -1628,8 +2146,10 @@ void Mehrotra
         Initialize
         ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
           augMappedSources, augMappedTargets, augColOffs,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1664,18 +2184,21 @@ void Mehrotra
 
     DistSparseMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
-    ldl::DistFront<Real> JFront;
+    auto& JFront = *session.front;
+    auto& JFrontMeta = session.frontMeta;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
                        dxAff(comm), dyAff(comm), dzAff(comm),
-                       dx(comm),    dy(comm),    dz(comm);
+                       dx(comm),    dy(comm),    dz(comm),
+                       dxCorr(comm), dyCorr(comm), dzCorr(comm), rmuCorr(comm);
 
     Real muOld = 0.1;
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1752,6 +2275,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1796,12 +2320,16 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
-                    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-                    if( commRank == 0 && ctrl.time )
-                        Output("ND: ",timer.Stop()," secs");
-                    InvertMap( map, invMap );
+                    if( !analyzed )
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        NestedDissection
+                        ( J.LockedDistGraph(), map, rootSep, info );
+                        if( commRank == 0 && ctrl.time )
+                            Output("ND: ",timer.Stop()," secs");
+                        InvertMap( map, invMap );
+                    }
                 }
                 else
                     J.multMeta = meta;
@@ -1826,9 +2354,7 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                JFront.Pull( J, map, rootSep, info, JFrontMeta );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1887,18 +2413,20 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
-                    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-                    if( commRank == 0 && ctrl.time )
-                        Output("ND: ",timer.Stop()," secs");
-                    InvertMap( map, invMap );
+                    if( !analyzed )
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        NestedDissection
+                        ( J.LockedDistGraph(), map, rootSep, info );
+                        if( commRank == 0 && ctrl.time )
+                            Output("ND: ",timer.Stop()," secs");
+                        InvertMap( map, invMap );
+                    }
                 }
                 else
                     J.multMeta = meta;
-                JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                JFront.Pull( J, map, rootSep, info, JFrontMeta );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1960,6 +2488,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rmuNrm2)); 
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -1983,6 +2513,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -2080,6 +2611,126 @@ void Mehrotra
         }
         // TODO: Residual checks 
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            comm );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+                    try
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                        if( commRank == 0 && ctrl.time )
+                            Output("Corrector: ",timer.Stop()," secs");
+                    }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+                    try
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                        if( commRank == 0 && ctrl.time )
+                            Output("Corrector: ",timer.Stop()," secs");
+                    }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else
+                {
+                    NormalKKTRHS( A, gamma, x, z, rc, rb, rmuCorr, dyCorr );
+                    try
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        reg_ldl::RegularizedSolveAfter
+                        ( J, regTmp, invMap, info, JFront, dyCorr, dmvMeta,
+                          ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
+                        if( commRank == 0 && ctrl.time )
+                            Output("Corrector: ",timer.Stop()," secs");
+                    }
+                    catch(...) { break; }
+                    ExpandNormalSolution
+                    ( A, gamma, x, z, rc, rmuCorr, dxCorr, dyCorr, dzCorr );
+                }
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -2135,8 +2786,29 @@ void Mehrotra
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
     }
+    session.RecordAnalysis( APre, ctrl.system );
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& A, 
+  const DistMultiVec<Real>& b, 
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x, 
+        DistMultiVec<Real>& y, 
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))
+    DistSparseMehrotraSession<Real> session( A.Comm() );
+    Mehrotra( A, b, c, x, y, z, session, ctrl );
 }
 
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const Matrix<Real>& A, \
@@ -2147,6 +2819,15 @@ void Mehrotra
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& b, \
     const ElementalMatrix<Real>& c, \
@@ -2155,12 +2836,38 @@ void Mehrotra
           ElementalMatrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const ElementalMatrix<Real>& A, \
+    const ElementalMatrix<Real>& b, \
+    const ElementalMatrix<Real>& c, \
+          ElementalMatrix<Real>& x, \
+          ElementalMatrix<Real>& y, \
+          ElementalMatrix<Real>& z, \
+          DistMehrotraSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
   ( const DistSparseMatrix<Real>& A, \
@@ -2169,6 +2876,7 @@ void Mehrotra
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
+          DistSparseMehrotraSession<Real>& session, \
     const MehrotraCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
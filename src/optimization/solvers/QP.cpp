@@ -32,6 +32,26 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const Matrix<Real>& Q, 
+  const Matrix<Real>& A,
+  const Matrix<Real>& b, 
+  const Matrix<Real>& c, 
+        Matrix<Real>& x, 
+        Matrix<Real>& y,
+        Matrix<Real>& z, 
+        MehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("QP"))
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void QP
 ( const ElementalMatrix<Real>& Q, 
@@ -50,6 +70,26 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const ElementalMatrix<Real>& Q, 
+  const ElementalMatrix<Real>& A,
+  const ElementalMatrix<Real>& b, 
+  const ElementalMatrix<Real>& c, 
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+        DistMehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("QP"))
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void QP
 ( const SparseMatrix<Real>& Q, 
@@ -68,6 +108,26 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q, 
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b, 
+  const Matrix<Real>& c, 
+        Matrix<Real>& x, 
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("QP"))
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void QP
 ( const DistSparseMatrix<Real>& Q,
@@ -86,6 +146,26 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c, 
+        DistMultiVec<Real>& x, 
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("QP"))
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 // Affine conic form
 // =================
 template<typename Real>
@@ -183,6 +263,25 @@ void QP
           Matrix<Real>& z, \
     const qp::direct::Ctrl<Real>& ctrl ); \
   template void QP \
+  ( const Matrix<Real>& Q, \
+    const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const ElementalMatrix<Real>& Q, \
+    const ElementalMatrix<Real>& A, \
+    const ElementalMatrix<Real>& b, \
+    const ElementalMatrix<Real>& c, \
+          ElementalMatrix<Real>& x, \
+          ElementalMatrix<Real>& y, \
+          ElementalMatrix<Real>& z, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
   ( const ElementalMatrix<Real>& Q, \
     const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& b, \
@@ -190,6 +289,16 @@ void QP
           ElementalMatrix<Real>& x, \
           ElementalMatrix<Real>& y, \
           ElementalMatrix<Real>& z, \
+          DistMehrotraSession<Real>& session, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
     const qp::direct::Ctrl<Real>& ctrl ); \
   template void QP \
   ( const SparseMatrix<Real>& Q, \
@@ -199,6 +308,16 @@ void QP
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
     const qp::direct::Ctrl<Real>& ctrl ); \
   template void QP \
   ( const DistSparseMatrix<Real>& Q, \
@@ -208,6 +327,7 @@ void QP
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
+          DistSparseMehrotraSession<Real>& session, \
     const qp::direct::Ctrl<Real>& ctrl ); \
   template void QP \
   ( const Matrix<Real>& Q, \
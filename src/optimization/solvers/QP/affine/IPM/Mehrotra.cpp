@@ -123,10 +123,12 @@ void Mehrotra
     Matrix<Real> J, d,
                  rmu,   rc,    rb,    rh,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCorr, dyCorr, dzCorr, dsCorr, rmuCorr;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -208,6 +210,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -264,6 +267,8 @@ void Mehrotra
              dzErrorNrm2/(1+rhNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -287,6 +292,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -308,6 +314,67 @@ void Mehrotra
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Compute the proposed step from the KKT system
+                // ---------------------------------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                ldl::SolveAfter( J, dSub, p, d, false );
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -475,16 +542,22 @@ void Mehrotra
     DistMatrix<Real> J(grid),     d(grid), 
                      rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                      dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
-                     dx(grid),    dy(grid),    dz(grid),    ds(grid);
+                     dx(grid),    dy(grid),    dz(grid),    ds(grid),
+                     dxCorr(grid), dyCorr(grid), dzCorr(grid), dsCorr(grid),
+                     rmuCorr(grid);
     dsAff.AlignWith( s );
     dzAff.AlignWith( s );
     ds.AlignWith( s );
     dz.AlignWith( s );
     rmu.AlignWith( s );
+    dzCorr.AlignWith( s );
+    dsCorr.AlignWith( s );
+    rmuCorr.AlignWith( s );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -567,6 +640,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -633,6 +707,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rhNrm2));
         }
  
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -656,6 +732,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -694,6 +771,78 @@ void Mehrotra
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            grid.Comm() );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Form the new KKT RHS
+                // --------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Solve for the new direction
+                // ---------------------------
+                try 
+                { 
+                    if( ctrl.time && commRank == 0 )
+                        timer.Start();
+                    ldl::SolveAfter( J, dSub, p, d, false ); 
+                    if( ctrl.time && commRank == 0 )
+                        Output("Combined solve: ",timer.Stop()," secs");
+                }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -845,15 +994,18 @@ void Mehrotra
 
     SparseMatrix<Real> J, JOrig;
     ldl::Front<Real> JFront;
+    ldl::FrontPullMeta JFrontMeta;
     Matrix<Real> d,
                  w,
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxCorr, dyCorr, dzCorr, dsCorr, rmuCorr;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -940,6 +1092,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -968,7 +1121,7 @@ void Mehrotra
             else 
                 Ones( dInner, n+m+k, 1 );
 
-            JFront.Pull( J, map, info );
+            JFront.Pull( J, map, info, JFrontMeta );
 
             LDL( info, JFront, LDL_2D );
             if( ctrl.resolveReg )
@@ -1020,6 +1173,8 @@ void Mehrotra
              dzErrorNrm2/(1+rhNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -1043,6 +1198,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -1084,6 +1240,81 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Set up the new KKT RHS
+                // ----------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Solve for the new direction
+                // ---------------------------
+                try
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -1276,16 +1507,20 @@ void Mehrotra
 
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
+    ldl::DistFrontPullMeta JFrontMeta;
     DistMultiVec<Real> d(comm),
                        w(comm),
                        rc(comm),    rb(comm),    rh(comm),    rmu(comm),
                        dxAff(comm), dyAff(comm), dzAff(comm), dsAff(comm),
-                       dx(comm),    dy(comm),    dz(comm),    ds(comm);
+                       dx(comm),    dy(comm),    dz(comm),    ds(comm),
+                       dxCorr(comm), dyCorr(comm), dzCorr(comm), dsCorr(comm),
+                       rmuCorr(comm);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1376,6 +1611,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := s o z
         // -------------
@@ -1410,8 +1646,7 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            JFront.Pull
-            ( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
+            JFront.Pull( J, map, rootSep, info, JFrontMeta );
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1476,6 +1711,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rhNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter using Mehrotra's formula
         // =======================================================
         Real alphaAffPri = pos_orth::MaxStep( s, dsAff, Real(1) );
@@ -1499,6 +1736,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -1544,6 +1782,87 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            comm );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( s, ds, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                // Set up the new RHS
+                // ------------------
+                KKTRHS( rc, rb, rh, rmuCorr, z, d );
+                // Compute the new direction
+                // -------------------------
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          dmvMeta, ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          dmvMeta, ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Corrector solver: ",timer.Stop()," secs");
+                }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, s, z, dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( s, dsCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
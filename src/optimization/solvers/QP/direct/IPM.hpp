@@ -24,6 +24,27 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 template<typename Real>
 void Mehrotra
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
+( const ElementalMatrix<Real>& Q,
+  const ElementalMatrix<Real>& A,
+  const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
 ( const ElementalMatrix<Real>& Q,
   const ElementalMatrix<Real>& A,
   const ElementalMatrix<Real>& b,
@@ -31,6 +52,7 @@ void Mehrotra
         ElementalMatrix<Real>& x,
         ElementalMatrix<Real>& y,
         ElementalMatrix<Real>& z,
+        DistMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 template<typename Real>
 void Mehrotra
@@ -44,6 +66,27 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 template<typename Real>
 void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+        MehrotraSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y, 
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
 ( const DistSparseMatrix<Real>& Q,
   const DistSparseMatrix<Real>& A,
   const DistMultiVec<Real>& b,
@@ -51,6 +94,7 @@ void Mehrotra
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y, 
         DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
 } // namespace direct
@@ -41,6 +41,7 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y, 
         Matrix<Real>& z,
+        MehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
@@ -61,10 +62,40 @@ void Mehrotra
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
-    Matrix<Real> dRow, dCol;
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b );
         DiagonalSolve( LEFT, NORMAL, dCol, c );
@@ -73,9 +104,9 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -85,6 +116,7 @@ void Mehrotra
     {
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -100,16 +132,20 @@ void Mehrotra
     }
 
     Initialize
-    ( Q, A, b, c, x, y, z, ctrl.primalInit, ctrl.dualInit, standardShift ); 
+    ( Q, A, b, c, x, y, z, primalInit, dualInit, standardShift ); 
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
 
     Real relError = 1;
     Matrix<Real> J, d, 
                  rb,    rc,    rmu,
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCorr, dyCorr, dzCorr, rmuCorr;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -181,6 +217,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -269,6 +306,8 @@ void Mehrotra
              dzErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -292,6 +331,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rb *= 1-sigma;
         rc *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -347,6 +387,87 @@ void Mehrotra
             LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else
+                    LogicError("Invalid KKT system choice");
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -377,6 +498,26 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))
+    MehrotraSession<Real> session;
+    Mehrotra( Q, A, b, c, x, y, z, session, ctrl );
 }
 
 template<typename Real>
@@ -388,6 +529,7 @@ void Mehrotra
         ElementalMatrix<Real>& xPre,
         ElementalMatrix<Real>& yPre,
         ElementalMatrix<Real>& zPre,
+        DistMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
@@ -401,6 +543,8 @@ void Mehrotra
         centralityRule = MehrotraCentrality<Real>;
 
     const Grid& grid = APre.Grid();
+    if( session.x.Grid() != grid )
+        LogicError("The session was formed over a different grid");
     const int commRank = grid.Rank();
 
     // Ensure that the inputs have the appropriate read/write properties
@@ -420,25 +564,54 @@ void Mehrotra
     control.colAlign = 0;
     control.rowAlign = 0;
 
-    // NOTE: x does not need to be a read proxy when !ctrl.primalInit
+    // NOTE: x does not need to be a read proxy when !primalInit
     DistMatrixReadWriteProxy<Real,Real,MC,MR>
       xProx( xPre, control ),
-    // NOTE: {y,z} do not need to be read proxies when !ctrl.dualInit
+    // NOTE: {y,z} do not need to be read proxies when !dualInit
       yProx( yPre, control ),
       zProx( zPre, control );
     auto& x = xProx.Get();
     auto& y = yProx.Get();
     auto& z = zProx.Get();
 
-    // Equilibrate the QP by diagonally scaling A
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
-    DistMatrix<Real,MC,STAR> dRow(grid);
-    DistMatrix<Real,MR,STAR> dCol(grid);
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    // Equilibrate the QP by diagonally scaling A
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b );
         DiagonalSolve( LEFT, NORMAL, dCol, c );
@@ -447,9 +620,9 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -459,6 +632,7 @@ void Mehrotra
     {
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -477,23 +651,30 @@ void Mehrotra
     }
 
     Initialize
-    ( Q, A, b, c, x, y, z, ctrl.primalInit, ctrl.dualInit, standardShift ); 
+    ( Q, A, b, c, x, y, z, primalInit, dualInit, standardShift ); 
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
 
     Real relError = 1;
     DistMatrix<Real> 
         J(grid), d(grid), 
         rc(grid),    rb(grid),    rmu(grid), 
         dxAff(grid), dyAff(grid), dzAff(grid),
-        dx(grid),    dy(grid),    dz(grid);
+        dx(grid),    dy(grid),    dz(grid),
+        dxCorr(grid), dyCorr(grid), dzCorr(grid), rmuCorr(grid);
     dx.AlignWith( x );
     dz.AlignWith( x );
     dxAff.AlignWith( x );
     dzAff.AlignWith( x );
     rmu.AlignWith( x );
+    dxCorr.AlignWith( x );
+    dzCorr.AlignWith( x );
+    rmuCorr.AlignWith( x );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -566,6 +747,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -655,6 +837,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -678,6 +862,7 @@ void Mehrotra
 
         // Compute the combined direction
         // ==============================
+        solveTimer.Start();
         rb *= 1-sigma;
         rc *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -733,6 +918,88 @@ void Mehrotra
             LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            grid.Comm() );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    // Construct the new KKT RHS
+                    // -------------------------
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+
+                    // Solve for the direction
+                    // -----------------------
+                    try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else
+                    LogicError("Invalid KKT system choice");
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -763,6 +1030,26 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const ElementalMatrix<Real>& Q,
+  const ElementalMatrix<Real>& A, 
+  const ElementalMatrix<Real>& b,
+  const ElementalMatrix<Real>& c,
+        ElementalMatrix<Real>& x,
+        ElementalMatrix<Real>& y,
+        ElementalMatrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))
+    DistMehrotraSession<Real> session( Q.Grid() );
+    Mehrotra( Q, A, b, c, x, y, z, session, ctrl );
 }
 
 template<typename Real>
@@ -774,6 +1061,7 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y, 
         Matrix<Real>& z,
+        MehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
@@ -801,10 +1089,40 @@ void Mehrotra
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
-    Matrix<Real> dRow, dCol;
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b );
         DiagonalSolve( LEFT, NORMAL, dCol, c );
@@ -813,9 +1131,9 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -825,6 +1143,7 @@ void Mehrotra
     {
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -840,18 +1159,24 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    // Reuse the analysis of the KKT system from the previous solve of the
+    // session if the problem has the same structure
+    const bool analyzed = session.Analyzed( QPre, APre, ctrl.system );
+    if( !analyzed )
+        session.ResetAnalysis();
+    auto& map = session.map;
+    auto& invMap = session.invMap;
+    auto& info = *session.info;
+    auto& rootSep = *session.rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     // TODO: Add permanent regularization and cache J metadata
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && !analyzed )
     {
         Initialize
         ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
@@ -860,8 +1185,10 @@ void Mehrotra
         ldl::Separator augRootSep;
         Initialize
         ( Q, A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -886,16 +1213,19 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     SparseMatrix<Real> J, JOrig;
-    ldl::Front<Real> JFront;
+    auto& JFront = *session.front;
+    auto& JFrontMeta = session.frontMeta;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
                  dxAff, dyAff, dzAff,
-                 dx,    dy,    dz;
+                 dx,    dy,    dz,
+                 dxCorr, dyCorr, dzCorr, rmuCorr;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -972,6 +1302,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1009,14 +1340,14 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 && 
+                if( numIts == 0 && !analyzed &&
                     (ctrl.system == FULL_KKT || 
-                     (ctrl.primalInit && ctrl.dualInit) ) )
+                     (primalInit && dualInit) ) )
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
                 }
-                JFront.Pull( J, map, info );
+                JFront.Pull( J, map, info, JFrontMeta );
 
                 LDL( info, JFront, LDL_2D );
                 if( ctrl.resolveReg )
@@ -1076,6 +1407,8 @@ void Mehrotra
              dzErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -1099,6 +1432,7 @@ void Mehrotra
 
         // Compute the combined direction
         // ==============================
+        solveTimer.Start();
         rb *= 1-sigma;
         rc *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -1175,6 +1509,110 @@ void Mehrotra
             LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    // Form the new KKT RHS
+                    // --------------------
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+                    // Solve for the direction
+                    // -----------------------
+                    try
+                    {
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                    }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    // Form the new KKT RHS
+                    // --------------------
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+                    // Solve for the direction
+                    // -----------------------
+                    try
+                    {
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl ); 
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+
+                    }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else
+                    LogicError("Invalid KKT system choice");
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -1205,6 +1643,27 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+    session.RecordAnalysis( QPre, APre, ctrl.system );
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A, 
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y, 
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))
+    MehrotraSession<Real> session;
+    Mehrotra( Q, A, b, c, x, y, z, session, ctrl );
 }
 
 template<typename Real>
@@ -1216,6 +1675,7 @@ void Mehrotra
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y, 
         DistMultiVec<Real>& z,
+        DistSparseMehrotraSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
@@ -1247,12 +1707,42 @@ void Mehrotra
     const Int m = A.Height();
     const Int n = A.Width();
     const Int degree = n;
-    DistMultiVec<Real> dRow(comm), dCol(comm);
+    // Warm-start from the solution of the previous solve of the session
+    const auto& warmStartCtrl = session.warmStartCtrl;
+    const bool warmStart =
+      warmStartCtrl.enabled && session.solved &&
+      !(ctrl.primalInit && ctrl.dualInit) &&
+      session.x.Height() == n && session.y.Height() == m;
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( warmStart && !primalInit )
+    {
+        x = session.x;
+        primalInit = true;
+    }
+    if( warmStart && !dualInit )
+    {
+        y = session.y;
+        z = session.z;
+        dualInit = true;
+    }
+
+    auto& dRow = session.dRow;
+    auto& dCol = session.dCol;
     if( ctrl.outerEquil )
     {
         if( commRank == 0 && ctrl.time )
             timer.Start();
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated && dRow.Height() == m && dCol.Height() == n )
+        {
+            DiagonalSolve( LEFT, NORMAL, dRow, A );
+            DiagonalSolve( RIGHT, NORMAL, dCol, A );
+        }
+        else
+        {
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            session.equilibrated = true;
+        }
         if( commRank == 0 && ctrl.time )
             Output("RuizEquil: ",timer.Stop()," secs");
 
@@ -1263,9 +1753,9 @@ void Mehrotra
             DiagonalSolve( LEFT, NORMAL, dCol, Q );
             DiagonalSolve( RIGHT, NORMAL, dCol, Q );
         }
-        if( ctrl.primalInit )
+        if( primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
-        if( ctrl.dualInit )
+        if( dualInit )
         {
             DiagonalScale( LEFT, NORMAL, dRow, y );
             DiagonalSolve( LEFT, NORMAL, dCol, z );
@@ -1275,6 +1765,7 @@ void Mehrotra
     {
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
+        session.equilibrated = false;
     }
 
     const Real bNrm2 = Nrm2( b );
@@ -1297,9 +1788,15 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
+    // Reuse the analysis of the KKT system from the previous solve of the
+    // session if the problem has the same structure
+    const bool analyzed = session.Analyzed( QPre, APre, ctrl.system );
+    if( !analyzed )
+        session.ResetAnalysis();
+    auto& map = session.map;
+    auto& invMap = session.invMap;
+    auto& info = *session.info;
+    auto& rootSep = *session.rootSep;
     vector<Int> mappedSources, mappedTargets, colOffs;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
@@ -1307,12 +1804,12 @@ void Mehrotra
     // TODO: Add permanent regularization and cache J metadata
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && !analyzed )
     {
         Initialize
         ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
           mappedSources, mappedTargets, colOffs,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl ); 
+          primalInit, dualInit, standardShift, ctrl.solveCtrl ); 
     }  
     else
     {
@@ -1323,8 +1820,10 @@ void Mehrotra
         Initialize
         ( Q, A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
           augMappedSources, augMappedTargets, augColOffs,
-          ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
+          primalInit, dualInit, standardShift, ctrl.solveCtrl );
     }
+    if( warmStart )
+        pos_orth::Recenter( x, z, warmStartCtrl.muMin, warmStartCtrl.beta );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1354,17 +1853,20 @@ void Mehrotra
 
     DistSparseMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
-    ldl::DistFront<Real> JFront;
+    auto& JFront = *session.front;
+    auto& JFrontMeta = session.frontMeta;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
                        dxAff(comm), dyAff(comm), dzAff(comm),
-                       dx(comm),    dy(comm),    dz(comm);
+                       dx(comm),    dy(comm),    dz(comm),
+                       dxCorr(comm), dyCorr(comm), dzCorr(comm), rmuCorr(comm);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1440,6 +1942,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
 
         // r_mu := x o z
         // -------------
@@ -1484,8 +1987,9 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( ctrl.system == FULL_KKT || 
-                        (ctrl.primalInit && ctrl.dualInit) )
+                    if( !analyzed &&
+                        (ctrl.system == FULL_KKT ||
+                         (primalInit && dualInit)) )
                     {
                         if( commRank == 0 && ctrl.time )
                             timer.Start();
@@ -1511,9 +2015,7 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                JFront.Pull( J, map, rootSep, info, JFrontMeta );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1583,6 +2085,8 @@ void Mehrotra
                  dzErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = pos_orth::MaxStep( x, dxAff, Real(1) );
@@ -1606,6 +2110,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rb *= 1-sigma;
         rc *= 1-sigma;
         Shift( rmu, -sigma*mu );
@@ -1689,6 +2194,118 @@ void Mehrotra
             LogicError("Invalid KKT system choice");
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            comm );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = pos_orth::MaxStep( x, dx, Real(1) );
+            Real alphaDual = pos_orth::MaxStep( z, dz, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + (v - t)
+                // ----------------------
+                pos_orth::GondzioCorrection
+                ( x, dx, z, dz, rmuCorr,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                rmuCorr += rmu;
+
+                if( ctrl.system == FULL_KKT )
+                {
+                    // Form the KKT system
+                    // -------------------
+                    KKTRHS( rc, rb, rmuCorr, z, d );
+                    // Solve for the direction
+                    // -----------------------
+                    try
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                        if( commRank == 0 && ctrl.time )
+                            Output("Corrector: ",timer.Stop()," secs");
+                    }
+                    catch(...) { break; }
+                    ExpandSolution( m, n, d, dxCorr, dyCorr, dzCorr );
+                }
+                else if( ctrl.system == AUGMENTED_KKT )
+                {
+                    // Form the KKT system
+                    // -------------------
+                    AugmentedKKTRHS( x, rc, rb, rmuCorr, d );
+                    // Solve for the direction
+                    // -----------------------
+                    try
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        if( ctrl.resolveReg )
+                            reg_ldl::SolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl );
+                        else
+                            reg_ldl::RegularizedSolveAfter
+                            ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                              dmvMeta, ctrl.solveCtrl.relTol,
+                              ctrl.solveCtrl.maxRefineIts,
+                              ctrl.solveCtrl.progress );
+                        if( commRank == 0 && ctrl.time )
+                            Output("Corrector: ",timer.Stop()," secs");
+                    }
+                    catch(...) { break; }
+                    ExpandAugmentedSolution
+                    ( x, z, rmuCorr, d, dxCorr, dyCorr, dzCorr );
+                }
+                else
+                    LogicError("Invalid KKT system choice");
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr = pos_orth::MaxStep( x, dxCorr, Real(1) );
+                Real alphaDualCorr = pos_orth::MaxStep( z, dzCorr, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( x, dx, 1/ctrl.maxStepRatio );
@@ -1719,8 +2336,30 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+    session.RecordAnalysis( QPre, APre, ctrl.system );
+    session.x = x;
+    session.y = y;
+    session.z = z;
+    session.solved = true;
+}
+
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A, 
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y, 
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))
+    DistSparseMehrotraSession<Real> session( Q.Comm() );
+    Mehrotra( Q, A, b, c, x, y, z, session, ctrl );
 }
 
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const Matrix<Real>& Q, \
@@ -1732,6 +2371,16 @@ void Mehrotra
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const Matrix<Real>& Q, \
+    const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const ElementalMatrix<Real>& Q, \
     const ElementalMatrix<Real>& A, \
     const ElementalMatrix<Real>& b, \
@@ -1741,6 +2390,16 @@ void Mehrotra
           ElementalMatrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const ElementalMatrix<Real>& Q, \
+    const ElementalMatrix<Real>& A, \
+    const ElementalMatrix<Real>& b, \
+    const ElementalMatrix<Real>& c, \
+          ElementalMatrix<Real>& x, \
+          ElementalMatrix<Real>& y, \
+          ElementalMatrix<Real>& z, \
+          DistMehrotraSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& Q, \
     const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
@@ -1750,6 +2409,25 @@ void Mehrotra
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          MehrotraSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
@@ -1757,6 +2435,7 @@ void Mehrotra
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
+          DistSparseMehrotraSession<Real>& session, \
     const MehrotraCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
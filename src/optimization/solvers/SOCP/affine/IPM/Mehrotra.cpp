@@ -120,10 +120,12 @@ void Mehrotra
                  rmu,   rc,    rb,    rh,
                  dxAff, dyAff, dzAff, dsAff,
                  dx,    dy,    dz,    ds,
+                 dxCorr, dyCorr, dzCorr, dsCorr, rmuCorr,
                  dzAffScaled, dsAffScaled;
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -200,6 +202,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
         Real wMaxNorm = MaxNorm(w);
         const Real wMaxNormLimit = 
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
@@ -279,6 +282,8 @@ void Mehrotra
              dmuErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = soc::MaxStep(s,dsAff,orders,firstInds,Real(1));
@@ -302,6 +307,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -339,6 +345,72 @@ void Mehrotra
 
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = soc::MaxStep( s, ds, orders, firstInds, Real(1) );
+            Real alphaDual = soc::MaxStep( z, dz, orders, firstInds, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + inv(l) o (v - t)
+                // -------------------------------
+                soc::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr, orders, firstInds,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                soc::Apply( lInv, rmuCorr, orders, firstInds );
+                rmuCorr += rmu;
+
+                // Compute the proposed step from the KKT system
+                // ---------------------------------------------
+                KKTRHS( rc, rb, rh, rmuCorr, wRoot, orders, firstInds, d );
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, wRoot, orders, firstInds, dxCorr, dyCorr,
+                  dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr =
+                  soc::MaxStep( s, dsCorr, orders, firstInds, Real(1) );
+                Real alphaDualCorr =
+                  soc::MaxStep( z, dzCorr, orders, firstInds, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = 
@@ -483,6 +555,8 @@ void Mehrotra
                      rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                      dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
                      dx(grid),    dy(grid),    dz(grid),    ds(grid),
+                     dxCorr(grid), dyCorr(grid), dzCorr(grid), dsCorr(grid),
+                     rmuCorr(grid),
                      dsAffScaled(grid), dzAffScaled(grid);
     w.AlignWith( s );
     wRoot.AlignWith( s );
@@ -494,11 +568,15 @@ void Mehrotra
     ds.AlignWith( s );
     dz.AlignWith( s );
     rmu.AlignWith( s );
+    dzCorr.AlignWith( s );
+    dsCorr.AlignWith( s );
+    rmuCorr.AlignWith( s );
     DistMatrix<Real> dSub(grid);
     DistPermutation p(grid);
     DistMatrix<Real> 
       dxError(grid), dyError(grid), dzError(grid), dmuError(grid);
     dzError.AlignWith( s );
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -575,6 +653,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
         Real wMaxNorm = MaxNorm(w);
         const Real wMaxNormLimit =
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
@@ -659,6 +738,8 @@ void Mehrotra
                  dmuErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = 
@@ -684,6 +765,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -723,6 +805,78 @@ void Mehrotra
           cutoffPar );
         // TODO: Residual checks
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            grid.Comm() );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri =
+              soc::MaxStep( s, ds, orders, firstInds, Real(1), cutoffPar );
+            Real alphaDual =
+              soc::MaxStep( z, dz, orders, firstInds, Real(1), cutoffPar );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + inv(l) o (v - t)
+                // -------------------------------
+                soc::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr, orders, firstInds,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)), sigma*mu,
+                  gondzioCtrl.betaMin, gondzioCtrl.betaMax, cutoffPar );
+                soc::Apply( lInv, rmuCorr, orders, firstInds, cutoffPar );
+                rmuCorr += rmu;
+
+                // Compute the proposed step from the KKT system
+                // ---------------------------------------------
+                KKTRHS
+                ( rc, rb, rh, rmuCorr, wRoot, orders, firstInds, d, cutoffPar );
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, wRoot, orders, firstInds, dxCorr, dyCorr,
+                  dzCorr, dsCorr, cutoffPar );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr =
+                  soc::MaxStep
+                  ( s, dsCorr, orders, firstInds, Real(1), cutoffPar );
+                Real alphaDualCorr =
+                  soc::MaxStep
+                  ( z, dzCorr, orders, firstInds, Real(1), cutoffPar );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = 
@@ -866,12 +1020,14 @@ void Mehrotra
 
     SparseMatrix<Real> J, JOrig;
     ldl::Front<Real> JFront;
+    ldl::FrontPullMeta JFrontMeta;
     Matrix<Real> d, 
                  w,     wRoot, wRootInv,
                  l,     lInv,
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
                  dx,    dy,    dz,    ds,
+                 dxCorr, dyCorr, dzCorr, dsCorr, rmuCorr,
                  dzAffScaled, dsAffScaled;
 
     // TODO: Expose regularization rules to user
@@ -922,6 +1078,7 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1000,6 +1157,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
         const Real wMaxNormLimit =
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
         if( wMaxNorm > wMaxNormLimit )
@@ -1045,7 +1203,7 @@ void Mehrotra
             else
                 Ones( dInner, n+m+kSparse, 1 );
 
-            JFront.Pull( J, map, info );
+            JFront.Pull( J, map, info, JFrontMeta );
             LDL( info, JFront, LDL_2D );
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
@@ -1109,6 +1267,8 @@ void Mehrotra
              dmuErrorNrm2/(1+rmuNrm2));
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         Real alphaAffPri = 
@@ -1134,6 +1294,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -1186,6 +1347,88 @@ void Mehrotra
           sparseToOrigOrders, sparseToOrigFirstInds,
           dx, dy, dz, ds );
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri = soc::MaxStep( s, ds, orders, firstInds, Real(1) );
+            Real alphaDual = soc::MaxStep( z, dz, orders, firstInds, Real(1) );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + inv(l) o (v - t)
+                // -------------------------------
+                soc::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr, orders, firstInds,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)),
+                  sigma*mu, gondzioCtrl.betaMin, gondzioCtrl.betaMax );
+                soc::Apply( lInv, rmuCorr, orders, firstInds );
+                rmuCorr += rmu;
+
+                // Compute the proposed step from the KKT system
+                // ---------------------------------------------
+                KKTRHS
+                ( rc, rb, rh, rmuCorr, wRoot, 
+                  orders, firstInds, origToSparseFirstInds, kSparse, d );
+                try 
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
+                          ctrl.solveCtrl.progress );
+                } 
+                catch(...) { break; }
+                ExpandSolution
+                ( m, n, d, rmuCorr, wRoot, 
+                  orders, firstInds, 
+                  sparseOrders, sparseFirstInds,
+                  sparseToOrigOrders, sparseToOrigFirstInds,
+                  dxCorr, dyCorr, dzCorr, dsCorr );
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr =
+                  soc::MaxStep( s, dsCorr, orders, firstInds, Real(1) );
+                Real alphaDualCorr =
+                  soc::MaxStep( z, dzCorr, orders, firstInds, Real(1) );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = 
@@ -1351,12 +1594,15 @@ void Mehrotra
     DistSparseMultMeta metaOrig;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
+    ldl::DistFrontPullMeta JFrontMeta;
     DistMultiVec<Real> d(comm),
                        w(comm),     wRoot(comm), wRootInv(comm),
                        l(comm),     lInv(comm),
                        rc(comm),    rb(comm),    rh(comm),    rmu(comm),
                        dxAff(comm), dyAff(comm), dzAff(comm), dsAff(comm),
                        dx(comm),    dy(comm),    dz(comm),    ds(comm),
+                       dxCorr(comm), dyCorr(comm), dzCorr(comm), dsCorr(comm),
+                       rmuCorr(comm),
                        dzAffScaled(comm), dsAffScaled(comm);
 
     // Form the regularization vectors
@@ -1418,15 +1664,12 @@ void Mehrotra
         Output("ND: ",timer.Stop()," secs");
     InvertMap( map, invMap );
 
-    vector<Int> mappedSources, mappedTargets, colOffs;
-    JStatic.MappedSources( map, mappedSources );
-    JStatic.MappedTargets( map, mappedTargets, colOffs );
-
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), 
                        dzError(comm), dmuError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+    Timer factTimer, solveTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1509,6 +1752,7 @@ void Mehrotra
 
         // Compute the affine search direction
         // ===================================
+        factTimer.Start();
         const Real wMaxNormLimit =
           Max(ctrl.wSafeMaxNorm,10/Min(Real(1),relError));
         if( ctrl.print && commRank == 0 )
@@ -1583,8 +1827,7 @@ void Mehrotra
             J.multMeta = meta;
             if( ctrl.time && commRank == 0 )
                 timer.Start();
-            JFront.Pull
-            ( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
+            JFront.Pull( J, map, rootSep, info, JFrontMeta );
             if( ctrl.time && commRank == 0 )
                 Output("Front pull: ",timer.Stop()," secs");
 
@@ -1672,6 +1915,8 @@ void Mehrotra
                 Output("residual check: ",timer.Stop()," secs");
         }
 
+        const double affineTime = factTimer.Stop();
+
         // Compute a centrality parameter
         // ==============================
         if( ctrl.time && commRank == 0 )
@@ -1701,6 +1946,7 @@ void Mehrotra
 
         // Solve for the combined direction
         // ================================
+        solveTimer.Start();
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
@@ -1766,6 +2012,106 @@ void Mehrotra
         if( ctrl.time && commRank == 0 )
             Output("ExpandSolution: ",timer.Stop()," secs");
 
+        const double solveTime = solveTimer.Stop();
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        const Int numCorrectors =
+          NumGondzioCorrectors
+          ( ctrl.gondzioCtrl, affineTime-solveTime, solveTime,
+            comm );
+        if( numCorrectors > 0 )
+        {
+            const auto& gondzioCtrl = ctrl.gondzioCtrl;
+            const Real minIncrease =
+              gondzioCtrl.minImprovement*gondzioCtrl.stepIncrease;
+            Real alphaPri =
+              soc::MaxStep( s, ds, orders, firstInds, Real(1), cutoffPar );
+            Real alphaDual =
+              soc::MaxStep( z, dz, orders, firstInds, Real(1), cutoffPar );
+            if( ctrl.forceSameStep )
+                alphaPri = alphaDual = Min(alphaPri,alphaDual);
+            for( Int corrector=0; corrector<numCorrectors; ++corrector )
+            {
+                if( Min(alphaPri,alphaDual) == Real(1) )
+                    break;
+
+                // r_mu := r_mu + inv(l) o (v - t)
+                // -------------------------------
+                soc::GondzioCorrection
+                ( s, ds, z, dz, rmuCorr, orders, firstInds,
+                  Min(alphaPri+gondzioCtrl.stepIncrease,Real(1)),
+                  Min(alphaDual+gondzioCtrl.stepIncrease,Real(1)), sigma*mu,
+                  gondzioCtrl.betaMin, gondzioCtrl.betaMax, cutoffPar );
+                soc::Apply( lInv, rmuCorr, orders, firstInds, cutoffPar );
+                rmuCorr += rmu;
+
+                if( ctrl.time && commRank == 0 )
+                    Output("r_mu formation: ",timer.Stop()," secs");
+
+                // Compute the proposed step from the KKT system
+                // ---------------------------------------------
+                KKTRHS
+                ( rc, rb, rh, rmuCorr, wRoot, 
+                  orders, firstInds, origToSparseFirstInds, kSparse,
+                  d, cutoffPar );
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          dmvMeta, ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, invMap, info, JFront, d,
+                          dmvMeta, ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Corrector solver: ",timer.Stop()," secs");
+                }
+                catch(...) { break; }
+                if( ctrl.time && commRank == 0 )
+                    timer.Start();
+                ExpandSolution
+                ( m, n, d, rmuCorr, wRoot, 
+                  orders, firstInds, 
+                  sparseOrders, sparseFirstInds,
+                  sparseToOrigOrders, sparseToOrigFirstInds,
+                  dxCorr, dyCorr, dzCorr, dsCorr, cutoffPar );
+                if( ctrl.time && commRank == 0 )
+                    Output("ExpandSolution: ",timer.Stop()," secs");
+
+                // Only keep the corrector if it lengthens the step enough
+                // -------------------------------------------------------
+                Real alphaPriCorr =
+                  soc::MaxStep
+                  ( s, dsCorr, orders, firstInds, Real(1), cutoffPar );
+                Real alphaDualCorr =
+                  soc::MaxStep
+                  ( z, dzCorr, orders, firstInds, Real(1), cutoffPar );
+                if( ctrl.forceSameStep )
+                    alphaPriCorr = alphaDualCorr =
+                      Min(alphaPriCorr,alphaDualCorr);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Gondzio corrector ",corrector,": alphaPri = ",
+                     alphaPriCorr,", alphaDual = ",alphaDualCorr);
+                if( Min(alphaPriCorr,alphaDualCorr) <
+                    Min(alphaPri,alphaDual)+minIncrease )
+                    break;
+                alphaPri = alphaPriCorr;
+                alphaDual = alphaDualCorr;
+                rmu = rmuCorr;
+                dx = dxCorr;
+                dy = dyCorr;
+                dz = dzCorr;
+                ds = dsCorr;
+            }
+        }
+
         // Update the current estimates
         // ============================
         if( ctrl.time && commRank == 0 )
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace pos_orth {
+
+// See Section 3 of
+//
+//   Jacek Gondzio,
+//   "Multiple centrality corrections in a primal-dual method for linear
+//    programming", Computational Optimization and Applications, Vol. 6,
+//   pp. 137--156, 1996.
+//
+// The returned vector is meant to be added to the complementarity residual,
+// r_mu, of a Newton system whose solution satisfies z o dx + x o dz = -r_mu.
+
+template<typename Real>
+inline Real GondzioTerm
+( Real v, Real sigmaMu, Real betaMin, Real betaMax )
+{
+    const Real lower = betaMin*sigmaMu;
+    const Real upper = betaMax*sigmaMu;
+    if( v < lower )
+        return v - lower;
+    else if( v > upper )
+        return Min( v - upper, upper );
+    else
+        return Real(0);
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::GondzioCorrection"))
+    const Int k = s.Height();
+    r.Resize( k, 1 );
+    const Real* sBuf = s.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+          Real* rBuf = r.Buffer();
+    for( Int i=0; i<k; ++i )
+    {
+        const Real v =
+          (sBuf[i]+alphaPri*dsBuf[i])*(zBuf[i]+alphaDual*dzBuf[i]);
+        rBuf[i] = GondzioTerm( v, sigmaMu, betaMin, betaMax );
+    }
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const ElementalMatrix<Real>& sPre,
+  const ElementalMatrix<Real>& dsPre,
+  const ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Real>& dzPre,
+        ElementalMatrix<Real>& rPre,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::GondzioCorrection"))
+    AssertSameGrids( sPre, dsPre, zPre, dzPre, rPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,VC,STAR>
+      rProx( rPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& r = rProx.Get();
+
+    r.Resize( s.Height(), 1 );
+    const Int localHeight = s.LocalHeight();
+    const Real* sBuf = s.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+          Real* rBuf = r.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real v =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        rBuf[iLoc] = GondzioTerm( v, sigmaMu, betaMin, betaMax );
+    }
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::GondzioCorrection"))
+    r.SetComm( s.Comm() );
+    r.Resize( s.Height(), 1 );
+    const Int localHeight = s.LocalHeight();
+    const Real* sBuf = s.LockedMatrix().LockedBuffer();
+    const Real* dsBuf = ds.LockedMatrix().LockedBuffer();
+    const Real* zBuf = z.LockedMatrix().LockedBuffer();
+    const Real* dzBuf = dz.LockedMatrix().LockedBuffer();
+          Real* rBuf = r.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real v =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        rBuf[iLoc] = GondzioTerm( v, sigmaMu, betaMin, betaMax );
+    }
+}
+
+#define PROTO(Real) \
+  template void GondzioCorrection \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+          Matrix<Real>& r, \
+    Real alphaPri, Real alphaDual, Real sigmaMu, \
+    Real betaMin, Real betaMax ); \
+  template void GondzioCorrection \
+  ( const ElementalMatrix<Real>& s, \
+    const ElementalMatrix<Real>& ds, \
+    const ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Real>& dz, \
+          ElementalMatrix<Real>& r, \
+    Real alphaPri, Real alphaDual, Real sigmaMu, \
+    Real betaMin, Real betaMax ); \
+  template void GondzioCorrection \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+          DistMultiVec<Real>& r, \
+    Real alphaPri, Real alphaDual, Real sigmaMu, \
+    Real betaMin, Real betaMax );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace pos_orth
+} // namespace El
@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace pos_orth {
+
+// A (nearly) complementary pair, such as the solution of a closely related
+// problem, lies on the boundary of the positive orthant and would stall an
+// Interior Point Method. With mu := max(s^T z / k, muMin), each pair whose
+// product lies below beta*mu has its larger member raised to at least
+// sqrt(beta*mu) and its smaller member set so that the product is exactly
+// beta*mu. Pairs which are already sufficiently central are left untouched.
+
+template<typename Real>
+inline void RecenterPair( Real& s, Real& z, Real target, Real lower )
+{
+    if( s*z >= target )
+        return;
+    if( s >= z )
+    {
+        s = Max(s,lower);
+        z = target / s;
+    }
+    else
+    {
+        z = Max(z,lower);
+        s = target / z;
+    }
+}
+
+template<typename Real,typename>
+void Recenter
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real muMin,
+  Real beta )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::Recenter"))
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real mu = Max( Dot(s,z)/k, muMin );
+    const Real target = beta*mu;
+    const Real lower = Sqrt(target);
+    Real* sBuf = s.Buffer();
+    Real* zBuf = z.Buffer();
+    for( Int i=0; i<k; ++i )
+        RecenterPair( sBuf[i], zBuf[i], target, lower );
+}
+
+template<typename Real,typename>
+void Recenter
+( ElementalMatrix<Real>& sPre,
+  ElementalMatrix<Real>& zPre,
+  Real muMin,
+  Real beta )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::Recenter"))
+    AssertSameGrids( sPre, zPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl );
+    auto& s = sProx.Get();
+    auto& z = zProx.Get();
+
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real mu = Max( Dot(s,z)/k, muMin );
+    const Real target = beta*mu;
+    const Real lower = Sqrt(target);
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Buffer();
+    Real* zBuf = z.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        RecenterPair( sBuf[iLoc], zBuf[iLoc], target, lower );
+}
+
+template<typename Real,typename>
+void Recenter
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real muMin,
+  Real beta )
+{
+    DEBUG_ONLY(CSE cse("pos_orth::Recenter"))
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real mu = Max( Dot(s,z)/k, muMin );
+    const Real target = beta*mu;
+    const Real lower = Sqrt(target);
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Matrix().Buffer();
+    Real* zBuf = z.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        RecenterPair( sBuf[iLoc], zBuf[iLoc], target, lower );
+}
+
+#define PROTO(Real) \
+  template void Recenter \
+  ( Matrix<Real>& s, \
+    Matrix<Real>& z, \
+    Real muMin, \
+    Real beta ); \
+  template void Recenter \
+  ( ElementalMatrix<Real>& s, \
+    ElementalMatrix<Real>& z, \
+    Real muMin, \
+    Real beta ); \
+  template void Recenter \
+  ( DistMultiVec<Real>& s, \
+    DistMultiVec<Real>& z, \
+    Real muMin, \
+    Real beta );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace pos_orth
+} // namespace El
@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace soc {
+
+// The complementarity of each pair of cone members is measured by the first
+// entry of their Jordan product, s_i^T z_i, which equals mu on the central
+// path. The correction for each cone is a multiple of the identity, e_i,
+// so that it can be added to the (unscaled) complementarity target.
+
+template<typename Real>
+inline Real GondzioTerm
+( Real v, Real sigmaMu, Real betaMin, Real betaMax )
+{
+    const Real lower = betaMin*sigmaMu;
+    const Real upper = betaMax*sigmaMu;
+    if( v < lower )
+        return v - lower;
+    else if( v > upper )
+        return Min( v - upper, upper );
+    else
+        return Real(0);
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Matrix<Real>& r,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax )
+{
+    DEBUG_ONLY(CSE cse("soc::GondzioCorrection"))
+    auto sTrial = s;
+    auto zTrial = z;
+    Axpy( alphaPri, ds, sTrial );
+    Axpy( alphaDual, dz, zTrial );
+    soc::Dots( sTrial, zTrial, r, orders, firstInds );
+
+    const Int height = r.Height();
+    Real* rBuf = r.Buffer();
+    const Int* firstIndBuf = firstInds.LockedBuffer();
+    for( Int i=0; i<height; ++i )
+        if( i == firstIndBuf[i] )
+            rBuf[i] = GondzioTerm( rBuf[i], sigmaMu, betaMin, betaMax );
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const ElementalMatrix<Real>& sPre,
+  const ElementalMatrix<Real>& dsPre,
+  const ElementalMatrix<Real>& zPre,
+  const ElementalMatrix<Real>& dzPre,
+        ElementalMatrix<Real>& rPre,
+  const ElementalMatrix<Int>& ordersPre,
+  const ElementalMatrix<Int>& firstIndsPre,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("soc::GondzioCorrection"))
+    AssertSameGrids( sPre, dsPre, zPre, dzPre, rPre, ordersPre, firstIndsPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,VC,STAR>
+      rProx( rPre, ctrl );
+    DistMatrixReadProxy<Int,Int,VC,STAR>
+      ordersProx( ordersPre, ctrl ),
+      firstIndsProx( firstIndsPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& r = rProx.Get();
+    auto& orders = ordersProx.GetLocked();
+    auto& firstInds = firstIndsProx.GetLocked();
+
+    DistMatrix<Real,VC,STAR> sTrial(s), zTrial(z);
+    Axpy( alphaPri, ds, sTrial );
+    Axpy( alphaDual, dz, zTrial );
+    soc::Dots( sTrial, zTrial, r, orders, firstInds, cutoff );
+
+    const Int localHeight = r.LocalHeight();
+    Real* rBuf = r.Buffer();
+    const Int* firstIndBuf = firstInds.LockedBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( r.GlobalRow(iLoc) == firstIndBuf[iLoc] )
+            rBuf[iLoc] = GondzioTerm( rBuf[iLoc], sigmaMu, betaMin, betaMax );
+}
+
+template<typename Real,typename>
+void GondzioCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        DistMultiVec<Real>& r,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real alphaPri, Real alphaDual, Real sigmaMu, Real betaMin, Real betaMax,
+  Int cutoff )
+{
+    DEBUG_ONLY(CSE cse("soc::GondzioCorrection"))
+    auto sTrial = s;
+    auto zTrial = z;
+    Axpy( alphaPri, ds, sTrial );
+    Axpy( alphaDual, dz, zTrial );
+    soc::Dots( sTrial, zTrial, r, orders, firstInds, cutoff );
+
+    const Int localHeight = r.LocalHeight();
+    Real* rBuf = r.Matrix().Buffer();
+    const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( r.GlobalRow(iLoc) == firstIndBuf[iLoc] )
+            rBuf[iLoc] = GondzioTerm( rBuf[iLoc], sigmaMu, betaMin, betaMax );
+}
+
+#define PROTO(Real) \
+  template void GondzioCorrection \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+          Matrix<Real>& r, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    Real alphaPri, Real alphaDual, Real sigmaMu, \
+    Real betaMin, Real betaMax ); \
+  template void GondzioCorrection \
+  ( const ElementalMatrix<Real>& s, \
+    const ElementalMatrix<Real>& ds, \
+    const ElementalMatrix<Real>& z, \
+    const ElementalMatrix<Real>& dz, \
+          ElementalMatrix<Real>& r, \
+    const ElementalMatrix<Int>& orders, \
+    const ElementalMatrix<Int>& firstInds, \
+    Real alphaPri, Real alphaDual, Real sigmaMu, \
+    Real betaMin, Real betaMax, Int cutoff ); \
+  template void GondzioCorrection \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+          DistMultiVec<Real>& r, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real alphaPri, Real alphaDual, Real sigmaMu, \
+    Real betaMin, Real betaMax, Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace soc
+} // namespace El
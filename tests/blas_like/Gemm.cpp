@@ -143,6 +143,42 @@ void TestGemm
             TestCorrectness
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     }
+
+    // Test the variant of Gemm which replicates over layers of the grid
+    C = COrig;
+    if( g.Rank() == 0 )
+        Output("2.5D Algorithm:");
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+        Output("  Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+
+    // Test the automatically selected variant of Gemm
+    C = COrig;
+    if( g.Rank() == 0 )
+        Output("Automatically selected algorithm:");
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_AUTO );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+        Output("  Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
 }
 
 int 
@@ -163,6 +199,9 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int c = Input("--c","replication factor for 2.5D Gemm",0);
+        const string tuningFile =
+          Input("--tuningFile","file caching the Gemm cost model",string(""));
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -171,6 +210,7 @@ main( int argc, char* argv[] )
         const Int rowAlignA = Input("--rowAlignA","row align of A",0);
         const Int rowAlignB = Input("--rowAlignB","row align of B",0); 
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
+        const bool profile = Input("--profile","write a profile?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -181,6 +221,10 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemmReplicationFactor( c );
+        SetGemmTuningFile( tuningFile );
+        if( profile )
+            EnableProfiling();
 
         ComplainIfDebug();
         if( commRank == 0 )
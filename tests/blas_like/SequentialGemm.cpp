@@ -0,0 +1,326 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare the (packed) Gemm used for datatypes without a vendor BLAS, e.g.,
+// Int, Quad, and Complex<Quad>, against the textbook triple loop, along with
+// the Hemm, Symm, Herk, and Syrk routines which are built on top of it
+
+template<typename T>
+void TextbookGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C )
+{
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+            CBuf[i+j*CLDim] *= beta;
+        for( Int l=0; l<k; ++l )
+        {
+            T gamma =
+              ( orientB == NORMAL ? BBuf[l+j*BLDim] : BBuf[j+l*BLDim] );
+            if( orientB == ADJOINT )
+                gamma = Conj(gamma);
+            gamma *= alpha;
+            if( orientA == NORMAL )
+            {
+                for( Int i=0; i<m; ++i )
+                    CBuf[i+j*CLDim] += gamma*ABuf[i+l*ALDim];
+            }
+            else
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    const T alphaA = ( orientA == ADJOINT ?
+                      Conj(ABuf[l+i*ALDim]) : ABuf[l+i*ALDim] );
+                    CBuf[i+j*CLDim] += gamma*alphaA;
+                }
+            }
+        }
+    }
+}
+
+// C := alpha A B + beta C or C := alpha B A + beta C, where only the 'uplo'
+// triangle of the Hermitian (or symmetric) matrix A is accessed
+template<typename T>
+void TextbookHemm
+( LeftOrRight side, UpperOrLower uplo, bool conjugate,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C )
+{
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = A.Height();
+    auto AEntry = [&]( Int i, Int j )
+      {
+        const bool stored = ( uplo == LOWER ? i >= j : i <= j );
+        if( stored )
+            return A.Get(i,j);
+        else
+            return ( conjugate ? Conj(A.Get(j,i)) : A.Get(j,i) );
+      };
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+                gamma += ( side == LEFT ? AEntry(i,l)*B.Get(l,j)
+                                        : B.Get(i,l)*AEntry(l,j) );
+            // Follow the BLAS convention of not reading C when beta is zero
+            const T CEntry = ( beta == T(0) ? T(0) : beta*C.Get(i,j) );
+            C.Set( i, j, CEntry + alpha*gamma );
+        }
+    }
+}
+
+// C := alpha A A^H + beta C or C := alpha A A^T + beta C, where only the
+// 'uplo' triangle of C is accessed
+template<typename T>
+void TextbookHerk
+( UpperOrLower uplo, bool conjugate,
+  T alpha, const Matrix<T>& A, T beta, Matrix<T>& C )
+{
+    const Int n = A.Height();
+    const Int k = A.Width();
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo == LOWER ? j : 0 );
+        const Int iEnd = ( uplo == LOWER ? n : j+1 );
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+                gamma += A.Get(i,l)*
+                  ( conjugate ? Conj(A.Get(j,l)) : A.Get(j,l) );
+            const T CEntry = ( beta == T(0) ? T(0) : beta*C.Get(i,j) );
+            C.Set( i, j, CEntry + alpha*gamma );
+        }
+    }
+}
+
+template<typename T>
+void TestSequentialGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k, bool print )
+{
+    // Use a large enough radius for the integer entries to be nontrivial
+    const T center = 0;
+    const Base<T> radius = 10;
+    Matrix<T> A, B, COrig, C, CRef;
+    if( orientA == NORMAL )
+        Uniform( A, m, k, center, radius );
+    else
+        Uniform( A, k, m, center, radius );
+    if( orientB == NORMAL )
+        Uniform( B, k, n, center, radius );
+    else
+        Uniform( B, n, k, center, radius );
+    Uniform( COrig, m, n, center, radius );
+    const T alpha = SampleBall( center, radius );
+    const T beta = SampleBall( center, radius );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+        Print( COrig, "COrig" );
+    }
+
+    Timer timer;
+    C = COrig;
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    Output("  Gemm finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, "C" );
+
+    CRef = COrig;
+    timer.Start();
+    TextbookGemm( orientA, orientB, alpha, A, B, beta, CRef );
+    const double refTime = timer.Stop();
+    Output("  Textbook loops finished in ",refTime," seconds");
+    Output("  Speedup: ",refTime/runTime);
+
+    CRef -= C;
+    Output("  || C ||_max = ",MaxNorm(C));
+    Output("  || E ||_max = ",MaxNorm(CRef));
+}
+
+// Returns the maximum entrywise difference between the templated BLAS
+// routine and the textbook loops over both sides, both triangles, and
+// beta in { 0, 1, other }
+template<typename T>
+Base<T> TestSequentialHemm( bool conjugate, Int m, Int n, bool print )
+{
+    const T center = 0;
+    const Base<T> radius = 10;
+    const T alpha = SampleBall( center, radius );
+    const T betas[3] = { T(0), T(1), SampleBall( center, radius ) };
+    Base<T> maxError = 0;
+    for( LeftOrRight side : { LEFT, RIGHT } )
+    {
+        const Int k = ( side == LEFT ? m : n );
+        for( UpperOrLower uplo : { LOWER, UPPER } )
+        {
+            for( const T& beta : betas )
+            {
+                Matrix<T> A, B, C, CRef;
+                Uniform( A, k, k, center, radius );
+                Uniform( B, m, n, center, radius );
+                Uniform( C, m, n, center, radius );
+                CRef = C;
+                const char sideChar = LeftOrRightToChar( side );
+                const char uploChar = UpperOrLowerToChar( uplo );
+                if( conjugate )
+                    blas::Hemm
+                    ( sideChar, uploChar, m, n,
+                      alpha, A.LockedBuffer(), A.LDim(),
+                             B.LockedBuffer(), B.LDim(),
+                      beta,  C.Buffer(),       C.LDim() );
+                else
+                    blas::Symm
+                    ( sideChar, uploChar, m, n,
+                      alpha, A.LockedBuffer(), A.LDim(),
+                             B.LockedBuffer(), B.LDim(),
+                      beta,  C.Buffer(),       C.LDim() );
+                TextbookHemm( side, uplo, conjugate, alpha, A, B, beta, CRef );
+                if( print )
+                {
+                    Print( C, "C" );
+                    Print( CRef, "CRef" );
+                }
+                CRef -= C;
+                maxError = Max( maxError, MaxNorm(CRef) );
+            }
+        }
+    }
+    Output
+    ("  ",(conjugate ? "Hemm" : "Symm"),": || E ||_max = ",maxError);
+    return maxError;
+}
+
+template<typename T>
+Base<T> TestSequentialHerk( bool conjugate, Int n, Int k, bool print )
+{
+    typedef Base<T> Real;
+    const T center = 0;
+    const Real radius = 10;
+    // Herk only accepts real scaling parameters
+    const T alpha =
+      ( conjugate ? T(SampleBall<Real>(0,radius)) : SampleBall(center,radius) );
+    const T betas[3] =
+      { T(0), T(1),
+        ( conjugate ? T(SampleBall<Real>(0,radius))
+                    : SampleBall(center,radius) ) };
+    Real maxError = 0;
+    for( UpperOrLower uplo : { LOWER, UPPER } )
+    {
+        for( const T& beta : betas )
+        {
+            Matrix<T> A, C, CRef;
+            Uniform( A, n, k, center, radius );
+            Uniform( C, n, n, center, radius );
+            CRef = C;
+            const char uploChar = UpperOrLowerToChar( uplo );
+            if( conjugate )
+                blas::Herk
+                ( uploChar, n, k,
+                  RealPart(alpha), A.LockedBuffer(), A.LDim(),
+                  RealPart(beta),  C.Buffer(),       C.LDim() );
+            else
+                blas::Syrk
+                ( uploChar, n, k,
+                  alpha, A.LockedBuffer(), A.LDim(),
+                  beta,  C.Buffer(),       C.LDim() );
+            TextbookHerk( uplo, conjugate, alpha, A, beta, CRef );
+            if( print )
+            {
+                Print( C, "C" );
+                Print( CRef, "CRef" );
+            }
+            // The opposite triangle must not have been modified either
+            CRef -= C;
+            maxError = Max( maxError, MaxNorm(CRef) );
+        }
+    }
+    Output
+    ("  ",(conjugate ? "Herk" : "Syrk"),": || E ||_max = ",maxError);
+    return maxError;
+}
+
+template<typename T>
+void TestSequentialSymmetric( Int m, Int n, Int k, bool print )
+{
+    typedef Base<T> Real;
+    // Integer arithmetic must be exact, and floating-point results must
+    // agree up to the rounding errors of inner products of length m, n, or k
+    const Real radius = 10;
+    const Real tol =
+      ( std::is_integral<T>::value ? Real(0)
+                             : 100*Max(Max(m,n),k)*radius*radius*radius*
+                               Epsilon<Real>() );
+    Real maxError = TestSequentialHemm<T>( true, m, n, print );
+    maxError = Max( maxError, TestSequentialHemm<T>( false, m, n, print ) );
+    maxError = Max( maxError, TestSequentialHerk<T>( true, n, k, print ) );
+    maxError = Max( maxError, TestSequentialHerk<T>( false, n, k, print ) );
+    if( maxError > tol )
+        LogicError("Error of ",maxError," exceeded tolerance of ",tol);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const Int m = Input("--m","height of result",100);
+        const Int n = Input("--n","width of result",100);
+        const Int k = Input("--k","inner dimension",100);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientA = CharToOrientation( transA );
+        const Orientation orientB = CharToOrientation( transB );
+
+        ComplainIfDebug();
+        Output("Will test Gemm",transA,transB,", Hemm, Symm, Herk, and Syrk");
+
+        Output("Testing with Int");
+        TestSequentialGemm<Int>( orientA, orientB, m, n, k, print );
+        TestSequentialSymmetric<Int>( m, n, k, print );
+
+#ifdef EL_HAVE_QUAD
+        Output("Testing with Quad");
+        TestSequentialGemm<Quad>( orientA, orientB, m, n, k, print );
+        TestSequentialSymmetric<Quad>( m, n, k, print );
+
+        Output("Testing with Complex<Quad>");
+        TestSequentialGemm<Complex<Quad>>( orientA, orientB, m, n, k, print );
+        TestSequentialSymmetric<Complex<Quad>>( m, n, k, print );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Form a random m x n sparse matrix whose rows have a varying number of
+// entries (including some empty rows) so that the row blocks assigned to
+// each thread have uneven costs
+template<typename T>
+void RandomSparse( SparseMatrix<T>& A, Int m, Int n, Int maxPerRow )
+{
+    Zeros( A, m, n );
+    A.Reserve( m*maxPerRow );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int numEntries =
+          ( i % 7 == 3 ? 0 : SampleUniform<Int>(1,maxPerRow+1) );
+        for( Int k=0; k<numEntries; ++k )
+            A.QueueUpdate( i, SampleUniform<Int>(0,n), SampleBall<T>() );
+    }
+    A.ProcessQueues();
+}
+
+template<typename T>
+bool CheckProduct
+( Orientation orientation, const SparseMatrix<T>& A, Int numRHS, bool print )
+{
+    typedef Base<T> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int height = ( orientation==NORMAL ? n : m );
+    const Int resultHeight = ( orientation==NORMAL ? m : n );
+    const T alpha = SampleBall<T>();
+    const T beta = SampleBall<T>();
+
+    Matrix<T> X, Y, YRef;
+    Uniform( X, height, numRHS );
+    Uniform( Y, resultHeight, numRHS );
+    YRef = Y;
+
+    Multiply( orientation, alpha, A, X, beta, Y );
+
+    // Compare against the dense product
+    Matrix<T> ADense;
+    Zeros( ADense, m, n );
+    Copy( A, ADense );
+    Gemm( orientation, NORMAL, alpha, ADense, X, beta, YRef );
+
+    const Real refNorm = FrobeniusNorm( YRef );
+    Axpy( T(-1), Y, YRef );
+    const Real errNorm = FrobeniusNorm( YRef );
+    const Real tol = 10*Max(m,n)*Epsilon<Real>();
+    const bool passed = ( errNorm <= tol*Max(refNorm,Real(1)) );
+    if( print || !passed )
+        Output
+        ("  ",OrientationToChar(orientation)," with ",numRHS,
+         " right-hand sides: || Y - YRef ||_F / || YRef ||_F = ",
+         errNorm/Max(refNorm,Real(1)));
+    return passed;
+}
+
+template<typename T>
+void TestMultiply( Int m, Int n, Int maxPerRow, bool print )
+{
+    SparseMatrix<T> A;
+    RandomSparse( A, m, n, maxPerRow );
+
+    // Cover a single right-hand side, whole blocks of four, and remainders
+    bool passed = true;
+    for( Orientation orientation : { NORMAL, TRANSPOSE, ADJOINT } )
+        for( Int numRHS : { 1, 2, 3, 4, 5, 8, 11 } )
+            passed = CheckProduct( orientation, A, numRHS, print ) && passed;
+    if( !passed )
+        LogicError("Sparse multiplication test failed");
+    Output("PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",500);
+        const Int n = Input("--n","width of matrix",300);
+        const Int maxPerRow = Input("--maxPerRow","max entries per row",10);
+        const bool print = Input("--print","print errors?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            Output("Testing with floats:");
+            TestMultiply<float>( m, n, maxPerRow, print );
+            Output("Testing with doubles:");
+            TestMultiply<double>( m, n, maxPerRow, print );
+            Output("Testing with single-precision complex:");
+            TestMultiply<Complex<float>>( m, n, maxPerRow, print );
+            Output("Testing with double-precision complex:");
+            TestMultiply<Complex<double>>( m, n, maxPerRow, print );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Add a few entries to each local row of A: some whose columns correspond to
+// the locally-owned rows of the multivector, and some anywhere, so that both
+// the overlapped local product and the neighbor exchange are exercised
+template<typename T>
+void AddRandomEntries( DistSparseMatrix<T>& A, Int numPerRow )
+{
+    const Int n = A.Width();
+    DistMultiVec<T> X( n, 1, A.Comm() );
+    const Int firstCol = X.FirstLocalRow();
+    const Int localWidth = X.LocalHeight();
+
+    A.Reserve( A.NumLocalEntries() + 2*numPerRow*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        for( Int k=0; k<numPerRow; ++k )
+        {
+            if( localWidth > 0 )
+            {
+                const Int j = firstCol + SampleUniform<Int>(0,localWidth);
+                A.QueueLocalUpdate( iLoc, j, SampleBall<T>() );
+            }
+            const Int j = SampleUniform<Int>(0,n);
+            A.QueueLocalUpdate( iLoc, j, SampleBall<T>() );
+        }
+    }
+    A.ProcessLocalQueues();
+}
+
+// Compare Y := alpha op(A) X + beta Y against the product of the dense copies
+template<typename T>
+bool CheckProduct
+( Orientation orientation, const DistSparseMatrix<T>& A, Int numRHS,
+  const Grid& g, bool print )
+{
+    typedef Base<T> Real;
+    mpi::Comm comm = A.Comm();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int height = ( orientation==NORMAL ? n : m );
+    const Int resultHeight = ( orientation==NORMAL ? m : n );
+    T alpha = SampleBall<T>();
+    T beta = SampleBall<T>();
+    mpi::Broadcast( alpha, 0, comm );
+    mpi::Broadcast( beta, 0, comm );
+
+    DistMultiVec<T> X(comm), Y(comm);
+    Uniform( X, height, numRHS );
+    Uniform( Y, resultHeight, numRHS );
+
+    DistMatrix<T> ADense(g), XDense(g), YDense(g), YRef(g);
+    Copy( A, ADense );
+    Copy( X, XDense );
+    Copy( Y, YRef );
+    Gemm( orientation, NORMAL, alpha, ADense, XDense, beta, YRef );
+
+    Multiply( orientation, alpha, A, X, beta, Y );
+    Copy( Y, YDense );
+
+    const Real refNorm = FrobeniusNorm( YRef );
+    Axpy( T(-1), YDense, YRef );
+    const Real errNorm = FrobeniusNorm( YRef );
+    const Real tol = 10*Max(m,n)*Epsilon<Real>();
+    const bool passed = ( errNorm <= tol*Max(refNorm,Real(1)) );
+    if( (print || !passed) && mpi::Rank(comm) == 0 )
+        Output
+        ("  ",OrientationToChar(orientation)," with ",numRHS,
+         " right-hand sides: || Y - YRef ||_F / || YRef ||_F = ",
+         errNorm/Max(refNorm,Real(1)));
+    return passed;
+}
+
+template<typename T>
+void TestMultiply
+( Int m, Int n, Int numPerRow, const Grid& g, bool print )
+{
+    mpi::Comm comm = g.Comm();
+    DistSparseMatrix<T> A(comm);
+    Zeros( A, m, n );
+    AddRandomEntries( A, numPerRow );
+
+    // Every orientation and width is run twice so that the cached plan and
+    // its buffers are reused both with the same and with different widths
+    bool passed = true;
+    for( Int rep=0; rep<2; ++rep )
+        for( Orientation orientation : { NORMAL, TRANSPOSE, ADJOINT } )
+            for( Int numRHS : { 1, 4, 7 } )
+                passed = CheckProduct( orientation, A, numRHS, g, print ) &&
+                         passed;
+
+    // Modifying the matrix must invalidate the communication plan
+    AddRandomEntries( A, numPerRow );
+    for( Orientation orientation : { NORMAL, ADJOINT } )
+        passed = CheckProduct( orientation, A, 3, g, print ) && passed;
+
+    if( !passed )
+        LogicError("Distributed sparse multiplication test failed");
+    if( mpi::Rank(comm) == 0 )
+        Output("PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",500);
+        const Int n = Input("--n","width of matrix",300);
+        const Int numPerRow = Input("--numPerRow","entries per row",4);
+        const bool print = Input("--print","print errors?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestMultiply<double>( m, n, numPerRow, g, print );
+        // A square matrix has matching row and column distributions
+        TestMultiply<double>( n, n, numPerRow, g, print );
+
+        if( commRank == 0 )
+            Output("Testing with double-precision complex:");
+        TestMultiply<Complex<double>>( m, n, numPerRow, g, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
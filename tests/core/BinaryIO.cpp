@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void Check
+( const DistMatrix<T,STAR,STAR>& AOrig, FileFormat format,
+  const string basename, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("Check"))
+    const Grid& g = AOrig.Grid();
+    const Int commRank = g.Rank();
+    if( commRank == 0 )
+        Output
+        ("Testing ",FileExtension(format)," read into [",
+         DistToString(U),",",DistToString(V),"]");
+
+    DistMatrix<T,U,V> A(g);
+    Int colAlign = SampleUniform<Int>(0,A.ColStride());
+    Int rowAlign = SampleUniform<Int>(0,A.RowStride());
+    mpi::Broadcast( colAlign, 0, g.Comm() );
+    mpi::Broadcast( rowAlign, 0, g.Comm() );
+    A.Align( colAlign, rowAlign );
+    if( format == BINARY_FLAT )
+        A.Resize( AOrig.Height(), AOrig.Width() );
+    Read( A, basename+"."+FileExtension(format), format );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(A);
+    Int myErrorFlag = 0;
+    if( A.Height() != AOrig.Height() || A.Width() != AOrig.Width() )
+        myErrorFlag = 1;
+    else
+    {
+        for( Int j=0; j<A.Width(); ++j )
+            for( Int i=0; i<A.Height(); ++i )
+                if( A_STAR_STAR.GetLocal(i,j) != AOrig.GetLocal(i,j) )
+                    myErrorFlag = 1;
+    }
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( summedErrorFlag == 0 )
+    {
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    else
+    {
+        if( commRank == 0 )
+            Output("FAILED");
+        if( print )
+            Print( A, "A" );
+    }
+}
+
+template<typename T,Dist U,Dist V>
+void CheckAll
+( Int m, Int n, const Grid& g, FileFormat format, bool print )
+{
+    const Int commRank = g.Rank();
+    const string basename = "BinaryIO";
+    if( commRank == 0 )
+        Output
+        ("Writing ",FileExtension(format)," from [",
+         DistToString(U),",",DistToString(V),"]");
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+    Write( A, basename, format );
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(A);
+    Check<T,CIRC,CIRC>( A_STAR_STAR, format, basename, print );
+    Check<T,MC,  MR  >( A_STAR_STAR, format, basename, print );
+    Check<T,MC,  STAR>( A_STAR_STAR, format, basename, print );
+    Check<T,MD,  STAR>( A_STAR_STAR, format, basename, print );
+    Check<T,MR,  MC  >( A_STAR_STAR, format, basename, print );
+    Check<T,STAR,MR  >( A_STAR_STAR, format, basename, print );
+    Check<T,STAR,STAR>( A_STAR_STAR, format, basename, print );
+    Check<T,STAR,VC  >( A_STAR_STAR, format, basename, print );
+    Check<T,VR,  STAR>( A_STAR_STAR, format, basename, print );
+}
+
+template<typename T>
+void
+BinaryIOTest( Int m, Int n, const Grid& g, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("BinaryIOTest"))
+    CheckAll<T,MC,  MR  >( m, n, g, BINARY, print );
+    CheckAll<T,STAR,STAR>( m, n, g, BINARY, print );
+    CheckAll<T,VC,  STAR>( m, n, g, BINARY, print );
+    CheckAll<T,MC,  MR  >( m, n, g, BINARY_FLAT, print );
+    CheckAll<T,STAR,VR  >( m, n, g, BINARY_FLAT, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const bool print = Input("--print","print wrong matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        BinaryIOTest<double>( m, n, g, print );
+
+        if( commRank == 0 )
+            Output("Testing with double-precision complex:");
+        BinaryIOTest<Complex<double>>( m, n, g, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
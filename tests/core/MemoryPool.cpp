@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+bool Aligned( const Memory<T>& mem )
+{ return size_t(mem.Buffer()) % MemoryAlignment() == 0; }
+
+// Recycled blocks must be indistinguishable from fresh ones: complex
+// buffers are zero-initialized just as with new Complex<Real>[n]
+template<typename Real>
+bool TestReuse( Int n )
+{
+    bool passed = true;
+    ResetMemoryPoolStats();
+    {
+        Memory<Complex<Real>> mem( n );
+        passed = passed && Aligned( mem );
+        Complex<Real>* buf = mem.Buffer();
+        for( Int i=0; i<n; ++i )
+            buf[i] = Complex<Real>(i+1,-i-1);
+    }
+    {
+        Memory<Complex<Real>> mem( n );
+        passed = passed && Aligned( mem );
+        const Complex<Real>* buf = mem.Buffer();
+        for( Int i=0; i<n; ++i )
+            if( buf[i] != Complex<Real>(0) )
+                passed = false;
+    }
+    const MemoryPoolStats stats = GetMemoryPoolStats();
+    if( MemoryPoolEnabled() && stats.numHits == 0 )
+        passed = false;
+    return passed;
+}
+
+bool TestAlignment()
+{
+    bool passed = true;
+    const size_t oldAlignment = MemoryAlignment();
+    for( size_t alignment : { size_t(64), size_t(128), size_t(4096) } )
+    {
+        SetMemoryAlignment( alignment );
+        for( Int n : { 1, 17, 1000, 100000 } )
+        {
+            Memory<double> mem( n );
+            passed = passed && Aligned( mem );
+        }
+    }
+    SetMemoryAlignment( oldAlignment );
+    return passed;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+
+    try
+    {
+        const Int n = Input("--n","number of entries",1000);
+        const bool print = Input("--print","print pool statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        bool passed = TestAlignment();
+        passed = TestReuse<float>( n ) && passed;
+        passed = TestReuse<double>( n ) && passed;
+
+        // The same guarantees must hold without the pool
+        DisableMemoryPool();
+        passed = TestReuse<double>( n ) && passed;
+        EnableMemoryPool();
+
+        if( print && commRank == 0 )
+            PrintMemoryPoolStats();
+        if( !passed )
+            LogicError("Memory pool test failed");
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Every process queues a different number of updates to random entries so
+// that the processes need different numbers of rounds to drain their queues.
+// The values are small integers so that the sums are exact regardless of the
+// order in which the updates are applied.
+vector<Entry<double>> RandomUpdates
+( Int m, Int n, Int numUpdates, mpi::Comm comm )
+{
+    const Int commRank = mpi::Rank( comm );
+    const Int numLocalUpdates = ( commRank == 0 ? 3*numUpdates : numUpdates );
+    vector<Entry<double>> updates( numLocalUpdates );
+    for( auto& entry : updates )
+    {
+        entry.i = SampleUniform<Int>(0,m);
+        entry.j = SampleUniform<Int>(0,n);
+        entry.value = double(SampleUniform<Int>(1,10));
+    }
+    return updates;
+}
+
+// Form the sum of the updates from all processes, as well as the number of
+// updates to each entry, in a dense matrix on every process
+void Reference
+( const vector<Entry<double>>& updates, Int m, Int n, mpi::Comm comm,
+  Matrix<double>& sums, Matrix<double>& counts )
+{
+    Zeros( sums, m, n );
+    Zeros( counts, m, n );
+    for( const auto& entry : updates )
+    {
+        sums.Update( entry.i, entry.j, entry.value );
+        counts.Update( entry.i, entry.j, 1. );
+    }
+    mpi::AllReduce( sums.Buffer(), m*n, comm );
+    mpi::AllReduce( counts.Buffer(), m*n, comm );
+}
+
+template<Dist U,Dist V>
+bool TestDistMatrix
+( const vector<Entry<double>>& updates, const Matrix<double>& sums,
+  const Grid& g )
+{
+    const Int m = sums.Height();
+    const Int n = sums.Width();
+    DistMatrix<double,U,V> A(g);
+    Zeros( A, m, n );
+    A.Reserve( updates.size() );
+    for( const auto& entry : updates )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    Int myErrorFlag = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( A.GetLocal(iLoc,jLoc) != sums.Get(i,j) )
+                myErrorFlag = 1;
+        }
+    }
+    return mpi::AllReduce( myErrorFlag, g.Comm() ) == 0;
+}
+
+bool TestDistSparseMatrix
+( const vector<Entry<double>>& updates,
+  const Matrix<double>& sums, const Matrix<double>& counts, mpi::Comm comm )
+{
+    const Int m = sums.Height();
+    const Int n = sums.Width();
+    DistSparseMatrix<double> A(comm);
+    Zeros( A, m, n );
+    A.Reserve( updates.size(), updates.size() );
+    for( const auto& entry : updates )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+
+    // Each updated entry of the local rows must appear exactly once
+    Int myErrorFlag = 0;
+    Int numExpected = 0;
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int j=0; j<n; ++j )
+            if( counts.Get(i,j) != 0 )
+                ++numExpected;
+    }
+    if( A.NumLocalEntries() != numExpected )
+        myErrorFlag = 1;
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+    {
+        if( e > 0 && A.Row(e) == A.Row(e-1) && A.Col(e) <= A.Col(e-1) )
+            myErrorFlag = 1;
+        if( counts.Get(A.Row(e),A.Col(e)) == 0 ||
+            A.Value(e) != sums.Get(A.Row(e),A.Col(e)) )
+            myErrorFlag = 1;
+    }
+    return mpi::AllReduce( myErrorFlag, comm ) == 0;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",80);
+        const Int numUpdates = Input("--numUpdates","updates per process",5000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const auto updates = RandomUpdates( m, n, numUpdates, comm );
+        Matrix<double> sums, counts;
+        Reference( updates, m, n, comm, sums, counts );
+
+        // The default batch size exchanges each queue in a single round, as
+        // the original AllToAll did; the smaller sizes require many rounds
+        const Int defaultBatchSize = AssemblyBatchSize();
+        bool passed = true;
+        for( Int batchSize : { defaultBatchSize, Int(1000), Int(37), Int(1) } )
+        {
+            SetAssemblyBatchSize( batchSize );
+            const bool passedMCMR = TestDistMatrix<MC,MR>( updates, sums, g );
+            const bool passedVCSTAR =
+              TestDistMatrix<VC,STAR>( updates, sums, g );
+            const bool passedSparse =
+              TestDistSparseMatrix( updates, sums, counts, comm );
+            if( commRank == 0 )
+                Output
+                ("batch size ",batchSize,": [MC,MR] ",
+                 (passedMCMR ? "PASSED" : "FAILED"),", [VC,* ] ",
+                 (passedVCSTAR ? "PASSED" : "FAILED"),", sparse ",
+                 (passedSparse ? "PASSED" : "FAILED"));
+            passed = passed && passedMCMR && passedVCSTAR && passedSparse;
+        }
+        SetAssemblyBatchSize( defaultBatchSize );
+        if( !passed )
+            LogicError("ProcessQueues test failed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+bool Equal( const SparseMatrix<T>& A, const SparseMatrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.NumEntries() != B.NumEntries() )
+        return false;
+    for( Int e=0; e<A.NumEntries(); ++e )
+        if( A.Row(e) != B.Row(e) || A.Col(e) != B.Col(e) ||
+            A.Value(e) != B.Value(e) )
+            return false;
+    return true;
+}
+
+template<typename T>
+bool Equal( const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B )
+{
+    Int myErrorFlag = 0;
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.NumLocalEntries() != B.NumLocalEntries() )
+        myErrorFlag = 1;
+    else
+    {
+        for( Int e=0; e<A.NumLocalEntries(); ++e )
+            if( A.Row(e) != B.Row(e) || A.Col(e) != B.Col(e) ||
+                A.Value(e) != B.Value(e) )
+                myErrorFlag = 1;
+    }
+    return mpi::AllReduce( myErrorFlag, A.Comm() ) == 0;
+}
+
+void Report( bool passed, mpi::Comm comm )
+{
+    if( mpi::Rank(comm) == 0 )
+        Output( passed ? "PASSED" : "FAILED" );
+}
+
+template<typename T>
+void CheckFormat
+( const DistSparseMatrix<T>& A, FileFormat format, bool print )
+{
+    mpi::Comm comm = A.Comm();
+    const string basename = "SparseIO";
+    const string filename = basename+"."+FileExtension(format);
+    if( mpi::Rank(comm) == 0 )
+        Output("Writing and reading ",FileExtension(format));
+    Write( A, basename, format );
+    mpi::Barrier( comm );
+
+    DistSparseMatrix<T> B(comm);
+    Read( B, filename );
+    const bool passed = Equal( A, B );
+    Report( passed, comm );
+    if( !passed && print )
+        Print( B, "B" );
+
+    // Every process reads the entire file into a sequential matrix
+    SparseMatrix<T> ASeq, BSeq;
+    Read( BSeq, filename );
+    if( mpi::Size(comm) == 1 )
+    {
+        ASeq = A;
+        Report( Equal( ASeq, BSeq ), comm );
+    }
+    else
+    {
+        const Int numEntries = A.NumEntries();
+        const Int myErrorFlag = ( BSeq.NumEntries() == numEntries ? 0 : 1 );
+        Report( mpi::AllReduce( myErrorFlag, comm ) == 0, comm );
+    }
+}
+
+// A symmetric coordinate file only stores the lower triangle, so reading it
+// should produce the same matrix as the expanded general file
+template<typename T>
+void CheckSymmetric( Int n, mpi::Comm comm )
+{
+    const string filename = "SparseIOSymmetric.mtx";
+    if( mpi::Rank(comm) == 0 )
+    {
+        Output("Reading a symmetric Matrix Market file");
+        ofstream file( filename.c_str() );
+        file << "%%MatrixMarket matrix coordinate real symmetric\n"
+             << "% A 1D Laplacian\n"
+             << n << " " << n << " " << 2*n-1 << "\n";
+        for( Int i=0; i<n; ++i )
+        {
+            file << i+1 << " " << i+1 << " 2\n";
+            if( i > 0 )
+                file << "  " << i+1 << " " << i << " -1\n";
+        }
+    }
+    mpi::Barrier( comm );
+
+    DistSparseMatrix<T> A(comm), L(comm);
+    Read( A, filename );
+    Zeros( L, n, n );
+    L.Reserve( 3*L.LocalHeight() );
+    for( Int iLoc=0; iLoc<L.LocalHeight(); ++iLoc )
+    {
+        const Int i = L.GlobalRow(iLoc);
+        if( i > 0 )
+            L.QueueLocalUpdate( iLoc, i-1, T(-1) );
+        L.QueueLocalUpdate( iLoc, i, T(2) );
+        if( i < n-1 )
+            L.QueueLocalUpdate( iLoc, i+1, T(-1) );
+    }
+    L.ProcessLocalQueues();
+    Report( Equal( A, L ), comm );
+}
+
+template<typename T>
+void SparseIOTest( Int n, mpi::Comm comm, bool print )
+{
+    // Form a random nonsymmetric matrix with a few entries per row
+    DistSparseMatrix<T> A(comm);
+    Zeros( A, n, n );
+    const Int numPerRow = 5;
+    A.Reserve( numPerRow*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int k=0; k<numPerRow; ++k )
+        {
+            const Int j = SampleUniform<Int>(0,n);
+            A.QueueLocalUpdate( iLoc, j, SampleBall<T>() );
+        }
+        A.QueueLocalUpdate( iLoc, i, T(n) );
+    }
+    A.ProcessLocalQueues();
+    if( print )
+        Print( A, "A" );
+
+    CheckFormat( A, BINARY, print );
+    CheckFormat( A, MATRIX_MARKET, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",1000);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        SparseIOTest<double>( n, comm, print );
+        CheckSymmetric<double>( n, comm );
+
+        if( commRank == 0 )
+            Output("Testing with double-precision complex:");
+        SparseIOTest<Complex<double>>( n, comm, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
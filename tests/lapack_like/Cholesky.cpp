@@ -57,7 +57,8 @@ void TestCholesky
   UpperOrLower uplo,
   Int m,
   const Grid& g,
-  bool scalapack )
+  bool scalapack,
+  bool lookAhead )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistPermutation p(g);
@@ -80,7 +81,12 @@ void TestCholesky
     if( pivot )
         Cholesky( uplo, A, p );
     else
-        Cholesky( uplo, A, scalapack );
+    {
+        CholeskyCtrl ctrl;
+        ctrl.scalapack = scalapack;
+        ctrl.lookAhead = lookAhead;
+        Cholesky( uplo, A, ctrl );
+    }
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -120,6 +126,7 @@ main( int argc, char* argv[] )
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool pivot = Input("--pivot","use pivoting?",false);
+        const bool lookAhead = Input("--lookAhead","look ahead?",false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -148,17 +155,21 @@ main( int argc, char* argv[] )
             Output("Testing with doubles:");
         if( scalapack )
             TestCholesky<double>
-            ( testCorrectness, pivot, print, printDiag, uplo, m, g, true );
+            ( testCorrectness, pivot, print, printDiag, uplo, m, g,
+              true, false );
         TestCholesky<double>
-        ( testCorrectness, pivot, print, printDiag, uplo, m, g, false );
+        ( testCorrectness, pivot, print, printDiag, uplo, m, g,
+          false, lookAhead );
 
         if( commRank == 0 )
             Output("Testing with double-precision complex:");
         if( scalapack )
             TestCholesky<Complex<double>>
-            ( testCorrectness, pivot, print, printDiag, uplo, m, g, true );
+            ( testCorrectness, pivot, print, printDiag, uplo, m, g,
+              true, false );
         TestCholesky<Complex<double>>
-        ( testCorrectness, pivot, print, printDiag, uplo, m, g, false );
+        ( testCorrectness, pivot, print, printDiag, uplo, m, g,
+          false, lookAhead );
     }
     catch( exception& e ) { ReportException(e); }
 
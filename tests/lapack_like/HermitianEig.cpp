@@ -244,6 +244,61 @@ main( int argc, char* argv[] )
             ( testCorrectness, print, onlyEigvals, clustered, 
               uplo, m, sort, g, subset, ctrl_z, scalapack );
 
+        if( commRank == 0 )
+            Output("Two-stage tridiag algorithms:");
+        ctrl_d.tridiagCtrl.twoStage = true;
+        ctrl_z.tridiagCtrl.twoStage = true;
+        if( testReal )
+            TestHermitianEig<double>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_d, false );
+        if( testCpx )
+            TestHermitianEig<Complex<double>>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_z, false );
+        ctrl_d.tridiagCtrl.twoStage = false;
+        ctrl_z.tridiagCtrl.twoStage = false;
+
+        if( commRank == 0 )
+            Output("Divide-and-conquer tridiagonal eigensolver:");
+        ctrl_d.useDC = true;
+        ctrl_z.useDC = true;
+        if( testReal )
+            TestHermitianEig<double>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_d, false );
+        if( testCpx )
+            TestHermitianEig<Complex<double>>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_z, false );
+        ctrl_d.useDC = false;
+        ctrl_z.useDC = false;
+
+        // Unlike PMRRR, divide and conquer runs in single-precision
+        HermitianEigSubset<float> subset_s;
+        subset_s.indexSubset = subset.indexSubset;
+        subset_s.lowerIndex = subset.lowerIndex;
+        subset_s.upperIndex = subset.upperIndex;
+        subset_s.rangeSubset = subset.rangeSubset;
+        subset_s.lowerBound = subset.lowerBound;
+        subset_s.upperBound = subset.upperBound;
+        HermitianEigCtrl<float> ctrl_s;
+        ctrl_s.timeStages = timeStages;
+        ctrl_s.useDC = true;
+        HermitianEigCtrl<Complex<float>> ctrl_c;
+        ctrl_c.timeStages = timeStages;
+        ctrl_c.useDC = true;
+        if( commRank == 0 )
+            Output("Single-precision divide-and-conquer:");
+        if( testReal )
+            TestHermitianEig<float>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset_s, ctrl_s, false );
+        if( testCpx )
+            TestHermitianEig<Complex<float>>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset_s, ctrl_c, false );
+
         // Also test with non-standard distributions
         if( commRank == 0 )
             Output("Nonstandard distributions:");
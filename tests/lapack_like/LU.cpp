@@ -57,7 +57,7 @@ void TestCorrectness
 template<typename F> 
 void TestLU
 ( Int m, const Grid& g, Int pivoting, 
-  bool testCorrectness, bool forceGrowth, bool print )
+  bool testCorrectness, bool forceGrowth, bool lookAhead, bool print )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistPermutation P(g), Q(g);
@@ -79,7 +79,11 @@ void TestLU
     if( pivoting == 0 )
         LU( A );
     else if( pivoting == 1 )
-        LU( A, P );
+    {
+        LUCtrl ctrl;
+        ctrl.lookAhead = lookAhead;
+        LU( A, P, ctrl );
+    }
     else if( pivoting == 2 )
         LU( A, P, Q );
 
@@ -140,6 +144,8 @@ main( int argc, char* argv[] )
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
+        const bool lookAhead = Input
+            ("--lookAhead","look ahead in partially-pivoted LU?",false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -166,12 +172,13 @@ main( int argc, char* argv[] )
 
         if( commRank == 0 )
             Output("Testing with doubles:");
-        TestLU<double>( m, g, pivot, testCorrectness, forceGrowth, print );
+        TestLU<double>
+        ( m, g, pivot, testCorrectness, forceGrowth, lookAhead, print );
 
         if( commRank == 0 )
             Output("Testing with double-precision complex:");
         TestLU<Complex<double>>
-        ( m, g, pivot, testCorrectness, forceGrowth, print );
+        ( m, g, pivot, testCorrectness, forceGrowth, lookAhead, print );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve a well-conditioned system with mixed precision without allowing the
+// fallback to a full-precision factorization and check the backward error
+template<typename F,class SolveType>
+bool CheckSolve
+( const string& label, const DistMatrix<F>& A, const DistMatrix<F>& B,
+  const SolveType& solve, bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int commRank = g.Rank();
+    const Int n = A.Height();
+
+    if( commRank == 0 )
+        Output("  Mixed-precision ",label,"...");
+    DistMatrix<F> X(g), E(g);
+    X = B;
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    try { solve( X ); }
+    catch( const RefinementFailureException& e )
+    {
+        if( commRank == 0 )
+            Output("    GMRES-IR failed: ",e.what());
+        return false;
+    }
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+
+    E = B;
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    if( print )
+        Print( E, "B - A X" );
+    const Real frobA = FrobeniusNorm( A );
+    const Real frobB = FrobeniusNorm( B );
+    const Real frobX = FrobeniusNorm( X );
+    const Real frobE = FrobeniusNorm( E );
+    const Real relResid = frobE / (frobA*frobX+frobB);
+    const Real tol = 10*n*Epsilon<Real>();
+    if( commRank == 0 )
+        Output
+        ("    ",runTime," seconds\n",
+         "    || B - A X ||_F / ( || A ||_F || X ||_F + || B ||_F ) = ",
+         relResid);
+    return relResid <= tol;
+}
+
+template<typename F>
+bool TestDense
+( Int n, Int numRHS, const Grid& g, bool progress, bool print )
+{
+    typedef Base<F> Real;
+
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = true;
+    ctrl.fallback = false;
+    ctrl.progress = progress;
+
+    DistMatrix<F> A(g), B(g);
+    Gaussian( A, n, n );
+    ShiftDiagonal( A, F(n) );
+    Uniform( B, n, numRHS );
+    if( numRHS > 1 )
+    {
+        // The remaining right-hand sides must be refined around a zero one
+        auto b1 = B( ALL, IR(1) );
+        Zero( b1 );
+    }
+    bool passed = CheckSolve
+      ( "LinearSolve", A, B,
+        [&]( DistMatrix<F>& X ) { LinearSolve( A, X, ctrl ); }, print );
+
+    // Form a Hermitian positive-definite matrix
+    DistMatrix<F> G(g);
+    Gaussian( G, n, n );
+    Herk( LOWER, ADJOINT, Real(1), G, A );
+    ShiftDiagonal( A, F(n) );
+    MakeHermitian( LOWER, A );
+    passed = CheckSolve
+      ( "HPDSolve", A, B,
+        [&]( DistMatrix<F>& X ) { HPDSolve( LOWER, NORMAL, A, X, ctrl ); },
+        print ) && passed;
+
+    // Solve against the transpose using the other triangle
+    DistMatrix<F> AT(g);
+    Transpose( A, AT );
+    passed = CheckSolve
+      ( "HPDSolve (upper, transposed)", AT, B,
+        [&]( DistMatrix<F>& X ) { HPDSolve( UPPER, TRANSPOSE, A, X, ctrl ); },
+        print ) && passed;
+    return passed;
+}
+
+bool TestSparse
+( Int n1, Int n2, Int n3, const BisectCtrl& bisectCtrl, bool progress )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<double> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    DistSparseMatrix<float> ALow(comm);
+    Copy( A, ALow );
+
+    const DistGraph& graph = A.DistGraph();
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator sep;
+    DistMap map, invMap;
+    ldl::NestedDissection( graph, map, sep, info, bisectCtrl );
+    InvertMap( map, invMap );
+
+    if( commRank == 0 )
+        Output("  Single-precision sparse LDL^H...");
+    ldl::DistFront<float> front( ALow, map, sep, info, false );
+    LDL( info, front, LDL_1D );
+
+    DistMultiVec<double> B(comm), X(comm), reg(comm);
+    Uniform( B, N, 1 );
+    Zeros( reg, N, 1 );
+    X = B;
+
+    RegSolveCtrl<double> ctrl;
+    ctrl.relTol = 1e-12;
+    ctrl.maxIts = 20;
+    ctrl.progress = progress;
+    if( commRank == 0 )
+        Output("  Double-precision refinement...");
+    const Int numIts =
+      reg_ldl::MixedSolveAfter( A, reg, invMap, info, front, X, ctrl );
+
+    DistMultiVec<double> E(comm);
+    E = B;
+    Multiply( NORMAL, -1., A, X, 1., E );
+    const double relResid = FrobeniusNorm(E) / FrobeniusNorm(B);
+    if( commRank == 0 )
+        Output
+        ("    ",numIts," iterations\n",
+         "    || B - A X ||_F / || B ||_F = ",relResid);
+    return relResid <= 10*ctrl.relTol;
+}
+
+// Solve a sparse least squares problem with the regularized quasi-semidefinite
+// factorization computed in single precision and compare against the
+// solution computed entirely in double precision
+bool TestSparseLeastSquares( Int n1, Int n2, bool progress )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const Int n = n1*n2;
+
+    // Stack a 2D Laplacian on top of the identity
+    DistSparseMatrix<double> L(comm), A(comm);
+    Laplacian( L, n1, n2 );
+    Zeros( A, 2*n, n );
+    A.Reserve( L.NumLocalEntries()+A.LocalHeight(), L.NumLocalEntries() );
+    for( Int e=0; e<L.NumLocalEntries(); ++e )
+        A.QueueUpdate( L.Row(e), L.Col(e), L.Value(e) );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( i >= n )
+            A.QueueLocalUpdate( iLoc, i-n, 1. );
+    }
+    A.ProcessQueues();
+
+    DistMultiVec<double> B(comm), X(comm), XRef(comm);
+    Uniform( B, 2*n, 2 );
+
+    LeastSquaresCtrl<double> ctrl;
+    ctrl.solveCtrl.relTol = 1e-12;
+    ctrl.solveCtrl.maxIts = 20;
+    ctrl.solveCtrl.progress = progress;
+    if( commRank == 0 )
+        Output("  Double-precision sparse LeastSquares...");
+    LeastSquares( NORMAL, A, B, XRef, ctrl );
+    if( commRank == 0 )
+        Output("  Mixed-precision sparse LeastSquares...");
+    ctrl.solveCtrl.mixedPrecision = true;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+
+    X -= XRef;
+    const double relError = FrobeniusNorm(X) / FrobeniusNorm(XRef);
+    if( commRank == 0 )
+        Output("    || X - XRef ||_F / || XRef ||_F = ",relError);
+    return relError <= 1e-8;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","height of dense matrix",200);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            Output("Double-precision:");
+        bool passed = TestDense<double>( n, numRHS, g, progress, print );
+
+        if( commRank == 0 )
+            Output("Double-precision complex:");
+        passed = TestDense<Complex<double>>( n, numRHS, g, progress, print ) &&
+                 passed;
+
+        if( commRank == 0 )
+            Output("Sparse double-precision:");
+        BisectCtrl bisectCtrl;
+        bisectCtrl.cutoff = cutoff;
+        passed = TestSparse( n1, n2, n3, bisectCtrl, progress ) && passed;
+        passed = TestSparseLeastSquares( n1, n2, progress ) && passed;
+
+        if( !passed )
+            LogicError("Mixed-precision solve test failed");
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve an ill-conditioned (Hilbert) system whose exact solution is the
+// vector of all ones. For the double-double and quad-double types, the
+// matrix is factored in the next-lowest precision and the solution is
+// refined with GMRES-IR.
+template<typename Real>
+void TestHilbert( Int n, bool mixedPrecision, bool progress, bool print )
+{
+    Matrix<Real> A, X, XTrue, B;
+    Hilbert( A, n );
+    Ones( XTrue, n, 1 );
+    Zeros( B, n, 1 );
+    Gemv( NORMAL, Real(1), A, XTrue, Real(0), B );
+
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = mixedPrecision;
+    ctrl.progress = progress;
+
+    X = B;
+    Timer timer;
+    timer.Start();
+    LinearSolve( A, X, ctrl );
+    const double runTime = timer.Stop();
+    if( print )
+        Print( X, "X" );
+
+    X -= XTrue;
+    Output("  LinearSolve finished in ",runTime," seconds");
+    Output("  || X - XTrue ||_max = ",MaxNorm(X));
+}
+
+template<typename Real>
+void TestDistHilbert( Int n, const Grid& g, bool progress )
+{
+    DistMatrix<Real> A(g), X(g), XTrue(g), B(g);
+    Hilbert( A, n );
+    Ones( XTrue, n, 1 );
+    Zeros( B, n, 1 );
+    Gemv( NORMAL, Real(1), A, XTrue, Real(0), B );
+
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = true;
+    ctrl.progress = progress;
+
+    X = B;
+    LinearSolve( A, X, ctrl );
+    X -= XTrue;
+    const Real maxError = MaxNorm( X );
+    if( g.Rank() == 0 )
+        Output("  || X - XTrue ||_max = ",maxError);
+}
+
+template<typename Real>
+void TimeGemm( Int n )
+{
+    Matrix<Real> A, B, C;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+
+    Timer timer;
+    timer.Start();
+    Gemm( NORMAL, NORMAL, Real(1), A, B, Real(0), C );
+    const double runTime = timer.Stop();
+    const double gFlops = 2.*double(n)*double(n)*double(n)/(1.e9*runTime);
+    Output("  Gemm finished in ",runTime," seconds (",gFlops," GFlop/s)");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of Hilbert matrix",12);
+        const Int nGemm = Input("--nGemm","size of Gemm timing",200);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            Output("Hilbert system with double:");
+            TestHilbert<double>( n, false, progress, print );
+            Output("Hilbert system with DoubleDouble:");
+            TestHilbert<DoubleDouble>( n, true, progress, print );
+            Output("Hilbert system with QuadDouble:");
+            TestHilbert<QuadDouble>( n, true, progress, print );
+
+            Output("Gemm with double:");
+            TimeGemm<double>( nGemm );
+            Output("Gemm with DoubleDouble:");
+            TimeGemm<DoubleDouble>( nGemm );
+            Output("Gemm with QuadDouble:");
+            TimeGemm<QuadDouble>( nGemm );
+#ifdef EL_HAVE_QUAD
+            Output("Gemm with Quad:");
+            TimeGemm<Quad>( nGemm );
+#endif
+        }
+
+        if( commRank == 0 )
+            Output("Distributed Hilbert system with DoubleDouble:");
+        TestDistHilbert<DoubleDouble>( n, g, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& T,
+  const DistMatrix<F>& Q,
+  bool print, bool display )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real frobNormA = FrobeniusNorm( A );
+    if( g.Rank() == 0 )
+        Output("Testing error...");
+
+    // Check that T is (quasi-)triangular
+    DistMatrix<F> TLower( T );
+    MakeTrapezoidal( LOWER, TLower, ( IsComplex<F>::value ? -1 : -2 ) );
+    const Real frobNormTLower = FrobeniusNorm( TLower );
+
+    // Compute || A - Q T Q^H ||_F
+    DistMatrix<F> G(g), E( A );
+    Gemm( NORMAL, NORMAL, F(1), Q, T, G );
+    Gemm( NORMAL, ADJOINT, F(-1), G, Q, F(1), E );
+    const Real frobNormE = FrobeniusNorm( E );
+    if( print )
+        Print( E, "A - Q T Q^H" );
+    if( display )
+        Display( E, "A - Q T Q^H" );
+
+    // Compute || I - Q^H Q ||_F
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real frobNormOrthog = HermitianFrobeniusNorm( LOWER, E );
+
+    if( g.Rank() == 0 )
+        Output
+        ("    ||A||_F = ",frobNormA,"\n",
+         "    || strictly lower(T) ||_F = ",frobNormTLower,"\n",
+         "    ||A - Q T Q^H||_F / ||A||_F = ",frobNormE/frobNormA,"\n",
+         "    ||I - Q^H Q||_F = ",frobNormOrthog);
+}
+
+template<typename F>
+void TestSchur
+( Int n, const Grid& g, const HessQRCtrl& qrCtrl, bool testCorrectness,
+  bool print, bool display )
+{
+    DistMatrix<F> A(g), T(g), Q(g);
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+
+    Uniform( A, n, n );
+    T = A;
+    if( print )
+        Print( A, "A" );
+    if( display )
+        Display( A, "A" );
+
+    SchurCtrl<Base<F>> ctrl;
+    ctrl.qrCtrl = qrCtrl;
+    if( g.Rank() == 0 )
+        Output("  Starting Schur decomposition...");
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Schur( T, w, Q, true, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        Output("  ",runTime," seconds");
+    if( print )
+    {
+        Print( T, "T" );
+        Print( Q, "Q" );
+        Print( w, "w" );
+    }
+    if( display )
+    {
+        Display( T, "T" );
+        Display( Q, "Q" );
+        Display( w, "w" );
+    }
+    if( testCorrectness )
+        TestCorrectness( A, T, Q, print, display );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","height of matrix",300);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int minMultiBulgeSize =
+          Input("--minMultiBulgeSize","max size of LAPACK blocks",75);
+        const Int numShifts =
+          Input("--numShifts","shifts per sweep (0=auto)",0);
+        const Int deflationSize =
+          Input("--deflationSize","AED window size (0=auto)",0);
+        const bool scalapack =
+          Input("--scalapack","use ScaLAPACK's QR algorithm?",false);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool display = Input("--display","display matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        HessQRCtrl qrCtrl;
+        qrCtrl.scalapack = scalapack;
+        qrCtrl.minMultiBulgeSize = minMultiBulgeSize;
+        qrCtrl.numShifts = numShifts;
+        qrCtrl.deflationSize = deflationSize;
+
+        if( commRank == 0 )
+            Output("Double-precision:");
+        TestSchur<double>( n, g, qrCtrl, testCorrectness, print, display );
+
+        if( commRank == 0 )
+            Output("Double-precision complex:");
+        TestSchur<Complex<double>>
+        ( n, g, qrCtrl, testCorrectness, print, display );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
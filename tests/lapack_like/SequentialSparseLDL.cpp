@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// The solve sweeps forward and backward over every front of the tree
+template<typename F>
+bool TestFactorization
+( const SparseMatrix<F>& A,
+  const vector<Int>& invMap, const ldl::NodeInfo& info,
+  const ldl::Front<F>& front, Int numRHS )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+
+    Matrix<F> B, X;
+    Uniform( B, n, numRHS );
+    X = B;
+    ldl::SolveAfter( invMap, info, front, X );
+    const Real BNorm = FrobeniusNorm( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), B );
+    const Real residNorm = FrobeniusNorm( B );
+    Output("  || B - A X ||_F / || B ||_F = ",residNorm/BNorm);
+    return residNorm <= n*Epsilon<Real>()*BNorm*100;
+}
+
+template<typename F>
+void TestSparseLDL
+( Int n1, Int n2, Int n3, Int numRHS, Int cutoff, bool print )
+{
+    SparseMatrix<F> A;
+    Laplacian( A, n1, n2, n3 );
+    // Make the problem indefinite (but still nonsingular)
+    ShiftDiagonal( A, F(-1)/F(2) );
+    if( print )
+        Print( A, "A" );
+
+    // A small cutoff leads to a deep elimination tree with many independent
+    // subtrees
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map, invMap;
+    ldl::NaturalNestedDissection
+    ( n1, n2, n3, A.LockedGraph(), map, rootSep, info, cutoff );
+    InvertMap( map, invMap );
+
+    bool passed = true;
+    for( LDLFrontType type : { LDL_1D, LDL_2D, LDL_INTRAPIV_2D } )
+    {
+        ldl::Front<F> front( A, map, info );
+        LDL( info, front, type );
+        passed = TestFactorization( A, invMap, info, front, numRHS ) && passed;
+    }
+    if( !passed )
+        LogicError("Sequential sparse LDL test failed");
+    Output("PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",12);
+        const Int n2 = Input("--n2","second grid dimension",12);
+        const Int n3 = Input("--n3","third grid dimension",12);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",16);
+        const bool print = Input("--print","print matrix?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            Output("Testing with doubles:");
+            TestSparseLDL<double>( n1, n2, n3, numRHS, cutoff, print );
+            Output("Testing with double-precision complex:");
+            TestSparseLDL<Complex<double>>
+            ( n1, n2, n3, numRHS, cutoff, print );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -31,6 +31,102 @@ void MakeFrontsUniform( ldl::DistFront<F>& front )
         MakeFrontsUniform( *front.duplicate );
 }
 
+// Check that the (unfactored) storage of two frontal trees is identical
+template<typename F>
+bool FrontsMatch( const ldl::Front<F>& front, const ldl::Front<F>& ref )
+{
+    if( front.type != ref.type || front.sparseLeaf != ref.sparseLeaf ||
+        front.children.size() != ref.children.size() )
+        return false;
+    const Int height = ref.LDense.Height();
+    const Int width = ref.LDense.Width();
+    if( front.LDense.Height() != height || front.LDense.Width() != width )
+        return false;
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            if( front.LDense.Get(i,j) != ref.LDense.Get(i,j) )
+                return false;
+    if( ref.sparseLeaf )
+    {
+        const Int numEntries = ref.workSparse.NumEntries();
+        if( front.workSparse.NumEntries() != numEntries )
+            return false;
+        for( Int e=0; e<numEntries; ++e )
+            if( front.workSparse.Value(e) != ref.workSparse.Value(e) )
+                return false;
+    }
+    for( Int c=0; c<Int(ref.children.size()); ++c )
+        if( !FrontsMatch( *front.children[c], *ref.children[c] ) )
+            return false;
+    return true;
+}
+
+template<typename F>
+bool FrontsMatch( const ldl::DistFront<F>& front, const ldl::DistFront<F>& ref )
+{
+    if( front.type != ref.type )
+        return false;
+    if( ref.duplicate != nullptr )
+        return front.duplicate != nullptr &&
+               FrontsMatch( *front.duplicate, *ref.duplicate );
+    const Matrix<F>& LLoc = front.L2D.LockedMatrix();
+    const Matrix<F>& LRefLoc = ref.L2D.LockedMatrix();
+    if( front.L2D.Height() != ref.L2D.Height() ||
+        front.L2D.Width() != ref.L2D.Width() ||
+        LLoc.Height() != LRefLoc.Height() || LLoc.Width() != LRefLoc.Width() )
+        return false;
+    for( Int jLoc=0; jLoc<LRefLoc.Width(); ++jLoc )
+        for( Int iLoc=0; iLoc<LRefLoc.Height(); ++iLoc )
+            if( LLoc.Get(iLoc,jLoc) != LRefLoc.Get(iLoc,jLoc) )
+                return false;
+    return front.child != nullptr && FrontsMatch( *front.child, *ref.child );
+}
+
+// Pulling new values through a cached plan into a factored tree must yield
+// exactly the same fronts as a fresh pull of the modified matrix
+bool TestSequentialPullMeta( Int n1, Int n2, Int n3, const BisectCtrl& ctrl )
+{
+    SparseMatrix<double> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    ldl::NodeInfo info;
+    ldl::Separator sep;
+    vector<Int> map, invMap;
+    ldl::NestedDissection( A.LockedGraph(), map, sep, info, ctrl );
+    InvertMap( map, invMap );
+
+    ldl::Front<double> front;
+    ldl::FrontPullMeta meta;
+    front.Pull( A, map, info, meta, false );
+    LDL( info, front, LDL_1D );
+
+    ShiftDiagonal( A, 1. );
+    front.Pull( A, map, info, meta, false );
+    ldl::Front<double> freshFront;
+    freshFront.Pull( A, map, info, false );
+    return FrontsMatch( front, freshFront );
+}
+
+bool TestDistPullMeta
+(       DistSparseMatrix<double>& A,
+  const DistMap& map,
+  const ldl::DistSeparator& sep,
+  const ldl::DistNodeInfo& info )
+{
+    ldl::DistFront<double> front;
+    ldl::DistFrontPullMeta meta;
+    front.Pull( A, map, sep, info, meta, false );
+    LDL( info, front, LDL_1D );
+
+    ShiftDiagonal( A, 1. );
+    front.Pull( A, map, sep, info, meta, false );
+    ldl::DistFront<double> freshFront( A, map, sep, info, false );
+    ShiftDiagonal( A, -1. );
+    const Int myMismatch = ( FrontsMatch( front, freshFront ) ? 0 : 1 );
+    return mpi::AllReduce( myMismatch, A.Comm() ) == 0;
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -45,6 +141,8 @@ int main( int argc, char* argv[] )
         const Int numRepeats = Input
             ("--numRepeats","number of repeated factorizations",5);
         const bool intraPiv = Input("--intraPiv","frontal pivoting?",false);
+        const bool valuesOnly = Input
+            ("--valuesOnly","refactor by only pulling in new values?",false);
         const bool sequential = Input
             ("--sequential","sequential partitions?",true);
         const int numDistSeps = Input
@@ -57,6 +155,7 @@ int main( int argc, char* argv[] )
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
+        PrintInputReport();
 
         BisectCtrl ctrl;
         ctrl.sequential = sequential;
@@ -101,16 +200,40 @@ int main( int argc, char* argv[] )
             Output("Building ldl::DistFront tree...");
         mpi::Barrier( comm );
         const double buildStart = mpi::Time();
-        ldl::DistFront<double> front( A, map, sep, info, false );
+        ldl::DistFront<double> front;
+        ldl::DistFrontPullMeta pullMeta;
+        if( valuesOnly )
+            front.Pull( A, map, sep, info, pullMeta, false );
+        else
+            front.Pull( A, map, sep, info, false );
         mpi::Barrier( comm );
         const double buildStop = mpi::Time();
         if( commRank == 0 )
             Output(buildStop-buildStart," seconds");
 
+        bool passed = true;
+        const double tol = N*Epsilon<double>()*100;
         for( Int repeat=0; repeat<numRepeats; ++repeat )
         {
             if( repeat != 0 )
-                MakeFrontsUniform( front );
+            {
+                if( valuesOnly )
+                {
+                    // Change the values of A, but not its sparsity pattern
+                    ShiftDiagonal( A, 1., 0, true );
+                    if( commRank == 0 )
+                        Output("Pulling in the new values...");
+                    mpi::Barrier( comm );
+                    const double pullStart = mpi::Time();
+                    front.Pull( A, map, sep, info, pullMeta, false );
+                    mpi::Barrier( comm );
+                    const double pullStop = mpi::Time();
+                    if( commRank == 0 )
+                        Output(pullStop-pullStart," seconds");
+                }
+                else
+                    MakeFrontsUniform( front );
+            }
 
             if( commRank == 0 )
                 Output("Running LDL^T and redistribution...");
@@ -128,16 +251,45 @@ int main( int argc, char* argv[] )
             if( commRank == 0 )
                 Output("Solving against random right-hand side...");
             const double solveStart = mpi::Time();
-            DistMultiVec<double> y( N, 1, comm );
-            MakeUniform( y );
+            DistMultiVec<double> b( N, 1, comm );
+            MakeUniform( b );
+            auto y = b;
             ldl::SolveAfter( invMap, info, front, y );
             mpi::Barrier( comm );
             const double solveStop = mpi::Time();
             if( commRank == 0 )
                 Output("  Time = ",solveStop-solveStart," seconds");
 
-            // TODO: Check residual error
+            // The factors of random fronts have no relation to A
+            if( valuesOnly || repeat == 0 )
+            {
+                const double bNrm2 = FrobeniusNorm( b );
+                Multiply( NORMAL, -1., A, y, 1., b );
+                const double eNrm2 = FrobeniusNorm( b );
+                if( commRank == 0 )
+                    Output("  || b - A x ||_2 / || b ||_2 = ",eNrm2/bNrm2);
+                if( eNrm2 > tol*bNrm2 )
+                    passed = false;
+            }
+        }
+
+        if( commRank == 0 )
+            Output("Comparing cached-plan pulls against fresh pulls...");
+        if( !TestDistPullMeta( A, map, sep, info ) )
+        {
+            if( commRank == 0 )
+                Output("  Distributed pull mismatch");
+            passed = false;
         }
+        if( commRank == 0 && !TestSequentialPullMeta( n1, n2, n3, ctrl ) )
+        {
+            Output("  Sequential pull mismatch");
+            passed = false;
+        }
+        if( !mpi::AllReduce( Int(passed), mpi::MIN, comm ) )
+            LogicError("Sparse LDL refactorization test failed");
+        if( commRank == 0 )
+            Output("PASSED");
     }
     catch( exception& e ) { ReportException(e); }
 
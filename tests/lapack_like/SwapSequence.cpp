@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A DistPermutation which is a swap sequence composes its swaps into a single
+// exchange (whose metadata is cached) when applied to an elementally
+// distributed matrix. The results are compared against applying each swap
+// individually with El::RowSwap and El::ColSwap.
+
+// Every process must queue the same swaps, so they are drawn on the root
+void RandomSwaps
+( Int n, Int numSwaps, bool implicitOrigins,
+  vector<Int>& origins, vector<Int>& dests, mpi::Comm comm )
+{
+    origins.resize( numSwaps );
+    dests.resize( numSwaps );
+    if( mpi::Rank(comm) == 0 )
+    {
+        for( Int j=0; j<numSwaps; ++j )
+        {
+            // With explicit origins, draw from a small set of rows so that
+            // the swaps frequently repeat and overlap
+            origins[j] =
+              ( implicitOrigins ? j : SampleUniform<Int>(0,Min(n,Int(8))) );
+            dests[j] = SampleUniform<Int>(0,n);
+        }
+        // Start from an unexpected origin so that the origins are stored
+        // explicitly, swap the first pair again, and add a trivial swap
+        if( !implicitOrigins && numSwaps >= 3 )
+        {
+            origins[0] = 1;
+            origins[numSwaps-2] = dests[0];
+            dests[numSwaps-2] = origins[0];
+            dests[numSwaps-1] = origins[numSwaps-1];
+        }
+    }
+    mpi::Broadcast( origins.data(), numSwaps, 0, comm );
+    mpi::Broadcast( dests.data(), numSwaps, 0, comm );
+}
+
+template<typename T,Dist U,Dist V>
+bool Matches
+( const string& label, const DistMatrix<T,U,V>& A,
+  const DistMatrix<T,U,V>& ARef, bool print )
+{
+    DistMatrix<T,U,V> E( A );
+    E -= ARef;
+    const Base<T> error = MaxNorm( E );
+    if( print )
+    {
+        Print( A, label );
+        Print( ARef, label+" reference" );
+    }
+    if( error != Base<T>(0) && A.Grid().Rank() == 0 )
+        Output("    ",label,": || A - ARef ||_max = ",error," (FAILED)");
+    return error == Base<T>(0);
+}
+
+template<Dist U,Dist V>
+bool TestApplications
+( const DistPermutation& P,
+  const vector<Int>& origins, const vector<Int>& dests,
+  Int m, Int offset, const Grid& g, bool print )
+{
+    const Int numSwaps = origins.size();
+    DistMatrix<double,U,V> AOrig(g);
+    // Each entry is unique, so any misplaced row or column is detected
+    auto entry = [&]( Int i, Int j ) { return double(i+j*m); };
+    Zeros( AOrig, m, m );
+    IndexDependentFill( AOrig, function<double(Int,Int)>(entry) );
+
+    bool passed = true;
+
+    // Apply the sequence to the rows and then invert it
+    DistMatrix<double,U,V> A( AOrig ), ARef( AOrig );
+    P.PermuteRows( A, offset );
+    for( Int j=0; j<numSwaps; ++j )
+        RowSwap( ARef, origins[j]+offset, dests[j]+offset );
+    passed = Matches( "PermuteRows", A, ARef, print ) && passed;
+    P.InversePermuteRows( A, offset );
+    for( Int j=numSwaps-1; j>=0; --j )
+        RowSwap( ARef, origins[j]+offset, dests[j]+offset );
+    passed = Matches( "InversePermuteRows", A, ARef, print ) && passed;
+    passed = Matches( "InversePermuteRows", A, AOrig, print ) && passed;
+
+    // Apply the inverse first to the columns
+    P.InversePermuteCols( A, offset );
+    for( Int j=numSwaps-1; j>=0; --j )
+        ColSwap( ARef, origins[j]+offset, dests[j]+offset );
+    passed = Matches( "InversePermuteCols", A, ARef, print ) && passed;
+    P.PermuteCols( A, offset );
+    for( Int j=0; j<numSwaps; ++j )
+        ColSwap( ARef, origins[j]+offset, dests[j]+offset );
+    passed = Matches( "PermuteCols", A, ARef, print ) && passed;
+    passed = Matches( "PermuteCols", A, AOrig, print ) && passed;
+
+    return passed;
+}
+
+template<Dist U,Dist V>
+bool TestSwapSequence
+( Int n, Int numSwaps, bool implicitOrigins, const Grid& g, bool print )
+{
+    const Int maxOffset = 5;
+    const Int m = n + maxOffset + 2;
+
+    vector<Int> origins, dests;
+    RandomSwaps( n, numSwaps, implicitOrigins, origins, dests, g.Comm() );
+
+    // Leave room for one more swap to be appended below
+    DistPermutation P(g);
+    P.MakeIdentity( n );
+    P.ReserveSwaps( numSwaps+1 );
+    for( Int j=0; j<numSwaps; ++j )
+        P.RowSwap( origins[j], dests[j] );
+    if( P.IsImplicitSwapSequence() != implicitOrigins )
+        LogicError("Unexpected form of the swap sequence");
+
+    bool passed = true;
+    // Repeating an offset reuses the cached metadata, while changing it
+    // invalidates the cache
+    for( Int offset : { Int(0), Int(0), Int(3), Int(3), maxOffset, Int(0) } )
+        passed = TestApplications<U,V>
+          ( P, origins, dests, m, offset, g, print ) && passed;
+
+    // Appending a swap must invalidate the cached metadata as well
+    origins.push_back( implicitOrigins ? numSwaps : dests[0] );
+    dests.push_back( n-1 );
+    P.RowSwap( origins.back(), dests.back() );
+    passed = TestApplications<U,V>
+      ( P, origins, dests, m, Int(0), g, print ) && passed;
+    return passed;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const Int n = Input("--n","size of permutation",50);
+        const Int numSwaps = Input("--numSwaps","number of swaps",80);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const Grid g( comm, r );
+
+        bool passed = true;
+        for( bool implicitOrigins : { true, false } )
+        {
+            // Implicit origins are of the form 0, 1, ..., numSwaps-1, and
+            // one more swap is appended during the test
+            const Int numSwapsPerm = ( implicitOrigins ? n-1 : numSwaps );
+            if( commRank == 0 )
+                Output
+                ("Testing ",numSwapsPerm," swaps with ",
+                 (implicitOrigins ? "implicit" : "explicit")," origins");
+            passed = TestSwapSequence<MC,MR>
+              ( n, numSwapsPerm, implicitOrigins, g, print ) && passed;
+            passed = TestSwapSequence<VC,STAR>
+              ( n, numSwapsPerm, implicitOrigins, g, print ) && passed;
+        }
+        if( !passed )
+            LogicError("Swap sequence test failed");
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
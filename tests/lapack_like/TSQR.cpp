@@ -58,7 +58,7 @@ void TestCorrectness
 template<typename F>
 void TestQR
 ( bool testCorrectness, bool print,
-  Int m, Int n, const Grid& g )
+  Int m, Int n, Int arity, const Grid& g )
 {
     DistMatrix<F,VC,STAR> A(g), AFact(g);
     DistMatrix<F,STAR,STAR> R(g);
@@ -72,7 +72,7 @@ void TestQR
         Output("  Starting TSQR factorization...");
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
-    qr::ExplicitTS( AFact, R );
+    qr::ExplicitTS( AFact, R, arity );
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double mD = double(m);
@@ -102,6 +102,7 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int arity = Input("--arity","arity of the reduction tree",2);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -117,11 +118,11 @@ main( int argc, char* argv[] )
 
         if( commRank == 0 )
             Output("Testing with doubles:");
-        TestQR<double>( testCorrectness, print, m, n, g );
+        TestQR<double>( testCorrectness, print, m, n, arity, g );
 
         if( commRank == 0 )
             Output("Testing with double-precision complex:");
-        TestQR<Complex<double>>( testCorrectness, print, m, n, g );
+        TestQR<Complex<double>>( testCorrectness, print, m, n, arity, g );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// B = BOrig U must hold for an integer matrix U with determinant +-1
+template<typename Real>
+bool Unimodular( const Matrix<Real>& BOrig, const Matrix<Real>& B )
+{
+    Matrix<Real> U( B );
+    LinearSolve( BOrig, U );
+    Round( U );
+    Matrix<Real> E( B );
+    Gemm( NORMAL, NORMAL, Real(-1), BOrig, U, Real(1), E );
+    const Matrix<Real>& UConst = U;
+    const Real det = Determinant( UConst );
+    return MaxNorm( E ) < Real(1)/Real(2) &&
+           Abs(Abs(det)-Real(1)) < Real(1)/Real(1000);
+}
+
+// Every column must satisfy the deep insertion condition,
+//
+//   delta || b*_i ||^2 <= || pi_i(b_k) ||^2,  0 <= i < k,
+//
+// where pi_i projects away from the span of the first i columns
+template<typename Real>
+bool DeepReduced( const Matrix<Real>& QR, Real delta, Real tol )
+{
+    const Int n = QR.Width();
+    for( Int k=1; k<n; ++k )
+    {
+        Real projNormSquared = QR.Get(k,k)*QR.Get(k,k);
+        for( Int i=k-1; i>=0; --i )
+        {
+            projNormSquared += QR.Get(i,k)*QR.Get(i,k);
+            if( delta*QR.Get(i,i)*QR.Get(i,i) > projNormSquared*(1+tol) )
+                return false;
+        }
+    }
+    return true;
+}
+
+template<typename Real>
+Real FirstNorm( const Matrix<Real>& B )
+{ return FrobeniusNorm( B(ALL,IR(0)) ); }
+
+template<typename Real>
+bool TestReduction( Int n, Real range, Int blocksize, bool print )
+{
+    const Real delta = Real(0.99);
+    const Real tol = Pow(Epsilon<Real>(),Real(1)/Real(2));
+
+    Matrix<Real> BOrig;
+    Uniform( BOrig, n, n, Real(0), range );
+    Round( BOrig );
+    if( print )
+        Print( BOrig, "BOrig" );
+
+    bool passed = true;
+    Matrix<Real> BLLL( BOrig ), QRLLL;
+    LLL( BLLL, QRLLL, delta );
+    Output("  LLL:     || b_0 ||_2 = ",FirstNorm(BLLL));
+
+    // DeepLLL must be LLL-reduced and satisfy the deep insertion condition
+    Matrix<Real> BDeep( BOrig ), QRDeep;
+    DeepLLL( BDeep, QRDeep, delta );
+    const bool deepPassed =
+      Unimodular( BOrig, BDeep ) && LLLDelta( QRDeep ) >= delta-tol &&
+      DeepReduced( QRDeep, delta, tol );
+    Output
+    ("  DeepLLL: || b_0 ||_2 = ",FirstNorm(BDeep),
+     (deepPassed ? "" : " (FAILED)"));
+    passed = passed && deepPassed;
+
+    // BKZ starts from the same LLL reduction and can only shorten b_0
+    BKZCtrl<Real> ctrl;
+    ctrl.blocksize = blocksize;
+    ctrl.delta = delta;
+    Matrix<Real> BBKZ( BOrig ), QRBKZ;
+    const Int numTours = BKZ( BBKZ, QRBKZ, ctrl );
+    bool bkzPassed =
+      Unimodular( BOrig, BBKZ ) && LLLDelta( QRBKZ ) >= delta-tol &&
+      FirstNorm(BBKZ) <= FirstNorm(BLLL)*(1+tol);
+
+    // A BKZ-reduced basis has no block containing a vector which violates
+    // the (generalized) Lovasz condition, so a further tour must not
+    // change it
+    Matrix<Real> BAgain( BBKZ ), QRAgain;
+    const Int numToursAgain = BKZ( BAgain, QRAgain, ctrl );
+    BAgain -= BBKZ;
+    bkzPassed = bkzPassed && numToursAgain == 1 && MaxNorm( BAgain ) == 0;
+
+    // When a single block spans the basis, b_0 is a shortest vector
+    if( blocksize >= n )
+        bkzPassed = bkzPassed && FirstNorm(BBKZ) <= FirstNorm(BDeep)*(1+tol);
+    Output
+    ("  BKZ-",blocksize,": || b_0 ||_2 = ",FirstNorm(BBKZ)," after ",
+     numTours," tours",(bkzPassed ? "" : " (FAILED)"));
+    passed = passed && bkzPassed;
+    if( print )
+        Print( BBKZ, "BBKZ" );
+    return passed;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const int commRank = mpi::Rank( mpi::COMM_WORLD );
+
+    try
+    {
+        const Int n = Input("--n","dimension of the lattice",24);
+        const double range = Input("--range","range of the entries",1000.);
+        const Int blocksize = Input("--blocksize","BKZ blocksize",10);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            bool passed = true;
+            Output("Blocksize ",blocksize,":");
+            passed = TestReduction<double>( n, range, blocksize, print );
+            Output("Full blocksize:");
+            passed = TestReduction<double>( n/2, range, n/2, print ) && passed;
+            if( !passed )
+                LogicError("Lattice reduction test failed");
+            Output("PASSED");
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
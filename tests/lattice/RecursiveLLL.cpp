@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// B = BOrig U must hold for an integer matrix U with determinant +-1
+template<typename Real>
+bool Unimodular( const Matrix<Real>& BOrig, const Matrix<Real>& B )
+{
+    Matrix<Real> U( B );
+    LinearSolve( BOrig, U );
+    Round( U );
+    Matrix<Real> E( B );
+    Gemm( NORMAL, NORMAL, Real(-1), BOrig, U, Real(1), E );
+    const Matrix<Real>& UConst = U;
+    const Real det = Determinant( UConst );
+    return MaxNorm( E ) < Real(1)/Real(2) &&
+           Abs(Abs(det)-Real(1)) < Real(1)/Real(1000);
+}
+
+// The product of the diagonal of R is the volume of the lattice
+template<typename Real>
+Real LogVolume( const Matrix<Real>& QR )
+{
+    Real logVol = 0;
+    for( Int j=0; j<QR.Width(); ++j )
+        logVol += Log( Abs(QR.Get(j,j)) );
+    return logVol;
+}
+
+template<typename Real>
+bool TestRecursiveLLL
+( Int m, Int n, Real range, Real delta, Int cutoff, bool print )
+{
+    const Real tol = Pow(Epsilon<Real>(),Real(1)/Real(2));
+
+    Matrix<Real> BOrig;
+    Uniform( BOrig, m, n, Real(0), range );
+    Round( BOrig );
+    if( print )
+        Print( BOrig, "BOrig" );
+
+    Matrix<Real> B( BOrig ), QR;
+    Timer timer;
+    timer.Start();
+    LLL( B, QR, delta );
+    const double runTime = timer.Stop();
+    const Real achieved = LLLDelta( QR );
+    Output
+    ("  LLL:          ",runTime," seconds, delta=",achieved,
+     ", || b_0 ||_2 = ",FrobeniusNorm(B(ALL,IR(0))));
+
+    Matrix<Real> BRec( BOrig ), QRRec;
+    timer.Start();
+    RecursiveLLL( BRec, QRRec, delta, Real(0), cutoff );
+    const double recTime = timer.Stop();
+    const Real recAchieved = LLLDelta( QRRec );
+    Output
+    ("  RecursiveLLL: ",recTime," seconds, delta=",recAchieved,
+     ", || b_0 ||_2 = ",FrobeniusNorm(BRec(ALL,IR(0))));
+
+    // Both must be LLL-reduced (with the same delta) bases of the lattice
+    // spanned by BOrig, and hence of each other's lattice
+    bool passed = achieved >= delta-tol && recAchieved >= delta-tol;
+    if( m == n )
+        passed = passed && Unimodular( BOrig, B ) && Unimodular( B, BRec );
+    const Real logVolDiff = Abs(LogVolume(QRRec)-LogVolume(QR));
+    passed = passed && logVolDiff <= n*tol;
+    if( !passed )
+        Output("  FAILED");
+    return passed;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const int commRank = mpi::Rank( mpi::COMM_WORLD );
+
+    try
+    {
+        const Int n = Input("--n","dimension of the lattice",60);
+        const double range = Input("--range","range of the entries",1000.);
+        const double delta = Input("--delta","delta for LLL",0.99);
+        const Int cutoff = Input("--cutoff","cutoff for the recursion",8);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            Output("Square basis:");
+            bool passed =
+              TestRecursiveLLL<double>( n, n, range, delta, cutoff, print );
+            Output("Tall basis:");
+            passed = TestRecursiveLLL<double>
+              ( 2*n, n, range, delta, cutoff, print ) && passed;
+            if( !passed )
+                LogicError("Recursive LLL test failed");
+            Output("PASSED");
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Form a feasible and bounded direct conic-form problem by choosing a strictly
+// feasible primal point, x > 0, and a strictly feasible dual point, z > 0
+template<typename Real>
+void FeasibleProblem
+( Int m, Int n,
+  DistMatrix<Real>& A, DistMatrix<Real>& b, DistMatrix<Real>& c )
+{
+    const Grid& g = A.Grid();
+    Gaussian( A, m, n );
+    DistMatrix<Real> xFeas(g), y(g), zFeas(g);
+    Uniform( xFeas, n, 1, Real(1), Real(1)/Real(2) );
+    Gaussian( y, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Gemv( NORMAL, Real(1), A, xFeas, Real(0), b );
+    c = zFeas;
+    Gemv( TRANSPOSE, Real(1), A, y, Real(1), c );
+}
+
+// The number of Mehrotra iterations, found as the smallest iteration limit
+// for which the solve succeeds (since minTol is set to targetTol, hitting
+// the limit without converging throws)
+template<class SolveType>
+Int NumIterations( const SolveType& solve, Int maxIts )
+{
+    for( Int its=0; its<=maxIts; ++its )
+    {
+        try
+        {
+            solve( its );
+            return its;
+        }
+        catch( const std::runtime_error& ) { }
+    }
+    RuntimeError("Did not converge within ",maxIts," iterations");
+    return -1;
+}
+
+template<typename Real>
+bool CompareSolves
+( const string& label,
+  const function<Real(Int,const GondzioCtrl<Real>&)>& solve,
+  Int numCorrectors, Int maxIts, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    GondzioCtrl<Real> plainCtrl, gondzioCtrl;
+    plainCtrl.maxCorrectors = 0;
+    // Always attempt every corrector rather than choosing the number from
+    // (noisy) timings
+    gondzioCtrl.maxCorrectors = numCorrectors;
+    gondzioCtrl.adaptive = false;
+
+    Real plainObj=0, gondzioObj=0;
+    const Int plainIts = NumIterations
+      ( [&]( Int its ) { plainObj = solve( its, plainCtrl ); }, maxIts );
+    // With the correctors, the same iteration limit must suffice
+    bool passed = true;
+    try { gondzioObj = solve( plainIts, gondzioCtrl ); }
+    catch( const std::runtime_error& ) { passed = false; }
+
+    const Real objDiff = Abs(gondzioObj-plainObj) / (1+Abs(plainObj));
+    const Real tol = Pow(Epsilon<Real>(),Real(0.4));
+    if( passed && objDiff > tol )
+        passed = false;
+    if( commRank == 0 )
+    {
+        Output
+        ("  ",label,": Mehrotra took ",plainIts," iterations, objective=",
+         plainObj);
+        if( passed )
+            Output
+            ("    with ",numCorrectors," Gondzio correctors: objective=",
+             gondzioObj," (relative difference ",objDiff,")");
+        else
+            Output
+            ("    with ",numCorrectors," Gondzio correctors: FAILED");
+    }
+    return passed;
+}
+
+template<typename Real>
+bool TestLP
+( Int m, Int n, Int numCorrectors, Int maxIts, const Grid& g, bool print )
+{
+    DistMatrix<Real> A(g), b(g), c(g);
+    FeasibleProblem( m, n, A, b, c );
+
+    auto solve = [&]( Int its, const GondzioCtrl<Real>& gondzioCtrl )
+      {
+        lp::direct::Ctrl<Real> ctrl(false);
+        ctrl.mehrotraCtrl.gondzioCtrl = gondzioCtrl;
+        ctrl.mehrotraCtrl.maxIts = its;
+        ctrl.mehrotraCtrl.minTol = ctrl.mehrotraCtrl.targetTol;
+        ctrl.mehrotraCtrl.print = print;
+        DistMatrix<Real> x(g), y(g), z(g);
+        LP( A, b, c, x, y, z, ctrl );
+        return Dot( c, x );
+      };
+    return CompareSolves<Real>( "LP", solve, numCorrectors, maxIts, g.Comm() );
+}
+
+template<typename Real>
+bool TestQP
+( Int m, Int n, Int numCorrectors, Int maxIts, const Grid& g, bool print )
+{
+    DistMatrix<Real> A(g), b(g), c(g);
+    FeasibleProblem( m, n, A, b, c );
+
+    // Form a rank-deficient positive semi-definite Q
+    DistMatrix<Real> G(g), Q(g);
+    Gaussian( G, n/2, n );
+    Zeros( Q, n, n );
+    Herk( LOWER, ADJOINT, Real(1), G, Real(0), Q );
+    MakeHermitian( LOWER, Q );
+
+    auto solve = [&]( Int its, const GondzioCtrl<Real>& gondzioCtrl )
+      {
+        qp::direct::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.gondzioCtrl = gondzioCtrl;
+        ctrl.mehrotraCtrl.maxIts = its;
+        ctrl.mehrotraCtrl.minTol = ctrl.mehrotraCtrl.targetTol;
+        ctrl.mehrotraCtrl.print = print;
+        DistMatrix<Real> x(g), y(g), z(g), Qx(g);
+        QP( Q, A, b, c, x, y, z, ctrl );
+        Zeros( Qx, n, 1 );
+        Gemv( NORMAL, Real(1), Q, x, Real(0), Qx );
+        return Dot( c, x ) + Dot( x, Qx )/Real(2);
+      };
+    return CompareSolves<Real>( "QP", solve, numCorrectors, maxIts, g.Comm() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of A",50);
+        const Int n = Input("--n","width of A",100);
+        const Int numCorrectors =
+          Input("--numCorrectors","number of Gondzio correctors",2);
+        const Int maxIts = Input("--maxIts","maximum number of iterations",60);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        bool passed = TestLP<double>( m, n, numCorrectors, maxIts, g, print );
+        passed = TestQP<double>( m, n, numCorrectors, maxIts, g, print ) &&
+                 passed;
+        if( !passed )
+            LogicError("Gondzio corrector test failed");
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
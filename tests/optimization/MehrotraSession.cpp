@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A = [I, R], where R is random and sparse, so that A has full row rank
+void RandomConstraints( SparseMatrix<double>& A, Int m, Int n, Int numPerRow )
+{
+    Zeros( A, m, n );
+    A.Reserve( m*(numPerRow+1) );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i, 1. );
+        for( Int k=0; k<numPerRow; ++k )
+        {
+            const Int j = m + SampleUniform<Int>(0,n-m);
+            A.QueueUpdate( i, j, SampleBall<double>() );
+        }
+    }
+    A.ProcessQueues();
+}
+
+// Choose b and c such that a random positive x is primal feasible and a
+// random positive z is dual feasible
+void FeasibleData
+( const SparseMatrix<double>& A, Matrix<double>& b, Matrix<double>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<double> xFeas, y, zFeas;
+    Uniform( xFeas, n, 1, 1., 0.5 );
+    Gaussian( y, m, 1 );
+    Uniform( zFeas, n, 1, 1., 0.5 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, 1., A, xFeas, 0., b );
+    c = zFeas;
+    Multiply( TRANSPOSE, 1., A, y, 1., c );
+}
+
+// Check that x is (nearly) primal feasible and that its objective matches
+// the one of a solve from scratch
+bool CheckSolution
+( const string& label, const SparseMatrix<double>& A,
+  const Matrix<double>& b, const Matrix<double>& x,
+  double obj, double coldObj )
+{
+    Matrix<double> r( b );
+    Multiply( NORMAL, -1., A, x, 1., r );
+    const double relResid = FrobeniusNorm( r ) / (1+FrobeniusNorm( b ));
+    const double objDiff = Abs(obj-coldObj) / (1+Abs(coldObj));
+    const double tol = Pow(Epsilon<double>(),0.4);
+    Output
+    ("  ",label,": || b - A x ||_2 / (1 + || b ||_2) = ",relResid,
+     ", relative objective difference = ",objDiff);
+    return relResid <= tol && objDiff <= tol &&
+           pos_orth::NumOutside( x ) == 0;
+}
+
+// Perturbing b and c keeps the sparsity pattern of the KKT system, so the
+// second solve through the session must reuse the same ordering and frontal
+// tree (and the equilibration of A)
+bool CheckReuse
+( const MehrotraSession<double>& session, const ldl::NodeInfo* info,
+  const ldl::Front<double>* front, const vector<Int>& map )
+{
+    const bool reused =
+      session.analyzed && session.equilibrated &&
+      session.info.get() == info && session.front.get() == front &&
+      session.map == map && !session.frontMeta.patternOffsets.empty();
+    Output("  analysis and factorization storage reused: ",reused);
+    return reused;
+}
+
+bool TestSparseLP( Int m, Int n, Int numPerRow, bool print )
+{
+    SparseMatrix<double> A;
+    RandomConstraints( A, m, n, numPerRow );
+    Matrix<double> b, c;
+    FeasibleData( A, b, c );
+
+    lp::direct::Ctrl<double> ctrl(true);
+    ctrl.mehrotraCtrl.print = print;
+    MehrotraSession<double> session;
+    Matrix<double> x, y, z;
+    LP( A, b, c, x, y, z, session, ctrl );
+    const ldl::NodeInfo* info = session.info.get();
+    const ldl::Front<double>* front = session.front.get();
+    const vector<Int> map = session.map;
+
+    // Perturb the problem and warm-start from the previous solution
+    Matrix<double> bNew, cNew;
+    FeasibleData( A, bNew, cNew );
+    b *= 0.9;
+    Axpy( 0.1, bNew, b );
+    c *= 0.9;
+    Axpy( 0.1, cNew, c );
+    LP( A, b, c, x, y, z, session, ctrl );
+    bool passed = CheckReuse( session, info, front, map );
+
+    Matrix<double> xCold, yCold, zCold;
+    LP( A, b, c, xCold, yCold, zCold, ctrl );
+    return CheckSolution
+      ( "LP", A, b, x, Dot(c,x), Dot(c,xCold) ) && passed;
+}
+
+bool TestSparseQP( Int m, Int n, Int numPerRow, bool print )
+{
+    SparseMatrix<double> A, Q;
+    RandomConstraints( A, m, n, numPerRow );
+    Matrix<double> b, c;
+    FeasibleData( A, b, c );
+
+    // A diagonal, positive semi-definite Q
+    Zeros( Q, n, n );
+    Q.Reserve( n );
+    for( Int i=0; i<n; i+=2 )
+        Q.QueueUpdate( i, i, SampleUniform<double>(0.,1.) );
+    Q.ProcessQueues();
+    auto objective = [&]( const Matrix<double>& x )
+      {
+        Matrix<double> Qx;
+        Zeros( Qx, n, 1 );
+        Multiply( NORMAL, 1., Q, x, 0., Qx );
+        return Dot(c,x) + Dot(x,Qx)/2;
+      };
+
+    qp::direct::Ctrl<double> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    MehrotraSession<double> session;
+    Matrix<double> x, y, z;
+    QP( Q, A, b, c, x, y, z, session, ctrl );
+    const ldl::NodeInfo* info = session.info.get();
+    const ldl::Front<double>* front = session.front.get();
+    const vector<Int> map = session.map;
+
+    Matrix<double> bNew, cNew;
+    FeasibleData( A, bNew, cNew );
+    b *= 0.9;
+    Axpy( 0.1, bNew, b );
+    c *= 0.9;
+    Axpy( 0.1, cNew, c );
+    QP( Q, A, b, c, x, y, z, session, ctrl );
+    bool passed = CheckReuse( session, info, front, map );
+
+    Matrix<double> xCold, yCold, zCold;
+    QP( Q, A, b, c, xCold, yCold, zCold, ctrl );
+    return CheckSolution
+      ( "QP", A, b, x, objective(x), objective(xCold) ) && passed;
+}
+
+bool TestDenseLP( Int m, Int n, const Grid& g, bool print )
+{
+    const int commRank = g.Rank();
+    DistMatrix<double> A(g), b(g), c(g), xFeas(g), yFeas(g), zFeas(g);
+    Gaussian( A, m, n );
+    Uniform( xFeas, n, 1, 1., 0.5 );
+    Gaussian( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, 1., 0.5 );
+    Zeros( b, m, 1 );
+    Gemv( NORMAL, 1., A, xFeas, 0., b );
+    c = zFeas;
+    Gemv( TRANSPOSE, 1., A, yFeas, 1., c );
+
+    lp::direct::Ctrl<double> ctrl(false);
+    ctrl.mehrotraCtrl.print = print;
+    DistMehrotraSession<double> session(g);
+    DistMatrix<double> x(g), y(g), z(g);
+    LP( A, b, c, x, y, z, session, ctrl );
+
+    // Scale the feasible points and warm-start from the previous solution
+    xFeas *= 1.1;
+    zFeas *= 0.9;
+    Gemv( NORMAL, 1., A, xFeas, 0., b );
+    c = zFeas;
+    Gemv( TRANSPOSE, 1., A, yFeas, 1., c );
+    LP( A, b, c, x, y, z, session, ctrl );
+    const bool reused = session.equilibrated && session.solved;
+
+    DistMatrix<double> xCold(g), yCold(g), zCold(g), r(b);
+    LP( A, b, c, xCold, yCold, zCold, ctrl );
+    Gemv( NORMAL, -1., A, x, 1., r );
+    const double relResid = FrobeniusNorm( r ) / (1+FrobeniusNorm( b ));
+    const double obj = Dot( c, x );
+    const double coldObj = Dot( c, xCold );
+    const double objDiff = Abs(obj-coldObj) / (1+Abs(coldObj));
+    const Int numOutside = pos_orth::NumOutside( x );
+    const double tol = Pow(Epsilon<double>(),0.4);
+    if( commRank == 0 )
+        Output
+        ("  dense LP: || b - A x ||_2 / (1 + || b ||_2) = ",relResid,
+         ", relative objective difference = ",objDiff,
+         ", session updated: ",reused);
+    return reused && relResid <= tol && objDiff <= tol && numOutside == 0;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of A",100);
+        const Int n = Input("--n","width of A",200);
+        const Int numPerRow =
+          Input("--numPerRow","random entries per row of A",3);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        bool passed = TestDenseLP( m/2, n/2, g, print );
+        if( commRank == 0 )
+        {
+            passed = TestSparseLP( m, n, numPerRow, print ) && passed;
+            passed = TestSparseQP( m, n, numPerRow, print ) && passed;
+        }
+        if( !mpi::AllReduce( Int(passed), mpi::MIN, comm ) )
+            LogicError("Mehrotra session test failed");
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}